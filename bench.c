@@ -0,0 +1,573 @@
+/*
+Benchmarks of the hot dootstr functions against plain libc code doing the same job.
+Build and run both character widths with "make bench", results go to bench_output.txt.
+Usage: bench [max bytes] [function filter]
+Every line of the output is CSV: width,function,impl,bytes,reps,ns_per_op,mb_per_s
+*/
+#include <stdio.h>
+#include <time.h>
+#include <wctype.h>
+
+#include "dootstr.c"
+
+#ifdef DOOTSTR_USE_WCHAR
+#define L_(s) L##s
+#define B_STRSTR wcsstr
+#define B_TOUPPER towupper
+#define B_TOLOWER towlower
+#define B_ISALPHA iswalpha
+#define B_ISDIGIT iswdigit
+#define B_ISSPACE iswspace
+#define B_ISLOWER iswlower
+#define B_SNPRINTF swprintf
+#define B_STRTOD wcstod
+#define WIDTH "wchar"
+#else
+#define L_(s) s
+#define B_STRSTR strstr
+#define B_TOUPPER toupper
+#define B_TOLOWER tolower
+#define B_ISALPHA isalpha
+#define B_ISDIGIT isdigit
+#define B_ISSPACE isspace
+#define B_ISLOWER islower
+#define B_SNPRINTF snprintf
+#define B_STRTOD strtod
+#define WIDTH "char"
+#endif
+
+#define BENCH_MIN 8 // Smallest input in bytes
+#define BENCH_STEP 8 // Each size is this many times the previous one
+#define BENCH_WORK (64 << 20) // Bytes processed per measurement, small inputs are repeated to reach it
+#define BENCH_MAXREPS 1000000
+
+/*@brief State shared by one benchmark size: the input and the buffers both implementations work on.*/
+typedef struct bench
+{
+    size_t n; /*Input length in characters*/
+    str_t *src; /*The original input*/
+    str_t *work; /*The dootstr copy that gets modified*/
+    dchar_t *buf; /*The libc copy that gets modified, 2 * n + 64 characters*/
+    volatile size_t sink; /*Results are added here so nothing is optimized away*/
+} bench_t;
+
+/*@brief One benchmarked operation. fill prepares src, lib and base run the operation once.*/
+typedef struct benchfn
+{
+    const char *name; /*Name in the output*/
+    void (*fill)(dchar_t *p, size_t n); /*Fills the input*/
+    void (*lib)(bench_t *pb); /*The dootstr version*/
+    void (*base)(bench_t *pb); /*The libc version*/
+} benchfn_t;
+
+double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+#pragma region INPUTS
+/*Letters 'a'-'p' and spaces, with "xy" every 64 characters. 'q' and 'z' never occur.*/
+void fill_text(dchar_t *p, size_t n)
+{
+    uint32_t x = 12345;
+    for (size_t i = 0; i < n; i++)
+    {
+        x = x * 1103515245 + 12345;
+        p[i] = ((x >> 16) % 8 == 0) ? ' ' : 'a' + (x >> 20) % 16;
+        if (i % 64 == 62 && i + 1 < n)
+        {
+            p[i] = 'x';
+            p[++i] = 'y';
+        }
+    }
+}
+
+void fill_lower(dchar_t *p, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        p[i] = 'a' + i % 26;
+    }
+}
+
+void fill_digits(dchar_t *p, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        p[i] = '0' + i % 10;
+    }
+}
+
+void fill_spaces(dchar_t *p, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        p[i] = (i % 3) ? ' ' : '\t';
+    }
+}
+
+/*Decimal numbers like "-1234.567e-3" separated by single spaces.*/
+void fill_numbers(dchar_t *p, size_t n)
+{
+    uint32_t x = 12345;
+    char num[32];
+    size_t i = 0;
+    while (i < n)
+    {
+        x = x * 1103515245 + 12345;
+        int len = snprintf(num, sizeof(num), "%s%u.%03ue%d ", (x & 1) ? "-" : "", (x >> 8) % 100000, (x >> 4) % 1000, (int)(x >> 28) - 8);
+        for (int k = 0; k < len && i < n; k++)
+        {
+            p[i++] = num[k];
+        }
+    }
+}
+#pragma endregion
+
+/*@brief Puts the original input back into both working copies.*/
+void reset(bench_t *pb)
+{
+    memcpy(pb->work->pstr, pb->src->pstr, (pb->n + 1) * sizeof(dchar_t));
+    pb->work->strlen = pb->n;
+    memcpy(pb->buf, pb->src->pstr, (pb->n + 1) * sizeof(dchar_t));
+}
+
+#pragma region OPERATIONS
+/*Appending: builds the input 8 characters at a time into an empty string.*/
+void lib_append(bench_t *pb)
+{
+    str_t *s = str_new(0);
+    dchar_t piece[9];
+    for (size_t i = 0; i < pb->n; i += 8)
+    {
+        size_t k = (pb->n - i < 8) ? pb->n - i : 8;
+        memcpy(piece, pb->src->pstr + i, k * sizeof(dchar_t));
+        piece[k] = '\0';
+        str_append_c(s, piece);
+    }
+    pb->sink += s->strlen;
+    str_free(&s);
+}
+
+void base_append(bench_t *pb)
+{
+    size_t len = 0, cap = 16;
+    dchar_t *s = malloc(cap * sizeof(dchar_t));
+    for (size_t i = 0; i < pb->n; i += 8)
+    {
+        size_t k = (pb->n - i < 8) ? pb->n - i : 8;
+        if (len + k + 1 > cap)
+        {
+            cap *= 2;
+            s = realloc(s, cap * sizeof(dchar_t));
+        }
+        memcpy(s + len, pb->src->pstr + i, k * sizeof(dchar_t));
+        len += k;
+        s[len] = '\0';
+    }
+    pb->sink += len;
+    free(s);
+}
+
+/*Inserting 8 characters in the middle.*/
+void lib_insert(bench_t *pb)
+{
+    str_insert_c(pb->work, L_("INSERTED"), pb->work->strlen / 2);
+    pb->work->strlen -= 8; // Drop the tail again, the length stays n
+    pb->work->pstr[pb->work->strlen] = '\0';
+}
+
+void base_insert(bench_t *pb)
+{
+    size_t mid = pb->n / 2;
+    memmove(pb->buf + mid + 8, pb->buf + mid, (pb->n - mid + 1) * sizeof(dchar_t));
+    memcpy(pb->buf + mid, L_("INSERTED"), 8 * sizeof(dchar_t));
+    pb->buf[pb->n] = '\0';
+}
+
+/*Replacing "xy" with "xy", which does all the work but keeps the input the same.*/
+void lib_replace(bench_t *pb)
+{
+    pb->sink += str_replace(pb->work, L_("xy"), L_("xy"));
+}
+
+void base_replace(bench_t *pb)
+{
+    dchar_t *out = malloc((pb->n + 1) * sizeof(dchar_t));
+    const dchar_t *p = pb->buf, *q;
+    dchar_t *o = out;
+    while ((q = B_STRSTR(p, L_("xy"))) != NULL)
+    {
+        memcpy(o, p, (q - p) * sizeof(dchar_t));
+        o += q - p;
+        memcpy(o, L_("xy"), 2 * sizeof(dchar_t));
+        o += 2;
+        p = q + 2;
+        pb->sink++;
+    }
+    memcpy(o, p, (pb->buf + pb->n - p + 1) * sizeof(dchar_t));
+    memcpy(pb->buf, out, (pb->n + 1) * sizeof(dchar_t));
+    free(out);
+}
+
+/*Removing every "xy", including putting the input back.*/
+void lib_remove(bench_t *pb)
+{
+    reset(pb);
+    pb->sink += str_remove(pb->work, L_("xy"));
+}
+
+void base_remove(bench_t *pb)
+{
+    reset(pb);
+    dchar_t *o = pb->buf;
+    const dchar_t *p = pb->buf, *q;
+    while ((q = B_STRSTR(p, L_("xy"))) != NULL)
+    {
+        memmove(o, p, (q - p) * sizeof(dchar_t));
+        o += q - p;
+        p = q + 2;
+        pb->sink++;
+    }
+    memmove(o, p, (pb->buf + pb->n - p + 1) * sizeof(dchar_t));
+}
+
+/*Counting "xy".*/
+void lib_count(bench_t *pb)
+{
+    pb->sink += str_count(pb->src, L_("xy"));
+}
+
+void base_count(bench_t *pb)
+{
+    const dchar_t *p = pb->src->pstr;
+    while ((p = B_STRSTR(p, L_("xy"))) != NULL)
+    {
+        pb->sink++;
+        p++;
+    }
+}
+
+/*Searching for "qz", which never occurs.*/
+void lib_index(bench_t *pb)
+{
+    pb->sink += str_index(pb->src, L_("qz"));
+}
+
+void base_index(bench_t *pb)
+{
+    pb->sink += (size_t)B_STRSTR(pb->src->pstr, L_("qz"));
+}
+
+void lib_rindex(bench_t *pb)
+{
+    pb->sink += str_rindex(pb->src, L_("qz"));
+}
+
+void base_rindex(bench_t *pb)
+{
+    for (size_t i = pb->n; i-- > 1; )
+    {
+        if (pb->src->pstr[i - 1] == 'q' && pb->src->pstr[i] == 'z')
+        {
+            pb->sink += i;
+            return;
+        }
+    }
+}
+
+/*The str_is*() checks on inputs for which they're true, so the whole input is read.*/
+void lib_isalpha(bench_t *pb)
+{
+    pb->sink += str_isalpha(pb->src);
+}
+
+void lib_isdigit(bench_t *pb)
+{
+    pb->sink += str_isdigit(pb->src);
+}
+
+void lib_isspace(bench_t *pb)
+{
+    pb->sink += str_isspace(pb->src);
+}
+
+void lib_islower(bench_t *pb)
+{
+    pb->sink += str_islower(pb->src);
+}
+
+#define BASE_IS(name, fn) \
+void name(bench_t *pb) \
+{ \
+    const dchar_t *p = pb->src->pstr; \
+    while (*p && fn(*p)) \
+    { \
+        ++p; \
+    } \
+    pb->sink += !*p; \
+}
+BASE_IS(base_isalpha, B_ISALPHA)
+BASE_IS(base_isdigit, B_ISDIGIT)
+BASE_IS(base_isspace, B_ISSPACE)
+BASE_IS(base_islower, B_ISLOWER)
+
+/*Case conversion, the input is lower case text.*/
+void lib_upper(bench_t *pb)
+{
+    reset(pb);
+    str_upper(pb->work);
+}
+
+void base_upper(bench_t *pb)
+{
+    reset(pb);
+    for (size_t i = 0; i < pb->n; i++)
+    {
+        pb->buf[i] = B_TOUPPER(pb->buf[i]);
+    }
+}
+
+void lib_lower(bench_t *pb)
+{
+    reset(pb);
+    str_lower(pb->work);
+}
+
+void base_lower(bench_t *pb)
+{
+    reset(pb);
+    for (size_t i = 0; i < pb->n; i++)
+    {
+        pb->buf[i] = B_TOLOWER(pb->buf[i]);
+    }
+}
+
+/*Reversing the input in place, every call undoes the one before.*/
+void lib_reverse(bench_t *pb)
+{
+    str_reverse(pb->work);
+}
+
+void base_reverse(bench_t *pb)
+{
+    for (size_t i = 0, j = pb->n; j - i >= 2; i++)
+    {
+        dchar_t c = pb->buf[i];
+        pb->buf[i] = pb->buf[--j];
+        pb->buf[j] = c;
+    }
+}
+
+/*Taking every second character into a string that already has room for it.*/
+void lib_stride(bench_t *pb)
+{
+    str_assignSlice(pb->work, pb->src->pstr, 0, STR_END, 2);
+    pb->sink += pb->work->strlen;
+}
+
+void base_stride(bench_t *pb)
+{
+    size_t k = 0;
+    for (size_t i = 0; i < pb->n; i += 2)
+    {
+        pb->buf[k++] = pb->src->pstr[i];
+    }
+    pb->buf[k] = '\0';
+    pb->sink += k;
+}
+
+/*Formatting: builds about n characters out of integer, hex and floating point conversions.*/
+void lib_format(bench_t *pb)
+{
+    str_t *s = pb->work;
+    s->strlen = 0;
+    for (size_t i = 0; s->strlen < pb->n; i++)
+    {
+        str_format(s, L_("%zu %x %.3f|"), i, (unsigned)i, i * 0.25);
+    }
+    pb->sink += s->strlen;
+}
+
+void base_format(bench_t *pb)
+{
+    size_t len = 0;
+    for (size_t i = 0; len < pb->n; i++)
+    {
+        len += B_SNPRINTF(pb->buf + len, 2 * pb->n + 64 - len, L_("%zu %x %.3f|"), i, (unsigned)i, i * 0.25);
+    }
+    pb->sink += len;
+}
+
+/*Number conversion: writes about n characters of doubles and integers. snprintf() has no shortest round-trip conversion, %.17g is the
+closest one that reads back to the same double.*/
+void lib_numbers(bench_t *pb)
+{
+    str_t *s = pb->work;
+    s->strlen = 0;
+    for (size_t i = 0; s->strlen < pb->n; i++)
+    {
+        str_append_double(s, i * 0.37);
+        str_append_c(s, L_(" "));
+        str_append_i64(s, -(int64_t)i * 977);
+        str_append_c(s, L_(" "));
+    }
+    pb->sink += s->strlen;
+}
+
+void base_numbers(bench_t *pb)
+{
+    size_t len = 0;
+    for (size_t i = 0; len < pb->n; i++)
+    {
+        len += B_SNPRINTF(pb->buf + len, 2 * pb->n + 64 - len, L_("%.17g %lld "), i * 0.37, -(long long)i * 977);
+    }
+    pb->sink += len;
+}
+
+/*Parsing: reads every number of the input as a double.*/
+void lib_parse(bench_t *pb)
+{
+    double d, sum = 0;
+    size_t pos = 0, end;
+    while (pos < pb->n && str_tod_at(pb->src, pos, &d, &end) == STR_OK)
+    {
+        sum += d;
+        pos = end + 1;
+    }
+    pb->sink += (size_t)(sum != 0) + pos;
+}
+
+void base_parse(bench_t *pb)
+{
+    double sum = 0;
+    const dchar_t *p = pb->src->pstr;
+    dchar_t *stop;
+    while (*p)
+    {
+        double d = B_STRTOD(p, &stop);
+        if (stop == p)
+        {
+            break;
+        }
+        sum += d;
+        p = *stop ? stop + 1 : stop;
+    }
+    pb->sink += (size_t)(sum != 0) + (p - pb->src->pstr);
+}
+
+/*Splitting: copies the words between the spaces of the input into separate strings.*/
+void lib_split(bench_t *pb)
+{
+    sarr_t *parts = str_split(pb->src, L_(" "));
+    pb->sink += parts->size;
+    str_afree(&parts);
+}
+
+void base_split(bench_t *pb)
+{
+    dchar_t **parts = malloc((pb->n / 2 + 1) * sizeof(dchar_t*));
+    size_t count = 0;
+    const dchar_t *p = pb->src->pstr, *end = p + pb->n;
+    while (p < end)
+    {
+        const dchar_t *next = B_STRSTR(p, L_(" "));
+        next = next ? next : end;
+        if (next > p)
+        {
+            parts[count] = malloc((next - p + 1) * sizeof(dchar_t));
+            memcpy(parts[count], p, (next - p) * sizeof(dchar_t));
+            parts[count++][next - p] = '\0';
+        }
+        p = (next == end) ? end : next + 1;
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        free(parts[i]);
+    }
+    free(parts);
+    pb->sink += count;
+}
+#pragma endregion
+
+benchfn_t benches[] = {
+    { "append", fill_text, lib_append, base_append },
+    { "insert", fill_text, lib_insert, base_insert },
+    { "replace", fill_text, lib_replace, base_replace },
+    { "remove", fill_text, lib_remove, base_remove },
+    { "count", fill_text, lib_count, base_count },
+    { "index", fill_text, lib_index, base_index },
+    { "rindex", fill_text, lib_rindex, base_rindex },
+    { "isalpha", fill_lower, lib_isalpha, base_isalpha },
+    { "isdigit", fill_digits, lib_isdigit, base_isdigit },
+    { "isspace", fill_spaces, lib_isspace, base_isspace },
+    { "islower", fill_lower, lib_islower, base_islower },
+    { "upper", fill_text, lib_upper, base_upper },
+    { "lower", fill_text, lib_lower, base_lower },
+    { "reverse", fill_text, lib_reverse, base_reverse },
+    { "stride", fill_text, lib_stride, base_stride },
+    { "format", fill_text, lib_format, base_format },
+    { "numbers", fill_text, lib_numbers, base_numbers },
+    { "parse", fill_numbers, lib_parse, base_parse },
+    { "split", fill_text, lib_split, base_split },
+};
+
+/*@brief Runs one implementation reps times after a warm up run and prints its result line.*/
+void measure(bench_t *pb, const char *name, const char *impl, void (*fn)(bench_t*), size_t reps)
+{
+    reset(pb);
+    fn(pb);
+    double start = now();
+    for (size_t r = 0; r < reps; r++)
+    {
+        fn(pb);
+    }
+    double ns = (now() - start) * 1e9 / reps;
+    size_t bytes = pb->n * sizeof(dchar_t);
+    printf("%s,%s,%s,%zu,%zu,%.1f,%.1f\n", WIDTH, name, impl, bytes, reps, ns, (ns > 0) ? bytes / ns * 1e3 : 0.0);
+    fflush(stdout);
+}
+
+int main(int argc, char **argv)
+{
+    size_t maxbytes = (argc > 1) ? strtoull(argv[1], NULL, 0) : ((size_t)1 << 27);
+    const char *filter = (argc > 2) ? argv[2] : NULL;
+    setlocale(LC_ALL, "C.UTF-8");
+    printf("width,function,impl,bytes,reps,ns_per_op,mb_per_s\n");
+    for (size_t bytes = BENCH_MIN; bytes <= maxbytes; bytes *= BENCH_STEP)
+    {
+        bench_t b = { 0 };
+        b.n = bytes / sizeof(dchar_t);
+        if (b.n < 2)
+        {
+            continue;
+        }
+        b.src = str_new(b.n + 1);
+        b.work = str_new(b.n + 1);
+        b.buf = malloc((2 * b.n + 64) * sizeof(dchar_t));
+        if (!b.buf)
+        {
+            STRERROR("malloc");
+        }
+        size_t reps = BENCH_WORK / bytes;
+        reps = (reps < 1) ? 1 : (reps > BENCH_MAXREPS) ? BENCH_MAXREPS : reps;
+        for (size_t i = 0; i < sizeof(benches) / sizeof(benches[0]); i++)
+        {
+            if (filter && !strstr(benches[i].name, filter))
+            {
+                continue;
+            }
+            benches[i].fill(b.src->pstr, b.n);
+            b.src->pstr[b.n] = '\0';
+            b.src->strlen = b.n;
+            measure(&b, benches[i].name, "dootstr", benches[i].lib, reps);
+            measure(&b, benches[i].name, "libc", benches[i].base, reps);
+        }
+        str_free(&b.src);
+        str_free(&b.work);
+        free(b.buf);
+    }
+    return EXIT_SUCCESS;
+}
@@ -8,24 +8,46 @@ It works on my machine.
 #ifndef __DOOTSTR_INC
 #define __DOOTSTR_INC
 
+#include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 #include <locale.h>
 #include <wchar.h>
+#include <wctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <math.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifndef DOOTSTR_NO_THREADS
+#include <pthread.h>
+#endif
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <tmmintrin.h> // Only used by functions compiled for SSSE3 with a target attribute, after checking the CPU at runtime
+#endif
+
+#include "dootstr_tables.h"
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024 // limits.h only defines it with _XOPEN_SOURCE, 1024 is the Linux limit
+#endif
 
 #define STRFAIL(message) (fprintf(stderr, "STRFAIL: %s:%d\n%s\n", __FILE__, __LINE__, message), exit(EXIT_FAILURE))
 // For my own functions
 #define STRERROR(source ) (perror(source), fprintf(stderr, "STRFAIL: %s:%d\n", __FILE__, __LINE__), exit(EXIT_FAILURE))
 // For standard functions
 
-#ifdef DOOTSTR_DEBUG
-#define STR_LOG_ALLOC(oldcap, newcap) (printf("Reallocating from: %ld to %ld\n", oldcap, newcap))
-#else
-#define STR_LOG_ALLOC(oldcap, newcap) 
-#endif
-
 #ifdef DOOTSTR_SLICE_ERRORS
 #define STR_SLICE_ERROR(message) (fprintf(stderr, "STRFAIL: %s:%d\n%s\n", __FILE__, __LINE__, message), exit(EXIT_FAILURE))
 #else
@@ -60,6 +82,19 @@ typedef char dchar_t;
 #define STR_EMPTY ""
 #endif
 
+#define STR_CPINDEX_STEP 64 // Code points between two entries of a code point index
+
+/** @struct strcpindex_t
+ *  @brief Sparse index of the code points of a UTF-8 string, see str_u8index(). It's filled lazily and cut back to the unchanged prefix
+ *  whenever the string is modified.
+ */
+typedef struct strcpindex
+{
+    size_t *offsets; /*Byte offset of every STR_CPINDEX_STEP-th code point, offsets[0] is always 0*/
+    size_t count; /*Number of valid offsets, at least 1*/
+    size_t capacity; /*Size of the offsets array*/
+} strcpindex_t;
+
 /** @struct str_t
  *  @brief This structure wraps a raw C style char pointer and provides a dynamic string implementation.
  *  Structures of this type are to be passed to str_* functions. The str_t struct always allocates it's own memory and
@@ -71,1764 +106,8920 @@ typedef struct str
     dchar_t *pstr; /*Null terminated pointer to the char data*/
     size_t strlen; /*Number of stored readable characters*/
     size_t capacity; /*Current size of the allocated memory block*/
-
+    strcpindex_t *cpindex; /*Code point index, only used by the str_u8* functions and null until str_u8index() is called*/
+    size_t mapped; /*Length of the read-only file mapping pstr points into (capacity is 0 then), see str_mapfile(). 0 for ordinary strings*/
+    size_t head; /*Number of characters consumed from the front of the block (or mapping), pstr points this far into it. See str_consume()*/
 } str_t;
 
+/** @struct str_view_t
+ *  @brief A read-only view of a range of characters owned by someone else (a str_t, a c-style string or any other buffer).
+ *  The characters are not necessarily null terminated, always use the strlen field. The view doesn't own any memory.
+ */
+typedef struct strview
+{
+    const dchar_t *pstr; /*Pointer to the first viewed character*/
+    size_t strlen; /*Number of viewed characters*/
+} str_view_t;
 
+#ifndef __DOOTSTR_ERR_INC
+#define __DOOTSTR_ERR_INC // Shared with the wide instance of dootwstr.c
+/*@brief Error codes returned by the functions that report errors to the caller instead of failing.*/
+typedef enum strerr
+{
+    STR_OK = 0, /*Success*/
+    STR_ERR_NULL, /*A required pointer was null*/
+    STR_ERR_EMPTY, /*There was nothing to parse*/
+    STR_ERR_SYNTAX, /*The input is malformed*/
+    STR_ERR_RANGE, /*The value doesn't fit in the result type*/
+    STR_ERR_IO, /*Reading a file failed, errno says why*/
+    STR_ERR_FORMAT, /*The file isn't in the expected format*/
+    STR_ERR_CHECKSUM, /*The file's checksum doesn't match its contents*/
+    STR_ERR_INDEX, /*A position or length goes outside the string*/
+    STR_ERR_OVERLAP, /*Two edits of a str_edits_t change the same characters*/
+} str_err_t;
+#endif
 
-#pragma region ALLOCATION
+#pragma region STATS
 /*
-@brief Reallocates the memory block of the str_t, copying the old contents. If the new capacity is to small to contain the old contents,
-some data will be lost, however the null terminator will always be inserted.
+Allocation statistics. Compile with DOOTSTR_STATS to count the character blocks allocated, resized and freed by the library, the bytes
+allocated and copied because of them and the biggest capacity reached, in total, per size and per function. The counters are updated
+with relaxed atomic adds, so they're cheap and safe to use from several threads. Without DOOTSTR_STATS the STR_STAT_* macros are empty
+and str_stats() reports zeros.
+Memory is counted under the function that asked for it: str_realloc(), __str_reserve() and __str_appendn() pass their caller's name on.
 */
-void str_realloc(str_t *pstr, size_t newcap)
+#define STR_STATS_BUCKETS 48 // Size classes of the histogram, bucket i counts blocks of 2^i to 2^(i+1) - 1 bytes
+#define STR_STATS_FUNCS 128 // Most functions tracked separately, the rest are counted under "other"
+
+/** @struct str_fnstats_t
+ *  @brief Statistics of the allocations made by one function.
+ */
+typedef struct strfnstats
 {
-    (void)STR_EXPR_TESTOVERFLOW(newcap / 2);
-    STR_LOG_ALLOC(pstr->capacity, newcap);
-    if (newcap == 0)
+    const char *name; /*Name of the function*/
+    uint64_t allocs; /*New blocks*/
+    uint64_t reallocs; /*Blocks resized or replaced*/
+    uint64_t bytes_allocated; /*Bytes of the new and resized blocks*/
+    uint64_t bytes_copied; /*Bytes of characters copied to new blocks*/
+} str_fnstats_t;
+
+/** @struct str_stats_t
+ *  @brief Snapshot of the allocation statistics, filled by str_stats().
+ */
+typedef struct strstats
+{
+    uint64_t allocs; /*New blocks, including the first block of a string made by str_new(0) and the heap copy a mapped string gets on its first change*/
+    uint64_t reallocs; /*Blocks resized or replaced, the replaced block isn't counted in frees*/
+    uint64_t frees; /*Blocks given back by str_free() and str_destroy(), allocs - frees is the number of live blocks*/
+    uint64_t bytes_allocated; /*Bytes of the new and resized blocks*/
+    uint64_t bytes_copied; /*Bytes of characters copied to new blocks*/
+    uint64_t peak_capacity; /*Biggest block in bytes*/
+    uint64_t sizes[STR_STATS_BUCKETS]; /*Number of new and resized blocks per size, see STR_STATS_BUCKETS*/
+    size_t nfuncs; /*Number of entries in funcs*/
+    str_fnstats_t funcs[STR_STATS_FUNCS + 1]; /*Per function statistics, in no particular order*/
+} str_stats_t;
+
+#ifdef DOOTSTR_STATS
+#define STR_CALLER __func__
+#define STR_STAT_ALLOC(caller, cap) __str_statrecord((caller), 0, (cap) * sizeof(dchar_t), 0)
+#define STR_STAT_REALLOC(caller, old, cap, copied) __str_statrecord((caller), (old) ? 1 : 0, (cap) * sizeof(dchar_t), (copied) * sizeof(dchar_t)) // A new block if there was no old one
+#define STR_STAT_COPY(caller, copied) __str_statrecord((caller), 2, 0, (copied) * sizeof(dchar_t))
+#define STR_STAT_FREE() __atomic_fetch_add(&__str_stats.frees, 1, __ATOMIC_RELAXED)
+
+str_stats_t __str_stats;
+
+/*@brief Internal function that returns the statistics entry of a function, adding it the first time. Names are compared by address,
+which is enough for __func__.*/
+str_fnstats_t *__str_statfn(const char *caller)
+{
+    size_t h = ((uintptr_t)caller >> 3) % STR_STATS_FUNCS;
+    for (size_t i = 0; i < STR_STATS_FUNCS; i++, h = (h + 1) % STR_STATS_FUNCS)
     {
-        STRFAIL("str_realloc: Capacity of 0 is not allowed.");
+        const char *name = __atomic_load_n(&__str_stats.funcs[h].name, __ATOMIC_ACQUIRE);
+        if (name == caller)
+        {
+            return __str_stats.funcs + h;
+        }
+        if (!name)
+        {
+            const char *expected = NULL;
+            if (__atomic_compare_exchange_n(&__str_stats.funcs[h].name, &expected, caller, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ||
+                expected == caller)
+            {
+                return __str_stats.funcs + h;
+            }
+        }
     }
-    if (!pstr)
+    __str_stats.funcs[STR_STATS_FUNCS].name = "other";
+    return __str_stats.funcs + STR_STATS_FUNCS;
+}
+
+/*@brief Internal function that counts a new (kind 0) or resized (kind 1) block of bytes bytes, or just a copy (kind 2).*/
+void __str_statrecord(const char *caller, int kind, size_t bytes, size_t copied)
+{
+    str_fnstats_t *pf = __str_statfn(caller ? caller : "unknown");
+    if (kind < 2)
+    {
+        __atomic_fetch_add(kind ? &__str_stats.reallocs : &__str_stats.allocs, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(kind ? &pf->reallocs : &pf->allocs, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&__str_stats.bytes_allocated, bytes, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&pf->bytes_allocated, bytes, __ATOMIC_RELAXED);
+        int bucket = 0;
+        while (bucket < STR_STATS_BUCKETS - 1 && (bytes >> (bucket + 1)) != 0)
+        {
+            bucket++;
+        }
+        __atomic_fetch_add(&__str_stats.sizes[bucket], 1, __ATOMIC_RELAXED);
+        uint64_t peak = __atomic_load_n(&__str_stats.peak_capacity, __ATOMIC_RELAXED);
+        while (bytes > peak && !__atomic_compare_exchange_n(&__str_stats.peak_capacity, &peak, bytes, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {
+        }
+    }
+    if (copied)
     {
-        STRFAIL("str_realloc: The address of str_t pointer was null.");
+        __atomic_fetch_add(&__str_stats.bytes_copied, copied, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&pf->bytes_copied, copied, __ATOMIC_RELAXED);
     }
-    pstr->pstr = (dchar_t *)realloc(pstr->pstr, newcap * sizeof(dchar_t));
-    if (!pstr->pstr)
+}
+#else
+#define STR_CALLER NULL
+#define STR_STAT_ALLOC(caller, cap)
+#define STR_STAT_REALLOC(caller, old, cap, copied)
+#define STR_STAT_COPY(caller, copied)
+#define STR_STAT_FREE()
+#endif
+
+/*@brief Fills *out with a snapshot of the allocation statistics. All zeros unless compiled with DOOTSTR_STATS.*/
+void str_stats(str_stats_t *out)
+{
+    if (!out)
     {
-        STRERROR("realloc");
+        STRFAIL("str_stats: The address of a str_stats_t was null.");
     }
-    pstr->capacity = newcap;
-    if (pstr->capacity < pstr->strlen + 1) // Need to insert new null terminator
+    memset(out, 0, sizeof(str_stats_t));
+    #ifdef DOOTSTR_STATS
+    out->allocs = __atomic_load_n(&__str_stats.allocs, __ATOMIC_RELAXED);
+    out->reallocs = __atomic_load_n(&__str_stats.reallocs, __ATOMIC_RELAXED);
+    out->frees = __atomic_load_n(&__str_stats.frees, __ATOMIC_RELAXED);
+    out->bytes_allocated = __atomic_load_n(&__str_stats.bytes_allocated, __ATOMIC_RELAXED);
+    out->bytes_copied = __atomic_load_n(&__str_stats.bytes_copied, __ATOMIC_RELAXED);
+    out->peak_capacity = __atomic_load_n(&__str_stats.peak_capacity, __ATOMIC_RELAXED);
+    for (int i = 0; i < STR_STATS_BUCKETS; i++)
     {
-        pstr->pstr[pstr->capacity - 1] = '\0';
-        pstr->strlen = pstr->capacity - 1;
+        out->sizes[i] = __atomic_load_n(&__str_stats.sizes[i], __ATOMIC_RELAXED);
     }
+    for (size_t i = 0; i <= STR_STATS_FUNCS; i++)
+    {
+        str_fnstats_t *pf = __str_stats.funcs + i;
+        const char *name = __atomic_load_n(&pf->name, __ATOMIC_ACQUIRE);
+        if (!name)
+        {
+            continue;
+        }
+        str_fnstats_t *po = out->funcs + out->nfuncs++;
+        po->name = name;
+        po->allocs = __atomic_load_n(&pf->allocs, __ATOMIC_RELAXED);
+        po->reallocs = __atomic_load_n(&pf->reallocs, __ATOMIC_RELAXED);
+        po->bytes_allocated = __atomic_load_n(&pf->bytes_allocated, __ATOMIC_RELAXED);
+        po->bytes_copied = __atomic_load_n(&pf->bytes_copied, __ATOMIC_RELAXED);
+    }
+    #endif
 }
 
-/*@brief Returns a pointer to a string initialized with a c-style string literal.*/
-str_t *str_newfrom(const dchar_t *cstring)
+/*@brief Sets all allocation statistics back to zero. Allocations made by other threads at the same time may be lost.*/
+void str_statsreset(void)
 {
-    str_t *pstr = (str_t*)malloc(sizeof(str_t));
-    if (!pstr)
+    #ifdef DOOTSTR_STATS
+    uint64_t *p = &__str_stats.allocs, *end = __str_stats.sizes + STR_STATS_BUCKETS;
+    for (; p < end; p++)
     {
-        STRERROR("malloc");
+        __atomic_store_n(p, 0, __ATOMIC_RELAXED);
     }
-    pstr->strlen = _strlen(cstring);
-    (void)STR_EXPR_TESTOVERFLOW((pstr->strlen + 1) / 2);
-    pstr->pstr = _strdup(cstring);
-    if (!pstr->pstr)
+    for (size_t i = 0; i <= STR_STATS_FUNCS; i++)
     {
-        #ifdef DOOTSTR_USE_WCHAR
-        STRERROR("wcsdup");
-        #else
-        STRERROR("strdup");
-        #endif
-    }  
-    pstr->capacity = pstr->strlen + 1;
-    return pstr;
+        __atomic_store_n(&__str_stats.funcs[i].allocs, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&__str_stats.funcs[i].reallocs, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&__str_stats.funcs[i].bytes_allocated, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&__str_stats.funcs[i].bytes_copied, 0, __ATOMIC_RELAXED);
+    }
+    #endif
 }
 
-/*@brief Returns a pointer to a newly initialized empty string with a memory block of a given capacity.*/
-str_t *str_new(size_t capacity)
+/*@brief Prints the allocation statistics in a human readable form, functions without allocations are left out.*/
+void str_statsprint(FILE *f)
 {
-    str_t *pstr = (str_t*)malloc(sizeof(str_t));
-    if (!pstr)
+    if (!f)
+    {
+        STRFAIL("str_statsprint: The FILE pointer was null.");
+    }
+    str_stats_t *ps = (str_stats_t*)malloc(sizeof(str_stats_t));
+    if (!ps)
     {
         STRERROR("malloc");
     }
-    pstr->strlen = 0;
-    pstr->pstr = NULL;
-    pstr->capacity = capacity;
-    if (pstr->capacity != 0)
+    str_stats(ps);
+    fprintf(f, "allocs %llu, reallocs %llu, frees %llu, bytes allocated %llu, bytes copied %llu, peak capacity %llu\n",
+        (unsigned long long)ps->allocs, (unsigned long long)ps->reallocs, (unsigned long long)ps->frees,
+        (unsigned long long)ps->bytes_allocated, (unsigned long long)ps->bytes_copied, (unsigned long long)ps->peak_capacity);
+    for (int i = 0; i < STR_STATS_BUCKETS; i++)
     {
-        (void)STR_EXPR_TESTOVERFLOW(capacity / 2);
-        pstr->pstr = (dchar_t *)malloc(sizeof(dchar_t) * pstr->capacity);
-        if (!pstr->pstr)
+        if (ps->sizes[i])
         {
-            STRERROR("malloc");
+            fprintf(f, "  %llu+ bytes: %llu\n", 1ULL << i, (unsigned long long)ps->sizes[i]);
         }
-        *pstr->pstr = '\0';
     }
-    return pstr;
+    for (size_t i = 0; i < ps->nfuncs; i++)
+    {
+        str_fnstats_t *pf = ps->funcs + i;
+        if (pf->allocs || pf->reallocs || pf->bytes_copied)
+        {
+            fprintf(f, "  %s: allocs %llu, reallocs %llu, bytes allocated %llu, bytes copied %llu\n", pf->name,
+                (unsigned long long)pf->allocs, (unsigned long long)pf->reallocs, (unsigned long long)pf->bytes_allocated,
+                (unsigned long long)pf->bytes_copied);
+        }
+    }
+    free(ps);
 }
+#pragma endregion
 
-/*@brief Internal funtion that calculates the actual value of a FROM_END index.*/
-size_t __str_boundIndex(size_t ind, size_t clen)
+#pragma region SCANNING
+/*@brief Internal function that returns a pointer to the first occurance of any of the characters a, b or c in [p, end),
+or end if there isn't any. Scans 16 bytes at a time when SSE2 is available.*/
+const dchar_t *__str_findany3(const dchar_t *p, const dchar_t *end, dchar_t a, dchar_t b, dchar_t c)
 {
-    if (ind == STR_END) // It's after the last
-    {
-        return clen;
-    }
-    else if (ind & STR_END) // It's counted from the end
+#ifdef __SSE2__
+    #ifdef DOOTSTR_USE_WCHAR
+    if (sizeof(dchar_t) == 4)
     {
-        ind = (ind & ~STR_END);
-        if (ind > clen)
+        __m128i va = _mm_set1_epi32((int)a), vb = _mm_set1_epi32((int)b), vc = _mm_set1_epi32((int)c);
+        while (end - p >= 4)
         {
-            STRFAIL("str indexing: Index (from-the-end) goes out of bounds from the left side.");
-            return 0;
+            __m128i x = _mm_loadu_si128((const __m128i *)p);
+            __m128i eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(x, va), _mm_cmpeq_epi32(x, vb)), _mm_cmpeq_epi32(x, vc));
+            int mask = _mm_movemask_epi8(eq);
+            if (mask)
+            {
+                return p + __builtin_ctz(mask) / 4;
+            }
+            p += 4;
         }
-        else 
+    }
+    #else
+    __m128i va = _mm_set1_epi8(a), vb = _mm_set1_epi8(b), vc = _mm_set1_epi8(c);
+    while (end - p >= 16)
+    {
+        __m128i x = _mm_loadu_si128((const __m128i *)p);
+        __m128i eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, va), _mm_cmpeq_epi8(x, vb)), _mm_cmpeq_epi8(x, vc));
+        int mask = _mm_movemask_epi8(eq);
+        if (mask)
         {
-            return clen - ind;
+            return p + __builtin_ctz(mask);
         }
+        p += 16;
     }
-    return ind;
+    #endif
+#endif
+    while (p < end && *p != a && *p != b && *p != c)
+    {
+        ++p;
+    }
+    return p;
 }
+#pragma endregion
 
-// TODO: Maybe redesign this hot garbage function and change all int types to fixed width??? No? Ok. Fine.
-/*@brief Returns a pointer to a new string populated with characters from the python-like slice [beg, ..., end) with a given step.
-A negative step means that the order will be reversed. Use STR_END to indicate the item one after the last one. Use STR_FROMEND(n) to indicate the
-n-th item from the back, ex. STR_FROMEND(1) is the last item (don't try STR_END-1 - it doesn't work!).
-See also 'https://stackoverflow.com/questions/509211/how-slicing-in-python-works' for more information.
-Invalid bounds that would cause the string to be empty, by default do not cause en error, unless DOOTSTR_SLICE_ERRORS is defined.
-Otherwise, the function treats you like a baby and corrects your bounds to fit inside the string.
-NOTE: values of beg/end cannot have the most significant bit, set to 1.*/
-str_t *str_newslice(const dchar_t *cstring, size_t beg, size_t end, long step)
+#pragma region UTF8
+/*
+UTF-8 support. The internal decoding and validation functions work on char buffers in every build, the str_u8* functions need a narrow
+build (they work on the str_t bytes) but don't need UTF-8 mode. With DOOTSTR_USE_UTF8 defined
+the strings are treated as UTF-8 text: c-style strings passed to str_newfrom, str_steal, str_assign_c, str_append_c and str_insert_c are
+validated (unless DOOTSTR_UTF8_NOCHECK is defined, then validation is up to you, see str_u8check), and the classification and strip functions
+work on code points instead of bytes. Everything else still works on bytes, use the str_u8* functions to index by code points.
+*/
+#if defined(DOOTSTR_USE_WCHAR) && defined(DOOTSTR_USE_UTF8)
+#error "DOOTSTR_USE_UTF8 can't be combined with DOOTSTR_USE_WCHAR."
+#endif
+
+#if defined(DOOTSTR_USE_UTF8) && !defined(DOOTSTR_UTF8_NOCHECK)
+#define STR_UTF8_CHECK(cstring, len, message) (__str_u8valid((cstring), (len)) ? 0 : (STRFAIL(message), 0))
+#else
+#define STR_UTF8_CHECK(cstring, len, message) 0
+#endif
+
+// Character classes of code points, see __str_u8class()
+#define STR_U8_ALPHA 1
+#define STR_U8_DIGIT 2
+#define STR_U8_UPPER 4
+#define STR_U8_LOWER 8
+#define STR_U8_SPACE 16
+#define STR_U8_CASED 32 // Upper case, lower case or title case, the Cased property of Unicode
+#define STR_U8_REPLACEMENT 0xFFFD // Stands in for bytes that aren't valid UTF-8 when decoding
+#define STR_CP_RAW 0x80000000U // Marks units that aren't text (invalid UTF-8 for example), case mapping and normalization leave them alone
+
+/*@brief Internal function that decodes the UTF-8 sequence at p into cp. Returns the length of the sequence, or 0 if it isn't a valid
+(shortest form, not a surrogate, at most U+10FFFF) sequence that ends before end.*/
+size_t __str_u8next(const char *p, const char *end, uint32_t *cp)
 {
-    if (!cstring)
-    {
-        STRFAIL("str_newslice: The passed address of the cstring is null.");
-    }
-    if (!(*cstring))
+    const unsigned char *s = (const unsigned char *)p;
+    uint32_t c = s[0], min;
+    size_t n;
+    if (c < 0x80)
     {
-        STR_SLICE_ERROR("str_newslice: The sliced cstring is empty.");
-        return str_newfrom(STR_EMPTY);
+        *cp = c;
+        return 1;
     }
-    if (step == 0)
+    else if ((c & 0xE0) == 0xC0)
     {
-        STR_SLICE_ERROR("str_newsloice: The step cannot be zero. Resulting slice is empty.");
-        return str_newfrom(STR_EMPTY);
+        n = 2, c &= 0x1F, min = 0x80;
     }
-
-    size_t clen = _strlen(cstring);
-    beg = __str_boundIndex(beg, clen); // In case the index is 'from the end'
-    if (beg >= clen)
+    else if ((c & 0xF0) == 0xE0)
     {
-        STR_SLICE_ERROR("str_newslice: Beg goes out of bounds from the right side.");
-        beg = clen - 1;
+        n = 3, c &= 0x0F, min = 0x800;
     }
-    end = __str_boundIndex(end, clen); // In case the index is 'from the end'
-    if (end > clen)
+    else if ((c & 0xF8) == 0xF0)
     {
-        STR_SLICE_ERROR("str_newslice: End goes out of bounds from the right side.");
-        end = clen;
+        n = 4, c &= 0x07, min = 0x10000;
     }
-    if (end < beg)
+    else
     {
-        STR_SLICE_ERROR("str_newslice: End is less than beg - resulting slice is invalid (empty).");
-        return str_newfrom(STR_EMPTY);
+        return 0;
     }
-    else if (end == beg)
+    if ((size_t)(end - p) < n)
     {
-        STR_SLICE_ERROR("str_newslice: End is equal to beg - resulting slice is empty.");
-        return str_newfrom(STR_EMPTY);
+        return 0;
     }
-
-    size_t sliceLen = 1 + (end - beg - 1) / labs(step); // This is correct I think
-    str_t *slice = str_new(sliceLen + 1);
-    size_t ind = (step > 0) ? beg : end - 1;
-    size_t added = 0;
-    //printf("Beg: %ld, end: %ld, step: %ld\n", beg, end, step);
-    //printf("Slicelen: %ld\n", sliceLen);
-    //printf("capacity: %ld\n", slice->capacity);
-    while (added < sliceLen)
+    for (size_t i = 1; i < n; i++)
     {
-        //printf("Ind: %ld\n", ind);
-        slice->pstr[added++] = cstring[ind];
-        if (step > 0)
+        if ((s[i] & 0xC0) != 0x80)
         {
-            ind += step;
-        }
-        else
-        {
-            ind += (size_t)(-step);
+            return 0;
         }
+        c = (c << 6) | (s[i] & 0x3F);
     }
-    slice->strlen = sliceLen;
-    slice->pstr[slice->strlen] = '\0';
-    return slice;
-}
-
-/*@brief Create a new doostr by taking ownership of an existing heap allocated c-style string. Other means of construction are
-preferable, this is only for unique occasions.*/
-str_t *str_steal(dchar_t *cstring)
-{
-    str_t *pstr = (str_t*)malloc(sizeof(str_t));
-    if (!pstr)
+    if (c < min || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF))
     {
-        STRERROR("malloc");
+        return 0;
     }
-    pstr->pstr = cstring;
-    pstr->strlen = _strlen(cstring);
-    pstr->capacity = pstr->strlen + 1;
-    return pstr;
+    *cp = c;
+    return n;
 }
 
-/*@brief Safely free a str_t object by passing the address of a pointer variable. The pointer will be set to null afterwards.*/
-void str_free(str_t **ppstr)
+/*@brief Internal function that encodes a valid code point as UTF-8 and returns the number of written bytes.*/
+size_t __str_u8encode(char *dst, uint32_t cp)
 {
-    if (!ppstr)
+    if (cp < 0x80)
     {
-        STRFAIL("str_free: The address of a str_t pointer variable was null. Remember to pass an address (&variable) of a pointer variable to this function.");
+        dst[0] = (char)cp;
+        return 1;
     }
-    if (!*ppstr)
+    else if (cp < 0x800)
     {
-        return;
+        dst[0] = (char)(0xC0 | (cp >> 6));
+        dst[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
     }
-    if ((*ppstr)->pstr)
+    else if (cp < 0x10000)
     {
-        free((*ppstr)->pstr);
+        dst[0] = (char)(0xE0 | (cp >> 12));
+        dst[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        dst[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
     }
-    free(*ppstr);
-    *ppstr = NULL;
+    dst[0] = (char)(0xF0 | (cp >> 18));
+    dst[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+    dst[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    dst[3] = (char)(0x80 | (cp & 0x3F));
+    return 4;
 }
 
-/*
-This function is only to be used on stack allocated str_t objects. It handles deallocating their memory. 
-@param[in] pstr A pointer to a stack allocated str_t to be destroyed.
-*/
-void str_destroy(str_t *pstr)
+/*@brief Internal function that returns the first byte of the first invalid UTF-8 sequence in [p, end), or end if there isn't one.*/
+const char *__str_u8scalarcheck(const char *p, const char *end)
 {
-    if (!pstr)
+    uint32_t cp;
+    while (p < end)
     {
-        STRFAIL("str_destroy: The address of a str_t was null. Cannot destroy it.");
-    }
-    if (pstr->pstr)
-    {
-        free(pstr->pstr);
+        uint64_t chunk;
+        if (end - p >= 8 && (memcpy(&chunk, p, 8), !(chunk & 0x8080808080808080ULL))) // 8 ASCII characters at once
+        {
+            p += 8;
+            continue;
+        }
+        size_t n = __str_u8next(p, end, &cp);
+        if (!n)
+        {
+            return p;
+        }
+        p += n;
     }
-    pstr->strlen = 0;
-    pstr->capacity = 0;
+    return end;
 }
 
-#pragma endregion
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define STR_U8_SIMD
+// Error flags of two consecutive bytes, from Keiser and Lemire "Validating UTF-8 In Less Than One Instruction Per Byte"
+#define STR_U8E_TOO_SHORT (1 << 0) // A lead byte followed by a lead byte or ASCII
+#define STR_U8E_TOO_LONG (1 << 1) // ASCII followed by a continuation byte
+#define STR_U8E_OVERLONG_3 (1 << 2)
+#define STR_U8E_TOO_LARGE (1 << 3)
+#define STR_U8E_SURROGATE (1 << 4)
+#define STR_U8E_OVERLONG_2 (1 << 5)
+#define STR_U8E_TOO_LARGE_1000 (1 << 6)
+#define STR_U8E_OVERLONG_4 (1 << 6)
+#define STR_U8E_TWO_CONTS (1 << 7) // Two continuation bytes, only valid right after a 3 or 4 byte lead
+#define STR_U8E_CARRY (STR_U8E_TOO_SHORT | STR_U8E_TOO_LONG | STR_U8E_TWO_CONTS)
 
-#pragma region MODIFICATION
+/*@brief Internal function that returns the error flags of a 16 byte block, given the block before it. Every byte pair is classified with
+three nibble lookups, the remaining bits tell if a continuation byte is missing or unexpected 2 or 3 bytes after a lead.*/
+__attribute__((target("ssse3")))
+__m128i __str_u8blockerrors(__m128i input, __m128i prev)
+{
+    const __m128i byte1high = _mm_setr_epi8(
+        STR_U8E_TOO_LONG, STR_U8E_TOO_LONG, STR_U8E_TOO_LONG, STR_U8E_TOO_LONG,
+        STR_U8E_TOO_LONG, STR_U8E_TOO_LONG, STR_U8E_TOO_LONG, STR_U8E_TOO_LONG,
+        STR_U8E_TWO_CONTS, STR_U8E_TWO_CONTS, STR_U8E_TWO_CONTS, STR_U8E_TWO_CONTS,
+        STR_U8E_TOO_SHORT | STR_U8E_OVERLONG_2,
+        STR_U8E_TOO_SHORT,
+        STR_U8E_TOO_SHORT | STR_U8E_OVERLONG_3 | STR_U8E_SURROGATE,
+        STR_U8E_TOO_SHORT | STR_U8E_TOO_LARGE | STR_U8E_TOO_LARGE_1000 | STR_U8E_OVERLONG_4);
+    const __m128i byte1low = _mm_setr_epi8(
+        STR_U8E_CARRY | STR_U8E_OVERLONG_3 | STR_U8E_OVERLONG_2 | STR_U8E_OVERLONG_4,
+        STR_U8E_CARRY | STR_U8E_OVERLONG_2,
+        STR_U8E_CARRY,
+        STR_U8E_CARRY,
+        STR_U8E_CARRY | STR_U8E_TOO_LARGE,
+        STR_U8E_CARRY | STR_U8E_TOO_LARGE | STR_U8E_TOO_LARGE_1000,
+        STR_U8E_CARRY | STR_U8E_TOO_LARGE | STR_U8E_TOO_LARGE_1000,
+        STR_U8E_CARRY | STR_U8E_TOO_LARGE | STR_U8E_TOO_LARGE_1000,
+        STR_U8E_CARRY | STR_U8E_TOO_LARGE | STR_U8E_TOO_LARGE_1000,
+        STR_U8E_CARRY | STR_U8E_TOO_LARGE | STR_U8E_TOO_LARGE_1000,
+        STR_U8E_CARRY | STR_U8E_TOO_LARGE | STR_U8E_TOO_LARGE_1000,
+        STR_U8E_CARRY | STR_U8E_TOO_LARGE | STR_U8E_TOO_LARGE_1000,
+        STR_U8E_CARRY | STR_U8E_TOO_LARGE | STR_U8E_TOO_LARGE_1000,
+        STR_U8E_CARRY | STR_U8E_TOO_LARGE | STR_U8E_TOO_LARGE_1000 | STR_U8E_SURROGATE,
+        STR_U8E_CARRY | STR_U8E_TOO_LARGE | STR_U8E_TOO_LARGE_1000,
+        STR_U8E_CARRY | STR_U8E_TOO_LARGE | STR_U8E_TOO_LARGE_1000);
+    const __m128i byte2high = _mm_setr_epi8(
+        STR_U8E_TOO_SHORT, STR_U8E_TOO_SHORT, STR_U8E_TOO_SHORT, STR_U8E_TOO_SHORT,
+        STR_U8E_TOO_SHORT, STR_U8E_TOO_SHORT, STR_U8E_TOO_SHORT, STR_U8E_TOO_SHORT,
+        STR_U8E_TOO_LONG | STR_U8E_OVERLONG_2 | STR_U8E_TWO_CONTS | STR_U8E_OVERLONG_3 | STR_U8E_TOO_LARGE_1000 | STR_U8E_OVERLONG_4,
+        STR_U8E_TOO_LONG | STR_U8E_OVERLONG_2 | STR_U8E_TWO_CONTS | STR_U8E_OVERLONG_3 | STR_U8E_TOO_LARGE,
+        STR_U8E_TOO_LONG | STR_U8E_OVERLONG_2 | STR_U8E_TWO_CONTS | STR_U8E_SURROGATE | STR_U8E_TOO_LARGE,
+        STR_U8E_TOO_LONG | STR_U8E_OVERLONG_2 | STR_U8E_TWO_CONTS | STR_U8E_SURROGATE | STR_U8E_TOO_LARGE,
+        STR_U8E_TOO_SHORT, STR_U8E_TOO_SHORT, STR_U8E_TOO_SHORT, STR_U8E_TOO_SHORT);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    __m128i prev1 = _mm_alignr_epi8(input, prev, 15);
+    __m128i special = _mm_and_si128(
+        _mm_and_si128(_mm_shuffle_epi8(byte1high, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+                      _mm_shuffle_epi8(byte1low, _mm_and_si128(prev1, nibble))),
+        _mm_shuffle_epi8(byte2high, _mm_and_si128(_mm_srli_epi16(input, 4), nibble)));
+    __m128i third = _mm_subs_epu8(_mm_alignr_epi8(input, prev, 14), _mm_set1_epi8((char)(0xE0 - 0x80))); // Only 111_____ gets the top bit
+    __m128i fourth = _mm_subs_epu8(_mm_alignr_epi8(input, prev, 13), _mm_set1_epi8((char)(0xF0 - 0x80))); // Only 1111____ gets the top bit
+    __m128i must23 = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8((char)0x80));
+    return _mm_xor_si128(must23, special);
+}
 
-void str_clear(str_t *pstr)
+/*@brief Internal function that checks if [p, p + len) is valid UTF-8, 16 bytes at a time. Blocks of pure ASCII only need a check
+that the block before them didn't end in the middle of a sequence.*/
+__attribute__((target("ssse3")))
+int __str_u8validssse3(const char *p, size_t len)
 {
-    str_destroy(pstr);
+    const __m128i maxlast = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                          (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+    __m128i error = _mm_setzero_si128(), prev = _mm_setzero_si128(), incomplete = _mm_setzero_si128();
+    const char *end = p + len;
+    char tail[16];
+    while (p < end)
+    {
+        __m128i input;
+        if (end - p >= 16)
+        {
+            input = _mm_loadu_si128((const __m128i *)p);
+        }
+        else // The last block is padded with zeros, which also catches a sequence cut off by the end
+        {
+            memset(tail, 0, sizeof(tail));
+            memcpy(tail, p, end - p);
+            input = _mm_loadu_si128((const __m128i *)tail);
+        }
+        if (!_mm_movemask_epi8(input))
+        {
+            error = _mm_or_si128(error, incomplete);
+        }
+        else
+        {
+            error = _mm_or_si128(error, __str_u8blockerrors(input, prev));
+            incomplete = _mm_subs_epu8(input, maxlast);
+        }
+        prev = input;
+        p += 16;
+    }
+    error = _mm_or_si128(error, incomplete);
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
 }
+#endif
 
-void str_assign_c(str_t *pstr, const dchar_t *cstring)
+/*@brief Internal function that returns 1 if [p, p + len) is valid UTF-8. Uses the SSSE3 validator when the CPU supports it.*/
+int __str_u8valid(const char *p, size_t len)
 {
-    if (!cstring)
+#ifdef STR_U8_SIMD
+    if (len >= 32 && __builtin_cpu_supports("ssse3"))
     {
-        STRFAIL("str_assign_c: Cannot assign to null char pointer.");
+        return __str_u8validssse3(p, len);
     }
-    if (!pstr)
+#endif
+    return __str_u8scalarcheck(p, p + len) == p + len;
+}
+
+#ifdef __SSE2__
+/*@brief Internal function that adds up the 16 byte sized counters of acc.*/
+size_t __str_sumbytes(__m128i acc)
+{
+    __m128i sums = _mm_sad_epu8(acc, _mm_setzero_si128());
+    return (size_t)_mm_cvtsi128_si32(sums) + (size_t)_mm_extract_epi16(sums, 4);
+}
+#endif
+
+/*@brief Internal function that returns the number of code points in [p, end), which is the number of bytes that aren't continuation bytes.
+Invalid bytes count as one code point each, the same way __str_u8skip() steps over them.*/
+size_t __str_u8count(const char *p, const char *end)
+{
+    size_t count = 0;
+    if (p < end) // The first byte always starts a code point, even a stray continuation byte
     {
-        STRFAIL("str_assign_c: The address of a str_t was null.");
+        count = 1;
+        ++p;
     }
-    if (pstr->pstr == cstring)
+#ifdef __SSE2__
+    const __m128i lastcont = _mm_set1_epi8((char)0xBF); // Continuation bytes are the smallest signed bytes, 0x80 to 0xBF
+    while (end - p >= 16)
     {
-        return;
+        __m128i acc = _mm_setzero_si128(); // Byte counters, flushed before they can overflow
+        size_t blocks = (size_t)(end - p) / 16 < 255 ? (size_t)(end - p) / 16 : 255;
+        for (size_t i = 0; i < blocks; i++, p += 16)
+        {
+            __m128i x = _mm_loadu_si128((const __m128i *)p);
+            acc = _mm_sub_epi8(acc, _mm_cmpgt_epi8(x, lastcont));
+        }
+        count += __str_sumbytes(acc);
     }
-    size_t clen = _strlen(cstring);
-    if (!pstr->pstr)
-    {
-        str_realloc(pstr, clen + 1);
-    }
-    else if (pstr->capacity < clen + 1)
+#endif
+    while (p < end)
     {
-        str_realloc(pstr, clen + 1);
+        count += ((*p++ & 0xC0) != 0x80);
     }
-    pstr->strlen = clen;
-    memcpy(pstr->pstr, cstring, (clen + 1) * sizeof(dchar_t));
+    return count;
 }
 
-void str_assign(str_t *pleft, const str_t *pright)
+/*@brief Internal function that returns a pointer to the n-th code point after p, or end if there are fewer.*/
+const char *__str_u8skip(const char *p, const char *end, size_t n)
 {
-    if (!pright)
-    {
-        STRFAIL("str_assign: Cannot assign a null str_t to another.");
-    }
-    if (!pleft)
+    if (n == 0 || p >= end)
     {
-        STRFAIL("str_assign: The address of the left str_t was null.");
-    }
-    if (pleft == pright)
-    {
-        return;
+        return p;
     }
-    if (!pleft->pstr)
+    ++p; // p starts the first code point, look for the n-th start after it
+#ifdef __SSE2__
+    const __m128i lastcont = _mm_set1_epi8((char)0xBF);
+    while (end - p >= 16)
     {
-        str_realloc(pleft, pright->strlen);
+        size_t starts = __builtin_popcount(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i *)p), lastcont)));
+        if (starts >= n) // It's in this block
+        {
+            break;
+        }
+        n -= starts;
+        p += 16;
     }
-    else if (pleft->capacity < pright->strlen + 1)
+#endif
+    for (; p < end; ++p)
     {
-        str_realloc(pleft, pright->strlen + 1);
+        if ((*p & 0xC0) != 0x80 && --n == 0)
+        {
+            return p;
+        }
     }
-    pleft->strlen = pright->strlen;
-    memcpy(pleft->pstr, pright->pstr, (pright->strlen + 1) * sizeof(dchar_t));
+    return end;
 }
 
-/*This function, unlike str_newslice by default allows you to use empty slices by setting beg the same as end.*/
-void str_assignSlice(str_t *pstr, const dchar_t *cstring, size_t beg, size_t end, long step)
+/*@brief Internal function that returns the character classes (STR_U8_* flags) of a code point.*/
+unsigned __str_u8class(uint32_t cp)
 {
-    if (!cstring)
+    if (cp < 0x80)
     {
-        STRFAIL("str_assignSlice: The passed address of the cstring is null.");
+        return __str_asciiclass[cp];
     }
-    if (!(*cstring))
+    size_t lo = 0, hi = sizeof(__str_uniclass) / sizeof(__str_uniclass[0]) / 2;
+    while (lo < hi) // Finds the first range that ends at or after cp
     {
-        STR_SLICE_ERROR("str_assignSlice: The sliced cstring is empty.");
-        str_assign_c(pstr, STR_EMPTY);
-        return;
+        size_t mid = (lo + hi) / 2;
+        if (__str_uniclass[2 * mid + 1] < cp)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
     }
-    if (step == 0)
+    if (2 * lo < sizeof(__str_uniclass) / sizeof(__str_uniclass[0]) && (__str_uniclass[2 * lo] & 0xFFFFFF) <= cp)
     {
-        STR_SLICE_ERROR("str_assignSlice: The step cannot be zero. Resulting slice is empty.");
-        str_assign_c(pstr, STR_EMPTY);
-        return;
+        return __str_uniclass[2 * lo] >> 24;
     }
+    return 0;
+}
 
-    size_t clen = _strlen(cstring);
-    beg = __str_boundIndex(beg, clen); // In case the index is 'from the end'
-    if (beg > clen)
-    {
-        STR_SLICE_ERROR("str_assignSlice: Beg goes out of bounds from the right side.");
-        beg = clen - 1;
-    }
-    end = __str_boundIndex(end, clen); // In case the index is 'from the end'
-    if (end > clen)
+/*@brief Internal function that returns 1 if every code point of [p, end) has one of the anyOf classes (or anyOf is 0) and none of the
+noneOf classes. Invalid sequences have no classes.*/
+int __str_u8all(const char *p, const char *end, unsigned anyOf, unsigned noneOf)
+{
+    while (p < end)
     {
-        STR_SLICE_ERROR("str_assignSlice: End goes out of bounds from the right side.");
-        end = clen;
+        uint32_t cp;
+        size_t n = __str_u8next(p, end, &cp);
+        unsigned flags = n ? __str_u8class(cp) : 0;
+        if ((anyOf && !(flags & anyOf)) || (flags & noneOf))
+        {
+            return 0;
+        }
+        p += n ? n : 1;
     }
-    if (end < beg)
+    return 1;
+}
+
+// Case mapping kinds, the first three index the (upper, lower, fold) records of dootstr_tables.h
+#define STR_CASE_UPPER 0
+#define STR_CASE_LOWER 1
+#define STR_CASE_FOLD 2
+#define STR_CASE_SWAP 3 // Upper case code points to lower case and lower case ones to upper case
+#define STR_CASE_BLOCK 128 // Code points per block of the two-stage tables, must match tools/gentables.py
+#define STR_CASE_SPECIAL 0x40000000 // Marks records of mappings to several code points, must match tools/gentables.py
+#define STR_CASE_MAXLEN 3 // Longest mapping, in code points
+
+/*@brief Internal function that writes the full case mapping (STR_CASE_UPPER, STR_CASE_LOWER or STR_CASE_FOLD) of a code point
+to out and returns its length in code points. Anything outside of Unicode maps to itself.*/
+size_t __str_casemap(uint32_t cp, int kind, uint32_t *out)
+{
+    if (cp < 0x80)
     {
-        STR_SLICE_ERROR("str_assignSlice: End is less than beg - resulting slice is invalid (empty).");
-        str_assign_c(pstr, STR_EMPTY);
-        return;
+        if (kind == STR_CASE_UPPER)
+        {
+            *out = (cp - 'a' < 26) ? cp - 0x20 : cp;
+        }
+        else
+        {
+            *out = (cp - 'A' < 26) ? cp + 0x20 : cp;
+        }
+        return 1;
     }
-    else if (end == beg)
+    if (cp > 0x10FFFF)
     {
-        str_assign_c(pstr, STR_EMPTY);
-        return;
+        *out = cp;
+        return 1;
     }
-    size_t sliceLen = 1 + (end - beg - 1) / labs(step); // This is correct I think
-    if (pstr->capacity < sliceLen + 1)
+    size_t record = __str_casestage2[__str_casestage1[cp / STR_CASE_BLOCK] * STR_CASE_BLOCK + cp % STR_CASE_BLOCK];
+    int32_t m = __str_caserecords[3 * record + kind];
+    if ((m & 0x7F000000) == STR_CASE_SPECIAL)
     {
-        str_realloc(pstr, sliceLen + 1);
+        size_t n = (m >> 16) & 0xFF;
+        memcpy(out, __str_casespecials + (m & 0xFFFF), n * sizeof(uint32_t));
+        return n;
     }
-    size_t ind = (step > 0) ? beg : end - 1;
-    size_t added = 0;
-    while (added < sliceLen)
+    *out = cp + m;
+    return 1;
+}
+
+#ifndef DOOTSTR_USE_WCHAR
+/*@brief Internal function that fills the code point index of the string up to the entry of code point k * STR_CPINDEX_STEP, or
+up to the end of the string. Returns the number of the last entry at or before k.*/
+size_t __str_cpindexextend(const str_t *pstr, size_t k)
+{
+    strcpindex_t *idx = pstr->cpindex;
+    const char *beg = pstr->pstr ? pstr->pstr : STR_EMPTY, *end = beg + pstr->strlen;
+    while (idx->count <= k)
     {
-        pstr->pstr[added++] = cstring[ind];
-        if (step > 0)
+        const char *next = __str_u8skip(beg + idx->offsets[idx->count - 1], end, STR_CPINDEX_STEP);
+        if (next == end)
         {
-            ind += step;
+            break;
         }
-        else
+        if (idx->count == idx->capacity)
         {
-            ind += (size_t)(-step);
+            idx->capacity *= 2;
+            idx->offsets = (size_t *)realloc(idx->offsets, idx->capacity * sizeof(size_t));
+            if (!idx->offsets)
+            {
+                STRERROR("realloc");
+            }
         }
-
+        idx->offsets[idx->count++] = next - beg;
     }
-    pstr->strlen = sliceLen;
-    pstr->pstr[pstr->strlen] = '\0';
+    return (k < idx->count) ? k : idx->count - 1;
 }
 
-void str_append_c(str_t *pstr, const dchar_t *cstring)
+/*@brief Internal function that returns the byte offset of the i-th code point of the string, or its length if there are fewer code points.
+Starts from the closest index entry if the string has an index.*/
+size_t __str_u8offset(const str_t *pstr, size_t i)
 {
-    if (!pstr || !cstring)
-    {
-        STRFAIL("str_append: The address of a str_t or a c string was null.");
-    }
-    size_t rlen = _strlen(cstring);
-    if (!pstr->pstr)
+    const char *beg = pstr->pstr ? pstr->pstr : STR_EMPTY, *end = beg + pstr->strlen;
+    if (!pstr->cpindex)
     {
-        str_realloc(pstr, STR_NEWCAPACITY(rlen + 1));
-        pstr->strlen = 0; // It should be zero already, just making sure tho
-        if (!pstr->pstr)
-        {
-            STRERROR("realloc");
-        }
+        return __str_u8skip(beg, end, i) - beg;
     }
-    else if (pstr->capacity < pstr->strlen + rlen + 1)
+    size_t k = __str_cpindexextend(pstr, i / STR_CPINDEX_STEP);
+    return __str_u8skip(beg + pstr->cpindex->offsets[k], end, i - k * STR_CPINDEX_STEP) - beg;
+}
+
+/*@brief Internal function that returns the number of code points of the string, in O(1) amortized time if it has an index.*/
+size_t __str_u8length(const str_t *pstr)
+{
+    const char *beg = pstr->pstr ? pstr->pstr : STR_EMPTY, *end = beg + pstr->strlen;
+    if (!pstr->cpindex)
     {
-        str_realloc(pstr, STR_NEWCAPACITY(pstr->strlen + rlen + 1));
-        if (!pstr->pstr)
-        {
-            STRERROR("realloc");
-        }
+        return __str_u8count(beg, end);
     }
-
-    memcpy(pstr->pstr + pstr->strlen, cstring, (rlen + 1) * sizeof(dchar_t));
-    pstr->strlen = pstr->strlen + rlen; 
+    size_t k = __str_cpindexextend(pstr, SIZE_MAX);
+    return k * STR_CPINDEX_STEP + __str_u8count(beg + pstr->cpindex->offsets[k], end);
 }
 
-void str_append(str_t *pleft, const str_t *pright)
+/*@brief Checks if len bytes starting at p are valid UTF-8. On failure returns STR_ERR_SYNTAX and sets badpos (if it isn't null)
+to the offset of the first invalid sequence.*/
+str_err_t str_u8check(const dchar_t *p, size_t len, size_t *badpos)
 {
-    if (!pleft || !pright)
+    if (!p)
     {
-        STRFAIL("str_append: The address of a str_t was null.");
+        return STR_ERR_NULL;
     }
-    if (!pright->pstr)
+    if (__str_u8valid(p, len))
     {
-        return;
+        return STR_OK;
     }
-    if (!pleft->pstr)
+    if (badpos)
     {
-        str_realloc(pleft, STR_NEWCAPACITY(pright->strlen + 1));
-        pleft->strlen = 0; // It should be zero already, just making sure tho
-        if (!pleft->pstr)
-        {
-            STRERROR("realloc");
-        }
+        *badpos = __str_u8scalarcheck(p, p + len) - p;
     }
-    else if (pleft->capacity < pleft->strlen + pright->strlen + 1)
+    return STR_ERR_SYNTAX;
+}
+
+/*@brief Returns 1 if the string is valid UTF-8.*/
+int str_isutf8(const str_t *pstr)
+{
+    if (!pstr)
     {
-        str_realloc(pleft, STR_NEWCAPACITY(pleft->strlen + pright->strlen + 1));
-        if (!pleft->pstr)
-        {
-            STRERROR("realloc");
-        }
+        STRFAIL("str_isutf8: The address of a str_t was null.");
     }
-    memcpy(pleft->pstr + pleft->strlen, pright->pstr, (pright->strlen + 1) * sizeof(dchar_t));
-    pleft->strlen = pleft->strlen + pright->strlen;
+    return !pstr->pstr || __str_u8valid(pstr->pstr, pstr->strlen);
 }
 
+/*@brief Returns the number of code points in the string. Takes O(1) amortized time if the string has an index (see str_u8index).*/
+size_t str_u8len(const str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_u8len: The address of a str_t was null.");
+    }
+    return __str_u8length(pstr);
+}
+#endif
+#pragma endregion
+
+
+
+#pragma region ALLOCATION
+#ifdef DOOTSTR_USE_POOL
 /*
-@brief Inserts a cstring starting at a given position in the str_t object. If the str_t is empty only position 0 is valid.
+With DOOTSTR_USE_POOL defined, the character blocks of str_new(), str_newfrom(), str_realloc(), str_free() and str_destroy() come from
+power of two size classes. Freed blocks go on a free list of the freeing thread, a thread with too many passes a batch on to a shared
+list (guarded by a mutex) and blocks that don't fit there either are given back to free(). A thread that runs out takes a batch from the
+shared list before calling malloc(). The capacity of a pooled string is rounded up to its class.
+Pooled blocks are ordinary malloc() blocks, so the functions that still use free() directly stay correct, they just don't recycle.
 */
-void str_insert_c(str_t *pstr, const dchar_t *cstring, size_t position)
+#define STR_POOL_MINSHIFT 4 // Smallest class is 16 bytes
+#define STR_POOL_MAXSHIFT 16 // Largest class is 64KB, bigger blocks always use malloc()
+#define STR_POOL_CLASSES (STR_POOL_MAXSHIFT - STR_POOL_MINSHIFT + 1)
+#define STR_POOL_LOCAL 64 // Most free blocks of one class a thread keeps
+#define STR_POOL_SHARED 1024 // Most free blocks of one class kept on the shared lists
+#define STR_POOL_BATCH 32 // Number of blocks moved between a thread's list and the shared one at once
+
+/*@brief Internal struct of a list of free blocks, linked through their first bytes.*/
+typedef struct strfreelist
 {
-    // if (position < 0)
-    // {
-    //     DOOTFAIL("str_insert_c: The position cannot be negative.");
-    // }
-    if (!pstr || !cstring)
+    void *head; /*The first free block*/
+    size_t count; /*Number of blocks on the list*/
+} strfreelist_t;
+
+/*@brief Internal struct of the free lists of one thread.*/
+typedef struct strcache
+{
+    strfreelist_t lists[STR_POOL_CLASSES]; /*One list per size class*/
+    int registered; /*Set once the thread's lists are flushed when it exits*/
+} strcache_t;
+
+#ifdef DOOTSTR_NO_THREADS
+strcache_t __str_cache;
+#else
+__thread strcache_t __str_cache;
+strfreelist_t __str_shared[STR_POOL_CLASSES];
+pthread_mutex_t __str_sharedlock = PTHREAD_MUTEX_INITIALIZER;
+pthread_key_t __str_cachekey;
+pthread_once_t __str_cacheonce = PTHREAD_ONCE_INIT;
+#endif
+
+/*@brief Internal function that returns the class of a block of at least bytes bytes, or -1 if it's too big for the pool.
+Rounds up when round is set (for allocating) and down otherwise (for a block that's already that big).*/
+int __str_poolclass(size_t bytes, int round)
+{
+    if (bytes > ((size_t)1 << STR_POOL_MAXSHIFT))
     {
-        STRFAIL("str_insert_c: The address of a str_t or a c string was null.");
+        return -1;
     }
-    if (position > pstr->strlen)
+    int shift = STR_POOL_MINSHIFT;
+    while (((size_t)1 << shift) < bytes)
     {
-        STRFAIL("str_insert_c: Position has to be no greater than string length.");
+        shift++;
     }
-    if (position == pstr->strlen)
+    if (!round && ((size_t)1 << shift) > bytes)
     {
-        str_append_c(pstr, cstring);
-        return;
+        shift--;
     }
-    size_t rlen = _strlen(cstring); 
-    if ((!pstr->pstr || pstr->strlen == 0) && position != 0)
+    return shift - STR_POOL_MINSHIFT; // -1 for blocks smaller than the smallest class when rounding down
+}
+
+/*@brief Internal function that moves up to n blocks from the front of one list to another.*/
+void __str_poolmove(strfreelist_t *from, strfreelist_t *to, size_t n)
+{
+    while (n-- > 0 && from->head)
     {
-        STRFAIL("str_insert_c: Cannot insert at a non zero position to an empty string.");
+        void *block = from->head;
+        from->head = *(void**)block;
+        from->count--;
+        *(void**)block = to->head;
+        to->head = block;
+        to->count++;
     }
-    // Block is empty - allocating new block //
-    if (!pstr->pstr)
+}
+
+#ifndef DOOTSTR_NO_THREADS
+/*@brief Internal function that passes the free blocks of an exiting thread to the shared lists, freeing those that don't fit.*/
+void __str_cacheexit(void *pcache)
+{
+    strcache_t *pc = (strcache_t*)pcache;
+    pthread_mutex_lock(&__str_sharedlock);
+    for (int c = 0; c < STR_POOL_CLASSES; c++)
     {
-        str_realloc(pstr, STR_NEWCAPACITY(rlen + 1));
-        memcpy(pstr->pstr, cstring, (rlen + 1) * sizeof(dchar_t));
-        pstr->strlen = rlen;
-        return;
+        size_t room = STR_POOL_SHARED - __str_shared[c].count;
+        __str_poolmove(pc->lists + c, __str_shared + c, room);
     }
-    // Block is too small, allocating new block and manually moving //
-    if (pstr->capacity < pstr->strlen + rlen + 1)
+    pthread_mutex_unlock(&__str_sharedlock);
+    for (int c = 0; c < STR_POOL_CLASSES; c++)
     {
-        size_t newcap = STR_NEWCAPACITY(pstr->strlen + rlen + 1);
-        STR_LOG_ALLOC(pstr->capacity, newcap);
-        dchar_t *newblock = (dchar_t *)malloc(sizeof(dchar_t) * newcap);  
-        if (!newblock)
+        while (pc->lists[c].head)
         {
-            STRERROR("malloc");
+            void *block = pc->lists[c].head;
+            pc->lists[c].head = *(void**)block;
+            free(block);
         }
-        memcpy(newblock, pstr->pstr, position * sizeof(dchar_t));
-        memcpy(newblock + position, cstring, rlen * sizeof(dchar_t));
-        memcpy(newblock + position + rlen, pstr->pstr + position, (pstr->strlen - position) * sizeof(dchar_t));
-        newblock[pstr->strlen + rlen] = '\0';
-        free(pstr->pstr);
-        pstr->pstr = newblock;
-        pstr->strlen = pstr->strlen + rlen;
-        pstr->capacity = newcap;
-        return;
+        pc->lists[c].count = 0;
     }
-    // Block is big enough, just moving characters around //
-    // Ok so there was a horrendous bug involving overflow when comparing an int to an ssize_t.
-    // Since then the index and position are of type ssize_t.
-    for (ssize_t i = pstr->strlen; i >= (ssize_t)position; --i)
+}
+
+/*@brief Internal function that creates the key whose destructor flushes a thread's lists.*/
+void __str_cachekeyinit(void)
+{
+    if (pthread_key_create(&__str_cachekey, __str_cacheexit) != 0)
     {
-        pstr->pstr[i + rlen] = pstr->pstr[i];
+        STRERROR("pthread_key_create");
     }
-    memcpy(pstr->pstr + position, cstring, rlen * sizeof(dchar_t));
-    pstr->strlen = pstr->strlen + rlen;
-    pstr->pstr[pstr->strlen] = '\0';
 }
+#endif
 
-void str_insert(str_t *pleft, str_t *pright, size_t position)
+/*@brief Internal function that returns a block of at least *pcap characters and sets *pcap to the number of characters it holds.*/
+dchar_t *__str_blockalloc(size_t *pcap)
 {
-    // if (position < 0)
-    // {
-    //     DOOTFAIL("str_insert: The position cannot be negative.");
-    // }
-    if (!pleft || !pright)
+    int c = __str_poolclass(*pcap * sizeof(dchar_t), 1);
+    void *block = NULL;
+    if (c >= 0)
     {
-        STRFAIL("str_insert: The address of a str_t was null.");
+        strfreelist_t *pl = __str_cache.lists + c;
+        #ifndef DOOTSTR_NO_THREADS
+        if (!pl->head) // Only happens once per STR_POOL_BATCH blocks taken from the shared list
+        {
+            pthread_mutex_lock(&__str_sharedlock);
+            __str_poolmove(__str_shared + c, pl, STR_POOL_BATCH);
+            pthread_mutex_unlock(&__str_sharedlock);
+        }
+        #endif
+        if (pl->head)
+        {
+            block = pl->head;
+            pl->head = *(void**)block;
+            pl->count--;
+        }
+        *pcap = ((size_t)1 << (c + STR_POOL_MINSHIFT)) / sizeof(dchar_t);
     }
-    if (position > pleft->strlen)
+    if (!block)
     {
-        STRFAIL("str_insert: Position has to be no greater than string length.");
+        block = malloc(*pcap * sizeof(dchar_t));
+        if (!block)
+        {
+            STRERROR("malloc");
+        }
     }
-    if (position == pleft->strlen)
+    return (dchar_t*)block;
+}
+
+/*@brief Internal function that gives back a block of (at least) capacity characters.*/
+void __str_blockfree(dchar_t *block, size_t capacity)
+{
+    if (!block)
     {
-        str_append(pleft, pright);
         return;
     }
-    if ((!pleft->pstr || pleft->strlen == 0) && position != 0)
+    int c = __str_poolclass(capacity * sizeof(dchar_t), 0);
+    if (c < 0)
     {
-        STRFAIL("str_insert_c: Cannot insert at a non zero position to an empty string.");
+        free(block);
+        return;
     }
-    // Block is empty - allocating new block //
-    if (!pleft->pstr)
+    strfreelist_t *pl = __str_cache.lists + c;
+    #ifdef DOOTSTR_NO_THREADS
+    if (pl->count >= STR_POOL_LOCAL)
     {
-        str_realloc(pleft, STR_NEWCAPACITY(pright->strlen + 1));
-        memcpy(pleft->pstr, pright->pstr, (pright->strlen + 1) * sizeof(dchar_t));
-        pleft->strlen = pright->strlen;
+        free(block);
         return;
     }
-    // Block is too small, allocating new block and manually moving //
-    if (pleft->capacity < pleft->strlen + pright->strlen + 1)
+    #else
+    if (!__str_cache.registered)
     {
-        size_t newcap = STR_NEWCAPACITY(pleft->strlen + pright->strlen + 1);
-        STR_LOG_ALLOC(pleft->capacity, newcap);
-        dchar_t *newblock = (dchar_t *)malloc(sizeof(dchar_t) * newcap);  
-        if (!newblock)
+        pthread_once(&__str_cacheonce, __str_cachekeyinit);
+        pthread_setspecific(__str_cachekey, &__str_cache);
+        __str_cache.registered = 1;
+    }
+    if (pl->count >= STR_POOL_LOCAL)
+    {
+        pthread_mutex_lock(&__str_sharedlock);
+        size_t room = STR_POOL_SHARED - __str_shared[c].count;
+        __str_poolmove(pl, __str_shared + c, (room < STR_POOL_BATCH) ? room : STR_POOL_BATCH);
+        pthread_mutex_unlock(&__str_sharedlock);
+        if (pl->count >= STR_POOL_LOCAL)
         {
-            STRERROR("malloc");
+            free(block);
+            return;
         }
-        memcpy(newblock, pleft->pstr, position * sizeof(dchar_t));
-        memcpy(newblock + position, pright->pstr, pright->strlen * sizeof(dchar_t));
-        memcpy(newblock + position + pright->strlen, pleft->pstr + position, (pleft->strlen - position) * sizeof(dchar_t));
-        newblock[pleft->strlen + pright->strlen] = '\0';
-        free(pleft->pstr);
-        pleft->pstr = newblock;
-        pleft->strlen = pleft->strlen + pright->strlen;
-        pleft->capacity = newcap;
-        return;
     }
-    // Block is big enough, just moving characters around //
-    // Ok so there was a horrendous bug involving overflow when comparing an int to an ssize_t.
-    // Since then the index and position are of type ssize_t.
-    for (ssize_t i = pleft->strlen; i >= (ssize_t)position; --i)
-    {
-        pleft->pstr[i + pright->strlen] = pleft->pstr[i];
+    #endif
+    *(void**)block = pl->head;
+    pl->head = block;
+    pl->count++;
+}
+
+/*@brief Internal function that moves the first keep characters of a block of oldcap characters to a block of at least *pcap characters,
+setting *pcap to its real size. Keeps the block if it's already in the right class.*/
+dchar_t *__str_blockrealloc(dchar_t *block, size_t oldcap, size_t *pcap, size_t keep)
+{
+    int c = __str_poolclass(*pcap * sizeof(dchar_t), 1);
+    if (c < 0 && __str_poolclass(oldcap * sizeof(dchar_t), 0) < 0)
+    {
+        block = (dchar_t*)realloc(block, *pcap * sizeof(dchar_t)); // Neither block is pooled
+        if (!block)
+        {
+            STRERROR("realloc");
+        }
+        return block;
     }
-    memcpy(pleft->pstr + position, pright->pstr, pright->strlen * sizeof(dchar_t));
-    pleft->strlen = pleft->strlen + pright->strlen;
-    pleft->pstr[pleft->strlen] = '\0';
+    if (block && c >= 0 && oldcap * sizeof(dchar_t) == ((size_t)1 << (c + STR_POOL_MINSHIFT)))
+    {
+        *pcap = oldcap;
+        return block;
+    }
+    dchar_t *newblock = __str_blockalloc(pcap);
+    if (block)
+    {
+        memcpy(newblock, block, ((keep < *pcap) ? keep : *pcap) * sizeof(dchar_t));
+    }
+    __str_blockfree(block, oldcap);
+    return newblock;
 }
 
-/*
-@brief Allocates a new doostr object containing the concatenated string. Not sure why someone would use this, but ok.
-*/
-str_t *str_concat(str_t *pleft, str_t *pright)
+/*@brief Frees the blocks the pool keeps for the calling thread and the shared ones. Only needed to give memory back to the system.*/
+void str_poolflush(void)
 {
-    if (!pleft || !pright)
+    for (int c = 0; c < STR_POOL_CLASSES; c++)
     {
-        STRFAIL("str_concat: One of the argument str_t was null.");
+        #ifndef DOOTSTR_NO_THREADS
+        pthread_mutex_lock(&__str_sharedlock);
+        __str_poolmove(__str_shared + c, __str_cache.lists + c, SIZE_MAX);
+        pthread_mutex_unlock(&__str_sharedlock);
+        #endif
+        while (__str_cache.lists[c].head)
+        {
+            void *block = __str_cache.lists[c].head;
+            __str_cache.lists[c].head = *(void**)block;
+            free(block);
+        }
+        __str_cache.lists[c].count = 0;
     }
-    str_t *pstr = str_new(STR_NEWCAPACITY(pleft->strlen + pright->strlen + 1));
-    // From what I've read, calling memcpy(_, NULL, 0) could violate the standard, hence the check
-    if (pleft->pstr)
+}
+#else
+/*@brief Internal function that returns a block of *pcap characters.*/
+dchar_t *__str_blockalloc(size_t *pcap)
+{
+    dchar_t *block = (dchar_t *)malloc(*pcap * sizeof(dchar_t));
+    if (!block)
     {
-        memcpy(pstr->pstr, pleft->pstr, pleft->strlen * sizeof(dchar_t)); 
+        STRERROR("malloc");
     }
-    if (pright->pstr)
+    return block;
+}
+
+/*@brief Internal function that frees a block.*/
+void __str_blockfree(dchar_t *block, size_t capacity)
+{
+    (void)capacity;
+    free(block);
+}
+
+/*@brief Internal function that reallocates a block to *pcap characters.*/
+dchar_t *__str_blockrealloc(dchar_t *block, size_t oldcap, size_t *pcap, size_t keep)
+{
+    (void)oldcap;
+    (void)keep;
+    block = (dchar_t *)realloc(block, *pcap * sizeof(dchar_t));
+    if (!block)
     {
-        memcpy(pstr->pstr + pleft->strlen, pright->pstr, pright->strlen * sizeof(dchar_t));
+        STRERROR("realloc");
     }
-    pstr->pstr[pleft->strlen + pright->strlen] = '\0';
-    return pstr;
+    return block;
 }
+#endif
 
-/*
-@brief Removes a substring from a str_t.
-@param[in] pstr string object
-@param[in] position position to where the removed substr begins
-@param[in] length the length of the substring to remove. Must be at least 1.
-NOTE: As of currently I can't be bothered to implement safety measures against potential overflow
-caused by ex. position + length. Fix it later.
-*/
-void str_cut(str_t *pstr, size_t position, size_t length)
+/*@brief Internal function that turns a string made by str_mapfile() into an ordinary one with a heap block of newcap characters,
+copying as much of the file (and its null terminator) as fits, and unmaps the file.*/
+void __str_unmap(str_t *pstr, size_t newcap)
 {
-    if (!pstr)
+    size_t copied = (pstr->strlen + 1 < newcap) ? pstr->strlen + 1 : newcap;
+    dchar_t *newblock = __str_blockalloc(&newcap);
+    memcpy(newblock, pstr->pstr, copied * sizeof(dchar_t));
+    STR_STAT_ALLOC(STR_CALLER, newcap);
+    STR_STAT_COPY(STR_CALLER, copied);
+    munmap(pstr->pstr - pstr->head, pstr->mapped);
+    pstr->pstr = newblock;
+    pstr->capacity = newcap;
+    pstr->mapped = 0;
+    pstr->head = 0;
+}
+
+/*@brief Internal function that has to be called by everything that changes the characters of a string, other than appending to it.
+Characters before pos must stay the same. Cuts the code point index back to the part before pos and gives mapped strings a writable copy,
+so pointers into the string taken before the call are stale afterwards.*/
+void __str_mutate(str_t *pstr, size_t pos)
+{
+    if (pstr->mapped)
     {
-        STRFAIL("str_cut: The passed address was null.");
+        __str_unmap(pstr, pstr->strlen + 1);
     }
-    if (length < 1)
+    strcpindex_t *idx = pstr->cpindex;
+    if (idx)
     {
-        return;
+        while (idx->count > 1 && idx->offsets[idx->count - 1] >= pos)
+        {
+            --idx->count;
+        }
     }
-    if (position + 1 > pstr->strlen || position + length > pstr->strlen)
+}
+
+/*@brief Internal function that gives back the memory block of a string that isn't mapped, along with the characters consumed from its
+front.*/
+void __str_dropblock(str_t *pstr)
+{
+    if (pstr->pstr)
     {
-        STRFAIL("str_cut: The substring to be removed goes out of bounds of the string.");
+        __str_blockfree(pstr->pstr - pstr->head, pstr->capacity + pstr->head);
     }
-    for (ssize_t i = position + length; i <= pstr->strlen; ++i) // Moving hte null terminator as well
+    pstr->head = 0;
+}
+
+/*@brief Internal function that moves the characters of a string back to the start of its block, so the consumed ones can be used again.*/
+void __str_compact(str_t *pstr)
+{
+    if (pstr->head == 0 || pstr->mapped)
     {
-        pstr->pstr[i - length] = pstr->pstr[i];
+        return;
     }
-    pstr->strlen -= length;
+    memmove(pstr->pstr - pstr->head, pstr->pstr, (pstr->strlen + 1) * sizeof(dchar_t));
+    pstr->pstr -= pstr->head;
+    pstr->capacity += pstr->head;
+    pstr->head = 0;
 }
 
-size_t str_count(str_t *pstr, const dchar_t * seq); // Temporary solution to solve compilation issues.
-size_t str_countAny(str_t *pstr, const dchar_t * set);
+/*@brief Internal function that removes the first n characters of a string by moving pstr forward instead of moving the rest of the
+string. The block is compacted once more than half of it was consumed, so every character is moved at most once on average and a string
+that keeps being consumed doesn't hold on to a mostly empty block. Mapped strings stay mapped.*/
+void __str_advance(str_t *pstr, size_t n)
+{
+    if (pstr->cpindex)
+    {
+        pstr->cpindex->count = 1; // The offsets are counted from pstr
+    }
+    pstr->pstr += n;
+    pstr->head += n;
+    pstr->strlen -= n;
+    if (!pstr->mapped)
+    {
+        pstr->capacity -= n;
+        if (pstr->head > pstr->capacity)
+        {
+            __str_compact(pstr);
+        }
+    }
+}
 
-/*@brief Removes all occurances of seq from the string. Returns number of removed instances.*/
-size_t str_remove(str_t *pstr, const dchar_t *seq)
+/*@brief Internal function that does the work of str_realloc(), counting the memory under caller.*/
+void __str_reallocfrom(str_t *pstr, size_t newcap, const char *caller)
 {
+    (void)caller;
+    (void)STR_EXPR_TESTOVERFLOW(newcap / 2);
+    if (newcap == 0)
+    {
+        STRFAIL("str_realloc: Capacity of 0 is not allowed.");
+    }
     if (!pstr)
     {
-        STRFAIL("str_remove: The passed address was null.");
+        STRFAIL("str_realloc: The address of str_t pointer was null.");
     }
-    if (!pstr->pstr)
+    size_t blockcap = newcap; // Pooled blocks can be bigger
+    if (pstr->mapped)
     {
-        return 0;
+        __str_unmap(pstr, newcap); // Counted as a new block
     }
-    if (!seq)
+    else
     {
-        STRFAIL("str_remove: The passed address of seq was null.");
+        __str_compact(pstr); // The consumed characters are reused instead of being carried over
+        dchar_t *old = pstr->pstr;
+        (void)old; // Only needed for the statistics
+        pstr->pstr = __str_blockrealloc(pstr->pstr, pstr->capacity, &blockcap, pstr->strlen + 1);
+        STR_STAT_REALLOC(caller, old, blockcap, old ? ((pstr->strlen + 1 < newcap) ? pstr->strlen + 1 : newcap) : 0);
+        pstr->capacity = blockcap;
     }
-    if (!(*seq))
+    if (newcap < pstr->strlen + 1) // Need to insert new null terminator
     {
-        return 0;
+        __str_mutate(pstr, newcap - 1);
+        pstr->pstr[newcap - 1] = '\0';
+        pstr->strlen = newcap - 1;
     }
-    size_t count = str_count(pstr, seq);
-    size_t rlen = _strlen(seq);
-    size_t newLen = pstr->strlen - count *rlen;
-    size_t *seqPos = (size_t*)malloc(sizeof(size_t)*count); // Array housing the positions of found substrings
-    if (!seqPos)
+}
+
+/*
+@brief Reallocates the memory block of the str_t, copying the old contents. If the new capacity is to small to contain the old contents,
+some data will be lost, however the null terminator will always be inserted.
+*/
+void str_realloc(str_t *pstr, size_t newcap)
+{
+    __str_reallocfrom(pstr, newcap, "str_realloc");
+}
+#ifdef DOOTSTR_STATS
+#undef str_realloc // Renamed by dootwstr.c
+#define str_realloc(pstr, newcap) __str_reallocfrom((pstr), (newcap), __func__) // Counted under the function that called it
+#endif
+
+/*@brief Returns a pointer to a string initialized with a c-style string literal.*/
+str_t *str_newfrom(const dchar_t *cstring)
+{
+    str_t *pstr = (str_t*)malloc(sizeof(str_t));
+    if (!pstr)
     {
         STRERROR("malloc");
     }
-    size_t i = 0;
-    dchar_t *p = pstr->pstr;
-    while ((p = _strstr(p, seq)) != NULL)
+    pstr->cpindex = NULL;
+    pstr->mapped = 0;
+    pstr->head = 0;
+    pstr->strlen = _strlen(cstring);
+    (void)STR_EXPR_TESTOVERFLOW((pstr->strlen + 1) / 2);
+    (void)STR_UTF8_CHECK(cstring, pstr->strlen, "str_newfrom: The cstring is not valid UTF-8.");
+    #ifdef DOOTSTR_USE_POOL
+    pstr->capacity = pstr->strlen + 1;
+    pstr->pstr = __str_blockalloc(&pstr->capacity);
+    memcpy(pstr->pstr, cstring, (pstr->strlen + 1) * sizeof(dchar_t));
+    #else
+    pstr->pstr = _strdup(cstring);
+    if (!pstr->pstr)
     {
-        //printf("pos: %ld\n", p - pstr->pstr);
-        seqPos[i++] = p - pstr->pstr;
-        p += rlen;
+        #ifdef DOOTSTR_USE_WCHAR
+        STRERROR("wcsdup");
+        #else
+        STRERROR("strdup");
+        #endif
+    }  
+    pstr->capacity = pstr->strlen + 1;
+    #endif
+    STR_STAT_ALLOC(STR_CALLER, pstr->capacity);
+    STR_STAT_COPY(STR_CALLER, pstr->strlen + 1);
+    return pstr;
+}
+
+/*@brief Returns a pointer to a newly initialized empty string with a memory block of a given capacity.*/
+str_t *str_new(size_t capacity)
+{
+    str_t *pstr = (str_t*)malloc(sizeof(str_t));
+    if (!pstr)
+    {
+        STRERROR("malloc");
     }
-    i = 0; // The current element to be moved to the left (or left alone)
-    size_t seqInd = 0; // The index of the next sequence to be ecnountered
-    size_t offset = 0; // The offset by which to move elements to the left
-    while (i < pstr->strlen + 1) // Plus 1 to copy '/0'
+    pstr->strlen = 0;
+    pstr->pstr = NULL;
+    pstr->cpindex = NULL;
+    pstr->mapped = 0;
+    pstr->head = 0;
+    pstr->capacity = capacity;
+    if (pstr->capacity != 0)
     {
-        //printf("i: %ld\n", i);
-        if (seqInd < count && i == seqPos[seqInd])
+        (void)STR_EXPR_TESTOVERFLOW(capacity / 2);
+        pstr->pstr = __str_blockalloc(&pstr->capacity);
+        STR_STAT_ALLOC(STR_CALLER, pstr->capacity);
+        *pstr->pstr = '\0';
+    }
+    return pstr;
+}
+
+/*@brief Internal funtion that calculates the actual value of a FROM_END index.*/
+size_t __str_boundIndex(size_t ind, size_t clen)
+{
+    if (ind == STR_END) // It's after the last
+    {
+        return clen;
+    }
+    else if (ind & STR_END) // It's counted from the end
+    {
+        ind = (ind & ~STR_END);
+        if (ind > clen)
         {
-            i += rlen;
-            offset += rlen;
-            seqInd++;
+            STRFAIL("str indexing: Index (from-the-end) goes out of bounds from the left side.");
+            return 0;
         }
-        else if (offset > 0)
+        else 
         {
-            pstr->pstr[i - offset] = pstr->pstr[i];
-            ++i;
+            return clen - ind;
         }
-        else
+    }
+    return ind;
+}
+
+#if defined(__SSE2__) && (!defined(DOOTSTR_USE_WCHAR) || WCHAR_MAX > 0xFFFF)
+#define STR_SLICE_SIMD
+#define STR_SLICE_VECUNITS (16 / sizeof(dchar_t))
+
+/*@brief Internal function that reverses the order of the characters in a vector.*/
+__m128i __str_revvec(__m128i x)
+{
+    #ifdef DOOTSTR_USE_WCHAR
+    return _mm_shuffle_epi32(x, 0x1B);
+    #else
+    x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8)); // Swaps the bytes of every 16 bit word
+    x = _mm_shufflehi_epi16(_mm_shufflelo_epi16(x, 0x1B), 0x1B); // Reverses the words of both halves
+    return _mm_shuffle_epi32(x, 0x4E); // Swaps the halves
+    #endif
+}
+
+/*@brief Internal function that returns a vector of p[0], p[step], p[2 * step], ... for a step of 2 or 4. Reads step vectors from p.*/
+__m128i __str_gathervec(const dchar_t *p, long step)
+{
+    #ifdef DOOTSTR_USE_WCHAR
+    __m128i a = _mm_loadu_si128((const __m128i *)p), b = _mm_loadu_si128((const __m128i *)(p + 4));
+    if (step == 2)
+    {
+        return _mm_unpacklo_epi64(_mm_shuffle_epi32(a, 0x08), _mm_shuffle_epi32(b, 0x08)); // Elements 0 and 2 of both
+    }
+    __m128i c = _mm_loadu_si128((const __m128i *)(p + 8)), d = _mm_loadu_si128((const __m128i *)(p + 12));
+    return _mm_unpacklo_epi64(_mm_unpacklo_epi32(a, b), _mm_unpacklo_epi32(c, d)); // Element 0 of each
+    #else
+    if (step == 2)
+    {
+        __m128i low = _mm_set1_epi16(0xFF); // Keeps the even bytes, packing the words gives them back as bytes
+        return _mm_packus_epi16(_mm_and_si128(_mm_loadu_si128((const __m128i *)p), low),
+            _mm_and_si128(_mm_loadu_si128((const __m128i *)(p + 16)), low));
+    }
+    __m128i low = _mm_set1_epi32(0xFF); // Keeps every fourth byte, packed to words and then to bytes
+    __m128i ab = _mm_packs_epi32(_mm_and_si128(_mm_loadu_si128((const __m128i *)p), low),
+        _mm_and_si128(_mm_loadu_si128((const __m128i *)(p + 16)), low));
+    __m128i cd = _mm_packs_epi32(_mm_and_si128(_mm_loadu_si128((const __m128i *)(p + 32)), low),
+        _mm_and_si128(_mm_loadu_si128((const __m128i *)(p + 48)), low));
+    return _mm_packus_epi16(ab, cd);
+    #endif
+}
+#endif
+
+/*@brief Internal function that copies the n characters src[0], src[step], src[2 * step], ... to dst, which can't overlap src. A negative
+step goes backwards from src. Step 1 is a memcpy(), step -1 reverses a vector at a time and steps 2 and 4 are gathered a vector at a
+time with SSE2. Nothing after the last copied character is read.*/
+void __str_slicecopy(dchar_t *dst, const dchar_t *src, size_t n, long step)
+{
+    size_t i = 0;
+    if (n == 0)
+    {
+        return;
+    }
+    if (step == 1)
+    {
+        memcpy(dst, src, n * sizeof(dchar_t));
+        return;
+    }
+    #ifdef STR_SLICE_SIMD
+    if (step == -1)
+    {
+        for (; i + STR_SLICE_VECUNITS <= n; i += STR_SLICE_VECUNITS)
         {
-            ++i;
+            __m128i x = _mm_loadu_si128((const __m128i *)(src - i - (STR_SLICE_VECUNITS - 1)));
+            _mm_storeu_si128((__m128i *)(dst + i), __str_revvec(x));
+        }
+    }
+    else if (step == 2 || step == 4)
+    {
+        for (; (i + STR_SLICE_VECUNITS) * step - 1 <= (n - 1) * step; i += STR_SLICE_VECUNITS) // The last vector ends on src[(n - 1) * step]
+        {
+            _mm_storeu_si128((__m128i *)(dst + i), __str_gathervec(src + i * step, step));
         }
     }
-    free(seqPos);
-    pstr->strlen = newLen;
-    //pstr->pstr[pstr->strlen-1] = '\0';
-    return count;
+    #endif
+    for (; i < n; i++)
+    {
+        dst[i] = src[(ssize_t)i * step];
+    }
+}
+
+/*@brief Internal function that reverses n characters in place, swapping a vector from each end at a time.*/
+void __str_reverse(dchar_t *p, size_t n)
+{
+    size_t i = 0, j = n;
+    #ifdef STR_SLICE_SIMD
+    while (j - i >= 2 * STR_SLICE_VECUNITS)
+    {
+        __m128i front = _mm_loadu_si128((const __m128i *)(p + i));
+        __m128i back = _mm_loadu_si128((const __m128i *)(p + j - STR_SLICE_VECUNITS));
+        _mm_storeu_si128((__m128i *)(p + i), __str_revvec(back));
+        _mm_storeu_si128((__m128i *)(p + j - STR_SLICE_VECUNITS), __str_revvec(front));
+        i += STR_SLICE_VECUNITS;
+        j -= STR_SLICE_VECUNITS;
+    }
+    #endif
+    while (j - i >= 2)
+    {
+        dchar_t c = p[i];
+        p[i++] = p[--j];
+        p[j] = c;
+    }
+}
+
+/*@brief Returns a pointer to a new string populated with characters from the python-like slice [beg, ..., end) with a given step.
+A negative step means that the order will be reversed. Use STR_END to indicate the item one after the last one. Use STR_FROMEND(n) to indicate the
+n-th item from the back, ex. STR_FROMEND(1) is the last item (don't try STR_END-1 - it doesn't work!).
+See also 'https://stackoverflow.com/questions/509211/how-slicing-in-python-works' for more information.
+Invalid bounds that would cause the string to be empty, by default do not cause en error, unless DOOTSTR_SLICE_ERRORS is defined.
+Otherwise, the function treats you like a baby and corrects your bounds to fit inside the string.
+NOTE: values of beg/end cannot have the most significant bit, set to 1.*/
+str_t *str_newslice(const dchar_t *cstring, size_t beg, size_t end, long step)
+{
+    if (!cstring)
+    {
+        STRFAIL("str_newslice: The passed address of the cstring is null.");
+    }
+    if (!(*cstring))
+    {
+        STR_SLICE_ERROR("str_newslice: The sliced cstring is empty.");
+        return str_newfrom(STR_EMPTY);
+    }
+    if (step == 0)
+    {
+        STR_SLICE_ERROR("str_newsloice: The step cannot be zero. Resulting slice is empty.");
+        return str_newfrom(STR_EMPTY);
+    }
+
+    size_t clen = _strlen(cstring);
+    beg = __str_boundIndex(beg, clen); // In case the index is 'from the end'
+    if (beg >= clen)
+    {
+        STR_SLICE_ERROR("str_newslice: Beg goes out of bounds from the right side.");
+        beg = clen - 1;
+    }
+    end = __str_boundIndex(end, clen); // In case the index is 'from the end'
+    if (end > clen)
+    {
+        STR_SLICE_ERROR("str_newslice: End goes out of bounds from the right side.");
+        end = clen;
+    }
+    if (end < beg)
+    {
+        STR_SLICE_ERROR("str_newslice: End is less than beg - resulting slice is invalid (empty).");
+        return str_newfrom(STR_EMPTY);
+    }
+    else if (end == beg)
+    {
+        STR_SLICE_ERROR("str_newslice: End is equal to beg - resulting slice is empty.");
+        return str_newfrom(STR_EMPTY);
+    }
+
+    size_t sliceLen = 1 + (end - beg - 1) / labs(step); // This is correct I think
+    str_t *slice = str_new(sliceLen + 1);
+    __str_slicecopy(slice->pstr, cstring + ((step > 0) ? beg : end - 1), sliceLen, step); // Negative steps start from the back
+    slice->strlen = sliceLen;
+    slice->pstr[slice->strlen] = '\0';
+    return slice;
+}
+
+/*@brief Create a new doostr by taking ownership of an existing heap allocated c-style string. Other means of construction are
+preferable, this is only for unique occasions.*/
+str_t *str_steal(dchar_t *cstring)
+{
+    str_t *pstr = (str_t*)malloc(sizeof(str_t));
+    if (!pstr)
+    {
+        STRERROR("malloc");
+    }
+    pstr->pstr = cstring;
+    pstr->cpindex = NULL;
+    pstr->mapped = 0;
+    pstr->head = 0;
+    pstr->strlen = _strlen(cstring);
+    (void)STR_UTF8_CHECK(cstring, pstr->strlen, "str_steal: The cstring is not valid UTF-8.");
+    pstr->capacity = pstr->strlen + 1;
+    STR_STAT_ALLOC(STR_CALLER, pstr->capacity); // Adopted, str_free() will count it as freed
+    return pstr;
+}
+
+#ifndef DOOTSTR_USE_WCHAR
+// Access hints for str_mapfile(), passed on to madvise()
+#define STR_MAP_NORMAL 0
+#define STR_MAP_SEQUENTIAL 1 // Read from start to end, pages can be read ahead and dropped early
+#define STR_MAP_RANDOM 2 // Read in random order, don't read ahead
+#define STR_MAP_WILLNEED 3 // The whole file will be needed soon
+
+/*@brief Returns a new read-only string with the contents of a file, mapped into memory instead of read into a buffer. Everything that
+only reads the string works on it without copying, the first change (or append) copies it into an ordinary heap block. The advice is
+one of the STR_MAP_* hints. Returns null and leaves errno set if the file can't be opened or mapped. Only available in narrow builds,
+the file is taken as it is, so an embedded null byte ends the string for the functions that look for the null terminator.*/
+str_t *str_mapfile(const char *path, int advice)
+{
+    if (!path)
+    {
+        STRFAIL("str_mapfile: The passed address of path was null.");
+    }
+    int fd = open(path, O_RDONLY);
+    if (fd == -1)
+    {
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) == -1)
+    {
+        int err = errno;
+        close(fd);
+        errno = err;
+        return NULL;
+    }
+    if ((uint64_t)st.st_size > STR_MAXSIZE)
+    {
+        close(fd);
+        errno = EFBIG;
+        return NULL;
+    }
+    size_t size = (size_t)st.st_size;
+    if (size == 0)
+    {
+        close(fd);
+        return str_newfrom(STR_EMPTY);
+    }
+    // One more page than the file needs, zero filled, so there's a null terminator even when the size is a multiple of the page size
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t maplen = (size / page + 1) * page;
+    char *base = (char *)mmap(NULL, maplen, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+    {
+        int err = errno;
+        close(fd);
+        errno = err;
+        return NULL;
+    }
+    if (mmap(base, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+    {
+        int err = errno;
+        munmap(base, maplen);
+        close(fd);
+        errno = err;
+        return NULL;
+    }
+    close(fd); // The mapping keeps the file
+    static const int hints[] = {MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED};
+    if (advice > STR_MAP_NORMAL && advice <= STR_MAP_WILLNEED)
+    {
+        madvise(base, size, hints[advice]);
+    }
+    (void)STR_UTF8_CHECK(base, size, "str_mapfile: The file is not valid UTF-8.");
+
+    str_t *pstr = (str_t*)malloc(sizeof(str_t));
+    if (!pstr)
+    {
+        STRERROR("malloc");
+    }
+    pstr->pstr = base;
+    pstr->cpindex = NULL;
+    pstr->mapped = maplen;
+    pstr->head = 0;
+    pstr->strlen = size;
+    pstr->capacity = 0; // Nothing to write into, so appending has to reallocate
+    return pstr;
+}
+#endif
+
+/*@brief Safely free a str_t object by passing the address of a pointer variable. The pointer will be set to null afterwards.*/
+void str_free(str_t **ppstr)
+{
+    if (!ppstr)
+    {
+        STRFAIL("str_free: The address of a str_t pointer variable was null. Remember to pass an address (&variable) of a pointer variable to this function.");
+    }
+    if (!*ppstr)
+    {
+        return;
+    }
+    if ((*ppstr)->mapped)
+    {
+        munmap((*ppstr)->pstr - (*ppstr)->head, (*ppstr)->mapped);
+    }
+    else if ((*ppstr)->pstr)
+    {
+        STR_STAT_FREE();
+        __str_dropblock(*ppstr);
+    }
+    if ((*ppstr)->cpindex)
+    {
+        free((*ppstr)->cpindex->offsets);
+        free((*ppstr)->cpindex);
+    }
+    free(*ppstr);
+    *ppstr = NULL;
+}
+
+/*
+This function is only to be used on stack allocated str_t objects. It handles deallocating their memory. 
+@param[in] pstr A pointer to a stack allocated str_t to be destroyed.
+*/
+void str_destroy(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_destroy: The address of a str_t was null. Cannot destroy it.");
+    }
+    if (pstr->mapped)
+    {
+        munmap(pstr->pstr - pstr->head, pstr->mapped);
+        pstr->pstr = NULL;
+        pstr->mapped = 0;
+        pstr->head = 0;
+    }
+    __str_mutate(pstr, 0);
+    if (pstr->pstr)
+    {
+        STR_STAT_FREE();
+        __str_dropblock(pstr);
+        pstr->pstr = NULL;
+    }
+    pstr->strlen = 0;
+    pstr->capacity = 0;
+}
+
+#pragma endregion
+
+#pragma region MODIFICATION
+
+void str_clear(str_t *pstr)
+{
+    str_destroy(pstr);
+}
+
+void str_assign_c(str_t *pstr, const dchar_t *cstring)
+{
+    if (!cstring)
+    {
+        STRFAIL("str_assign_c: Cannot assign to null char pointer.");
+    }
+    if (!pstr)
+    {
+        STRFAIL("str_assign_c: The address of a str_t was null.");
+    }
+    if (pstr->pstr == cstring)
+    {
+        return;
+    }
+    size_t clen = _strlen(cstring);
+    (void)STR_UTF8_CHECK(cstring, clen, "str_assign_c: The cstring is not valid UTF-8.");
+    __str_mutate(pstr, 0);
+    if (!pstr->pstr)
+    {
+        str_realloc(pstr, clen + 1);
+    }
+    else if (pstr->capacity < clen + 1)
+    {
+        str_realloc(pstr, clen + 1);
+    }
+    pstr->strlen = clen;
+    memcpy(pstr->pstr, cstring, (clen + 1) * sizeof(dchar_t));
+}
+
+void str_assign(str_t *pleft, const str_t *pright)
+{
+    if (!pright)
+    {
+        STRFAIL("str_assign: Cannot assign a null str_t to another.");
+    }
+    if (!pleft)
+    {
+        STRFAIL("str_assign: The address of the left str_t was null.");
+    }
+    if (pleft == pright)
+    {
+        return;
+    }
+    __str_mutate(pleft, 0);
+    if (!pleft->pstr)
+    {
+        str_realloc(pleft, pright->strlen);
+    }
+    else if (pleft->capacity < pright->strlen + 1)
+    {
+        str_realloc(pleft, pright->strlen + 1);
+    }
+    pleft->strlen = pright->strlen;
+    memcpy(pleft->pstr, pright->pstr, (pright->strlen + 1) * sizeof(dchar_t));
+}
+
+/*This function, unlike str_newslice by default allows you to use empty slices by setting beg the same as end.*/
+void str_assignSlice(str_t *pstr, const dchar_t *cstring, size_t beg, size_t end, long step)
+{
+    if (!cstring)
+    {
+        STRFAIL("str_assignSlice: The passed address of the cstring is null.");
+    }
+    if (!(*cstring))
+    {
+        STR_SLICE_ERROR("str_assignSlice: The sliced cstring is empty.");
+        str_assign_c(pstr, STR_EMPTY);
+        return;
+    }
+    if (step == 0)
+    {
+        STR_SLICE_ERROR("str_assignSlice: The step cannot be zero. Resulting slice is empty.");
+        str_assign_c(pstr, STR_EMPTY);
+        return;
+    }
+
+    size_t clen = _strlen(cstring);
+    beg = __str_boundIndex(beg, clen); // In case the index is 'from the end'
+    if (beg > clen)
+    {
+        STR_SLICE_ERROR("str_assignSlice: Beg goes out of bounds from the right side.");
+        beg = clen - 1;
+    }
+    end = __str_boundIndex(end, clen); // In case the index is 'from the end'
+    if (end > clen)
+    {
+        STR_SLICE_ERROR("str_assignSlice: End goes out of bounds from the right side.");
+        end = clen;
+    }
+    if (end < beg)
+    {
+        STR_SLICE_ERROR("str_assignSlice: End is less than beg - resulting slice is invalid (empty).");
+        str_assign_c(pstr, STR_EMPTY);
+        return;
+    }
+    else if (end == beg)
+    {
+        str_assign_c(pstr, STR_EMPTY);
+        return;
+    }
+    size_t sliceLen = 1 + (end - beg - 1) / labs(step); // This is correct I think
+    const dchar_t *first = cstring + ((step > 0) ? beg : end - 1); // Negative steps start from the back
+    if (pstr->pstr && cstring >= pstr->pstr && cstring <= pstr->pstr + pstr->strlen) // A slice of the string itself
+    {
+        size_t blocksize = sliceLen + 1;
+        dchar_t *newblock = __str_blockalloc(&blocksize);
+        __str_slicecopy(newblock, first, sliceLen, step);
+        str_destroy(pstr); // Gives back the block or the mapping that was sliced
+        STR_STAT_ALLOC(STR_CALLER, blocksize);
+        pstr->pstr = newblock;
+        pstr->capacity = blocksize;
+    }
+    else
+    {
+        __str_mutate(pstr, 0);
+        if (pstr->capacity < sliceLen + 1)
+        {
+            str_realloc(pstr, sliceLen + 1);
+        }
+        __str_slicecopy(pstr->pstr, first, sliceLen, step);
+    }
+    pstr->strlen = sliceLen;
+    pstr->pstr[pstr->strlen] = '\0';
+}
+
+/*@brief Reverses the string in place. In UTF-8 mode the order of the code points is reversed, so the string stays valid UTF-8.*/
+void str_reverse(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_reverse: The passed address of str_t was null.");
+    }
+    if (pstr->strlen < 2)
+    {
+        return;
+    }
+    __str_mutate(pstr, 0);
+    __str_reverse(pstr->pstr, pstr->strlen);
+    #ifdef DOOTSTR_USE_UTF8
+    char *p = pstr->pstr, *end = pstr->pstr + pstr->strlen;
+    while (p < end) // The continuation bytes of every sequence now come before its lead byte, so each sequence is turned back around
+    {
+        char *lead = p;
+        while (lead < end - 1 && (*lead & 0xC0) == 0x80)
+        {
+            ++lead;
+        }
+        __str_reverse(p, lead - p + 1);
+        p = lead + 1;
+    }
+    #endif
+}
+
+void str_append_c(str_t *pstr, const dchar_t *cstring)
+{
+    if (!pstr || !cstring)
+    {
+        STRFAIL("str_append: The address of a str_t or a c string was null.");
+    }
+    size_t rlen = _strlen(cstring);
+    (void)STR_UTF8_CHECK(cstring, rlen, "str_append_c: The cstring is not valid UTF-8.");
+    if (!pstr->pstr)
+    {
+        str_realloc(pstr, STR_NEWCAPACITY(rlen + 1));
+        pstr->strlen = 0; // It should be zero already, just making sure tho
+        if (!pstr->pstr)
+        {
+            STRERROR("realloc");
+        }
+    }
+    else if (pstr->capacity < pstr->strlen + rlen + 1)
+    {
+        str_realloc(pstr, STR_NEWCAPACITY(pstr->strlen + rlen + 1));
+        if (!pstr->pstr)
+        {
+            STRERROR("realloc");
+        }
+    }
+
+    memcpy(pstr->pstr + pstr->strlen, cstring, (rlen + 1) * sizeof(dchar_t));
+    pstr->strlen = pstr->strlen + rlen; 
+}
+
+void str_append(str_t *pleft, const str_t *pright)
+{
+    if (!pleft || !pright)
+    {
+        STRFAIL("str_append: The address of a str_t was null.");
+    }
+    if (!pright->pstr)
+    {
+        return;
+    }
+    if (!pleft->pstr)
+    {
+        str_realloc(pleft, STR_NEWCAPACITY(pright->strlen + 1));
+        pleft->strlen = 0; // It should be zero already, just making sure tho
+        if (!pleft->pstr)
+        {
+            STRERROR("realloc");
+        }
+    }
+    else if (pleft->capacity < pleft->strlen + pright->strlen + 1)
+    {
+        str_realloc(pleft, STR_NEWCAPACITY(pleft->strlen + pright->strlen + 1));
+        if (!pleft->pstr)
+        {
+            STRERROR("realloc");
+        }
+    }
+    memcpy(pleft->pstr + pleft->strlen, pright->pstr, (pright->strlen + 1) * sizeof(dchar_t));
+    pleft->strlen = pleft->strlen + pright->strlen;
+}
+
+/*@brief Internal function that makes sure there's room for extra more characters and the null terminator after the string's contents.
+Growing the block is counted under caller.*/
+void __str_reservefrom(str_t *pstr, size_t extra, const char *caller)
+{
+    if (!pstr->pstr)
+    {
+        __str_reallocfrom(pstr, STR_NEWCAPACITY(extra + 1), caller);
+        pstr->strlen = 0;
+    }
+    else if (pstr->capacity < pstr->strlen + extra + 1)
+    {
+        __str_reallocfrom(pstr, STR_NEWCAPACITY(pstr->strlen + extra + 1), caller);
+    }
+}
+#define __str_reserve(pstr, extra) __str_reservefrom((pstr), (extra), STR_CALLER)
+
+/*@brief Internal function that appends exactly len characters (which don't have to be null terminated) to the string.
+Growing the block is counted under caller.*/
+void __str_appendnfrom(str_t *pstr, const dchar_t *p, size_t len, const char *caller)
+{
+    __str_reservefrom(pstr, len, caller);
+    if (len > 0)
+    {
+        memcpy(pstr->pstr + pstr->strlen, p, len * sizeof(dchar_t));
+    }
+    pstr->strlen += len;
+    pstr->pstr[pstr->strlen] = '\0';
+}
+#define __str_appendn(pstr, p, len) __str_appendnfrom((pstr), (p), (len), STR_CALLER)
+
+/*
+@brief Inserts a cstring starting at a given position in the str_t object. If the str_t is empty only position 0 is valid.
+*/
+void str_insert_c(str_t *pstr, const dchar_t *cstring, size_t position)
+{
+    // if (position < 0)
+    // {
+    //     DOOTFAIL("str_insert_c: The position cannot be negative.");
+    // }
+    if (!pstr || !cstring)
+    {
+        STRFAIL("str_insert_c: The address of a str_t or a c string was null.");
+    }
+    if (position > pstr->strlen)
+    {
+        STRFAIL("str_insert_c: Position has to be no greater than string length.");
+    }
+    if (position == pstr->strlen)
+    {
+        str_append_c(pstr, cstring);
+        return;
+    }
+    size_t rlen = _strlen(cstring); 
+    (void)STR_UTF8_CHECK(cstring, rlen, "str_insert_c: The cstring is not valid UTF-8.");
+    if ((!pstr->pstr || pstr->strlen == 0) && position != 0)
+    {
+        STRFAIL("str_insert_c: Cannot insert at a non zero position to an empty string.");
+    }
+    __str_mutate(pstr, position);
+    // Block is empty - allocating new block //
+    if (!pstr->pstr)
+    {
+        str_realloc(pstr, STR_NEWCAPACITY(rlen + 1));
+        memcpy(pstr->pstr, cstring, (rlen + 1) * sizeof(dchar_t));
+        pstr->strlen = rlen;
+        return;
+    }
+    // Block is too small, allocating new block and manually moving //
+    if (pstr->capacity < pstr->strlen + rlen + 1)
+    {
+        size_t newcap = STR_NEWCAPACITY(pstr->strlen + rlen + 1);
+        dchar_t *newblock = __str_blockalloc(&newcap);
+        STR_STAT_REALLOC(STR_CALLER, pstr->pstr, newcap, pstr->strlen + rlen + 1);
+        memcpy(newblock, pstr->pstr, position * sizeof(dchar_t));
+        memcpy(newblock + position, cstring, rlen * sizeof(dchar_t));
+        memcpy(newblock + position + rlen, pstr->pstr + position, (pstr->strlen - position) * sizeof(dchar_t));
+        newblock[pstr->strlen + rlen] = '\0';
+        __str_dropblock(pstr);
+        pstr->pstr = newblock;
+        pstr->strlen = pstr->strlen + rlen;
+        pstr->capacity = newcap;
+        return;
+    }
+    // Block is big enough, just moving the tail and the null terminator //
+    memmove(pstr->pstr + position + rlen, pstr->pstr + position, (pstr->strlen - position + 1) * sizeof(dchar_t));
+    memcpy(pstr->pstr + position, cstring, rlen * sizeof(dchar_t));
+    pstr->strlen = pstr->strlen + rlen;
+    pstr->pstr[pstr->strlen] = '\0';
+}
+
+void str_insert(str_t *pleft, str_t *pright, size_t position)
+{
+    // if (position < 0)
+    // {
+    //     DOOTFAIL("str_insert: The position cannot be negative.");
+    // }
+    if (!pleft || !pright)
+    {
+        STRFAIL("str_insert: The address of a str_t was null.");
+    }
+    if (position > pleft->strlen)
+    {
+        STRFAIL("str_insert: Position has to be no greater than string length.");
+    }
+    if (position == pleft->strlen)
+    {
+        str_append(pleft, pright);
+        return;
+    }
+    if ((!pleft->pstr || pleft->strlen == 0) && position != 0)
+    {
+        STRFAIL("str_insert_c: Cannot insert at a non zero position to an empty string.");
+    }
+    __str_mutate(pleft, position);
+    // Block is empty - allocating new block //
+    if (!pleft->pstr)
+    {
+        str_realloc(pleft, STR_NEWCAPACITY(pright->strlen + 1));
+        memcpy(pleft->pstr, pright->pstr, (pright->strlen + 1) * sizeof(dchar_t));
+        pleft->strlen = pright->strlen;
+        return;
+    }
+    // Block is too small, allocating new block and manually moving //
+    if (pleft->capacity < pleft->strlen + pright->strlen + 1)
+    {
+        size_t newcap = STR_NEWCAPACITY(pleft->strlen + pright->strlen + 1);
+        dchar_t *newblock = __str_blockalloc(&newcap);
+        STR_STAT_REALLOC(STR_CALLER, pleft->pstr, newcap, pleft->strlen + pright->strlen + 1);
+        memcpy(newblock, pleft->pstr, position * sizeof(dchar_t));
+        memcpy(newblock + position, pright->pstr, pright->strlen * sizeof(dchar_t));
+        memcpy(newblock + position + pright->strlen, pleft->pstr + position, (pleft->strlen - position) * sizeof(dchar_t));
+        newblock[pleft->strlen + pright->strlen] = '\0';
+        __str_dropblock(pleft);
+        pleft->pstr = newblock;
+        pleft->strlen = pleft->strlen + pright->strlen;
+        pleft->capacity = newcap;
+        return;
+    }
+    // Block is big enough, just moving the tail and the null terminator //
+    memmove(pleft->pstr + position + pright->strlen, pleft->pstr + position, (pleft->strlen - position + 1) * sizeof(dchar_t));
+    memcpy(pleft->pstr + position, pright->pstr, pright->strlen * sizeof(dchar_t));
+    pleft->strlen = pleft->strlen + pright->strlen;
+    pleft->pstr[pleft->strlen] = '\0';
+}
+
+/*
+@brief Allocates a new doostr object containing the concatenated string. Not sure why someone would use this, but ok.
+*/
+str_t *str_concat(str_t *pleft, str_t *pright)
+{
+    if (!pleft || !pright)
+    {
+        STRFAIL("str_concat: One of the argument str_t was null.");
+    }
+    str_t *pstr = str_new(STR_NEWCAPACITY(pleft->strlen + pright->strlen + 1));
+    // From what I've read, calling memcpy(_, NULL, 0) could violate the standard, hence the check
+    if (pleft->pstr)
+    {
+        memcpy(pstr->pstr, pleft->pstr, pleft->strlen * sizeof(dchar_t)); 
+    }
+    if (pright->pstr)
+    {
+        memcpy(pstr->pstr + pleft->strlen, pright->pstr, pright->strlen * sizeof(dchar_t));
+    }
+    pstr->pstr[pleft->strlen + pright->strlen] = '\0';
+    return pstr;
+}
+
+/*
+@brief Removes a substring from a str_t.
+@param[in] pstr string object
+@param[in] position position to where the removed substr begins
+@param[in] length the length of the substring to remove. Must be at least 1.
+NOTE: As of currently I can't be bothered to implement safety measures against potential overflow
+caused by ex. position + length. Fix it later.
+*/
+void str_cut(str_t *pstr, size_t position, size_t length)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_cut: The passed address was null.");
+    }
+    if (length < 1)
+    {
+        return;
+    }
+    if (position + 1 > pstr->strlen || position + length > pstr->strlen)
+    {
+        STRFAIL("str_cut: The substring to be removed goes out of bounds of the string.");
+    }
+    if (position == 0) // Nothing has to move, see str_consume()
+    {
+        __str_advance(pstr, length);
+        return;
+    }
+    __str_mutate(pstr, position);
+    // Moving the null terminator as well
+    memmove(pstr->pstr + position, pstr->pstr + position + length, (pstr->strlen - position - length + 1) * sizeof(dchar_t));
+    pstr->strlen -= length;
+}
+
+/*@brief Removes the first n characters of the string in constant time. The string starts further into its memory block instead of moving,
+which is the way to take a string apart from the front (headers, fields, tokens). The block is compacted once more than half of it was
+consumed. In UTF-8 mode n is in bytes and has to end on a code point boundary.*/
+void str_consume(str_t *pstr, size_t n)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_consume: The passed address was null.");
+    }
+    if (n > pstr->strlen)
+    {
+        STRFAIL("str_consume: Cannot consume more characters than the string has.");
+    }
+    if (n == 0)
+    {
+        return;
+    }
+    #ifdef DOOTSTR_USE_UTF8
+    if ((pstr->pstr[n] & 0xC0) == 0x80)
+    {
+        STRFAIL("str_consume: n is not on a code point boundary.");
+    }
+    #endif
+    __str_advance(pstr, n);
+}
+
+size_t str_count(str_t *pstr, const dchar_t * seq); // Temporary solution to solve compilation issues.
+size_t str_countAny(str_t *pstr, const dchar_t * set);
+
+/*@brief Removes all occurances of seq from the string, taken from left to right without overlapping. Returns number of removed instances.*/
+size_t str_remove(str_t *pstr, const dchar_t *seq)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_remove: The passed address was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return 0;
+    }
+    if (!seq)
+    {
+        STRFAIL("str_remove: The passed address of seq was null.");
+    }
+    if (!(*seq))
+    {
+        return 0;
+    }
+    size_t count = str_count(pstr, seq); // Counts overlapping occurences too, so it's enough room for the positions
+    size_t rlen = _strlen(seq);
+    size_t *seqPos = (size_t*)malloc(sizeof(size_t)*count); // Array housing the positions of found substrings
+    if (!seqPos)
+    {
+        STRERROR("malloc");
+    }
+    size_t i = 0;
+    dchar_t *p = pstr->pstr;
+    while ((p = _strstr(p, seq)) != NULL)
+    {
+        //printf("pos: %ld\n", p - pstr->pstr);
+        seqPos[i++] = p - pstr->pstr;
+        p += rlen;
+    }
+    count = i; // The removed occurences don't overlap
+    size_t newLen = pstr->strlen - count *rlen;
+    __str_mutate(pstr, count ? seqPos[0] : pstr->strlen);
+    i = 0; // The current element to be moved to the left (or left alone)
+    size_t seqInd = 0; // The index of the next sequence to be ecnountered
+    size_t offset = 0; // The offset by which to move elements to the left
+    while (i < pstr->strlen + 1) // Plus 1 to copy '/0'
+    {
+        //printf("i: %ld\n", i);
+        if (seqInd < count && i == seqPos[seqInd])
+        {
+            i += rlen;
+            offset += rlen;
+            seqInd++;
+        }
+        else if (offset > 0)
+        {
+            pstr->pstr[i - offset] = pstr->pstr[i];
+            ++i;
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    free(seqPos);
+    pstr->strlen = newLen;
+    //pstr->pstr[pstr->strlen-1] = '\0';
+    return count;
+}
+
+/*@brief Removes all occurances of any character in set from the string. Returns number of removed instances.*/
+size_t str_removeAny(str_t *pstr, const dchar_t *set)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_removeAny: The passed address was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return 0;
+    }
+    if (!set)
+    {
+        STRFAIL("str_removeAny: The passed address of set was null.");
+    }
+    size_t count = str_countAny(pstr, set);
+    size_t newLen = pstr->strlen - count;
+    size_t *seqPos = (size_t*)malloc(sizeof(size_t)*count); // Array housing the positions of found substrings
+    if (!seqPos)
+    {
+        STRERROR("malloc");
+    }
+    size_t i = 0;
+    dchar_t *p = pstr->pstr;
+    while ((p = _strpbrk(p, set)) != NULL)
+    {
+        //printf("pos: %ld\n", p - pstr->pstr);
+        seqPos[i++] = p - pstr->pstr;
+        ++p;
+    }
+    __str_mutate(pstr, count ? seqPos[0] : pstr->strlen);
+    i = 0; // The current element to be moved to the left (or left alone)
+    size_t seqInd = 0; // The index of the next sequence to be ecnountered
+    size_t offset = 0; // The offset by which to move elements to the left
+    while (i < pstr->strlen + 1) // Plus 1 to copy '/0'
+    {
+        //printf("i: %ld\n", i);
+        if (seqInd < count && i == seqPos[seqInd])
+        {
+            offset++;
+            seqInd++;
+        }
+        else if (offset > 0)
+        {
+            pstr->pstr[i - offset] = pstr->pstr[i];
+        }
+        i++;
+    }
+    free(seqPos);
+    pstr->strlen = newLen;
+    //pstr->pstr[pstr->strlen-1] = '\0';
+    return count;
+}
+
+#pragma endregion
+
+#pragma region LOGICAL
+int str_isempty(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_isempty: The address of a str_t was null.");
+    }
+    return !pstr->pstr || (pstr->strlen == 0);
+}
+
+int str_isalnum(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_isalnum: The address of a str_t was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return 0;
+    }
+    #ifdef DOOTSTR_USE_UTF8
+    return __str_u8all(pstr->pstr, pstr->pstr + pstr->strlen, STR_U8_ALPHA | STR_U8_DIGIT, 0);
+    #else
+    dchar_t *p = pstr->pstr;
+    while (*p)
+    {
+        if (!isalnum(*p))
+        {
+            return 0;
+        }
+        ++p;
+    }
+    return 1;
+    #endif
+}
+
+int str_isalpha(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_isalpha: The address of a str_t was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return 0;
+    }
+    #ifdef DOOTSTR_USE_UTF8
+    return __str_u8all(pstr->pstr, pstr->pstr + pstr->strlen, STR_U8_ALPHA, 0);
+    #else
+    dchar_t *p = pstr->pstr;
+    while (*p)
+    {
+        if (!isalpha(*p))
+        {
+            return 0;
+        }
+        ++p;
+    }
+    return 1;
+    #endif
+}
+
+int str_isdigit(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_isdigit: The address of a str_t was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return 0;
+    }
+    #ifdef DOOTSTR_USE_UTF8
+    return __str_u8all(pstr->pstr, pstr->pstr + pstr->strlen, STR_U8_DIGIT, 0);
+    #else
+    dchar_t *p = pstr->pstr;
+    while (*p)
+    {
+        if (!isdigit(*p))
+        {
+            return 0;
+        }
+        ++p;
+    }
+    return 1;
+    #endif
+}
+
+int str_islower(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_islower: The address of a str_t was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return 0;
+    }
+    #ifdef DOOTSTR_USE_UTF8
+    return __str_u8all(pstr->pstr, pstr->pstr + pstr->strlen, 0, STR_U8_UPPER);
+    #else
+    dchar_t *p = pstr->pstr;
+    while (*p)
+    {
+        if (isalpha(*p) && !islower(*p))
+        {
+            return 0;
+        }
+        ++p;
+    }
+    return 1;
+    #endif
+}
+
+int str_isupper(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_isupper: The address of a str_t was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return 0;
+    }
+    #ifdef DOOTSTR_USE_UTF8
+    return __str_u8all(pstr->pstr, pstr->pstr + pstr->strlen, 0, STR_U8_LOWER);
+    #else
+    dchar_t *p = pstr->pstr;
+    while (*p)
+    {
+        if (isalpha(*p) && !isupper(*p))
+        {
+            return 0;
+        }
+        ++p;
+    }
+    return 1;
+    #endif
+}
+
+int str_isspace(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_isspace: The address of a str_t was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return 0;
+    }
+    #ifdef DOOTSTR_USE_UTF8
+    return __str_u8all(pstr->pstr, pstr->pstr + pstr->strlen, STR_U8_SPACE, 0);
+    #else
+    dchar_t *p = pstr->pstr;
+    while (*p)
+    {
+        if (!isspace(*p))
+        {
+            return 0;
+        }
+        ++p;
+    }
+    return 1;
+    #endif
+}
+
+/*Returns 1 if the string contains only characters from a given set*/
+int str_containsOnly(str_t *pstr, const dchar_t *set)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_containsOnly: The address of a str_t was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return 0;
+    }
+    dchar_t *p = pstr->pstr;
+    while (*p)
+    {
+        if (_strpbrk(p, set) != p)
+        {
+            return 0;
+        }
+        ++p;
+    }
+    return 1;
+}
+
+/*Returns 1 if the string contains any of the characters characters from a given set.
+The function is just a wrapper for _strpbrk(), but I kept it for convenience.*/
+int str_containsAny(str_t *pstr, const dchar_t *set)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_containsAny: The address of a str_t was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return 0;
+    }
+    return _strpbrk(pstr->pstr, set) != NULL;
+}
+
+/*Returns 1 if the string contains seq as a substr.
+The function is just a wrapper for _strstr() but I kept it for convenience.*/
+int str_containsSeq(str_t *pstr, const dchar_t *seq)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_containsAny: The address of a str_t was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return 0;
+    }
+    return _strstr(pstr->pstr, seq) != NULL;
+}
+#pragma endregion
+
+#pragma region TRANSFORM
+/*
+Case mapping. Wide builds and UTF-8 mode map every code point with the full Unicode mappings (so the length can change, "ß" becomes
+"SS" in upper case), plain narrow builds only map ASCII letters and leave other bytes alone. Nothing here depends on the locale.
+*/
+#if defined(__SSE2__) && (!defined(DOOTSTR_USE_WCHAR) || WCHAR_MAX > 0xFFFF)
+#define STR_CASE_SIMD
+#define STR_CASE_VECUNITS (16 / sizeof(dchar_t))
+
+// Sixteen set bytes followed by sixteen clear ones, loading at 16 - n gives a mask of the first n bytes
+const unsigned char __str_prefixmask[32] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+};
+
+/*@brief Internal function that loads STR_CASE_VECUNITS units from p and maps the ASCII ones before the first unit that isn't ASCII
+with the given kind (STR_CASE_*). Writes every unit to v, the ones after that prefix unchanged, and returns the length of the prefix.*/
+size_t __str_asciicasevec(const dchar_t *p, int kind, __m128i *v)
+{
+    __m128i x = _mm_loadu_si128((const __m128i *)p);
+    __m128i upper, lower, flip, bit;
+    #ifdef DOOTSTR_USE_WCHAR
+    int ascii = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(x, _mm_set1_epi32(~0x7F)), _mm_setzero_si128()));
+    upper = _mm_and_si128(_mm_cmpgt_epi32(x, _mm_set1_epi32('A' - 1)), _mm_cmpgt_epi32(_mm_set1_epi32('Z' + 1), x));
+    lower = _mm_and_si128(_mm_cmpgt_epi32(x, _mm_set1_epi32('a' - 1)), _mm_cmpgt_epi32(_mm_set1_epi32('z' + 1), x));
+    bit = _mm_set1_epi32(0x20);
+    #else
+    int ascii = _mm_movemask_epi8(x) ^ 0xFFFF;
+    upper = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('A' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), x));
+    lower = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), x));
+    bit = _mm_set1_epi8(0x20);
+    #endif
+    switch (kind)
+    {
+    case STR_CASE_UPPER:
+        flip = lower;
+        break;
+    case STR_CASE_SWAP:
+        flip = _mm_or_si128(upper, lower);
+        break;
+    default:
+        flip = upper;
+        break;
+    }
+    if (ascii == 0xFFFF)
+    {
+        *v = _mm_xor_si128(x, _mm_and_si128(flip, bit));
+        return STR_CASE_VECUNITS;
+    }
+    size_t bytes = __builtin_ctz(~ascii);
+    flip = _mm_and_si128(flip, _mm_loadu_si128((const __m128i *)(__str_prefixmask + 16 - bytes)));
+    *v = _mm_xor_si128(x, _mm_and_si128(flip, bit));
+    return bytes / sizeof(dchar_t);
+}
+#endif
+
+/*@brief Internal function that maps an ASCII code point with the given kind (STR_CASE_*).*/
+uint32_t __str_asciicase(uint32_t c, int kind)
+{
+    if ((kind != STR_CASE_UPPER && c - 'A' < 26) || ((kind == STR_CASE_UPPER || kind == STR_CASE_SWAP) && c - 'a' < 26))
+    {
+        return c ^ 0x20;
+    }
+    return c;
+}
+
+/*@brief Internal function that decodes the code point at p, UTF-8 in narrow builds and a single unit in wide ones, and returns its
+length in units. Invalid UTF-8 decodes one byte at a time to STR_CP_RAW | byte.*/
+size_t __str_cpdecode(const dchar_t *p, const dchar_t *end, uint32_t *cp)
+{
+    #ifdef DOOTSTR_USE_WCHAR
+    (void)end;
+    *cp = (uint32_t)*p;
+    return 1;
+    #else
+    const unsigned char *s = (const unsigned char *)p;
+    if (s[0] >= 0xC2 && s[0] < 0xE0 && end - p >= 2 && (s[1] & 0xC0) == 0x80) // Most non-ASCII text is two byte sequences
+    {
+        *cp = (uint32_t)(s[0] & 0x1F) << 6 | (s[1] & 0x3F);
+        return 2;
+    }
+    size_t n = __str_u8next(p, end, cp);
+    if (!n)
+    {
+        *cp = STR_CP_RAW | s[0];
+        return 1;
+    }
+    return n;
+    #endif
+}
+
+/*@brief Internal function that encodes a code point decoded by __str_cpdecode (or its mapping) to dst and returns its length in units.*/
+size_t __str_cpencode(dchar_t *dst, uint32_t cp)
+{
+    #ifdef DOOTSTR_USE_WCHAR
+    *dst = (dchar_t)cp;
+    return 1;
+    #else
+    if (cp & STR_CP_RAW)
+    {
+        *dst = (char)(cp & 0xFF);
+        return 1;
+    }
+    return __str_u8encode(dst, cp);
+    #endif
+}
+
+/*@brief Internal function that returns the length in units that __str_cpencode writes for a code point.*/
+size_t __str_cpunits(uint32_t cp)
+{
+    #ifdef DOOTSTR_USE_WCHAR
+    (void)cp;
+    return 1;
+    #else
+    if (cp < 0x80 || (cp & STR_CP_RAW))
+    {
+        return 1;
+    }
+    return (cp < 0x800) ? 2 : (cp < 0x10000) ? 3 : 4;
+    #endif
+}
+
+/*@brief Internal function that decodes the code point at p for case mapping like __str_cpdecode. Plain narrow builds only map ASCII,
+so there every other byte decodes to STR_CP_RAW | byte.*/
+size_t __str_casedecode(const dchar_t *p, const dchar_t *end, uint32_t *cp)
+{
+    #if defined(DOOTSTR_USE_WCHAR) || defined(DOOTSTR_USE_UTF8)
+    return __str_cpdecode(p, end, cp);
+    #else
+    (void)end;
+    *cp = (unsigned char)*p;
+    if (*cp >= 0x80)
+    {
+        *cp |= STR_CP_RAW;
+    }
+    return 1;
+    #endif
+}
+
+/*@brief Internal function that returns 1 if the code point is cased, which decides the final form of a capital sigma. Title case
+letters like U+1FAD count, even though they are neither upper nor lower case.*/
+int __str_iscased(uint32_t cp)
+{
+    return !(cp & STR_CP_RAW) && (__str_u8class(cp) & STR_U8_CASED);
+}
+
+/*@brief Internal function that maps the code point cp found at p in [beg, end) for __str_casetransform and returns the length
+of the mapping. Handles STR_CASE_SWAP and the final sigma rule: a capital sigma after a cased letter, but not before one, lowers to
+a final sigma. Case ignorable code points in between aren't skipped.*/
+size_t __str_casemapat(const dchar_t *beg, const dchar_t *p, const dchar_t *end, uint32_t cp, int kind, uint32_t *out)
+{
+    if (kind == STR_CASE_SWAP)
+    {
+        unsigned flags = (cp & STR_CP_RAW) ? 0 : __str_u8class(cp);
+        if (flags & STR_U8_UPPER)
+        {
+            kind = STR_CASE_LOWER;
+        }
+        else if (flags & STR_U8_LOWER)
+        {
+            kind = STR_CASE_UPPER;
+        }
+        else
+        {
+            *out = cp;
+            return 1;
+        }
+    }
+    if (cp == 0x3A3 && kind == STR_CASE_LOWER && p > beg)
+    {
+        const dchar_t *prev = p - 1;
+        #ifndef DOOTSTR_USE_WCHAR
+        while (prev > beg && p - prev < 4 && ((unsigned char)*prev & 0xC0) == 0x80)
+        {
+            --prev;
+        }
+        #endif
+        uint32_t before, after = 0;
+        __str_casedecode(prev, p, &before);
+        const dchar_t *next = p + __str_casedecode(p, end, &after);
+        if (next < end)
+        {
+            __str_casedecode(next, end, &after);
+        }
+        if (__str_iscased(before) && (next == end || !__str_iscased(after)))
+        {
+            *out = 0x3C2;
+            return 1;
+        }
+    }
+    return __str_casemap(cp, kind, out);
+}
+
+/*@brief Internal function that applies a case mapping (STR_CASE_*) to the whole string. Works in place while the mappings keep
+the length of what they replace, then measures the rest and rebuilds it in a new block.*/
+void __str_casetransform(str_t *pstr, int kind)
+{
+    if (!pstr->pstr)
+    {
+        return;
+    }
+    __str_mutate(pstr, 0);
+    dchar_t *beg = pstr->pstr, *p = beg, *end = beg + pstr->strlen;
+    uint32_t cp, out[STR_CASE_MAXLEN];
+    while (p < end)
+    {
+        #ifdef STR_CASE_SIMD
+        if ((size_t)(end - p) >= STR_CASE_VECUNITS)
+        {
+            __m128i v;
+            size_t k = __str_asciicasevec(p, kind, &v);
+            _mm_storeu_si128((__m128i *)p, v);
+            p += k;
+            if (k == STR_CASE_VECUNITS)
+            {
+                continue;
+            }
+        }
+        #endif
+        if ((uint32_t)*p < 0x80)
+        {
+            *p = (dchar_t)__str_asciicase((uint32_t)*p, kind);
+            p++;
+            continue;
+        }
+        size_t n = __str_casedecode(p, end, &cp);
+        if (__str_casemapat(beg, p, end, cp, kind, out) != 1 || __str_cpunits(out[0]) != n)
+        {
+            break;
+        }
+        p += __str_cpencode(p, out[0]);
+    }
+    if (p == end)
+    {
+        return;
+    }
+
+    size_t newLen = p - beg;
+    for (const dchar_t *q = p; q < end;)
+    {
+        if ((uint32_t)*q < 0x80)
+        {
+            newLen++;
+            q++;
+            continue;
+        }
+        size_t n = __str_casedecode(q, end, &cp);
+        size_t m = __str_casemapat(beg, q, end, cp, kind, out);
+        for (size_t i = 0; i < m; i++)
+        {
+            newLen += __str_cpunits(out[i]);
+        }
+        q += n;
+    }
+    size_t blocksize = (pstr->capacity < newLen + 1) ? newLen + 1 : pstr->capacity;
+    dchar_t *newblock = __str_blockalloc(&blocksize); // Pooled blocks can be bigger
+    STR_STAT_REALLOC(STR_CALLER, pstr->pstr, blocksize, newLen + 1);
+    memcpy(newblock, beg, (p - beg) * sizeof(dchar_t));
+    dchar_t *w = newblock + (p - beg);
+    while (p < end)
+    {
+        if ((uint32_t)*p < 0x80)
+        {
+            *w++ = (dchar_t)__str_asciicase((uint32_t)*p++, kind);
+            continue;
+        }
+        size_t n = __str_casedecode(p, end, &cp);
+        size_t m = __str_casemapat(beg, p, end, cp, kind, out);
+        for (size_t i = 0; i < m; i++)
+        {
+            w += __str_cpencode(w, out[i]);
+        }
+        p += n;
+    }
+    *w = '\0';
+    __str_dropblock(pstr);
+    pstr->pstr = newblock;
+    pstr->capacity = blocksize;
+    pstr->strlen = newLen;
+}
+
+/*@brief Converts the string to upper case.*/
+void str_upper(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_upper: The passed address was null.");
+    }
+    __str_casetransform(pstr, STR_CASE_UPPER);
+}
+
+/*@brief Converts the string to lower case.*/
+void str_lower(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_lower: The passed address was null.");
+    }
+    __str_casetransform(pstr, STR_CASE_LOWER);
+}
+
+/*@brief Converts upper case characters to lower case and lower case characters to upper case.*/
+void str_swapcase(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_swapcase: The passed address was null.");
+    }
+    __str_casetransform(pstr, STR_CASE_SWAP);
+}
+
+/*@brief Replaces the string with its full case folding, the form used for caseless matching (see str_casecmp). It's mostly the lower
+case, but it folds some characters further, "ß" becomes "ss" for example.*/
+void str_casefold(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_casefold: The passed address was null.");
+    }
+    __str_casetransform(pstr, STR_CASE_FOLD);
+}
+
+/*@brief Internal function that compares [p, pend) and [q, qend) ignoring case, for str_casecmp() and str_casecmp_v().*/
+int __str_casecmpn(const dchar_t *p, const dchar_t *pend, const dchar_t *q, const dchar_t *qend)
+{
+    uint32_t fa[STR_CASE_MAXLEN], fb[STR_CASE_MAXLEN], cp;
+    size_t na = 0, ia = 0, nb = 0, ib = 0; // Folded code points of the current code point of each string, and how many were compared
+    for (;;)
+    {
+        #ifdef STR_CASE_SIMD
+        if (ia == na && ib == nb && (size_t)(pend - p) >= STR_CASE_VECUNITS && (size_t)(qend - q) >= STR_CASE_VECUNITS)
+        {
+            __m128i va, vb;
+            size_t ka = __str_asciicasevec(p, STR_CASE_FOLD, &va), kb = __str_asciicasevec(q, STR_CASE_FOLD, &vb);
+            size_t same = __builtin_ctz(_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)) ^ 0x1FFFF) / sizeof(dchar_t);
+            size_t k = (ka < kb) ? ka : kb;
+            k = (same < k) ? same : k; // Equal ASCII units, the unit after them is compared below
+            p += k;
+            q += k;
+            if (k == STR_CASE_VECUNITS)
+            {
+                continue;
+            }
+        }
+        #endif
+        if (ia == na && ib == nb && p < pend && q < qend && (uint32_t)*p < 0x80 && (uint32_t)*q < 0x80)
+        {
+            uint32_t ca = __str_asciicase((uint32_t)*p++, STR_CASE_FOLD), cb = __str_asciicase((uint32_t)*q++, STR_CASE_FOLD);
+            if (ca != cb)
+            {
+                return (ca < cb) ? -1 : 1;
+            }
+            continue;
+        }
+        if (ia == na && p < pend)
+        {
+            p += __str_casedecode(p, pend, &cp);
+            na = __str_casemap(cp, STR_CASE_FOLD, fa);
+            ia = 0;
+        }
+        if (ib == nb && q < qend)
+        {
+            q += __str_casedecode(q, qend, &cp);
+            nb = __str_casemap(cp, STR_CASE_FOLD, fb);
+            ib = 0;
+        }
+        if (ia == na || ib == nb)
+        {
+            return (ia < na) - (ib < nb);
+        }
+        if (fa[ia] != fb[ib])
+        {
+            return (fa[ia] < fb[ib]) ? -1 : 1;
+        }
+        ia++;
+        ib++;
+    }
+}
+
+/*@brief Compares two strings ignoring case, by the code points of their full case foldings. Returns a negative value, zero or a positive
+value like strcmp. "Straße" and "STRASSE" compare equal.*/
+int str_casecmp(const str_t *a, const str_t *b)
+{
+    if (!a || !b)
+    {
+        STRFAIL("str_casecmp: The address of a str_t was null.");
+    }
+    const dchar_t *p = a->pstr ? a->pstr : STR_EMPTY, *q = b->pstr ? b->pstr : STR_EMPTY;
+    return __str_casecmpn(p, p + a->strlen, q, q + b->strlen);
+}
+
+/*@brief Returns a hash of the string that ignores case: strings that str_casecmp finds equal hash the same. It's 64-bit FNV-1a over
+the code points of the full case folding.*/
+uint64_t str_casehash(const str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_casehash: The address of a str_t was null.");
+    }
+    const dchar_t *p = pstr->pstr ? pstr->pstr : STR_EMPTY, *end = p + pstr->strlen;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    uint32_t cp, out[STR_CASE_MAXLEN];
+    while (p < end)
+    {
+        #ifdef STR_CASE_SIMD
+        if ((size_t)(end - p) >= STR_CASE_VECUNITS)
+        {
+            __m128i v;
+            dchar_t folded[STR_CASE_VECUNITS];
+            size_t k = __str_asciicasevec(p, STR_CASE_FOLD, &v);
+            _mm_storeu_si128((__m128i *)folded, v);
+            for (size_t i = 0; i < k; i++)
+            {
+                hash = (hash ^ (uint32_t)folded[i]) * 0x100000001b3ULL;
+            }
+            p += k;
+            if (k == STR_CASE_VECUNITS || p == end)
+            {
+                continue;
+            }
+        }
+        #endif
+        if ((uint32_t)*p < 0x80)
+        {
+            hash = (hash ^ __str_asciicase((uint32_t)*p++, STR_CASE_FOLD)) * 0x100000001b3ULL;
+            continue;
+        }
+        p += __str_casedecode(p, end, &cp);
+        size_t m = __str_casemap(cp, STR_CASE_FOLD, out);
+        for (size_t i = 0; i < m; i++)
+        {
+            hash = (hash ^ out[i]) * 0x100000001b3ULL;
+        }
+    }
+    return hash;
+}
+
+// Normalization properties, see __str_normprops(). The low byte is the canonical combining class.
+#define STR_NORM_NFD_NO 0x100 // Can't appear in NFD, must match tools/gentables.py
+#define STR_NORM_NFC_NO 0x200 // Can't appear in NFC
+#define STR_NORM_NFC_MAYBE 0x400 // Can combine with what's before it, so it may not appear in NFC
+#define STR_NORM_NFCQUICK 0x300 // Code points below this are in NFC whatever surrounds them
+#define STR_NORM_NFDQUICK 0xC0 // The same for NFD
+// Hangul syllables are composed and decomposed algorithmically
+#define STR_HANGUL_SBASE 0xAC00
+#define STR_HANGUL_LBASE 0x1100
+#define STR_HANGUL_VBASE 0x1161
+#define STR_HANGUL_TBASE 0x11A7
+#define STR_HANGUL_LCOUNT 19
+#define STR_HANGUL_VCOUNT 21
+#define STR_HANGUL_TCOUNT 28
+#define STR_HANGUL_SCOUNT (STR_HANGUL_LCOUNT * STR_HANGUL_VCOUNT * STR_HANGUL_TCOUNT)
+
+/*@brief Internal function that returns the normalization properties (canonical combining class | STR_NORM_* bits) of a code point.*/
+unsigned __str_normprops(uint32_t cp)
+{
+    if (cp > 0x10FFFF)
+    {
+        return 0;
+    }
+    return __str_normstage2[__str_normstage1[cp / STR_CASE_BLOCK] * STR_CASE_BLOCK + cp % STR_CASE_BLOCK];
+}
+
+/*@brief Internal function that runs the quick check for NFC (nfc set) or NFD over [beg, end). Returns 1 if the text is normalized,
+otherwise 0 and the offset of the first code point that isn't known to be normalized in *at. Skips runs of code points below
+STR_NORM_NFCQUICK (or STR_NORM_NFDQUICK) a vector at a time.*/
+int __str_normquick(const dchar_t *beg, const dchar_t *end, int nfc, size_t *at)
+{
+    unsigned fail = nfc ? (STR_NORM_NFC_NO | STR_NORM_NFC_MAYBE) : STR_NORM_NFD_NO;
+    uint32_t quick = nfc ? STR_NORM_NFCQUICK : STR_NORM_NFDQUICK;
+    unsigned lastCcc = 0;
+    const dchar_t *p = beg;
+    #ifdef STR_CASE_SIMD
+    #ifdef DOOTSTR_USE_WCHAR
+    __m128i limit = _mm_set1_epi32(quick);
+    #else
+    __m128i limit = _mm_set1_epi8((char)(nfc ? 0xCB : 0xC2)); // Largest lead byte of the code points below quick
+    #endif
+    #endif
+    while (p < end)
+    {
+        #ifdef STR_CASE_SIMD
+        if ((size_t)(end - p) >= STR_CASE_VECUNITS)
+        {
+            __m128i x = _mm_loadu_si128((const __m128i *)p);
+            #ifdef DOOTSTR_USE_WCHAR
+            __m128i below = _mm_and_si128(_mm_cmplt_epi32(x, limit), _mm_cmpgt_epi32(x, _mm_set1_epi32(-1)));
+            #else
+            __m128i below = _mm_cmpeq_epi8(_mm_min_epu8(x, limit), x);
+            #endif
+            if (_mm_movemask_epi8(below) == 0xFFFF)
+            {
+                lastCcc = 0;
+                p += STR_CASE_VECUNITS; // Can stop inside a sequence, its continuation bytes decode as raw bytes below
+                continue;
+            }
+        }
+        #endif
+        uint32_t cp;
+        size_t n = __str_cpdecode(p, end, &cp);
+        unsigned props = (cp < quick) ? 0 : __str_normprops(cp);
+        unsigned ccc = props & 0xFF;
+        if ((props & fail) || (ccc && lastCcc > ccc))
+        {
+            *at = p - beg;
+            return 0;
+        }
+        lastCcc = ccc;
+        p += n;
+    }
+    return 1;
+}
+
+/*@brief Internal function that returns the offset of the closest code point at or before offset at that normalizing can start from,
+a starter that can't combine with anything before it.*/
+size_t __str_normsafe(const dchar_t *beg, const dchar_t *end, size_t at)
+{
+    const dchar_t *p = beg + at;
+    for (;;)
+    {
+        uint32_t cp;
+        __str_cpdecode(p, end, &cp);
+        unsigned props = __str_normprops(cp);
+        if (p == beg || !(props & (0xFF | STR_NORM_NFC_NO | STR_NORM_NFC_MAYBE)))
+        {
+            return p - beg;
+        }
+        --p;
+        #ifndef DOOTSTR_USE_WCHAR
+        for (int i = 0; i < 3 && p > beg && ((unsigned char)*p & 0xC0) == 0x80; i++)
+        {
+            --p;
+        }
+        #endif
+    }
+}
+
+/*@brief Internal function that writes the full canonical decomposition of a code point to out and returns its length.*/
+size_t __str_decompose(uint32_t cp, uint32_t *out)
+{
+    if (cp - STR_HANGUL_SBASE < STR_HANGUL_SCOUNT)
+    {
+        uint32_t s = cp - STR_HANGUL_SBASE, t = s % STR_HANGUL_TCOUNT;
+        out[0] = STR_HANGUL_LBASE + s / (STR_HANGUL_VCOUNT * STR_HANGUL_TCOUNT);
+        out[1] = STR_HANGUL_VBASE + (s % (STR_HANGUL_VCOUNT * STR_HANGUL_TCOUNT)) / STR_HANGUL_TCOUNT;
+        out[2] = STR_HANGUL_TBASE + t;
+        return t ? 3 : 2;
+    }
+    if (__str_normprops(cp) & STR_NORM_NFD_NO)
+    {
+        size_t lo = 0, hi = sizeof(__str_decomp) / sizeof(__str_decomp[0]) / 2;
+        while (lo < hi)
+        {
+            size_t mid = (lo + hi) / 2;
+            if (__str_decomp[2 * mid] < cp)
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+        uint32_t entry = __str_decomp[2 * lo + 1];
+        memcpy(out, __str_decompcps + (entry & 0xFFFF), (entry >> 16) * sizeof(uint32_t));
+        return entry >> 16;
+    }
+    *out = cp;
+    return 1;
+}
+
+/*@brief Internal function that returns the primary composite of two code points, or 0 if they don't compose.*/
+uint32_t __str_compose(uint32_t a, uint32_t b)
+{
+    if (a - STR_HANGUL_LBASE < STR_HANGUL_LCOUNT && b - STR_HANGUL_VBASE < STR_HANGUL_VCOUNT)
+    {
+        return STR_HANGUL_SBASE + ((a - STR_HANGUL_LBASE) * STR_HANGUL_VCOUNT + (b - STR_HANGUL_VBASE)) * STR_HANGUL_TCOUNT;
+    }
+    if (a - STR_HANGUL_SBASE < STR_HANGUL_SCOUNT && (a - STR_HANGUL_SBASE) % STR_HANGUL_TCOUNT == 0 &&
+        b - STR_HANGUL_TBASE - 1 < STR_HANGUL_TCOUNT - 1)
+    {
+        return a + (b - STR_HANGUL_TBASE);
+    }
+    if (a > 0x10FFFF || b > 0x10FFFF)
+    {
+        return 0;
+    }
+    uint64_t key = (uint64_t)a << 21 | b;
+    size_t lo = 0, hi = sizeof(__str_compkeys) / sizeof(__str_compkeys[0]);
+    while (lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+        if (__str_compkeys[mid] < key)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return (lo < sizeof(__str_compkeys) / sizeof(__str_compkeys[0]) && __str_compkeys[lo] == key) ? __str_composites[lo] : 0;
+}
+
+/*@brief Internal function that normalizes the string to NFC (nfc set) or NFD. Returns without touching the string when the quick check
+passes, otherwise decomposes, reorders and (for NFC) recomposes from the last safe starter before the first failing code point, and
+only replaces that part of the string if the result differs.*/
+void __str_normalize(str_t *pstr, int nfc)
+{
+    if (!pstr->pstr)
+    {
+        return;
+    }
+    const dchar_t *beg = pstr->pstr, *end = beg + pstr->strlen;
+    size_t at;
+    if (__str_normquick(beg, end, nfc, &at))
+    {
+        return;
+    }
+    size_t from = __str_normsafe(beg, end, at);
+
+    size_t count = 0, capacity = (end - beg - from) + 16, oldCount = 0;
+    uint32_t *cps = (uint32_t *)malloc(capacity * sizeof(uint32_t));
+    if (!cps)
+    {
+        STRERROR("malloc");
+    }
+    for (const dchar_t *p = beg + from; p < end; oldCount++)
+    {
+        uint32_t cp;
+        p += __str_cpdecode(p, end, &cp);
+        if (capacity - count < 4) // Longest decomposition
+        {
+            capacity = STR_NEWCAPACITY(capacity);
+            cps = (uint32_t *)realloc(cps, capacity * sizeof(uint32_t));
+            if (!cps)
+            {
+                STRERROR("realloc");
+            }
+        }
+        count += __str_decompose(cp, cps + count);
+    }
+
+    for (size_t i = 1; i < count; i++) // Canonical ordering, a stable sort of every run of non-starters by combining class
+    {
+        uint32_t cp = cps[i];
+        unsigned ccc = __str_normprops(cp) & 0xFF;
+        size_t j = i;
+        while (ccc && j > 0 && (__str_normprops(cps[j - 1]) & 0xFF) > ccc)
+        {
+            cps[j] = cps[j - 1];
+            j--;
+        }
+        cps[j] = cp;
+    }
+
+    if (nfc)
+    {
+        size_t w = 0, starter = SIZE_MAX;
+        unsigned lastCcc = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            uint32_t cp = cps[i];
+            unsigned ccc = __str_normprops(cp) & 0xFF;
+            if (starter != SIZE_MAX && (w == starter + 1 || (lastCcc && lastCcc < ccc))) // Not blocked from the starter
+            {
+                uint32_t composite = __str_compose(cps[starter], cp);
+                if (composite)
+                {
+                    cps[starter] = composite;
+                    continue;
+                }
+            }
+            if (!ccc)
+            {
+                starter = w;
+            }
+            lastCcc = ccc;
+            cps[w++] = cp;
+        }
+        count = w;
+    }
+
+    size_t newLen = from;
+    for (size_t i = 0; i < count; i++)
+    {
+        newLen += __str_cpunits(cps[i]);
+    }
+    if (newLen == pstr->strlen && count == oldCount) // Passed as maybe, check whether anything changed
+    {
+        const dchar_t *p = beg + from;
+        size_t i = 0;
+        uint32_t cp;
+        while (i < count && (p += __str_cpdecode(p, end, &cp), cp == cps[i]))
+        {
+            i++;
+        }
+        if (i == count)
+        {
+            free(cps);
+            return;
+        }
+    }
+
+    __str_mutate(pstr, from);
+    beg = pstr->pstr;
+    size_t blocksize = (pstr->capacity < newLen + 1) ? newLen + 1 : pstr->capacity;
+    dchar_t *newblock = __str_blockalloc(&blocksize); // Pooled blocks can be bigger
+    STR_STAT_REALLOC(STR_CALLER, pstr->pstr, blocksize, newLen + 1);
+    memcpy(newblock, beg, from * sizeof(dchar_t));
+    dchar_t *w = newblock + from;
+    for (size_t i = 0; i < count; i++)
+    {
+        w += __str_cpencode(w, cps[i]);
+    }
+    *w = '\0';
+    free(cps);
+    __str_dropblock(pstr);
+    pstr->pstr = newblock;
+    pstr->capacity = blocksize;
+    pstr->strlen = newLen;
+}
+
+/*@brief Normalizes the string to NFC, canonical composition. Strings that are already in NFC (most text is) are found in one pass
+and left alone. Narrow strings are read as UTF-8, invalid bytes are left as they are.*/
+void str_normalize_nfc(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_normalize_nfc: The passed address was null.");
+    }
+    __str_normalize(pstr, 1);
+}
+
+/*@brief Normalizes the string to NFD, canonical decomposition. Strings that are already in NFD are found in one pass and left alone.
+Narrow strings are read as UTF-8, invalid bytes are left as they are.*/
+void str_normalize_nfd(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_normalize_nfd: The passed address was null.");
+    }
+    __str_normalize(pstr, 0);
+}
+
+/*@brief Counts how many times a sequence is found in a string.*/
+size_t str_count(str_t *pstr, const dchar_t * seq)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_count: The passed address was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return 0;
+    }
+    if (!seq)
+    {
+        STRFAIL("str_count: The passed address of seq was null.");
+    }
+    if (!(*seq))
+    {
+        STRFAIL("str_count: The passed sequence is empty.");
+    }
+    size_t count = 0;
+    dchar_t *p = pstr->pstr;
+    while ((p = _strstr(p, seq)) != NULL)
+    {
+        count++;
+        p++;
+    }
+    return count;
+}
+
+/*@brief Counts how many times a character from a set is found in the string.*/
+size_t str_countAny(str_t *pstr, const dchar_t * set)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_countAny: The passed address was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return 0;
+    }
+    if (!set)
+    {
+        STRFAIL("str_countAny: The passed address of set was null.");
+    }
+    if (!(*set))
+    {
+        STRFAIL("str_count: The passed set is empty.");
+    }
+    size_t count = 0;
+    dchar_t *p = pstr->pstr;
+    while ((p = _strpbrk(p, set)) != NULL)
+    {
+        count++;
+        p++;
+    }
+    return count;
+}
+
+/*@brief Replaces each full occurance of oldval with newval, taking them from left to right without overlapping (like str_replace_mt()).
+Returns the number of replaced instances. Always causes reallocation.
+NOTE: This *can* be used for removing substrings, but isn't recomended as this function causes an unnecessary reallocation. In such cases
+use str_remove() instead!*/
+size_t str_replace(str_t *pstr, const dchar_t *oldval, const dchar_t *newval)  // I suck at C, debugging this was hell...
+{
+    if (!pstr)
+    {
+        STRFAIL("str_replace: The passed address was null.");
+    }
+    if (!oldval)
+    {
+        STRFAIL("str_replace: The passed address of oldval was null.");
+    }
+    if (!newval)
+    {
+        STRFAIL("str_replace: The passed address of newval was null.");
+    }
+    size_t count = str_count(pstr, oldval); // Counts overlapping occurences too, so it's enough room for the offsets
+    size_t rlen = _strlen(newval), llen = _strlen(oldval);
+    size_t *offsets = (size_t*)malloc(sizeof(size_t)*count);
+    if (!offsets)
+    {
+        STRERROR("malloc");
+    }
+    size_t i = 0;
+    dchar_t *p = pstr->pstr;
+    while ((p = _strstr(p, oldval)) != NULL)
+    {
+        offsets[i++] = p - pstr->pstr;
+        p += llen;
+    }
+    count = i; // The replaced occurences don't overlap
+    size_t newLen = (rlen > llen) ? pstr->strlen + count*(rlen-llen) : pstr->strlen - count*(llen-rlen);
+    __str_mutate(pstr, count ? offsets[0] : pstr->strlen);
+
+    dchar_t *newblock;
+    size_t blocksize;
+    if (pstr->capacity < newLen + 1)
+    {
+        blocksize = newLen + 1;
+    }
+    else
+    {
+        blocksize = pstr->capacity;
+    }
+    newblock = __str_blockalloc(&blocksize);
+    memset(newblock, 0, blocksize);
+    STR_STAT_REALLOC(STR_CALLER, pstr->pstr, blocksize, newLen + 1);
+
+    i = 0;
+    size_t indOff = 0;
+    size_t oldpos = 0;
+    while (i < newLen + 1) // Plus 1 to copy '/0'
+    {
+        if (indOff < count && oldpos == offsets[indOff])
+        {
+            memcpy(newblock + i, newval, rlen * sizeof(dchar_t));
+            i += rlen;
+            oldpos += llen;
+            indOff++;
+        }
+        else
+        {
+            newblock[i++] = pstr->pstr[oldpos];
+            oldpos++;
+        }   
+    }
+    //newblock[blocksize-1] = '\0';
+    __str_dropblock(pstr);
+    free(offsets);
+    pstr->pstr = newblock;
+    pstr->capacity = blocksize;
+    pstr->strlen = newLen;
+    return count;
+}
+
+/*@brief Replaces any of the characters in set with newval. Returns the number of replaced instances. Always causes reallocation.
+NOTE: This *can* be used for removing characters, but isn't recomended as this function causes an unnecessary reallocation. In such cases
+use str_removeAny() instead!*/
+size_t str_replaceAny(str_t *pstr, const dchar_t *set, const dchar_t *newval)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_replaceAny: The passed address was null.");
+    }
+    if (!set)
+    {
+        STRFAIL("str_replaceAny: The passed address of set was null.");
+    }
+    if (!newval)
+    {
+        STRFAIL("str_replaceAny: The passed address of newval was null.");
+    }
+    size_t count = str_countAny(pstr, set);
+    size_t rlen = _strlen(newval);
+    size_t extraChars = count * rlen - count; // Additional needed characters
+    size_t *offsets = (size_t*)malloc(sizeof(size_t)*count);
+    if (!offsets)
+    {
+        STRERROR("malloc");
+    }
+    size_t i = 0;
+    dchar_t *p = pstr->pstr;
+    while ((p = _strpbrk(p, set)) != NULL)
+    {
+        offsets[i++] = p - pstr->pstr;
+        p++;
+    }
+    __str_mutate(pstr, count ? offsets[0] : pstr->strlen);
+
+    dchar_t *newblock;
+    size_t blocksize;
+    if (pstr->capacity < pstr->strlen + extraChars + 1)
+    {
+        blocksize = pstr->strlen + extraChars + 1;
+    }
+    else
+    {
+        blocksize = pstr->capacity;
+    }
+    newblock = __str_blockalloc(&blocksize);
+    STR_STAT_REALLOC(STR_CALLER, pstr->pstr, blocksize, pstr->strlen + extraChars + 1);
+
+    i = 0;
+    size_t indOff = 0;
+    size_t oldpos = 0;
+    while (i < pstr->strlen + extraChars + 1) // Plus 1 to copy '/0'
+    {
+        if (indOff < count && oldpos == offsets[indOff])
+        {
+            memcpy(newblock + i, newval, rlen * sizeof(dchar_t));
+            i += rlen;
+            indOff++;
+        }
+        else
+        {
+            newblock[i++] = pstr->pstr[oldpos];
+        }
+        oldpos++;
+    }
+    __str_dropblock(pstr);
+    free(offsets);
+    pstr->pstr = newblock;
+    pstr->capacity = blocksize;
+    pstr->strlen = pstr->strlen + extraChars;
+    return count;
+}
+
+/*@brief Replaces any of the characters in set with a char c. Returns the number of replaced instances.*/
+size_t str_replaceAnyCh(str_t *pstr, const dchar_t *set, char c)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_replaceAnyCh: The passed address was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return 0;
+    }
+    if (!set)
+    {
+        STRFAIL("str_replaceAnyCh: The passed address of seq was null.");
+    }
+    size_t count = 0;
+    dchar_t *p = pstr->pstr;
+    while ((p = _strpbrk(p, set)) != NULL)
+    {
+        if (count == 0)
+        {
+            size_t pos = p - pstr->pstr;
+            __str_mutate(pstr, pos);
+            p = pstr->pstr + pos;
+        }
+        *p = c;
+        count++;
+        p++;
+    }
+    return count;
+}
+
+/*@brief Internal function that returns the number of whitespace characters at the start of [p, p + len).
+In UTF-8 mode whitespace code points are recognized and the result is in bytes.*/
+size_t __str_lspace(const dchar_t *p, size_t len)
+{
+    size_t i = 0;
+    #ifdef DOOTSTR_USE_UTF8
+    uint32_t cp;
+    size_t n;
+    while (i < len && (n = __str_u8next(p + i, p + len, &cp)) && (__str_u8class(cp) & STR_U8_SPACE))
+    {
+        i += n;
+    }
+    #else
+    while (i < len && isspace(p[i]))
+    {
+        ++i;
+    }
+    #endif
+    return i;
+}
+
+/*@brief Internal function that returns the number of whitespace characters at the end of [p, p + len).
+In UTF-8 mode whitespace code points are recognized and the result is in bytes.*/
+size_t __str_rspace(const dchar_t *p, size_t len)
+{
+    size_t i = 0;
+    #ifdef DOOTSTR_USE_UTF8
+    while (i < len)
+    {
+        const char *end = p + len - i, *lead = end - 1;
+        while (lead > p && end - lead < 4 && (*lead & 0xC0) == 0x80) // Steps back to the lead byte of the last sequence
+        {
+            --lead;
+        }
+        uint32_t cp;
+        size_t n = __str_u8next(lead, end, &cp);
+        if (n != (size_t)(end - lead) || !(__str_u8class(cp) & STR_U8_SPACE))
+        {
+            break;
+        }
+        i += n;
+    }
+    #else
+    while (i < len && isspace(p[len - i - 1]))
+    {
+        ++i;
+    }
+    #endif
+    return i;
+}
+
+/*@brief Removes all preceding and trailing whitespaces.*/
+void str_strip(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_strip: The passed address of str_t was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return;
+    }
+    size_t rightoff = __str_rspace(pstr->pstr, pstr->strlen);
+    size_t leftoff = __str_lspace(pstr->pstr, pstr->strlen - rightoff);
+    __str_advance(pstr, leftoff);
+    if (rightoff > 0)
+    {
+        pstr->strlen -= rightoff;
+        __str_mutate(pstr, pstr->strlen);
+        pstr->pstr[pstr->strlen] = '\0';
+    }
+}
+
+/*@brief Removes all preceding whitespaces.*/
+void str_lstrip(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_strip: The passed address of str_t was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return;
+    }
+    __str_advance(pstr, __str_lspace(pstr->pstr, pstr->strlen)); // The whitespace is skipped, not moved over
+}
+
+/*@brief Removes all trailing whitespaces.*/
+void str_rstrip(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_strip: The passed address of str_t was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return;
+    }
+    pstr->strlen -= __str_rspace(pstr->pstr, pstr->strlen);
+    __str_mutate(pstr, pstr->strlen);
+    pstr->pstr[pstr->strlen] = '\0';
+}
+//TODO: Investigate what other cleanup fnc could be usefull.
+
+#pragma endregion
+
+#pragma region SPLITTING
+/*@brief Searches the string and returns the index where seq first occurs. -1 otherwise.*/
+ssize_t str_index(str_t *pstr, const dchar_t *seq)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_index: The passed address is null.");
+    }
+    if (!pstr->pstr)
+    {
+        return -1;
+    }
+    if (!seq)
+    {
+        STRFAIL("str_index: The passed address of seq is null.");
+    }
+    if (!(*seq))
+    {
+        return 0;
+    }
+    const dchar_t *found = _strstr(pstr->pstr, seq); // Linear in libc, the loop that was here went back after every partial match
+    return found ? found - pstr->pstr : -1;
+}
+
+/*@brief Searches the string and returns the index where seq last occurs. -1 otherwise.*/
+ssize_t str_rindex(str_t *pstr, const dchar_t *seq)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_index: The passed address is null.");
+    }
+    if (!pstr->pstr)
+    {
+        return -1;
+    }
+    if (!seq)
+    {
+        STRFAIL("str_rindex: The passed address of seq is null.");
+    }
+    if (!(*seq))
+    {
+        return 0;
+    }
+    ssize_t ending = -1;
+    ssize_t i = pstr->strlen -1;
+    ssize_t rlen = _strlen(seq);
+    const dchar_t *ps = seq + rlen - 1;
+    while (i >= 0)
+    {
+        ending = i;
+        while (i >= 0 && pstr->pstr[i] == *ps)
+        {
+            ps--;
+            if (ps < seq)
+            {
+                return i;
+            }
+            i--;
+        }
+        ps = seq;
+        i = ending - 1;
+        continue;
+        i--;
+    }
+    return -1;
+}
+
+/*@brief Finds the first occurance of pivot and splits the string by it.
+The passed output strings can but don't have to be initialized.
+@param[in] pstr input string (non empty)
+@param[in] pivot pivot sequence
+@param[in] pivot str_t containing the substring before the pivot.
+@param[in] outleft str_t containing the substring before the pivot.
+@param[in] outmid str_t containing the substring before the pivot.*/
+void str_partition(str_t *pstr, const dchar_t *pivot, str_t **outleft, str_t **outmid, str_t **outright)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_partition: The passed address of a str_t was null.");
+    }
+    if (!pstr->pstr)
+    {
+        STRFAIL("str_partition: The passed string was empty.");
+    }
+    if (!pivot)
+    {
+        STRFAIL("str_partition: The passed address of pivot was null.");
+    }
+    if (!(*pivot))
+    {
+        STRFAIL("str_partition: The passed pivot was empty.");
+    }
+    if (!outleft || !outmid || !outright)
+    {
+        STRFAIL("str_partition: One of the passed addreses of output str_t pointer variables was null.");
+    }
+    if (!*outleft)
+    {
+        *outleft = str_new(0);
+    }
+    if (!*outmid)
+    {
+        *outmid = str_new(0);
+    }
+    if (!*outright)
+    {
+        *outright = str_new(0);
+    }
+    ssize_t pivInd = str_index(pstr, pivot);
+    size_t pivLen = _strlen(pivot);
+    if (pivInd == -1)
+    {
+        str_assign_c(*outright, STR_EMPTY);
+        str_assign_c(*outmid, pivot);
+        str_assign_c(*outright, STR_EMPTY);
+    }
+    else
+    {
+        str_assignSlice(*outleft, pstr->pstr, 0, pivInd, 1);
+        str_assign_c(*outmid, pivot);
+        str_assignSlice(*outright, pstr->pstr, pivInd + pivLen, pstr->strlen, 1);
+    }
+}
+
+void str_rpartition(str_t *pstr, const dchar_t *pivot, str_t **outleft, str_t **outmid, str_t **outright)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_rpartition: The passed address of a str_t was null.");
+    }
+    if (!pstr->pstr)
+    {
+        STRFAIL("str_rpartition: The passed string was empty.");
+    }
+    if (!pivot)
+    {
+        STRFAIL("str_rpartition: The passed address of pivot was null.");
+    }
+    if (!(*pivot))
+    {
+        STRFAIL("str_rpartition: The passed pivot was empty.");
+    }
+    if (!outleft || !outmid || !outright)
+    {
+        STRFAIL("str_rpartition: One of the passed addreses of output str_t pointer variables was null.");
+    }
+    if (!*outleft)
+    {
+        *outleft = str_new(0);
+    }
+    if (!*outmid)
+    {
+        *outmid = str_new(0);
+    }
+    if (!*outright)
+    {
+        *outright = str_new(0);
+    }
+    ssize_t pivInd = str_rindex(pstr, pivot);
+    size_t pivLen = _strlen(pivot);
+    if (pivInd == -1)
+    {
+        str_assign_c(*outright, STR_EMPTY);
+        str_assign_c(*outmid, pivot);
+        str_assign_c(*outright, STR_EMPTY);
+    }
+    else
+    {
+        str_assignSlice(*outleft, pstr->pstr, 0, pivInd, 1);
+        str_assign_c(*outmid, pivot);
+        str_assignSlice(*outright, pstr->pstr, pivInd + pivLen, pstr->strlen, 1);
+    }
+}
+
+/*
+@brief This struct represents an array of str_t objects. It's used by some dootstr functions, to make dealing with many strings easier
+and safer. Now ideally this would be a dynamic vector, but at this point just use C++. This struct is mostly meant to be recieved by the user from
+str_ functions, not necessarily created.
+*/
+typedef struct sarr
+{
+    str_t **strArr; /*The array of str_t pointers (to single str_t structs).*/
+    size_t size; /*The number of strings in the array.*/
+} sarr_t;
+
+/*@brief Create a sarr_t by taking onwership of an existing array of c-style strings.
+The cstring pointer is freed, dangling and unusable afterwards. Make sure that the provided array is of size n,
+otherwise excpect read violations. Please be careful with this.*/
+sarr_t *str_asteal(dchar_t **cstrings, size_t n)
+{
+    if (!cstrings)
+    {
+        STRFAIL("str_asteal: The passed address to cstrings is null.");
+    }
+    for (size_t i = 0; i < n; i++)
+    {
+        if (!(cstrings[i]))
+        {
+            STRFAIL("str_asteal: One of the strings in the cstrings array is null");
+        }
+    }
+
+    sarr_t *parr = (sarr_t*)malloc(sizeof(sarr_t));
+    if (!parr)
+    {
+        STRERROR("malloc");
+    }
+    parr->strArr = (str_t**)malloc(sizeof(str_t*) * n);
+    if (!parr->strArr)
+    {
+        STRERROR("malloc");
+    }
+    parr->size = n;
+    for (size_t i = 0; i < n; i++)
+    {
+        parr->strArr[i] = str_steal(cstrings[i]);
+    }
+    free(cstrings);
+    return parr;
+}
+
+/*@brief Create a sarr_t by copying an already existing array of c-style strings.*/
+sarr_t *str_afrom(dchar_t **cstrings, size_t n)
+{
+    if (!cstrings)
+    {
+        STRFAIL("str_afrom: The passed address to cstrings is null.");
+    }
+    for (size_t i = 0; i < n; i++)
+    {
+        if (!(cstrings[i]))
+        {
+            STRFAIL("str_afrom: One of the strings in the cstrings array is null");
+        }
+    }
+
+    sarr_t *parr = (sarr_t*)malloc(sizeof(sarr_t));
+    if (!parr)
+    {
+        STRERROR("malloc");
+    }
+    parr->strArr = (str_t**)malloc(sizeof(str_t*) * n);
+    if (!parr->strArr)
+    {
+        STRERROR("malloc");
+    }
+    parr->size = n;
+    for (size_t i = 0; i < n; i++)
+    {
+        parr->strArr[i] = str_newfrom(cstrings[i]);
+    }
+    return parr;
+}
+
+/*Safely free a sarr_t by passing the addres of a str_t* variable. The variable will be set to NULL afterwards.*/
+void str_afree(sarr_t **pparr)
+{
+    if (!pparr)
+    {
+        STRFAIL("str_afree: The passed address of a sarr_t* variable is null.");
+    }
+    if (!*pparr)
+    {
+        return;
+    }
+    if (!(*pparr)->strArr)
+    {
+        (*pparr)->size = 0;
+        free(*pparr);
+        *pparr = NULL;
+        return;
+    }
+    for (size_t i = 0; i < (*pparr)->size; i++)
+    {
+        str_free((*pparr)->strArr + i);
+    }
+    free((*pparr)->strArr);
+    (*pparr)->strArr = NULL;
+    (*pparr)->size = 0;
+    free(*pparr);
+    *pparr = NULL;
+}
+
+/*@brief Internal function that counts how many parts spliting the string by delim will result in.
+I have a feeling this is horribly written and could be rewritten to 1/2 the length. This is godawful, but works.*/
+size_t __str_countSplits(str_t *pstr, const dchar_t *delim, size_t *dsize)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_split: The passed address of str_t was null.");
+    }
+    if (pstr->strlen == 0)
+    {
+        return 0;
+    }
+    if (!delim)
+    {
+        STRFAIL("str_split: The passed delim is null.");
+    }
+    if (!*delim)
+    {
+        return 1;
+    }
+    size_t dlen = _strlen(delim);
+    if (dsize)
+    {
+        *dsize = dlen;
+    }
+    const dchar_t *p = pstr->pstr, *plast = p;
+    size_t count = 0;
+    short anyDelim = 0;
+    while ((p = _strstr(p, delim)) != NULL)
+    {
+        // Check if character to the left is not outside or part of another delim sequence
+        if (p == pstr->pstr || (plast + dlen >= p && anyDelim))
+        {
+            anyDelim = 1;
+            plast = p;
+            p += dlen;
+            continue;
+        }
+        anyDelim = 1;
+        count++;
+        plast = p;
+        p += dlen;
+    }
+    if (plast == pstr->pstr)
+    {
+        //There was either no delim or a single delim at the beginning or 
+        if (anyDelim)
+        {
+            return pstr->strlen > dlen;
+        }
+        return 1;
+    }
+    if ((size_t)(plast + dlen - pstr->pstr) < pstr->strlen)
+    {
+        count ++; // Count the last one
+    }
+    return count;
+}
+
+/*@brief Splits the string by delim and returns an array (sarr_t) of resulting strings. Empty parts (next to another delim or at either
+end) are left out, and an empty delim gives a copy of the whole string. Mapped strings (see str_mapfile()) are split without copying them
+first.*/
+sarr_t *str_split(str_t *pstr, const dchar_t *delim)
+{
+    size_t dlen = 0;
+    size_t numSplits = __str_countSplits(pstr, delim, &dlen);
+    sarr_t *parr = (sarr_t*)malloc(sizeof(sarr_t));
+    if (!parr)
+    {
+        STRERROR("malloc");
+    }
+    parr->size = numSplits;
+    if (parr->size == 0)
+    {
+        parr->strArr = NULL;
+        return parr;
+    }
+    parr->strArr = (str_t**)malloc(sizeof(str_t*)*parr->size);
+    if (!parr->strArr)
+    {
+        STRERROR("malloc");
+    }
+    const dchar_t *p = pstr->pstr, *end = pstr->pstr + pstr->strlen;
+    size_t ind = 0;
+    while (ind < parr->size)
+    {
+        const dchar_t *next = dlen ? _strstr(p, delim) : NULL;
+        if (!next)
+        {
+            next = end;
+        }
+        if (next > p)
+        {
+            str_t *part = str_new(next - p + 1);
+            memcpy(part->pstr, p, (next - p) * sizeof(dchar_t));
+            part->strlen = next - p;
+            part->pstr[part->strlen] = '\0';
+            parr->strArr[ind++] = part;
+        }
+        p = (next == end) ? end : next + dlen;
+    }
+    return parr;
+}
+
+/*
+splitlines()
+join()
+split => returns a string array with a size
+*/
+
+typedef struct dootview
+{
+    int x;
+    // Struct that contains state of a str_t search, view, tokenization or alike
+} dootview_t;
+
+/* HOW IT'S MEANT TO BE USED:
+dootview_t view;
+str_setview(&view, str_t string);
+for ...
+    str_t *token = str_nextok(&view, delimset)
+
+*/
+#pragma endregion
+
+#pragma region VIEWING
+/*Safely access the i-th string character with bound checking and from-the-end indexing support.*/
+char str_at(str_t* pstr, size_t i)
+{
+    size_t boundInd = __str_boundIndex(i, pstr->strlen);
+    if (boundInd > pstr->strlen)
+    {
+        STRFAIL("str_at: Index is out of bounds from the right side.");
+    }
+    return pstr->pstr[boundInd];
+}
+
+#ifndef DOOTSTR_USE_WCHAR
+/*@brief Attaches a code point index to the string, which makes str_u8at, str_u8len, str_u8offset and str_u8substr take O(1) amortized time
+instead of scanning the string from the start. The index costs a size_t per STR_CPINDEX_STEP code points, it's filled as needed and kept
+up to date by every function that modifies the string. It's freed with the string or by str_u8dropindex.*/
+void str_u8index(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_u8index: The address of a str_t was null.");
+    }
+    if (pstr->cpindex)
+    {
+        return;
+    }
+    pstr->cpindex = (strcpindex_t *)malloc(sizeof(strcpindex_t));
+    if (!pstr->cpindex)
+    {
+        STRERROR("malloc");
+    }
+    pstr->cpindex->capacity = 16;
+    pstr->cpindex->offsets = (size_t *)malloc(pstr->cpindex->capacity * sizeof(size_t));
+    if (!pstr->cpindex->offsets)
+    {
+        STRERROR("malloc");
+    }
+    pstr->cpindex->offsets[0] = 0;
+    pstr->cpindex->count = 1;
+}
+
+/*@brief Frees the code point index of the string, if it has one.*/
+void str_u8dropindex(str_t *pstr)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_u8dropindex: The address of a str_t was null.");
+    }
+    if (pstr->cpindex)
+    {
+        free(pstr->cpindex->offsets);
+        free(pstr->cpindex);
+        pstr->cpindex = NULL;
+    }
+}
+
+/*@brief Returns the byte offset of the i-th code point of a UTF-8 string, with from-the-end indexing support.
+Index one after the last code point (STR_END) gives the length of the string in bytes.*/
+size_t str_u8offset(const str_t *pstr, size_t i)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_u8offset: The address of a str_t was null.");
+    }
+    size_t boundInd = (i & STR_END) ? __str_boundIndex(i, __str_u8length(pstr)) : i;
+    size_t off = __str_u8offset(pstr, boundInd);
+    if (off == pstr->strlen && boundInd > __str_u8length(pstr))
+    {
+        STRFAIL("str_u8offset: Index is out of bounds from the right side.");
+    }
+    return off;
+}
+
+/*@brief Returns the i-th code point of a UTF-8 string, with bound checking and from-the-end indexing support. Index one after the last
+code point gives 0, like str_at. Invalid sequences are returned as U+FFFD.*/
+uint32_t str_u8at(const str_t *pstr, size_t i)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_u8at: The address of a str_t was null.");
+    }
+    size_t off = str_u8offset(pstr, i);
+    if (off == pstr->strlen)
+    {
+        return 0;
+    }
+    uint32_t cp;
+    return __str_u8next(pstr->pstr + off, pstr->pstr + pstr->strlen, &cp) ? cp : STR_U8_REPLACEMENT;
+}
+
+/*@brief Returns a new string with the code points [beg, end) of a UTF-8 string, with from-the-end indexing support.
+Unlike str_u8newslice it works on a str_t, so it can use the string's code point index.*/
+str_t *str_u8substr(const str_t *pstr, size_t beg, size_t end)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_u8substr: The address of a str_t was null.");
+    }
+    size_t from = str_u8offset(pstr, beg), to = str_u8offset(pstr, end);
+    str_t *sub = str_new(to > from ? to - from + 1 : 1);
+    if (to > from)
+    {
+        memcpy(sub->pstr, pstr->pstr + from, to - from);
+        sub->strlen = to - from;
+    }
+    sub->pstr[sub->strlen] = '\0';
+    return sub;
+}
+
+/*@brief Like str_assignSlice, but beg, end and step count code points of a UTF-8 cstring instead of bytes.
+A negative step takes the code points from end - 1 down to beg.*/
+void str_u8assignSlice(str_t *pstr, const dchar_t *cstring, size_t beg, size_t end, long step)
+{
+    if (!cstring)
+    {
+        STRFAIL("str_u8assignSlice: The passed address of the cstring is null.");
+    }
+    if (!(*cstring))
+    {
+        STR_SLICE_ERROR("str_u8assignSlice: The sliced cstring is empty.");
+        str_assign_c(pstr, STR_EMPTY);
+        return;
+    }
+    if (step == 0)
+    {
+        STR_SLICE_ERROR("str_u8assignSlice: The step cannot be zero. Resulting slice is empty.");
+        str_assign_c(pstr, STR_EMPTY);
+        return;
+    }
+
+    const char *cend = cstring + _strlen(cstring);
+    size_t clen = __str_u8count(cstring, cend);
+    beg = __str_boundIndex(beg, clen); // In case the index is 'from the end'
+    if (beg > clen)
+    {
+        STR_SLICE_ERROR("str_u8assignSlice: Beg goes out of bounds from the right side.");
+        beg = clen - 1;
+    }
+    end = __str_boundIndex(end, clen); // In case the index is 'from the end'
+    if (end > clen)
+    {
+        STR_SLICE_ERROR("str_u8assignSlice: End goes out of bounds from the right side.");
+        end = clen;
+    }
+    if (end < beg)
+    {
+        STR_SLICE_ERROR("str_u8assignSlice: End is less than beg - resulting slice is invalid (empty).");
+        str_assign_c(pstr, STR_EMPTY);
+        return;
+    }
+    else if (end == beg)
+    {
+        str_assign_c(pstr, STR_EMPTY);
+        return;
+    }
+    const char *from = __str_u8skip(cstring, cend, beg);
+    size_t count = end - beg;
+    size_t *offsets = NULL; // Where each code point of [beg, end) starts, and where the last ends. Not needed for step 1
+    size_t stride = (size_t)labs(step);
+    size_t sliceLen = 1 + (count - 1) / stride;
+    size_t len = 0;
+    if (step == 1) // Contiguous, a single copy
+    {
+        len = __str_u8skip(from, cend, count) - from;
+    }
+    else
+    {
+        offsets = (size_t *)malloc((count + 1) * sizeof(size_t));
+        if (!offsets)
+        {
+            STRERROR("malloc");
+        }
+        const char *p = from;
+        for (size_t i = 0; i <= count; i++)
+        {
+            offsets[i] = p - from;
+            p = __str_u8skip(p, cend, 1);
+        }
+        for (size_t k = 0, ind = (step > 0) ? 0 : count - 1; k < sliceLen; k++, ind = (step > 0) ? ind + stride : ind - stride)
+        {
+            len += offsets[ind + 1] - offsets[ind];
+        }
+    }
+    char *dst;
+    dchar_t *newblock = NULL;
+    size_t blocksize = len + 1;
+    if (pstr->pstr && cstring >= pstr->pstr && cstring <= pstr->pstr + pstr->strlen) // A slice of the string itself
+    {
+        newblock = __str_blockalloc(&blocksize);
+        dst = newblock;
+    }
+    else
+    {
+        __str_mutate(pstr, 0);
+        if (pstr->capacity < len + 1)
+        {
+            str_realloc(pstr, len + 1);
+        }
+        dst = pstr->pstr;
+    }
+    if (step == 1)
+    {
+        memcpy(dst, from, len);
+    }
+    else
+    {
+        for (size_t k = 0, ind = (step > 0) ? 0 : count - 1; k < sliceLen; k++, ind = (step > 0) ? ind + stride : ind - stride)
+        {
+            size_t n = offsets[ind + 1] - offsets[ind];
+            memcpy(dst, from + offsets[ind], n);
+            dst += n;
+        }
+        free(offsets);
+    }
+    if (newblock)
+    {
+        str_destroy(pstr); // Gives back the block or the mapping that was sliced
+        STR_STAT_ALLOC(STR_CALLER, blocksize);
+        pstr->pstr = newblock;
+        pstr->capacity = blocksize;
+    }
+    pstr->strlen = len;
+    pstr->pstr[len] = '\0';
+}
+
+/*@brief Like str_newslice, but beg, end and step count code points of a UTF-8 cstring instead of bytes.*/
+str_t *str_u8newslice(const dchar_t *cstring, size_t beg, size_t end, long step)
+{
+    str_t *slice = str_new(1);
+    str_u8assignSlice(slice, cstring, beg, end, step);
+    return slice;
+}
+#endif
+#pragma endregion
+
+#pragma region BUILDER
+/*@brief Internal function that writes all of the iovec entries to fd, batching them into groups of at most IOV_MAX entries and
+resuming after partial writes. The iovec array is modified in the process. Returns the total number of bytes written.*/
+size_t __str_writevall(int fd, struct iovec *iov, size_t cnt)
+{
+    size_t total = 0;
+    while (cnt > 0)
+    {
+        int batch = (cnt > IOV_MAX) ? IOV_MAX : (int)cnt;
+        ssize_t written = writev(fd, iov, batch);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            STRERROR("writev");
+        }
+        total += (size_t)written;
+        // Skip the fully written entries and shorten the partially written one
+        while (cnt > 0 && (size_t)written >= iov->iov_len)
+        {
+            written -= iov->iov_len;
+            ++iov;
+            --cnt;
+        }
+        if (cnt > 0)
+        {
+            iov->iov_base = (char *)iov->iov_base + written;
+            iov->iov_len -= written;
+        }
+    }
+    return total;
+}
+
+#define STR_BCHUNK 4096 // Minimal size (in characters) of a block that holds the builder's owned copies
+
+/*@brief Internal struct describing a single piece recorded by a str_builder_t.*/
+typedef struct strpiece
+{
+    const dchar_t *pstr; /*Pointer to the piece's characters, not necessarily null terminated*/
+    size_t strlen; /*Number of characters in the piece*/
+} strpiece_t;
+
+/*@brief Internal struct for a block of memory holding copies owned by a str_builder_t.*/
+typedef struct strchunk
+{
+    struct strchunk *next; /*The previously filled chunk*/
+    size_t used; /*Number of characters already taken*/
+    size_t capacity; /*Number of characters that fit in the chunk*/
+    dchar_t data[]; /*The copied characters*/
+} strchunk_t;
+
+/** @struct str_builder_t
+ *  @brief A string builder that records pieces instead of copying them into a growing buffer. Pieces can be borrowed (only the pointer is kept,
+ *  so the memory has to stay valid and unchanged until the builder is used) or copied into memory owned by the builder. The pieces are joined
+ *  only when the builder is materialized into a str_t, which takes a single allocation, or written directly to a file descriptor.
+ */
+typedef struct strbuilder
+{
+    strpiece_t *pieces; /*Array of the recorded pieces*/
+    size_t count; /*Number of recorded pieces*/
+    size_t capacity; /*Size of the pieces array*/
+    size_t strlen; /*Total number of characters over all of the pieces*/
+    strchunk_t *chunks; /*Linked list of blocks holding owned copies, the newest one first*/
+} str_builder_t;
+
+/*@brief Returns a pointer to a new, empty string builder.*/
+str_builder_t *str_bnew(void)
+{
+    str_builder_t *pb = (str_builder_t*)malloc(sizeof(str_builder_t));
+    if (!pb)
+    {
+        STRERROR("malloc");
+    }
+    pb->pieces = NULL;
+    pb->count = 0;
+    pb->capacity = 0;
+    pb->strlen = 0;
+    pb->chunks = NULL;
+    return pb;
+}
+
+/*@brief Forgets all recorded pieces and releases the owned copies, keeping the builder ready for reuse.*/
+void str_bclear(str_builder_t *pb)
+{
+    if (!pb)
+    {
+        STRFAIL("str_bclear: The address of a str_builder_t was null.");
+    }
+    strchunk_t *pc = pb->chunks;
+    while (pc)
+    {
+        strchunk_t *next = pc->next;
+        free(pc);
+        pc = next;
+    }
+    pb->chunks = NULL;
+    pb->count = 0;
+    pb->strlen = 0;
+}
+
+/*@brief Safely free a str_builder_t by passing the address of a pointer variable. The pointer will be set to null afterwards.
+Borrowed pieces are not freed.*/
+void str_bfree(str_builder_t **ppb)
+{
+    if (!ppb)
+    {
+        STRFAIL("str_bfree: The address of a str_builder_t pointer variable was null.");
+    }
+    if (!*ppb)
+    {
+        return;
+    }
+    str_bclear(*ppb);
+    free((*ppb)->pieces);
+    free(*ppb);
+    *ppb = NULL;
+}
+
+/*@brief Internal function that records a piece, merging it with the previous one if they are adjacent in memory.*/
+void __str_bpush(str_builder_t *pb, const dchar_t *p, size_t len)
+{
+    if (len == 0)
+    {
+        return;
+    }
+    (void)STR_EXPR_TESTOVERFLOW((pb->strlen + len + 1) / 2);
+    if (pb->count > 0)
+    {
+        strpiece_t *last = pb->pieces + pb->count - 1;
+        if (last->pstr + last->strlen == p)
+        {
+            last->strlen += len;
+            pb->strlen += len;
+            return;
+        }
+    }
+    if (pb->count == pb->capacity)
+    {
+        size_t newcap = (pb->capacity == 0) ? 16 : pb->capacity * 2;
+        strpiece_t *newpieces = (strpiece_t*)realloc(pb->pieces, sizeof(strpiece_t) * newcap);
+        if (!newpieces)
+        {
+            STRERROR("realloc");
+        }
+        pb->pieces = newpieces;
+        pb->capacity = newcap;
+    }
+    pb->pieces[pb->count].pstr = p;
+    pb->pieces[pb->count].strlen = len;
+    pb->count++;
+    pb->strlen += len;
+}
+
+/*@brief Internal function that copies len characters into the builder's own memory and records them as a piece.*/
+void __str_bcopy(str_builder_t *pb, const dchar_t *p, size_t len)
+{
+    if (len == 0)
+    {
+        return;
+    }
+    strchunk_t *pc = pb->chunks;
+    if (!pc || pc->capacity - pc->used < len)
+    {
+        size_t chunkcap = (len > STR_BCHUNK) ? len : STR_BCHUNK;
+        pc = (strchunk_t*)malloc(sizeof(strchunk_t) + sizeof(dchar_t) * chunkcap);
+        if (!pc)
+        {
+            STRERROR("malloc");
+        }
+        pc->next = pb->chunks;
+        pc->used = 0;
+        pc->capacity = chunkcap;
+        pb->chunks = pc;
+    }
+    dchar_t *dest = pc->data + pc->used;
+    memcpy(dest, p, len * sizeof(dchar_t));
+    pc->used += len;
+    __str_bpush(pb, dest, len);
+}
+
+/*@brief Records a borrowed piece of exactly len characters. The memory isn't copied, so it has to stay valid and unchanged
+until the builder is materialized or written.*/
+void str_bborrown(str_builder_t *pb, const dchar_t *cstring, size_t len)
+{
+    if (!pb || (!cstring && len > 0))
+    {
+        STRFAIL("str_bborrown: The address of a str_builder_t or a c string was null.");
+    }
+    __str_bpush(pb, cstring, len);
+}
+
+/*@brief Records a borrowed c-style string. See str_bborrown() for the lifetime requirements.*/
+void str_bborrow_c(str_builder_t *pb, const dchar_t *cstring)
+{
+    if (!pb || !cstring)
+    {
+        STRFAIL("str_bborrow_c: The address of a str_builder_t or a c string was null.");
+    }
+    __str_bpush(pb, cstring, _strlen(cstring));
+}
+
+/*@brief Records the contents of a str_t without copying them. The str_t must not be modified or freed until the builder is used.*/
+void str_bborrow(str_builder_t *pb, const str_t *pstr)
+{
+    if (!pb || !pstr)
+    {
+        STRFAIL("str_bborrow: The address of a str_builder_t or a str_t was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return;
+    }
+    __str_bpush(pb, pstr->pstr, pstr->strlen);
+}
+
+/*@brief Records a copy of exactly len characters. Use this for temporary buffers that won't outlive the builder.*/
+void str_bappendn(str_builder_t *pb, const dchar_t *cstring, size_t len)
+{
+    if (!pb || (!cstring && len > 0))
+    {
+        STRFAIL("str_bappendn: The address of a str_builder_t or a c string was null.");
+    }
+    __str_bcopy(pb, cstring, len);
+}
+
+/*@brief Records a copy of a c-style string.*/
+void str_bappend_c(str_builder_t *pb, const dchar_t *cstring)
+{
+    if (!pb || !cstring)
+    {
+        STRFAIL("str_bappend_c: The address of a str_builder_t or a c string was null.");
+    }
+    __str_bcopy(pb, cstring, _strlen(cstring));
+}
+
+/*@brief Records a copy of the contents of a str_t.*/
+void str_bappend(str_builder_t *pb, const str_t *pstr)
+{
+    if (!pb || !pstr)
+    {
+        STRFAIL("str_bappend: The address of a str_builder_t or a str_t was null.");
+    }
+    if (!pstr->pstr)
+    {
+        return;
+    }
+    __str_bcopy(pb, pstr->pstr, pstr->strlen);
+}
+
+/*@brief Internal function that copies all of the pieces into dest and null terminates it. dest must hold pb->strlen + 1 characters.*/
+void __str_bjoin(const str_builder_t *pb, dchar_t *dest)
+{
+    for (size_t i = 0; i < pb->count; i++)
+    {
+        memcpy(dest, pb->pieces[i].pstr, pb->pieces[i].strlen * sizeof(dchar_t));
+        dest += pb->pieces[i].strlen;
+    }
+    *dest = '\0';
+}
+
+/*@brief Returns a pointer to a new string containing all of the recorded pieces. The string's memory is allocated exactly once
+and fits the contents exactly. The builder is left unchanged.*/
+str_t *str_bbuild(const str_builder_t *pb)
+{
+    if (!pb)
+    {
+        STRFAIL("str_bbuild: The address of a str_builder_t was null.");
+    }
+    str_t *pstr = str_new(pb->strlen + 1);
+    __str_bjoin(pb, pstr->pstr);
+    pstr->strlen = pb->strlen;
+    return pstr;
+}
+
+/*@brief Appends all of the recorded pieces to an existing str_t, reallocating it at most once.*/
+void str_bappendto(const str_builder_t *pb, str_t *pstr)
+{
+    if (!pb || !pstr)
+    {
+        STRFAIL("str_bappendto: The address of a str_builder_t or a str_t was null.");
+    }
+    if (!pstr->pstr)
+    {
+        str_realloc(pstr, STR_NEWCAPACITY(pb->strlen + 1));
+        pstr->strlen = 0;
+    }
+    else if (pstr->capacity < pstr->strlen + pb->strlen + 1)
+    {
+        str_realloc(pstr, STR_NEWCAPACITY(pstr->strlen + pb->strlen + 1));
+    }
+    __str_bjoin(pb, pstr->pstr + pstr->strlen);
+    pstr->strlen += pb->strlen;
+}
+
+/*@brief Writes all of the recorded pieces to a file descriptor with writev(), without joining them first.
+Characters are written as raw dchar_t memory. Returns the number of bytes written.*/
+size_t str_bwrite(const str_builder_t *pb, int fd)
+{
+    if (!pb)
+    {
+        STRFAIL("str_bwrite: The address of a str_builder_t was null.");
+    }
+    if (pb->count == 0)
+    {
+        return 0;
+    }
+    struct iovec *iov = (struct iovec*)malloc(sizeof(struct iovec) * pb->count);
+    if (!iov)
+    {
+        STRERROR("malloc");
+    }
+    for (size_t i = 0; i < pb->count; i++)
+    {
+        iov[i].iov_base = (void *)pb->pieces[i].pstr;
+        iov[i].iov_len = pb->pieces[i].strlen * sizeof(dchar_t);
+    }
+    size_t written = __str_writevall(fd, iov, pb->count);
+    free(iov);
+    return written;
+}
+
+/*@brief Internal function that writes count strings to fd with writev(), putting sep (if not null) between them. The iovec entries are
+filled into a stack array and flushed every IOV_MAX entries, so nothing is allocated or concatenated. Returns the number of bytes written.*/
+size_t __str_writestrs(str_t *const *strs, size_t count, const dchar_t *sep, int fd, const char *message)
+{
+    struct iovec iov[IOV_MAX];
+    size_t seplen = sep ? _strlen(sep) * sizeof(dchar_t) : 0;
+    size_t n = 0;
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (!strs[i])
+        {
+            STRFAIL(message);
+        }
+        if (i > 0 && seplen > 0)
+        {
+            iov[n].iov_base = (void *)sep;
+            iov[n++].iov_len = seplen;
+        }
+        if (strs[i]->strlen > 0)
+        {
+            iov[n].iov_base = (void *)strs[i]->pstr;
+            iov[n++].iov_len = strs[i]->strlen * sizeof(dchar_t);
+        }
+        if (n >= IOV_MAX - 1)
+        {
+            total += __str_writevall(fd, iov, n);
+            n = 0;
+        }
+    }
+    return total + __str_writevall(fd, iov, n);
+}
+
+/*@brief Writes the string to a file descriptor. Characters are written as raw dchar_t memory. Returns the number of bytes written.*/
+size_t str_write(const str_t *pstr, int fd)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_write: The address of a str_t was null.");
+    }
+    struct iovec iov = { (void *)pstr->pstr, pstr->strlen * sizeof(dchar_t) };
+    return __str_writevall(fd, &iov, 1);
+}
+
+/*@brief Writes count strings from the array to a file descriptor with writev(), separated by sep if it's not null. Nothing is concatenated
+in memory. Characters are written as raw dchar_t memory. Returns the number of bytes written.*/
+size_t str_writemany(str_t *const *strs, size_t count, const dchar_t *sep, int fd)
+{
+    if (!strs && count > 0)
+    {
+        STRFAIL("str_writemany: The array of str_t pointers was null.");
+    }
+    return __str_writestrs(strs, count, sep, fd, "str_writemany: One of the str_t pointers was null.");
+}
+
+/*@brief Writes all strings of the sarr_t to a file descriptor with writev(), separated by sep if it's not null. Nothing is concatenated
+in memory. Characters are written as raw dchar_t memory. Returns the number of bytes written.*/
+size_t str_awrite(const sarr_t *parr, const dchar_t *sep, int fd)
+{
+    if (!parr)
+    {
+        STRFAIL("str_awrite: The address of a sarr_t was null.");
+    }
+    return __str_writestrs(parr->strArr, parr->size, sep, fd, "str_awrite: One of the strings in the sarr_t was null.");
+}
+#pragma endregion
+
+#pragma region CSV
+/** @struct str_csv_t
+ *  @brief State of a CSV/TSV parser running over a buffer it doesn't own. Each call to str_csvnext() parses one record and fills the
+ *  fields array with views of its fields. Fields point directly into the parsed buffer, unless they contain escaped quotes (""), in which
+ *  case they are unescaped into the parser's scratch string. The views stay valid until the next call to str_csvnext().
+ *  The parser is lenient: an unterminated quoted field runs to the end of the buffer and characters following a closing quote
+ *  are kept as a part of the field.
+ */
+typedef struct strcsv
+{
+    const dchar_t *pstr; /*The parsed buffer*/
+    size_t strlen; /*Length of the parsed buffer*/
+    size_t pos; /*Position of the first character of the next record*/
+    dchar_t delim; /*Field separator, ex. ',' for CSV or '\t' for TSV*/
+    dchar_t quote; /*Quoting character, '"' by default*/
+    str_view_t *fields; /*Views of the current record's fields*/
+    size_t nfields; /*Number of fields in the current record*/
+    size_t fieldcap; /*Size of the fields array*/
+    size_t *scratchoff; /*Offsets of unescaped fields into the scratch string, SIZE_MAX for fields viewing the buffer*/
+    str_t *scratch; /*Storage for unescaped fields of the current record*/
+} str_csv_t;
+
+/*@brief Returns a pointer to a new parser over len characters of buf, separating fields with delim. The buffer isn't copied and has to
+outlive the parser.*/
+str_csv_t *str_csvnewn(const dchar_t *buf, size_t len, dchar_t delim)
+{
+    if (!buf && len > 0)
+    {
+        STRFAIL("str_csvnewn: The address of the parsed buffer was null.");
+    }
+    if (delim == '"' || delim == '\n' || delim == '\r' || delim == '\0')
+    {
+        STRFAIL("str_csvnewn: The delimiter cannot be a quote, a line break or a null character.");
+    }
+    str_csv_t *pcsv = (str_csv_t*)malloc(sizeof(str_csv_t));
+    if (!pcsv)
+    {
+        STRERROR("malloc");
+    }
+    pcsv->pstr = buf;
+    pcsv->strlen = len;
+    pcsv->pos = 0;
+    pcsv->delim = delim;
+    pcsv->quote = '"';
+    pcsv->fields = NULL;
+    pcsv->nfields = 0;
+    pcsv->fieldcap = 0;
+    pcsv->scratchoff = NULL;
+    pcsv->scratch = str_new(0);
+    return pcsv;
+}
+
+/*@brief Returns a pointer to a new parser over the contents of a str_t. The str_t must not be modified while it's being parsed.*/
+str_csv_t *str_csvnew(const str_t *pstr, dchar_t delim)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_csvnew: The address of a str_t was null.");
+    }
+    return str_csvnewn(pstr->pstr, pstr->pstr ? pstr->strlen : 0, delim);
+}
+
+/*@brief Safely free a str_csv_t by passing the address of a pointer variable. The pointer will be set to null afterwards.*/
+void str_csvfree(str_csv_t **ppcsv)
+{
+    if (!ppcsv)
+    {
+        STRFAIL("str_csvfree: The address of a str_csv_t pointer variable was null.");
+    }
+    if (!*ppcsv)
+    {
+        return;
+    }
+    free((*ppcsv)->fields);
+    free((*ppcsv)->scratchoff);
+    str_free(&(*ppcsv)->scratch);
+    free(*ppcsv);
+    *ppcsv = NULL;
+}
+
+/*@brief Internal function that adds a field to the current record. Fields stored in the scratch string are given by their offset.*/
+void __str_csvpush(str_csv_t *pcsv, const dchar_t *p, size_t len, size_t scratchoff)
+{
+    if (pcsv->nfields == pcsv->fieldcap)
+    {
+        size_t newcap = (pcsv->fieldcap == 0) ? 16 : pcsv->fieldcap * 2;
+        str_view_t *newfields = (str_view_t*)realloc(pcsv->fields, sizeof(str_view_t) * newcap);
+        size_t *newoff = (size_t*)realloc(pcsv->scratchoff, sizeof(size_t) * newcap);
+        if (!newfields || !newoff)
+        {
+            STRERROR("realloc");
+        }
+        pcsv->fields = newfields;
+        pcsv->scratchoff = newoff;
+        pcsv->fieldcap = newcap;
+    }
+    pcsv->fields[pcsv->nfields].pstr = p;
+    pcsv->fields[pcsv->nfields].strlen = len;
+    pcsv->scratchoff[pcsv->nfields] = scratchoff;
+    pcsv->nfields++;
+}
+
+/*@brief Parses the next record. Returns 1 if a record was parsed and 0 when the whole buffer has been consumed.
+Records are separated by "\n", "\r\n" or "\r". An empty line is a record with a single empty field.
+The record's fields are available as pcsv->fields[0 ... pcsv->nfields - 1].*/
+int str_csvnext(str_csv_t *pcsv)
+{
+    if (!pcsv)
+    {
+        STRFAIL("str_csvnext: The address of a str_csv_t was null.");
+    }
+    if (pcsv->pos >= pcsv->strlen)
+    {
+        pcsv->nfields = 0;
+        return 0;
+    }
+    const dchar_t *p = pcsv->pstr + pcsv->pos;
+    const dchar_t *end = pcsv->pstr + pcsv->strlen;
+    const dchar_t delim = pcsv->delim, quote = pcsv->quote;
+    str_t *scratch = pcsv->scratch;
+    scratch->strlen = 0;
+    pcsv->nfields = 0;
+    for (;;)
+    {
+        if (p < end && *p == quote)
+        {
+            const dchar_t *fbeg = ++p, *q;
+            size_t off = SIZE_MAX;
+            for (;;)
+            {
+                q = __str_findany3(p, end, quote, quote, quote);
+                if (q + 1 < end && q[1] == quote) // Escaped quote, the field has to be unescaped into the scratch string
+                {
+                    if (off == SIZE_MAX)
+                    {
+                        off = scratch->strlen;
+                        p = fbeg;
+                    }
+                    __str_appendn(scratch, p, q + 1 - p);
+                    p = q + 2;
+                    continue;
+                }
+                break;
+            }
+            if (off != SIZE_MAX)
+            {
+                __str_appendn(scratch, p, q - p);
+            }
+            p = (q < end) ? q + 1 : end;
+            if (p < end && *p != delim && *p != '\n' && *p != '\r') // Garbage after the closing quote
+            {
+                const dchar_t *t = __str_findany3(p, end, delim, '\n', '\r');
+                if (off == SIZE_MAX)
+                {
+                    off = scratch->strlen;
+                    __str_appendn(scratch, fbeg, q - fbeg);
+                }
+                __str_appendn(scratch, p, t - p);
+                p = t;
+            }
+            if (off == SIZE_MAX)
+            {
+                __str_csvpush(pcsv, fbeg, q - fbeg, SIZE_MAX);
+            }
+            else
+            {
+                __str_csvpush(pcsv, NULL, scratch->strlen - off, off);
+            }
+        }
+        else
+        {
+            const dchar_t *t = __str_findany3(p, end, delim, '\n', '\r');
+            __str_csvpush(pcsv, p, t - p, SIZE_MAX);
+            p = t;
+        }
+        if (p < end && *p == delim)
+        {
+            ++p;
+            continue;
+        }
+        if (p < end && *p == '\r')
+        {
+            ++p;
+            if (p < end && *p == '\n')
+            {
+                ++p;
+            }
+        }
+        else if (p < end && *p == '\n')
+        {
+            ++p;
+        }
+        break;
+    }
+    pcsv->pos = p - pcsv->pstr;
+    // The scratch string could have been reallocated while parsing, so its views are only resolved now
+    for (size_t i = 0; i < pcsv->nfields; i++)
+    {
+        if (pcsv->scratchoff[i] != SIZE_MAX)
+        {
+            pcsv->fields[i].pstr = scratch->pstr + pcsv->scratchoff[i];
+        }
+    }
+    return 1;
+}
+#pragma endregion
+
+#pragma region NUMBERS
+/*
+Locale independent conversions between strings and numbers. Parsing only supports base 10, there is no whitespace skipping and
+errors are reported through str_err_t instead of STRFAIL, since bad numbers in the input are an expected occurance.
+The whole-string variants (str_toi64, str_toi64_v, ...) require the string to contain nothing but the number, the _at variants parse
+the longest number starting at a given position and report where it ended, like strtol().
+*/
+
+/*@brief Internal function that checks if 8 bytes are all ASCII digits.*/
+int __str_iseightdigits(uint64_t chunk)
+{
+    return !(((chunk + 0x4646464646464646ULL) | (chunk - 0x3030303030303030ULL)) & 0x8080808080808080ULL);
+}
+
+/*@brief Internal function that converts 8 ASCII digits (loaded as a little endian word) to their value, SWAR style.*/
+uint32_t __str_parseeightdigits(uint64_t chunk)
+{
+    chunk -= 0x3030303030303030ULL;
+    chunk = (chunk * 10) + (chunk >> 8); // Pairs of digits
+    chunk = (((chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+             (((chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+    return (uint32_t)chunk;
+}
+
+/*@brief Internal function that accumulates decimal digits from [p, end) into *acc, at most maxdigits of them.
+Returns a pointer to the first character that wasn't consumed.*/
+const dchar_t *__str_scandigits(const dchar_t *p, const dchar_t *end, uint64_t *acc, size_t maxdigits)
+{
+    uint64_t v = *acc;
+    const dchar_t *stop = (end - p > (ptrdiff_t)maxdigits) ? p + maxdigits : end;
+#if !defined(DOOTSTR_USE_WCHAR) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    while (stop - p >= 8)
+    {
+        uint64_t chunk;
+        memcpy(&chunk, p, 8);
+        if (!__str_iseightdigits(chunk))
+        {
+            break;
+        }
+        v = v * 100000000ULL + __str_parseeightdigits(chunk);
+        p += 8;
+    }
+#endif
+    while (p < stop && *p >= '0' && *p <= '9')
+    {
+        v = v * 10 + (uint64_t)(*p - '0');
+        ++p;
+    }
+    *acc = v;
+    return p;
+}
+
+/*@brief Internal function that parses an unsigned decimal integer from [p, end). Returns the error code and stores the position after
+the last digit in *stop. The value saturates at UINT64_MAX on overflow.*/
+str_err_t __str_parseu64(const dchar_t *p, const dchar_t *end, uint64_t *out, const dchar_t **stop)
+{
+    const dchar_t *beg = p;
+    while (p < end && *p == '0') // Leading zeros don't count towards the 20 digits
+    {
+        ++p;
+    }
+    uint64_t v = 0;
+    const dchar_t *digits = p;
+    p = __str_scandigits(p, end, &v, 19); // 19 digits always fit
+    str_err_t err = STR_OK;
+    if (p - digits == 19 && p < end && *p >= '0' && *p <= '9')
+    {
+        if (__builtin_mul_overflow(v, 10, &v) || __builtin_add_overflow(v, (uint64_t)(*p - '0'), &v))
+        {
+            err = STR_ERR_RANGE;
+        }
+        ++p;
+        while (p < end && *p >= '0' && *p <= '9')
+        {
+            err = STR_ERR_RANGE;
+            ++p;
+        }
+    }
+    if (p == beg)
+    {
+        *stop = beg;
+        return STR_ERR_SYNTAX;
+    }
+    *out = (err == STR_OK) ? v : UINT64_MAX;
+    *stop = p;
+    return err;
+}
+
+/*@brief Internal function that parses an optionally signed decimal integer from [p, end).*/
+str_err_t __str_parsei64(const dchar_t *p, const dchar_t *end, int64_t *out, const dchar_t **stop)
+{
+    int neg = 0;
+    const dchar_t *beg = p;
+    if (p < end && (*p == '-' || *p == '+'))
+    {
+        neg = (*p == '-');
+        ++p;
+    }
+    uint64_t mag;
+    str_err_t err = __str_parseu64(p, end, &mag, stop);
+    if (err == STR_ERR_SYNTAX)
+    {
+        *stop = beg;
+        return err;
+    }
+    if (err == STR_OK && mag > (uint64_t)INT64_MAX + neg)
+    {
+        err = STR_ERR_RANGE;
+    }
+    if (err == STR_ERR_RANGE)
+    {
+        *out = neg ? INT64_MIN : INT64_MAX;
+        return err;
+    }
+    *out = neg ? (int64_t)(0ULL - mag) : (int64_t)mag;
+    return STR_OK;
+}
+
+/*@brief Internal function that checks if [p, end) starts with a given lowercase ASCII word, ignoring case.*/
+int __str_startsword(const dchar_t *p, const dchar_t *end, const char *word)
+{
+    for (; *word; ++word, ++p)
+    {
+        if (p >= end || (*p | 0x20) != *word)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*@brief Internal function implementing the Eisel-Lemire algorithm: converts w * 10^q to the bits of the closest double.
+w must be non zero and q must be in [-342, 308].*/
+uint64_t __str_eisellemire(uint64_t w, int q)
+{
+    int lz = __builtin_clzll(w);
+    w <<= lz;
+    const uint64_t *pow5 = __str_pow5_128 + 2 * (q + 342);
+    unsigned __int128 first = (unsigned __int128)w * pow5[0];
+    uint64_t high = (uint64_t)(first >> 64), low = (uint64_t)first;
+    if ((high & 0x1FF) == 0x1FF) // The truncated product could be off, take the next 64 bits into account
+    {
+        uint64_t second = (uint64_t)(((unsigned __int128)w * pow5[1]) >> 64);
+        low += second;
+        if (second > low)
+        {
+            high++;
+        }
+    }
+    int upperbit = (int)(high >> 63);
+    int shift = upperbit + 64 - 52 - 3;
+    uint64_t mantissa = high >> shift;
+    int power2 = (((152170 + 65536) * q) >> 16) + 63 + upperbit - lz + 1023;
+    if (power2 <= 0) // Subnormal
+    {
+        if (-power2 + 1 >= 64)
+        {
+            return 0;
+        }
+        mantissa >>= -power2 + 1;
+        mantissa += (mantissa & 1);
+        mantissa >>= 1;
+        power2 = (mantissa < (1ULL << 52)) ? 0 : 1;
+        return ((uint64_t)power2 << 52) | (mantissa & ((1ULL << 52) - 1));
+    }
+    // Exactly halfway between two doubles: round to even instead of up
+    if (low <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 && (mantissa << shift) == high)
+    {
+        mantissa &= ~1ULL;
+    }
+    mantissa += (mantissa & 1);
+    mantissa >>= 1;
+    if (mantissa >= (2ULL << 52))
+    {
+        mantissa = 1ULL << 52;
+        power2++;
+    }
+    mantissa &= ~(1ULL << 52);
+    if (power2 >= 0x7FF)
+    {
+        return 0x7FFULL << 52;
+    }
+    return ((uint64_t)power2 << 52) | mantissa;
+}
+
+/*@brief Internal function that falls back to strtod() for the rare inputs the fast paths can't decide. The decimal point is
+translated to the current locale's one, so the result is still locale independent.*/
+double __str_strtodfallback(const dchar_t *p, const dchar_t *end)
+{
+    size_t len = end - p;
+    char stackbuf[128];
+    char *buf = (len < sizeof(stackbuf)) ? stackbuf : (char*)malloc(len + 1);
+    if (!buf)
+    {
+        STRERROR("malloc");
+    }
+    char point = *localeconv()->decimal_point;
+    for (size_t i = 0; i < len; i++)
+    {
+        buf[i] = (p[i] == '.') ? point : (char)p[i];
+    }
+    buf[len] = '\0';
+    double d = strtod(buf, NULL);
+    if (buf != stackbuf)
+    {
+        free(buf);
+    }
+    return d;
+}
+
+/*@brief Internal function that parses a double from [p, end), rounding correctly to nearest. Accepts an optional sign, digits with an optional
+decimal point and exponent, as well as "inf", "infinity" and "nan" in any case.*/
+str_err_t __str_parsedouble(const dchar_t *p, const dchar_t *end, double *out, const dchar_t **stop)
+{
+    static const double exact[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                   1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    const dchar_t *beg = p;
+    int neg = 0;
+    if (p < end && (*p == '-' || *p == '+'))
+    {
+        neg = (*p == '-');
+        ++p;
+    }
+    if (p < end && (*p | 0x20) == 'i' && __str_startsword(p, end, "inf"))
+    {
+        *stop = p + (__str_startsword(p, end, "infinity") ? 8 : 3);
+        *out = neg ? -HUGE_VAL : HUGE_VAL;
+        return STR_OK;
+    }
+    if (p < end && (*p | 0x20) == 'n' && __str_startsword(p, end, "nan"))
+    {
+        *stop = p + 3;
+        *out = neg ? -NAN : NAN;
+        return STR_OK;
+    }
+    // Mantissa: up to 19 significant digits go into w, the rest only adjust the exponent
+    const dchar_t *numbeg = p;
+    while (p < end && *p == '0')
+    {
+        ++p;
+    }
+    uint64_t w = 0;
+    int64_t exp10 = 0;
+    size_t sigdigits = 0;
+    int truncated = 0, anydigits = (p > numbeg);
+    const dchar_t *q = __str_scandigits(p, end, &w, 19);
+    sigdigits = q - p;
+    anydigits |= (sigdigits > 0);
+    p = q;
+    while (p < end && *p >= '0' && *p <= '9') // Integer digits beyond 19
+    {
+        truncated |= (*p != '0');
+        exp10++;
+        ++p;
+    }
+    if (p < end && *p == '.')
+    {
+        ++p;
+        const dchar_t *frac = p;
+        if (sigdigits == 0) // Leading zeros of the fraction are not significant
+        {
+            while (p < end && *p == '0')
+            {
+                ++p;
+            }
+        }
+        q = __str_scandigits(p, end, &w, 19 - sigdigits);
+        sigdigits += q - p;
+        exp10 -= q - frac;
+        p = q;
+        while (p < end && *p >= '0' && *p <= '9')
+        {
+            truncated |= (*p != '0');
+            ++p;
+        }
+        anydigits |= (p > frac);
+    }
+    if (!anydigits)
+    {
+        *stop = beg;
+        return STR_ERR_SYNTAX;
+    }
+    if (p < end && (*p | 0x20) == 'e')
+    {
+        const dchar_t *e = p + 1;
+        int eneg = 0;
+        if (e < end && (*e == '-' || *e == '+'))
+        {
+            eneg = (*e == '-');
+            ++e;
+        }
+        if (e < end && *e >= '0' && *e <= '9')
+        {
+            int64_t ev = 0;
+            while (e < end && *e >= '0' && *e <= '9')
+            {
+                if (ev < 100000000)
+                {
+                    ev = ev * 10 + (*e - '0');
+                }
+                ++e;
+            }
+            exp10 += eneg ? -ev : ev;
+            p = e;
+        }
+    }
+    *stop = p;
+    double d;
+    str_err_t err = STR_OK;
+    if (w == 0)
+    {
+        d = 0.0;
+    }
+    else if (!truncated && exp10 >= -22 && exp10 <= 22 && w <= (1ULL << 53)) // Clinger's fast path, both operands are exact
+    {
+        d = (exp10 < 0) ? (double)w / exact[-exp10] : (double)w * exact[exp10];
+    }
+    else if (exp10 < -342)
+    {
+        d = 0.0;
+        err = STR_ERR_RANGE;
+    }
+    else if (exp10 > 308)
+    {
+        d = HUGE_VAL;
+        err = STR_ERR_RANGE;
+    }
+    else
+    {
+        uint64_t bits = __str_eisellemire(w, (int)exp10);
+        if (truncated && bits != __str_eisellemire(w + 1, (int)exp10)) // The dropped digits matter
+        {
+            d = __str_strtodfallback(numbeg, p);
+            memcpy(&bits, &d, sizeof(bits));
+        }
+        memcpy(&d, &bits, sizeof(d));
+        if (bits == 0 || bits == (0x7FFULL << 52))
+        {
+            err = STR_ERR_RANGE;
+        }
+    }
+    *out = neg ? -d : d;
+    return err;
+}
+
+/*@brief Internal function that runs a parser over a whole range, requiring all of it to be consumed.*/
+#define __STR_PARSEWHOLE(parser, p, len, out) \
+    do \
+    { \
+        if (!(p) || (len) == 0) \
+        { \
+            return STR_ERR_EMPTY; \
+        } \
+        const dchar_t *stop_; \
+        str_err_t err_ = parser((p), (p) + (len), (out), &stop_); \
+        if (err_ != STR_ERR_SYNTAX && stop_ != (p) + (len)) \
+        { \
+            return STR_ERR_SYNTAX; \
+        } \
+        return err_; \
+    } while (0)
+
+/*@brief Internal function that runs a parser starting at an offset and reports the offset right after the number.*/
+#define __STR_PARSEAT(parser, pstr, pos, out, end) \
+    do \
+    { \
+        if (!(pstr) || !(out)) \
+        { \
+            return STR_ERR_NULL; \
+        } \
+        if (!(pstr)->pstr || (pos) >= (pstr)->strlen) \
+        { \
+            return STR_ERR_EMPTY; \
+        } \
+        const dchar_t *stop_; \
+        str_err_t err_ = parser((pstr)->pstr + (pos), (pstr)->pstr + (pstr)->strlen, (out), &stop_); \
+        if (end) \
+        { \
+            *(end) = stop_ - (pstr)->pstr; \
+        } \
+        return err_; \
+    } while (0)
+
+/*@brief Converts the whole string to a signed 64-bit integer.*/
+str_err_t str_toi64(const str_t *pstr, int64_t *out)
+{
+    if (!pstr || !out)
+    {
+        return STR_ERR_NULL;
+    }
+    __STR_PARSEWHOLE(__str_parsei64, pstr->pstr, pstr->strlen, out);
+}
+
+/*@brief Converts the whole string to an unsigned 64-bit integer.*/
+str_err_t str_tou64(const str_t *pstr, uint64_t *out)
+{
+    if (!pstr || !out)
+    {
+        return STR_ERR_NULL;
+    }
+    __STR_PARSEWHOLE(__str_parseu64, pstr->pstr, pstr->strlen, out);
+}
+
+/*@brief Converts the whole string to a double, rounding correctly to nearest.*/
+str_err_t str_tod(const str_t *pstr, double *out)
+{
+    if (!pstr || !out)
+    {
+        return STR_ERR_NULL;
+    }
+    __STR_PARSEWHOLE(__str_parsedouble, pstr->pstr, pstr->strlen, out);
+}
+
+/*@brief Converts a whole view to a signed 64-bit integer.*/
+str_err_t str_toi64_v(str_view_t view, int64_t *out)
+{
+    if (!out)
+    {
+        return STR_ERR_NULL;
+    }
+    __STR_PARSEWHOLE(__str_parsei64, view.pstr, view.strlen, out);
+}
+
+/*@brief Converts a whole view to an unsigned 64-bit integer.*/
+str_err_t str_tou64_v(str_view_t view, uint64_t *out)
+{
+    if (!out)
+    {
+        return STR_ERR_NULL;
+    }
+    __STR_PARSEWHOLE(__str_parseu64, view.pstr, view.strlen, out);
+}
+
+/*@brief Converts a whole view to a double, rounding correctly to nearest.*/
+str_err_t str_tod_v(str_view_t view, double *out)
+{
+    if (!out)
+    {
+        return STR_ERR_NULL;
+    }
+    __STR_PARSEWHOLE(__str_parsedouble, view.pstr, view.strlen, out);
+}
+
+/*@brief Parses a signed 64-bit integer starting at position pos. If end isn't null, it receives the position right after the number.*/
+str_err_t str_toi64_at(const str_t *pstr, size_t pos, int64_t *out, size_t *end)
+{
+    __STR_PARSEAT(__str_parsei64, pstr, pos, out, end);
+}
+
+/*@brief Parses an unsigned 64-bit integer starting at position pos. If end isn't null, it receives the position right after the number.*/
+str_err_t str_tou64_at(const str_t *pstr, size_t pos, uint64_t *out, size_t *end)
+{
+    __STR_PARSEAT(__str_parseu64, pstr, pos, out, end);
+}
+
+/*@brief Parses a double starting at position pos. If end isn't null, it receives the position right after the number.*/
+str_err_t str_tod_at(const str_t *pstr, size_t pos, double *out, size_t *end)
+{
+    __STR_PARSEAT(__str_parsedouble, pstr, pos, out, end);
+}
+
+/*@brief Internal table of all two digit numbers, used to write decimal integers two digits at a time.*/
+const char __str_digitpairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/*@brief Internal function that returns the number of decimal digits of v.*/
+size_t __str_u64len(uint64_t v)
+{
+    static const uint64_t pow10[20] = {1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+        100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+        1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL};
+    v |= 1; // 0 has one digit too, no other number gains a digit this way since powers of 10 are even
+    size_t t = ((64 - __builtin_clzll(v)) * 1233) >> 12; // log10 estimate from the bit width, can be one too large
+    return t - (v < pow10[t]) + 1;
+}
+
+/*@brief Internal function that writes the decimal digits of v so that they end right before end. Returns a pointer to the first digit.*/
+dchar_t *__str_writeu64(dchar_t *end, uint64_t v)
+{
+    while (v >= 100)
+    {
+        const char *pair = __str_digitpairs + 2 * (v % 100);
+        v /= 100;
+        end -= 2;
+        end[0] = pair[0];
+        end[1] = pair[1];
+    }
+    if (v >= 10)
+    {
+        end -= 2;
+        end[0] = __str_digitpairs[2 * v];
+        end[1] = __str_digitpairs[2 * v + 1];
+    }
+    else
+    {
+        *--end = (dchar_t)('0' + v);
+    }
+    return end;
+}
+
+/*@brief Internal struct with the shortest decimal representation of a double: digits * 10^exponent.*/
+typedef struct strdecimal
+{
+    uint64_t digits; /*Significant digits, at most 17 of them*/
+    int32_t exponent; /*Decimal exponent of the last digit*/
+} strdecimal_t;
+
+/*@brief Internal function that returns the number of times value is divisible by 5.*/
+uint32_t __str_pow5factor(uint64_t value)
+{
+    uint32_t count = 0;
+    while (value % 5 == 0)
+    {
+        value /= 5;
+        ++count;
+    }
+    return count;
+}
+
+/*@brief Internal function that computes (m * mul) >> j, where mul is a 128-bit number given as its low and high word and j >= 64.*/
+uint64_t __str_mulshift64(uint64_t m, const uint64_t *mul, int32_t j)
+{
+    unsigned __int128 b0 = (unsigned __int128)m * mul[0];
+    unsigned __int128 b2 = (unsigned __int128)m * mul[1];
+    return (uint64_t)(((b0 >> 64) + b2) >> (j - 64));
+}
+
+/*@brief Internal function implementing Ryu (Ulf Adams, 2018): finds the shortest decimal that rounds back to the given finite, non zero
+double, picking the closest one when there are several.*/
+strdecimal_t __str_ryu(uint64_t ieeeMantissa, uint32_t ieeeExponent)
+{
+    int32_t e2;
+    uint64_t m2;
+    if (ieeeExponent == 0)
+    {
+        e2 = 1 - 1023 - 52 - 2;
+        m2 = ieeeMantissa;
+    }
+    else
+    {
+        e2 = (int32_t)ieeeExponent - 1023 - 52 - 2;
+        m2 = (1ULL << 52) | ieeeMantissa;
+    }
+    const int acceptBounds = (m2 & 1) == 0; // Round to even, so ties at the interval bounds round back to this double
+    // The interval of decimals that round to this double is (mv - mm, mv + mp), everything is scaled by 4 to keep it integral
+    const uint64_t mv = 4 * m2;
+    const uint32_t mmShift = ieeeMantissa != 0 || ieeeExponent <= 1;
+    uint64_t vr, vp, vm;
+    int32_t e10;
+    int vmIsTrailingZeros = 0, vrIsTrailingZeros = 0;
+    if (e2 >= 0)
+    {
+        const uint32_t q = (uint32_t)((e2 * 78913) >> 18) - (e2 > 3); // log10(2^e2), minus one
+        e10 = (int32_t)q;
+        const int32_t k = 125 + (int32_t)((((int32_t)q * 1217359) >> 19) + 1) - 1; // 125 + bit width of 5^q - 1
+        const int32_t i = -e2 + (int32_t)q + k;
+        const uint64_t *mul = __str_ryu_pow5inv + 2 * q;
+        vr = __str_mulshift64(4 * m2, mul, i);
+        vp = __str_mulshift64(4 * m2 + 2, mul, i);
+        vm = __str_mulshift64(4 * m2 - 1 - mmShift, mul, i);
+        if (q <= 21)
+        {
+            // Only one of mp, mv and mm can be a multiple of 5, if any
+            if (mv % 5 == 0)
+            {
+                vrIsTrailingZeros = __str_pow5factor(mv) >= q;
+            }
+            else if (acceptBounds)
+            {
+                vmIsTrailingZeros = __str_pow5factor(mv - 1 - mmShift) >= q;
+            }
+            else
+            {
+                vp -= __str_pow5factor(mv + 2) >= q;
+            }
+        }
+    }
+    else
+    {
+        const uint32_t q = (uint32_t)((-e2 * 732923) >> 20) - (-e2 > 1); // log10(5^-e2), minus one
+        e10 = (int32_t)q + e2;
+        const int32_t i = -e2 - (int32_t)q;
+        const int32_t k = (int32_t)(((i * 1217359) >> 19) + 1) - 125; // bit width of 5^i - 125
+        const int32_t j = (int32_t)q - k;
+        const uint64_t *mul = __str_ryu_pow5 + 2 * i;
+        vr = __str_mulshift64(4 * m2, mul, j);
+        vp = __str_mulshift64(4 * m2 + 2, mul, j);
+        vm = __str_mulshift64(4 * m2 - 1 - mmShift, mul, j);
+        if (q <= 1)
+        {
+            // mv has at least q trailing zero bits, so vr is exact
+            vrIsTrailingZeros = 1;
+            if (acceptBounds)
+            {
+                vmIsTrailingZeros = mmShift == 1;
+            }
+            else
+            {
+                --vp;
+            }
+        }
+        else if (q < 63)
+        {
+            vrIsTrailingZeros = (mv & ((1ULL << q) - 1)) == 0;
+        }
+    }
+    // Drop digits while the interval still contains a shorter number
+    int32_t removed = 0;
+    uint32_t lastRemovedDigit = 0;
+    uint64_t output;
+    if (vmIsTrailingZeros || vrIsTrailingZeros) // Rare case, exact ties have to be tracked
+    {
+        while (vp / 10 > vm / 10)
+        {
+            vmIsTrailingZeros &= vm % 10 == 0;
+            vrIsTrailingZeros &= lastRemovedDigit == 0;
+            lastRemovedDigit = (uint32_t)(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            ++removed;
+        }
+        if (vmIsTrailingZeros)
+        {
+            while (vm % 10 == 0)
+            {
+                vrIsTrailingZeros &= lastRemovedDigit == 0;
+                lastRemovedDigit = (uint32_t)(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                ++removed;
+            }
+        }
+        if (vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0)
+        {
+            lastRemovedDigit = 4; // Exactly halfway, round to even
+        }
+        output = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || lastRemovedDigit >= 5);
+    }
+    else
+    {
+        int roundUp = 0;
+        if (vp / 100 > vm / 100) // Remove two digits at a time when possible
+        {
+            roundUp = vr % 100 >= 50;
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+        while (vp / 10 > vm / 10)
+        {
+            roundUp = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            ++removed;
+        }
+        output = vr + (vr == vm || roundUp);
+    }
+    strdecimal_t dec = {output, e10 + removed};
+    return dec;
+}
+
+#define STR_DOUBLE_MAXLEN 25 // Longest output of __str_writedouble(), ex. "-2.2250738585072014e-308"
+
+/*@brief Internal function that writes the shortest representation of a double that reads back to the same value. Uses fixed notation for
+decimal exponents in [-4, 16] and scientific notation (like %g) otherwise. Returns the number of written characters.*/
+size_t __str_writedouble(dchar_t *dst, double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    dchar_t *p = dst;
+    const int neg = (int)(bits >> 63);
+    const uint64_t ieeeMantissa = bits & ((1ULL << 52) - 1);
+    const uint32_t ieeeExponent = (uint32_t)((bits >> 52) & 0x7FF);
+    if (ieeeExponent == 0x7FF)
+    {
+        const char *special = ieeeMantissa ? "nan" : (neg ? "-inf" : "inf");
+        while (*special)
+        {
+            *p++ = *special++;
+        }
+        return p - dst;
+    }
+    if (neg)
+    {
+        *p++ = '-';
+    }
+    if (ieeeExponent == 0 && ieeeMantissa == 0)
+    {
+        *p++ = '0';
+        return p - dst;
+    }
+    strdecimal_t dec = __str_ryu(ieeeMantissa, ieeeExponent);
+    dchar_t digits[20];
+    size_t olength = __str_u64len(dec.digits);
+    __str_writeu64(digits + olength, dec.digits);
+    int32_t lead = dec.exponent + (int32_t)olength - 1; // Exponent of the first digit
+    if (lead >= -4 && lead <= 16)
+    {
+        if (dec.exponent >= 0) // Integral
+        {
+            memcpy(p, digits, olength * sizeof(dchar_t));
+            p += olength;
+            for (int32_t i = 0; i < dec.exponent; i++)
+            {
+                *p++ = '0';
+            }
+        }
+        else if (lead >= 0) // Decimal point inside the digits
+        {
+            memcpy(p, digits, (lead + 1) * sizeof(dchar_t));
+            p += lead + 1;
+            *p++ = '.';
+            memcpy(p, digits + lead + 1, (olength - lead - 1) * sizeof(dchar_t));
+            p += olength - lead - 1;
+        }
+        else // Leading zeros
+        {
+            *p++ = '0';
+            *p++ = '.';
+            for (int32_t i = -1; i > lead; i--)
+            {
+                *p++ = '0';
+            }
+            memcpy(p, digits, olength * sizeof(dchar_t));
+            p += olength;
+        }
+        return p - dst;
+    }
+    *p++ = digits[0];
+    if (olength > 1)
+    {
+        *p++ = '.';
+        memcpy(p, digits + 1, (olength - 1) * sizeof(dchar_t));
+        p += olength - 1;
+    }
+    *p++ = 'e';
+    *p++ = (lead < 0) ? '-' : '+';
+    uint32_t e = (uint32_t)((lead < 0) ? -lead : lead);
+    if (e < 10)
+    {
+        *p++ = '0';
+    }
+    p += __str_u64len(e);
+    __str_writeu64(p, e);
+    return p - dst;
+}
+
+/*@brief Appends a signed integer in decimal, writing directly into the string's spare capacity.*/
+void str_append_i64(str_t *pstr, int64_t value)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_append_i64: The address of a str_t was null.");
+    }
+    __str_reserve(pstr, 20);
+    uint64_t mag = (value < 0) ? 0ULL - (uint64_t)value : (uint64_t)value;
+    size_t len = __str_u64len(mag) + (value < 0);
+    dchar_t *end = pstr->pstr + pstr->strlen + len;
+    dchar_t *beg = __str_writeu64(end, mag);
+    if (value < 0)
+    {
+        beg[-1] = '-';
+    }
+    *end = '\0';
+    pstr->strlen += len;
+}
+
+/*@brief Appends an unsigned integer in decimal, writing directly into the string's spare capacity.*/
+void str_append_u64(str_t *pstr, uint64_t value)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_append_u64: The address of a str_t was null.");
+    }
+    __str_reserve(pstr, 20);
+    size_t len = __str_u64len(value);
+    dchar_t *end = pstr->pstr + pstr->strlen + len;
+    __str_writeu64(end, value);
+    *end = '\0';
+    pstr->strlen += len;
+}
+
+/*@brief Appends an unsigned integer in lowercase hexadecimal, without any prefix.*/
+void str_append_hex(str_t *pstr, uint64_t value)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_append_hex: The address of a str_t was null.");
+    }
+    __str_reserve(pstr, 16);
+    size_t len = (64 - __builtin_clzll(value | 1) + 3) / 4;
+    dchar_t *end = pstr->pstr + pstr->strlen + len;
+    dchar_t *p = end;
+    do
+    {
+        *--p = "0123456789abcdef"[value & 0xF];
+        value >>= 4;
+    } while (p > end - len);
+    *end = '\0';
+    pstr->strlen += len;
+}
+
+/*@brief Appends the shortest decimal representation of a double that reads back (ex. with str_tod) to exactly the same value.
+Uses fixed notation for numbers between 1e-4 and 1e17 and scientific notation otherwise, "inf", "-inf" and "nan" for special values.*/
+void str_append_double(str_t *pstr, double value)
+{
+    if (!pstr)
+    {
+        STRFAIL("str_append_double: The address of a str_t was null.");
+    }
+    __str_reserve(pstr, STR_DOUBLE_MAXLEN);
+    pstr->strlen += __str_writedouble(pstr->pstr + pstr->strlen, value);
+    pstr->pstr[pstr->strlen] = '\0';
+}
+#pragma endregion
+
+#pragma region FORMATTING
+/*
+Formatting appends text to a str_t. A format string can mix two styles of conversions:
++ printf-style: %[flags][width][.precision][length]conversion, with the flags "-+ #0", '*' for width/precision passed as an int argument,
+  the length modifiers hh, h, l, ll, z, j, t, L and the conversions d i u o x X b c s p f F e E g G a A r and %%.
+  r is an extension that prints the shortest representation of a double that reads back to the same value (see str_append_double).
++ python-style: {} formats a str_t* argument, {:[[fill]align][sign][#][0][width][.precision][length][type]} uses the same conversion
+  characters as printf (no type means a str_t*), the alignments '<', '>', '^' and '=' and a custom fill character. {{ and }} produce braces.
+  A brace that doesn't start a conversion is copied as it is.
+The s conversion expects a dchar_t string and c a dchar_t character. The f, e, g and a conversions are rendered once with snprintf() while
+measuring and copied over afterwards, everything else is rendered directly into the string, which is reallocated at most once since the total
+length is computed up front.
+*/
+
+#define STR_FMT_PLUS 0x01 // Always print the sign
+#define STR_FMT_SPACE 0x02 // Print a space instead of the plus sign
+#define STR_FMT_ALT 0x04 // Alternate form (0x prefix, trailing decimal point, ...)
+#define STR_FMT_ARGWIDTH -2 // The width/precision is passed as an int argument
+#define STR_FMT_STACKOPS 32 // Number of operations str_format() can parse without allocating
+#define STR_FMT_STACKVALS 16 // Number of conversions str_format() can render without allocating
+#define STR_FMT_DOUBLEBUF 48 // Floating point conversions up to this length (with the null terminator) are kept without allocating
+
+/*@brief Internal struct for a single step of a compiled format: either a piece of literal text or a conversion.*/
+typedef struct strfmtop
+{
+    const dchar_t *lit; /*Literal text, null for conversions*/
+    size_t litlen; /*Length of the literal text*/
+    int width; /*Minimal field width, -1 if not given*/
+    int precision; /*Precision, -1 if not given*/
+    dchar_t fill; /*Padding character*/
+    char align; /*'<', '>', '^' or '=' (padding between the sign and the digits)*/
+    char conv; /*Conversion character, 'S' for a str_t* */
+    char length; /*Length modifier: '\0', 'H' for hh, 'h', 'l', 'q' for ll, 'z', 'j', 't' or 'L'*/
+    unsigned char flags; /*STR_FMT_* flags*/
+} strfmtop_t;
+
+/** @struct str_fmt_t
+ *  @brief A compiled format string. Compile hot format strings once with str_fmtnew() and pass them to str_formatSpec(), so that
+ *  the format doesn't need to be parsed on every call.
+ */
+typedef struct strfmt
+{
+    strfmtop_t *ops; /*The compiled steps in order*/
+    size_t nops; /*Number of steps*/
+    size_t opcap; /*Size of the ops array*/
+    size_t nconv; /*Number of conversions among the steps*/
+    size_t litlen; /*Total length of the literal text*/
+    int ownsops; /*Whether the ops array is heap allocated*/
+    dchar_t *text; /*Owned copy of the format string, null for formats parsed on the fly*/
+} str_fmt_t;
+
+/*@brief Internal union holding a single converted argument.*/
+typedef union strfmtarg
+{
+    long long i;
+    unsigned long long u;
+    double d;
+    long double ld;
+    const void *p;
+} strfmtarg_t;
+
+/*@brief Internal struct describing how an integer conversion is laid out: its sign, prefix, zeros and digits.*/
+typedef struct strfmtint
+{
+    unsigned long long mag; /*Absolute value*/
+    unsigned base; /*Base of the digits*/
+    char sign; /*Sign character or '\0'*/
+    char prefix[3]; /*"0x", "0X", "0b" or ""*/
+    size_t prefixlen; /*Length of the prefix*/
+    size_t zeros; /*Zeros required by the precision*/
+    size_t ndigits; /*Number of digits, 0 for a zero with zero precision*/
+} strfmtint_t;
+
+/*@brief Internal struct holding a conversion's argument and its measurements between the two formatting passes.*/
+typedef struct strfmtval
+{
+    strfmtarg_t arg; /*The argument*/
+    size_t len; /*Length of the rendered argument without the width padding*/
+    int width; /*Resolved width*/
+    int precision; /*Resolved precision*/
+    int left; /*Set when a negative width argument requested left alignment*/
+    strfmtint_t lay; /*Layout of an integer conversion*/
+    char *text; /*A rendered f, e, g or a conversion, points to buf when it fits and is null for the other conversions*/
+    char buf[STR_FMT_DOUBLEBUF]; /*Room for short floating point conversions*/
+} strfmtval_t;
+
+/*@brief Internal function that appends a step to a format, moving the steps to the heap once the initial array is full.*/
+strfmtop_t *__str_fmtpush(str_fmt_t *pfmt)
+{
+    if (pfmt->nops == pfmt->opcap)
+    {
+        size_t newcap = (pfmt->opcap == 0) ? 8 : pfmt->opcap * 2;
+        strfmtop_t *newops;
+        if (pfmt->ownsops)
+        {
+            newops = (strfmtop_t*)realloc(pfmt->ops, sizeof(strfmtop_t) * newcap);
+        }
+        else
+        {
+            newops = (strfmtop_t*)malloc(sizeof(strfmtop_t) * newcap);
+            if (newops && pfmt->nops > 0)
+            {
+                memcpy(newops, pfmt->ops, sizeof(strfmtop_t) * pfmt->nops);
+            }
+        }
+        if (!newops)
+        {
+            STRERROR("realloc");
+        }
+        pfmt->ops = newops;
+        pfmt->opcap = newcap;
+        pfmt->ownsops = 1;
+    }
+    strfmtop_t *op = pfmt->ops + pfmt->nops++;
+    op->lit = NULL;
+    op->litlen = 0;
+    op->width = -1;
+    op->precision = -1;
+    op->fill = ' ';
+    op->align = '>';
+    op->conv = '\0';
+    op->length = '\0';
+    op->flags = 0;
+    return op;
+}
+
+/*@brief Internal function that records literal text, extending the previous literal step if the text directly follows it.*/
+void __str_fmtlit(str_fmt_t *pfmt, const dchar_t *p, size_t len)
+{
+    if (len == 0)
+    {
+        return;
+    }
+    pfmt->litlen += len;
+    if (pfmt->nops > 0)
+    {
+        strfmtop_t *last = pfmt->ops + pfmt->nops - 1;
+        if (last->lit && last->lit + last->litlen == p)
+        {
+            last->litlen += len;
+            return;
+        }
+    }
+    strfmtop_t *op = __str_fmtpush(pfmt);
+    op->lit = p;
+    op->litlen = len;
+}
+
+/*@brief Internal function that parses a decimal number or a '*' of a width or precision.*/
+const dchar_t *__str_fmtnum(const dchar_t *p, int *out)
+{
+    if (*p == '*')
+    {
+        *out = STR_FMT_ARGWIDTH;
+        return p + 1;
+    }
+    int n = 0;
+    while (*p >= '0' && *p <= '9')
+    {
+        if (n > 100000)
+        {
+            STRFAIL("str_format: Width or precision is too large.");
+        }
+        n = n * 10 + (*p - '0');
+        ++p;
+    }
+    *out = n;
+    return p;
+}
+
+/*@brief Internal function that parses the length modifier and the conversion character shared by both conversion styles.*/
+const dchar_t *__str_fmttype(const dchar_t *p, strfmtop_t *op, int allowNone)
+{
+    switch (*p)
+    {
+    case 'h':
+        op->length = (p[1] == 'h') ? 'H' : 'h';
+        p += (p[1] == 'h') ? 2 : 1;
+        break;
+    case 'l':
+        op->length = (p[1] == 'l') ? 'q' : 'l';
+        p += (p[1] == 'l') ? 2 : 1;
+        break;
+    case 'z':
+    case 'j':
+    case 't':
+    case 'L':
+        op->length = (char)*p;
+        ++p;
+        break;
+    }
+    switch (*p)
+    {
+    case 'd': case 'i': case 'u': case 'o': case 'x': case 'X': case 'b':
+    case 'c': case 's': case 'p':
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A': case 'r':
+        op->conv = (char)*p;
+        return p + 1;
+    }
+    if (allowNone && !op->length)
+    {
+        op->conv = 'S';
+        return p;
+    }
+    STRFAIL("str_format: Invalid conversion character in the format string.");
+    return p;
+}
+
+/*@brief Internal function that parses a printf-style conversion starting right after the '%'.*/
+const dchar_t *__str_fmtprintf(const dchar_t *p, strfmtop_t *op)
+{
+    int left = 0, zero = 0;
+    for (;; ++p)
+    {
+        if (*p == '-') left = 1;
+        else if (*p == '0') zero = 1;
+        else if (*p == '+') op->flags |= STR_FMT_PLUS;
+        else if (*p == ' ') op->flags |= STR_FMT_SPACE;
+        else if (*p == '#') op->flags |= STR_FMT_ALT;
+        else break;
+    }
+    if ((*p >= '0' && *p <= '9') || *p == '*')
+    {
+        p = __str_fmtnum(p, &op->width);
+    }
+    if (*p == '.')
+    {
+        p = __str_fmtnum(p + 1, &op->precision);
+    }
+    p = __str_fmttype(p, op, 0);
+    if (left)
+    {
+        op->align = '<';
+    }
+    else if (zero && op->conv != 'c' && op->conv != 's' && op->conv != 'p')
+    {
+        op->align = '=';
+        op->fill = '0';
+    }
+    return p;
+}
+
+/*@brief Internal function that checks if a character is a python-style alignment.*/
+int __str_fmtisalign(dchar_t c)
+{
+    return c == '<' || c == '>' || c == '^' || c == '=';
+}
+
+/*@brief Internal function that parses a python-style conversion starting right after the '{'.*/
+const dchar_t *__str_fmtbrace(const dchar_t *p, strfmtop_t *op)
+{
+    char align = '\0';
+    if (*p == ':')
+    {
+        ++p;
+        if (*p && *p != '}' && __str_fmtisalign(p[1]))
+        {
+            op->fill = *p;
+            align = (char)p[1];
+            p += 2;
+        }
+        else if (__str_fmtisalign(*p))
+        {
+            align = (char)*p;
+            ++p;
+        }
+        if (*p == '+') { op->flags |= STR_FMT_PLUS; ++p; }
+        else if (*p == ' ') { op->flags |= STR_FMT_SPACE; ++p; }
+        else if (*p == '-') { ++p; }
+        if (*p == '#')
+        {
+            op->flags |= STR_FMT_ALT;
+            ++p;
+        }
+        if (*p == '0')
+        {
+            if (!align)
+            {
+                op->fill = '0';
+                align = '=';
+            }
+            ++p;
+        }
+        if ((*p >= '0' && *p <= '9') || *p == '*')
+        {
+            p = __str_fmtnum(p, &op->width);
+        }
+        if (*p == '.')
+        {
+            p = __str_fmtnum(p + 1, &op->precision);
+        }
+        p = __str_fmttype(p, op, 1);
+    }
+    else
+    {
+        op->conv = 'S';
+    }
+    if (*p != '}')
+    {
+        STRFAIL("str_format: Unterminated {} conversion in the format string.");
+    }
+    if (!align) // Python aligns numbers to the right and text to the left
+    {
+        align = (op->conv == 'S' || op->conv == 's' || op->conv == 'c') ? '<' : '>';
+    }
+    op->align = align;
+    return p + 1;
+}
+
+/*@brief Internal function that compiles a null terminated format into pfmt. The steps point into the format, which has to outlive them.*/
+void __str_fmtparse(str_fmt_t *pfmt, const dchar_t *format)
+{
+    const dchar_t *p = format, *litbeg = format;
+    while (*p)
+    {
+        if (*p == '%')
+        {
+            __str_fmtlit(pfmt, litbeg, p - litbeg);
+            if (p[1] == '%')
+            {
+                __str_fmtlit(pfmt, p + 1, 1);
+                p += 2;
+            }
+            else
+            {
+                p = __str_fmtprintf(p + 1, __str_fmtpush(pfmt));
+                pfmt->nconv++;
+            }
+            litbeg = p;
+        }
+        else if ((*p == '{' || *p == '}') && p[1] == *p)
+        {
+            __str_fmtlit(pfmt, litbeg, p + 1 - litbeg);
+            p += 2;
+            litbeg = p;
+        }
+        else if (*p == '{' && (p[1] == '}' || p[1] == ':'))
+        {
+            __str_fmtlit(pfmt, litbeg, p - litbeg);
+            p = __str_fmtbrace(p + 1, __str_fmtpush(pfmt));
+            pfmt->nconv++;
+            litbeg = p;
+        }
+        else
+        {
+            ++p;
+        }
+    }
+    __str_fmtlit(pfmt, litbeg, p - litbeg);
+}
+
+/*@brief Returns a pointer to a newly compiled format. The format string is copied, so it doesn't have to outlive the result.*/
+str_fmt_t *str_fmtnew(const dchar_t *format)
+{
+    if (!format)
+    {
+        STRFAIL("str_fmtnew: The address of the format string was null.");
+    }
+    str_fmt_t *pfmt = (str_fmt_t*)calloc(1, sizeof(str_fmt_t));
+    if (!pfmt)
+    {
+        STRERROR("calloc");
+    }
+    pfmt->text = _strdup(format);
+    if (!pfmt->text)
+    {
+        STRERROR("strdup");
+    }
+    __str_fmtparse(pfmt, pfmt->text);
+    return pfmt;
+}
+
+/*@brief Safely free a str_fmt_t by passing the address of a pointer variable. The pointer will be set to null afterwards.*/
+void str_fmtfree(str_fmt_t **ppfmt)
+{
+    if (!ppfmt)
+    {
+        STRFAIL("str_fmtfree: The address of a str_fmt_t pointer variable was null.");
+    }
+    if (!*ppfmt)
+    {
+        return;
+    }
+    if ((*ppfmt)->ownsops)
+    {
+        free((*ppfmt)->ops);
+    }
+    free((*ppfmt)->text);
+    free(*ppfmt);
+    *ppfmt = NULL;
+}
+
+/*@brief Internal function that fetches the argument of a conversion.*/
+void __str_fmtfetch(const strfmtop_t *op, strfmtval_t *val, va_list *ap)
+{
+    val->width = (op->width == STR_FMT_ARGWIDTH) ? va_arg(*ap, int) : op->width;
+    val->precision = (op->precision == STR_FMT_ARGWIDTH) ? va_arg(*ap, int) : op->precision;
+    val->left = 0;
+    val->text = NULL;
+    if (op->width == STR_FMT_ARGWIDTH && val->width < 0) // A negative width argument means left alignment, like in printf
+    {
+        val->width = (val->width == INT_MIN) ? 0 : -val->width;
+        val->left = 1;
+    }
+    if (val->precision < 0) // And a negative precision argument is ignored
+    {
+        val->precision = -1;
+    }
+    switch (op->conv)
+    {
+    case 'd': case 'i':
+        switch (op->length)
+        {
+        case 'H': val->arg.i = (signed char)va_arg(*ap, int); break;
+        case 'h': val->arg.i = (short)va_arg(*ap, int); break;
+        case 'l': val->arg.i = va_arg(*ap, long); break;
+        case 'q': val->arg.i = va_arg(*ap, long long); break;
+        case 'z': val->arg.i = va_arg(*ap, ssize_t); break;
+        case 'j': val->arg.i = va_arg(*ap, intmax_t); break;
+        case 't': val->arg.i = va_arg(*ap, ptrdiff_t); break;
+        default: val->arg.i = va_arg(*ap, int); break;
+        }
+        break;
+    case 'u': case 'o': case 'x': case 'X': case 'b':
+        switch (op->length)
+        {
+        case 'H': val->arg.u = (unsigned char)va_arg(*ap, unsigned); break;
+        case 'h': val->arg.u = (unsigned short)va_arg(*ap, unsigned); break;
+        case 'l': val->arg.u = va_arg(*ap, unsigned long); break;
+        case 'q': val->arg.u = va_arg(*ap, unsigned long long); break;
+        case 'z': val->arg.u = va_arg(*ap, size_t); break;
+        case 'j': val->arg.u = va_arg(*ap, uintmax_t); break;
+        case 't': val->arg.u = (unsigned long long)va_arg(*ap, ptrdiff_t); break;
+        default: val->arg.u = va_arg(*ap, unsigned); break;
+        }
+        break;
+    case 'c':
+        #ifdef DOOTSTR_USE_WCHAR
+        val->arg.u = va_arg(*ap, wint_t);
+        #else
+        val->arg.u = (unsigned char)va_arg(*ap, int);
+        #endif
+        break;
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A': case 'r':
+        if (op->length == 'L' && op->conv != 'r')
+        {
+            val->arg.ld = va_arg(*ap, long double);
+        }
+        else
+        {
+            val->arg.d = va_arg(*ap, double);
+        }
+        break;
+    default: // s, p and S
+        val->arg.p = va_arg(*ap, const void *);
+        break;
+    }
+}
+
+/*@brief Internal function that builds the snprintf() format for a floating point conversion. Width is only included for zero padding.*/
+void __str_fmtdoublespec(const strfmtop_t *op, const strfmtval_t *val, char *spec)
+{
+    *spec++ = '%';
+    if (op->flags & STR_FMT_PLUS) *spec++ = '+';
+    if (op->flags & STR_FMT_SPACE) *spec++ = ' ';
+    if (op->flags & STR_FMT_ALT) *spec++ = '#';
+    if (op->align == '=' && op->fill == '0' && val->width > 0)
+    {
+        spec += sprintf(spec, "0%d", val->width);
+    }
+    if (val->precision >= 0)
+    {
+        spec += sprintf(spec, ".%d", val->precision);
+    }
+    if (op->length == 'L')
+    {
+        *spec++ = 'L';
+    }
+    *spec++ = op->conv;
+    *spec = '\0';
+}
+
+/*@brief Internal function that renders a floating point conversion with snprintf() into val->text, using val->buf when it fits.
+Returns the length of the conversion.*/
+size_t __str_fmtdouble(const strfmtop_t *op, strfmtval_t *val)
+{
+    char spec[32];
+    __str_fmtdoublespec(op, val, spec);
+    int len;
+    if (op->length == 'L')
+    {
+        len = snprintf(val->buf, sizeof(val->buf), spec, val->arg.ld);
+    }
+    else
+    {
+        len = snprintf(val->buf, sizeof(val->buf), spec, val->arg.d);
+    }
+    if (len < 0)
+    {
+        STRERROR("snprintf");
+    }
+    val->text = val->buf;
+    if ((size_t)len >= sizeof(val->buf)) // Only long %f conversions and big precisions get here
+    {
+        val->text = (char*)malloc((size_t)len + 1);
+        if (!val->text)
+        {
+            STRERROR("malloc");
+        }
+        if (op->length == 'L')
+        {
+            snprintf(val->text, (size_t)len + 1, spec, val->arg.ld);
+        }
+        else
+        {
+            snprintf(val->text, (size_t)len + 1, spec, val->arg.d);
+        }
+    }
+    return (size_t)len;
+}
+
+/*@brief Internal function that returns the number of digits of v in a given base (2, 8, 10 or 16).*/
+size_t __str_fmtndigits(unsigned long long v, unsigned base)
+{
+    if (base == 10)
+    {
+        return __str_u64len(v);
+    }
+    size_t bits = 64 - __builtin_clzll(v | 1); // Powers of two just need the bit width
+    size_t shift = (base == 16) ? 4 : (base == 8) ? 3 : 1;
+    return (bits + shift - 1) / shift;
+}
+
+/*@brief Internal function that computes the layout of an integer conversion and returns its length.*/
+size_t __str_fmtintlayout(const strfmtop_t *op, const strfmtval_t *val, strfmtint_t *lay)
+{
+    lay->sign = '\0';
+    lay->prefixlen = 0;
+    lay->prefix[0] = '\0';
+    if (op->conv == 'd' || op->conv == 'i')
+    {
+        if (val->arg.i < 0)
+        {
+            lay->mag = 0ULL - (unsigned long long)val->arg.i;
+            lay->sign = '-';
+        }
+        else
+        {
+            lay->mag = (unsigned long long)val->arg.i;
+            lay->sign = (op->flags & STR_FMT_PLUS) ? '+' : (op->flags & STR_FMT_SPACE) ? ' ' : '\0';
+        }
+    }
+    else
+    {
+        lay->mag = val->arg.u;
+    }
+    lay->base = (op->conv == 'x' || op->conv == 'X') ? 16 : (op->conv == 'o') ? 8 : (op->conv == 'b') ? 2 : 10;
+    if ((op->flags & STR_FMT_ALT) && lay->mag != 0 && lay->base != 10 && lay->base != 8)
+    {
+        lay->prefix[0] = '0';
+        lay->prefix[1] = (op->conv == 'b') ? 'b' : op->conv;
+        lay->prefixlen = 2;
+    }
+    lay->ndigits = (val->precision == 0 && lay->mag == 0) ? 0 : __str_fmtndigits(lay->mag, lay->base);
+    lay->zeros = (val->precision > 0 && (size_t)val->precision > lay->ndigits) ? (size_t)val->precision - lay->ndigits : 0;
+    if ((op->flags & STR_FMT_ALT) && lay->base == 8 && lay->zeros == 0 && (lay->mag != 0 || lay->ndigits == 0))
+    {
+        lay->zeros = 1;
+    }
+    return (lay->sign != '\0') + lay->prefixlen + lay->zeros + lay->ndigits;
+}
+
+/*@brief Internal function that measures a conversion without the width padding.*/
+size_t __str_fmtmeasure(const strfmtop_t *op, strfmtval_t *val)
+{
+    const str_t *ps;
+    size_t len;
+    switch (op->conv)
+    {
+    case 'd': case 'i': case 'u': case 'o': case 'x': case 'X': case 'b':
+        return __str_fmtintlayout(op, val, &val->lay);
+    case 'c':
+        return 1;
+    case 's':
+        if (!val->arg.p)
+        {
+            return (val->precision < 0 || val->precision >= 6) ? 6 : 0; // "(null)", like glibc
+        }
+        #ifdef DOOTSTR_USE_WCHAR
+        return wcsnlen((const dchar_t *)val->arg.p, (val->precision < 0) ? (size_t)STR_MAXSIZE : (size_t)val->precision);
+        #else
+        return strnlen((const dchar_t *)val->arg.p, (val->precision < 0) ? (size_t)STR_MAXSIZE : (size_t)val->precision);
+        #endif
+    case 'S':
+        ps = (const str_t *)val->arg.p;
+        if (!ps)
+        {
+            return (val->precision < 0 || val->precision >= 6) ? 6 : 0;
+        }
+        len = ps->pstr ? ps->strlen : 0;
+        return (val->precision >= 0 && (size_t)val->precision < len) ? (size_t)val->precision : len;
+    case 'p':
+        return val->arg.p ? 2 + __str_fmtndigits((uintptr_t)val->arg.p, 16) : 5; // "(nil)"
+    case 'r':
+        {
+            dchar_t buf[STR_DOUBLE_MAXLEN];
+            return __str_writedouble(buf, val->arg.d) + (!signbit(val->arg.d) && (op->flags & (STR_FMT_PLUS | STR_FMT_SPACE)));
+        }
+    default:
+        return __str_fmtdouble(op, val);
+    }
+}
+
+/*@brief Internal function that writes count copies of c.*/
+dchar_t *__str_fmtfill(dchar_t *dst, dchar_t c, size_t count)
+{
+    while (count-- > 0)
+    {
+        *dst++ = c;
+    }
+    return dst;
+}
+
+/*@brief Internal function that writes the digits of v in a given base, ending right before end.*/
+void __str_fmtdigits(dchar_t *end, unsigned long long v, unsigned base, size_t ndigits, int upper)
+{
+    const char *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    if (base == 10)
+    {
+        if (ndigits > 0)
+        {
+            __str_writeu64(end, v);
+        }
+        return;
+    }
+    unsigned shift = (base == 16) ? 4 : (base == 8) ? 3 : 1;
+    while (ndigits-- > 0)
+    {
+        *--end = digits[v & (base - 1)];
+        v >>= shift;
+    }
+}
+
+/*@brief Internal function that writes a conversion, including its width padding, and returns the pointer right after it.*/
+dchar_t *__str_fmtwrite(dchar_t *dst, const strfmtop_t *op, const strfmtval_t *val)
+{
+    size_t pad = (val->width > 0 && (size_t)val->width > val->len) ? (size_t)val->width - val->len : 0;
+    char align = val->left ? '<' : op->align;
+    int isint = (op->conv == 'd' || op->conv == 'i' || op->conv == 'u' || op->conv == 'o' ||
+                 op->conv == 'x' || op->conv == 'X' || op->conv == 'b');
+    dchar_t fill = op->fill;
+    if (align == '=' && (!isint || val->precision >= 0)) // Zero padding is ignored for integers with a precision
+    {
+        align = '>';
+        if ((isint || op->conv == 'r') && fill == '0')
+        {
+            fill = ' ';
+        }
+    }
+    if (align == '>')
+    {
+        dst = __str_fmtfill(dst, fill, pad);
+    }
+    else if (align == '^')
+    {
+        dst = __str_fmtfill(dst, fill, pad / 2);
+    }
+    const strfmtint_t *lay = &val->lay;
+    const dchar_t *src;
+    switch (op->conv)
+    {
+    case 'd': case 'i': case 'u': case 'o': case 'x': case 'X': case 'b':
+        if (lay->sign)
+        {
+            *dst++ = lay->sign;
+        }
+        for (size_t i = 0; i < lay->prefixlen; i++)
+        {
+            *dst++ = lay->prefix[i];
+        }
+        if (align == '=')
+        {
+            dst = __str_fmtfill(dst, fill, pad);
+        }
+        dst = __str_fmtfill(dst, '0', lay->zeros);
+        dst += lay->ndigits;
+        __str_fmtdigits(dst, lay->mag, lay->base, lay->ndigits, op->conv == 'X');
+        break;
+    case 'c':
+        *dst++ = (dchar_t)val->arg.u;
+        break;
+    case 's':
+    case 'S':
+        if (!val->arg.p)
+        {
+            #ifdef DOOTSTR_USE_WCHAR
+            src = L"(null)";
+            #else
+            src = "(null)";
+            #endif
+        }
+        else
+        {
+            src = (op->conv == 's') ? (const dchar_t *)val->arg.p : ((const str_t *)val->arg.p)->pstr;
+        }
+        if (val->len > 0)
+        {
+            memcpy(dst, src, val->len * sizeof(dchar_t));
+        }
+        dst += val->len;
+        break;
+    case 'p':
+        if (!val->arg.p)
+        {
+            const char *nil = "(nil)";
+            while (*nil)
+            {
+                *dst++ = *nil++;
+            }
+            break;
+        }
+        *dst++ = '0';
+        *dst++ = 'x';
+        dst += val->len - 2;
+        __str_fmtdigits(dst, (uintptr_t)val->arg.p, 16, val->len - 2, 0);
+        break;
+    case 'r':
+        if (!signbit(val->arg.d) && (op->flags & (STR_FMT_PLUS | STR_FMT_SPACE)))
+        {
+            *dst++ = (op->flags & STR_FMT_PLUS) ? '+' : ' ';
+        }
+        dst += __str_writedouble(dst, val->arg.d);
+        break;
+    default: // Rendered by __str_fmtmeasure()
+        #ifndef DOOTSTR_USE_WCHAR
+        memcpy(dst, val->text, val->len);
+        dst += val->len;
+        #else
+        for (size_t i = 0; i < val->len; i++)
+        {
+            *dst++ = (unsigned char)val->text[i];
+        }
+        #endif
+        break;
+    }
+    if (align == '<')
+    {
+        dst = __str_fmtfill(dst, fill, pad);
+    }
+    else if (align == '^')
+    {
+        dst = __str_fmtfill(dst, fill, pad - pad / 2);
+    }
+    return dst;
+}
+
+/*@brief Appends the arguments formatted according to a compiled format to the string. Returns the number of appended characters.*/
+size_t str_vformatSpec(str_t *pstr, const str_fmt_t *pfmt, va_list ap)
+{
+    if (!pstr || !pfmt)
+    {
+        STRFAIL("str_vformatSpec: The address of a str_t or a str_fmt_t was null.");
+    }
+    strfmtval_t stackvals[STR_FMT_STACKVALS];
+    strfmtval_t *vals = stackvals;
+    if (pfmt->nconv > STR_FMT_STACKVALS)
+    {
+        vals = (strfmtval_t*)malloc(sizeof(strfmtval_t) * pfmt->nconv);
+        if (!vals)
+        {
+            STRERROR("malloc");
+        }
+    }
+    // First pass: fetch the arguments and measure the output
+    va_list aq;
+    va_copy(aq, ap);
+    size_t total = pfmt->litlen;
+    strfmtval_t *val = vals;
+    for (size_t i = 0; i < pfmt->nops; i++)
+    {
+        const strfmtop_t *op = pfmt->ops + i;
+        if (op->lit)
+        {
+            continue;
+        }
+        __str_fmtfetch(op, val, &aq);
+        val->len = __str_fmtmeasure(op, val);
+        total += (val->width > 0 && (size_t)val->width > val->len) ? (size_t)val->width : val->len;
+        val++;
+    }
+    va_end(aq);
+    // Grow the string once
+    if (!pstr->pstr)
+    {
+        str_realloc(pstr, STR_NEWCAPACITY(total + 1));
+        pstr->strlen = 0;
+    }
+    else if (pstr->capacity < pstr->strlen + total + 1)
+    {
+        str_realloc(pstr, STR_NEWCAPACITY(pstr->strlen + total + 1));
+    }
+    // Second pass: render
+    dchar_t *dst = pstr->pstr + pstr->strlen;
+    val = vals;
+    for (size_t i = 0; i < pfmt->nops; i++)
+    {
+        const strfmtop_t *op = pfmt->ops + i;
+        if (op->lit)
+        {
+            if (op->litlen <= 8) // Short literals are the common case, skip the call to memcpy()
+            {
+                for (size_t k = 0; k < op->litlen; k++)
+                {
+                    dst[k] = op->lit[k];
+                }
+            }
+            else
+            {
+                memcpy(dst, op->lit, op->litlen * sizeof(dchar_t));
+            }
+            dst += op->litlen;
+            continue;
+        }
+        dst = __str_fmtwrite(dst, op, val);
+        if (val->text != val->buf)
+        {
+            free(val->text);
+        }
+        val++;
+    }
+    *dst = '\0';
+    pstr->strlen += total;
+    if (vals != stackvals)
+    {
+        free(vals);
+    }
+    return total;
+}
+
+/*@brief Appends the arguments formatted according to a compiled format to the string. Returns the number of appended characters.*/
+size_t str_formatSpec(str_t *pstr, const str_fmt_t *pfmt, ...)
+{
+    va_list ap;
+    va_start(ap, pfmt);
+    size_t count = str_vformatSpec(pstr, pfmt, ap);
+    va_end(ap);
+    return count;
+}
+
+/*@brief Appends the formatted arguments to the string, parsing the format on the fly. Returns the number of appended characters.
+See the comment at the top of the FORMATTING region for the supported conversions.*/
+size_t str_vformat(str_t *pstr, const dchar_t *format, va_list ap)
+{
+    if (!pstr || !format)
+    {
+        STRFAIL("str_vformat: The address of a str_t or the format string was null.");
+    }
+    strfmtop_t stackops[STR_FMT_STACKOPS];
+    str_fmt_t fmt = {stackops, 0, STR_FMT_STACKOPS, 0, 0, 0, NULL};
+    __str_fmtparse(&fmt, format);
+    size_t count = str_vformatSpec(pstr, &fmt, ap);
+    if (fmt.ownsops)
+    {
+        free(fmt.ops);
+    }
+    return count;
+}
+
+/*@brief Appends the formatted arguments to the string, parsing the format on the fly. Returns the number of appended characters.*/
+size_t str_format(str_t *pstr, const dchar_t *format, ...)
+{
+    va_list ap;
+    va_start(ap, format);
+    size_t count = str_vformat(pstr, format, ap);
+    va_end(ap);
+    return count;
+}
+#pragma endregion
+
+#pragma region TRANSCODING
+/*
+Conversions between UTF-8, UTF-16 and UTF-32. Narrow strings are treated as UTF-8 and wide strings as UTF-32, or UTF-16 where wchar_t is
+16 bits wide. Every conversion measures the exact output length first, so the output is allocated once, and runs of ASCII are converted 16 bytes
+at a time with SSE2. Invalid input (bad UTF-8, unpaired surrogates, code points above U+10FFFF) gives STR_ERR_SYNTAX and the output is left as it was.
+The internal conversion functions write to dst, or only measure the output when dst is null. They return SIZE_MAX for invalid input.
+*/
+#if WCHAR_MAX > 0xFFFF
+typedef uint32_t strwunit_t; // The code unit wchar_t holds
+#define __str_u8towide __str_u8to32
+#define __str_widetou8 __str_u32to8
+#define __str_u16towide __str_u16to32
+#define __str_widetou16 __str_u32to16
+#define __str_widecopy __str_u32to32
+#else
+typedef uint16_t strwunit_t;
+#define __str_u8towide __str_u8to16
+#define __str_widetou8 __str_u16to8
+#define __str_u16towide __str_u16to16
+#define __str_widetou16 __str_u16to16
+#define __str_widecopy __str_u16to16
+#endif
+
+/*@brief Internal function that converts UTF-8 to UTF-16. Measuring validates with __str_u8valid() and counts one unit for every
+byte that isn't a continuation byte and one more for every 4 byte lead.*/
+size_t __str_u8to16(const char *p, size_t len, uint16_t *dst)
+{
+    const char *end = p + len;
+    if (!dst)
+    {
+        if (!__str_u8valid(p, len))
+        {
+            return SIZE_MAX;
+        }
+        size_t count = 0;
+#ifdef __SSE2__
+        const __m128i lastcont = _mm_set1_epi8((char)0xBF), lead4 = _mm_set1_epi8((char)0xF0);
+        while (end - p >= 16)
+        {
+            __m128i acc = _mm_setzero_si128();
+            size_t blocks = (size_t)(end - p) / 16 < 127 ? (size_t)(end - p) / 16 : 127; // Counters grow by up to 2 per block
+            for (size_t i = 0; i < blocks; i++, p += 16)
+            {
+                __m128i x = _mm_loadu_si128((const __m128i *)p);
+                acc = _mm_sub_epi8(acc, _mm_cmpgt_epi8(x, lastcont));
+                acc = _mm_sub_epi8(acc, _mm_cmpeq_epi8(_mm_max_epu8(x, lead4), x));
+            }
+            count += __str_sumbytes(acc);
+        }
+#endif
+        for (; p < end; p++)
+        {
+            count += ((*p & 0xC0) != 0x80) + ((unsigned char)*p >= 0xF0);
+        }
+        return count;
+    }
+    uint16_t *out = dst;
+    while (p < end)
+    {
+#ifdef __SSE2__
+        if (end - p >= 16)
+        {
+            __m128i x = _mm_loadu_si128((const __m128i *)p);
+            int mask = _mm_movemask_epi8(x);
+            if (!mask)
+            {
+                _mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi8(x, _mm_setzero_si128()));
+                _mm_storeu_si128((__m128i *)(out + 8), _mm_unpackhi_epi8(x, _mm_setzero_si128()));
+                p += 16;
+                out += 16;
+                continue;
+            }
+            for (int i = __builtin_ctz(mask); i > 0; i--) // The ASCII before the first multibyte sequence
+            {
+                *out++ = (unsigned char)*p++;
+            }
+        }
+#endif
+        uint32_t cp;
+        size_t n = __str_u8next(p, end, &cp);
+        if (!n)
+        {
+            return SIZE_MAX;
+        }
+        p += n;
+        if (cp >= 0x10000)
+        {
+            *out++ = (uint16_t)(0xD800 + ((cp - 0x10000) >> 10));
+            *out++ = (uint16_t)(0xDC00 + (cp & 0x3FF));
+        }
+        else
+        {
+            *out++ = (uint16_t)cp;
+        }
+    }
+    return out - dst;
+}
+
+/*@brief Internal function that converts UTF-8 to UTF-32. The length is the number of code points.*/
+size_t __str_u8to32(const char *p, size_t len, uint32_t *dst)
+{
+    const char *end = p + len;
+    if (!dst)
+    {
+        return __str_u8valid(p, len) ? __str_u8count(p, end) : SIZE_MAX;
+    }
+    uint32_t *out = dst;
+    while (p < end)
+    {
+#ifdef __SSE2__
+        if (end - p >= 16)
+        {
+            __m128i x = _mm_loadu_si128((const __m128i *)p);
+            int mask = _mm_movemask_epi8(x);
+            if (!mask)
+            {
+                const __m128i zero = _mm_setzero_si128();
+                __m128i lo = _mm_unpacklo_epi8(x, zero), hi = _mm_unpackhi_epi8(x, zero);
+                _mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi16(lo, zero));
+                _mm_storeu_si128((__m128i *)(out + 4), _mm_unpackhi_epi16(lo, zero));
+                _mm_storeu_si128((__m128i *)(out + 8), _mm_unpacklo_epi16(hi, zero));
+                _mm_storeu_si128((__m128i *)(out + 12), _mm_unpackhi_epi16(hi, zero));
+                p += 16;
+                out += 16;
+                continue;
+            }
+            for (int i = __builtin_ctz(mask); i > 0; i--)
+            {
+                *out++ = (unsigned char)*p++;
+            }
+        }
+#endif
+        size_t n = __str_u8next(p, end, out);
+        if (!n)
+        {
+            return SIZE_MAX;
+        }
+        p += n;
+        ++out;
+    }
+    return out - dst;
+}
+
+/*@brief Internal function that converts UTF-16 to UTF-8. Blocks of 8 ASCII units are packed into bytes at once.*/
+size_t __str_u16to8(const uint16_t *p, size_t len, char *dst)
+{
+    const uint16_t *end = p + len;
+    size_t count = 0;
+    while (p < end)
+    {
+#ifdef __SSE2__
+        if (end - p >= 8)
+        {
+            __m128i x = _mm_loadu_si128((const __m128i *)p);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(x, _mm_set1_epi16((short)0xFF80)), _mm_setzero_si128())) == 0xFFFF)
+            {
+                if (dst)
+                {
+                    _mm_storel_epi64((__m128i *)(dst + count), _mm_packus_epi16(x, x));
+                }
+                p += 8;
+                count += 8;
+                continue;
+            }
+        }
+#endif
+        uint32_t cp = *p++;
+        if (cp >= 0xD800 && cp <= 0xDFFF)
+        {
+            if (cp > 0xDBFF || p == end || *p < 0xDC00 || *p > 0xDFFF)
+            {
+                return SIZE_MAX;
+            }
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (*p++ - 0xDC00);
+        }
+        if (dst)
+        {
+            count += __str_u8encode(dst + count, cp);
+        }
+        else
+        {
+            count += 1 + (cp >= 0x80) + (cp >= 0x800) + (cp >= 0x10000);
+        }
+    }
+    return count;
+}
+
+/*@brief Internal function that converts UTF-32 to UTF-8. Blocks of 4 ASCII units are packed into bytes at once.*/
+size_t __str_u32to8(const uint32_t *p, size_t len, char *dst)
+{
+    const uint32_t *end = p + len;
+    size_t count = 0;
+    while (p < end)
+    {
+#ifdef __SSE2__
+        if (end - p >= 4)
+        {
+            __m128i x = _mm_loadu_si128((const __m128i *)p);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(x, _mm_set1_epi32((int)0xFFFFFF80)), _mm_setzero_si128())) == 0xFFFF)
+            {
+                if (dst)
+                {
+                    __m128i packed = _mm_packus_epi16(_mm_packs_epi32(x, x), x);
+                    int bytes = _mm_cvtsi128_si32(packed);
+                    memcpy(dst + count, &bytes, 4);
+                }
+                p += 4;
+                count += 4;
+                continue;
+            }
+        }
+#endif
+        uint32_t cp = *p++;
+        if (cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+        {
+            return SIZE_MAX;
+        }
+        if (dst)
+        {
+            count += __str_u8encode(dst + count, cp);
+        }
+        else
+        {
+            count += 1 + (cp >= 0x80) + (cp >= 0x800) + (cp >= 0x10000);
+        }
+    }
+    return count;
+}
+
+/*@brief Internal function that converts UTF-16 to UTF-32.*/
+size_t __str_u16to32(const uint16_t *p, size_t len, uint32_t *dst)
+{
+    const uint16_t *end = p + len;
+    size_t count = 0;
+    while (p < end)
+    {
+        uint32_t cp = *p++;
+        if (cp >= 0xD800 && cp <= 0xDFFF)
+        {
+            if (cp > 0xDBFF || p == end || *p < 0xDC00 || *p > 0xDFFF)
+            {
+                return SIZE_MAX;
+            }
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (*p++ - 0xDC00);
+        }
+        if (dst)
+        {
+            dst[count] = cp;
+        }
+        ++count;
+    }
+    return count;
+}
+
+/*@brief Internal function that converts UTF-32 to UTF-16.*/
+size_t __str_u32to16(const uint32_t *p, size_t len, uint16_t *dst)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < len; i++)
+    {
+        uint32_t cp = p[i];
+        if (cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+        {
+            return SIZE_MAX;
+        }
+        if (cp >= 0x10000)
+        {
+            if (dst)
+            {
+                dst[count] = (uint16_t)(0xD800 + ((cp - 0x10000) >> 10));
+                dst[count + 1] = (uint16_t)(0xDC00 + (cp & 0x3FF));
+            }
+            count += 2;
+        }
+        else
+        {
+            if (dst)
+            {
+                dst[count] = (uint16_t)cp;
+            }
+            ++count;
+        }
+    }
+    return count;
+}
+
+/*@brief Internal function that copies UTF-16 after checking that every surrogate is paired.*/
+size_t __str_u16to16(const uint16_t *p, size_t len, uint16_t *dst)
+{
+    if (__str_u16to32(p, len, NULL) == SIZE_MAX)
+    {
+        return SIZE_MAX;
+    }
+    if (dst)
+    {
+        memcpy(dst, p, len * sizeof(uint16_t));
+    }
+    return len;
+}
+
+/*@brief Internal function that copies UTF-32 after checking that it only holds valid code points.*/
+size_t __str_u32to32(const uint32_t *p, size_t len, uint32_t *dst)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        if (p[i] > 0x10FFFF || (p[i] >= 0xD800 && p[i] <= 0xDFFF))
+        {
+            return SIZE_MAX;
+        }
+    }
+    if (dst)
+    {
+        memcpy(dst, p, len * sizeof(uint32_t));
+    }
+    return len;
+}
+
+/*@brief Internal function that copies valid UTF-8.*/
+size_t __str_u8to8(const char *p, size_t len, char *dst)
+{
+    if (!__str_u8valid(p, len))
+    {
+        return SIZE_MAX;
+    }
+    if (dst)
+    {
+        memcpy(dst, p, len);
+    }
+    return len;
+}
+
+/*
+Internal macros that run a conversion function twice, once to measure the output and once to write it. __STR_TRANSCODEASSIGN writes into a
+str_t (which is only reallocated if it's too small), __STR_TRANSCODEALLOC into a new null terminated buffer that the caller has to free().
+*/
+#define __STR_TRANSCODEASSIGN(func, pstr, src, len, unit_t) \
+    do { \
+        size_t __n = func((src), (len), NULL); \
+        if (__n == SIZE_MAX) \
+        { \
+            return STR_ERR_SYNTAX; \
+        } \
+        (void)STR_EXPR_TESTOVERFLOW((__n + 1) / 2); \
+        __str_mutate((pstr), 0); \
+        if (!(pstr)->pstr || (pstr)->capacity < __n + 1) \
+        { \
+            str_realloc((pstr), __n + 1); \
+        } \
+        func((src), (len), (unit_t *)(pstr)->pstr); \
+        (pstr)->strlen = __n; \
+        (pstr)->pstr[__n] = '\0'; \
+        return STR_OK; \
+    } while (0)
+
+#define __STR_TRANSCODEALLOC(func, src, len, out_t, out, outlen) \
+    do { \
+        size_t __n = func((src), (len), NULL); \
+        if (__n == SIZE_MAX) \
+        { \
+            return STR_ERR_SYNTAX; \
+        } \
+        out_t *__buf = (out_t *)malloc((__n + 1) * sizeof(out_t)); \
+        if (!__buf) \
+        { \
+            STRERROR("malloc"); \
+        } \
+        func((src), (len), __buf); \
+        __buf[__n] = 0; \
+        *(out) = __buf; \
+        if (outlen) \
+        { \
+            *(outlen) = __n; \
+        } \
+        return STR_OK; \
+    } while (0)
+
+/*@brief Converts len bytes of UTF-8 to UTF-16. With a null dst only outlen is set, to the exact number of UTF-16 units needed.
+Otherwise dst needs room for that many units, no terminator is written.*/
+str_err_t str_u8tou16(const char *src, size_t len, uint16_t *dst, size_t *outlen)
+{
+    if (!src || !outlen)
+    {
+        return STR_ERR_NULL;
+    }
+    size_t n = __str_u8to16(src, len, dst);
+    if (n == SIZE_MAX)
+    {
+        return STR_ERR_SYNTAX;
+    }
+    *outlen = n;
+    return STR_OK;
+}
+
+/*@brief Converts len UTF-16 units to UTF-8. With a null dst only outlen is set, to the exact number of bytes needed.*/
+str_err_t str_u16tou8(const uint16_t *src, size_t len, char *dst, size_t *outlen)
+{
+    if (!src || !outlen)
+    {
+        return STR_ERR_NULL;
+    }
+    size_t n = __str_u16to8(src, len, dst);
+    if (n == SIZE_MAX)
+    {
+        return STR_ERR_SYNTAX;
+    }
+    *outlen = n;
+    return STR_OK;
+}
+
+/*@brief Replaces the contents of the string with len bytes of UTF-8, converted to wchar_t in wide builds.*/
+str_err_t str_assignu8(str_t *pstr, const char *src, size_t len)
+{
+    if (!pstr || !src)
+    {
+        return STR_ERR_NULL;
+    }
+    #ifdef DOOTSTR_USE_WCHAR
+    __STR_TRANSCODEASSIGN(__str_u8towide, pstr, src, len, strwunit_t);
+    #else
+    __STR_TRANSCODEASSIGN(__str_u8to8, pstr, src, len, char);
+    #endif
+}
+
+/*@brief Replaces the contents of the string with len units of UTF-16.*/
+str_err_t str_assignu16(str_t *pstr, const uint16_t *src, size_t len)
+{
+    if (!pstr || !src)
+    {
+        return STR_ERR_NULL;
+    }
+    #ifdef DOOTSTR_USE_WCHAR
+    __STR_TRANSCODEASSIGN(__str_u16towide, pstr, src, len, strwunit_t);
+    #else
+    __STR_TRANSCODEASSIGN(__str_u16to8, pstr, src, len, char);
+    #endif
+}
+
+/*@brief Replaces the contents of the string with len wide characters, converted to UTF-8 in narrow builds.*/
+str_err_t str_assignwcs(str_t *pstr, const wchar_t *src, size_t len)
+{
+    if (!pstr || !src)
+    {
+        return STR_ERR_NULL;
+    }
+    #ifdef DOOTSTR_USE_WCHAR
+    __STR_TRANSCODEASSIGN(__str_widecopy, pstr, (const strwunit_t *)src, len, strwunit_t);
+    #else
+    __STR_TRANSCODEASSIGN(__str_widetou8, pstr, (const strwunit_t *)src, len, char);
+    #endif
+}
+
+/*@brief Sets out to a new null terminated UTF-8 copy of the string and outlen (if it isn't null) to its length in bytes.
+The copy has to be freed with free().*/
+str_err_t str_tou8(const str_t *pstr, char **out, size_t *outlen)
+{
+    if (!pstr || !out)
+    {
+        return STR_ERR_NULL;
+    }
+    const dchar_t *src = pstr->pstr ? pstr->pstr : STR_EMPTY;
+    #ifdef DOOTSTR_USE_WCHAR
+    __STR_TRANSCODEALLOC(__str_widetou8, (const strwunit_t *)src, pstr->strlen, char, out, outlen);
+    #else
+    __STR_TRANSCODEALLOC(__str_u8to8, src, pstr->strlen, char, out, outlen);
+    #endif
+}
+
+/*@brief Sets out to a new null terminated UTF-16 copy of the string and outlen (if it isn't null) to its length in units.
+The copy has to be freed with free().*/
+str_err_t str_tou16(const str_t *pstr, uint16_t **out, size_t *outlen)
+{
+    if (!pstr || !out)
+    {
+        return STR_ERR_NULL;
+    }
+    const dchar_t *src = pstr->pstr ? pstr->pstr : STR_EMPTY;
+    #ifdef DOOTSTR_USE_WCHAR
+    __STR_TRANSCODEALLOC(__str_widetou16, (const strwunit_t *)src, pstr->strlen, uint16_t, out, outlen);
+    #else
+    __STR_TRANSCODEALLOC(__str_u8to16, src, pstr->strlen, uint16_t, out, outlen);
+    #endif
+}
+
+/*@brief Sets out to a new null terminated wide copy of the string and outlen (if it isn't null) to its length in wide characters.
+The copy has to be freed with free().*/
+str_err_t str_towcs(const str_t *pstr, wchar_t **out, size_t *outlen)
+{
+    if (!pstr || !out)
+    {
+        return STR_ERR_NULL;
+    }
+    const dchar_t *src = pstr->pstr ? pstr->pstr : STR_EMPTY;
+    #ifdef DOOTSTR_USE_WCHAR
+    __STR_TRANSCODEALLOC(__str_widecopy, (const strwunit_t *)src, pstr->strlen, strwunit_t, (strwunit_t **)out, outlen);
+    #else
+    __STR_TRANSCODEALLOC(__str_u8towide, src, pstr->strlen, strwunit_t, (strwunit_t **)out, outlen);
+    #endif
+}
+#pragma endregion
+
+#pragma region IO
+#define STR_READER_BUFSIZE 65536 // Default buffer size of a str_reader_t
+
+/** @struct str_reader_t
+ *  @brief Buffered reader of delimited records (usually lines) from a file descriptor it doesn't own. Records are copied straight from
+ *  the buffer into the caller's str_t, which keeps its capacity between calls, or handed out as views into the buffer (narrow builds only).
+ *  The buffer only grows when a single record doesn't fit in it, so reading a file of short lines doesn't allocate after the first call.
+ */
+typedef struct strreader
+{
+    int fd; /*The file descriptor read from*/
+    char *buf; /*Bytes read from fd but not handed out yet start at buf + pos and end at buf + end*/
+    size_t bufsize; /*Size of buf*/
+    size_t pos; /*Start of the next record in buf*/
+    size_t end; /*End of the data in buf*/
+    int eof; /*Set once read() reported the end of the file*/
+} str_reader_t;
+
+/*@brief Returns a pointer to a new reader of fd with a buffer of bufsize bytes, or STR_READER_BUFSIZE if bufsize is 0.
+The reader doesn't close fd.*/
+str_reader_t *str_readernew(int fd, size_t bufsize)
+{
+    if (fd < 0)
+    {
+        STRFAIL("str_readernew: Invalid file descriptor.");
+    }
+    str_reader_t *prd = (str_reader_t*)malloc(sizeof(str_reader_t));
+    if (!prd)
+    {
+        STRERROR("malloc");
+    }
+    prd->fd = fd;
+    prd->bufsize = bufsize ? bufsize : STR_READER_BUFSIZE;
+    prd->buf = (char*)malloc(prd->bufsize);
+    if (!prd->buf)
+    {
+        STRERROR("malloc");
+    }
+    prd->pos = 0;
+    prd->end = 0;
+    prd->eof = 0;
+    return prd;
 }
 
-/*@brief Removes all occurances of any character in set from the string. Returns number of removed instances.*/
-size_t str_removeAny(str_t *pstr, const dchar_t *set)
+/*@brief Safely free a str_reader_t by passing the address of a pointer variable. The pointer will be set to null afterwards.*/
+void str_readerfree(str_reader_t **pprd)
 {
-    if (!pstr)
+    if (!pprd)
     {
-        STRFAIL("str_removeAny: The passed address was null.");
+        STRFAIL("str_readerfree: The address of a str_reader_t pointer variable was null.");
     }
-    if (!pstr->pstr)
+    if (!*pprd)
     {
-        return 0;
+        return;
     }
-    if (!set)
+    free((*pprd)->buf);
+    free(*pprd);
+    *pprd = NULL;
+}
+
+/*@brief Internal function that reads more of the file into the buffer, first moving the unread data to the front and growing the buffer
+if it's full. Returns the number of bytes read, 0 at the end of the file.*/
+size_t __str_readerfill(str_reader_t *prd)
+{
+    if (prd->pos > 0)
     {
-        STRFAIL("str_removeAny: The passed address of set was null.");
+        memmove(prd->buf, prd->buf + prd->pos, prd->end - prd->pos);
+        prd->end -= prd->pos;
+        prd->pos = 0;
     }
-    size_t count = str_countAny(pstr, set);
-    size_t newLen = pstr->strlen - count;
-    size_t *seqPos = (size_t*)malloc(sizeof(size_t)*count); // Array housing the positions of found substrings
-    if (!seqPos)
+    if (prd->end == prd->bufsize)
     {
-        STRERROR("malloc");
+        size_t newsize = STR_NEWCAPACITY(prd->bufsize);
+        char *newbuf = (char*)realloc(prd->buf, newsize);
+        if (!newbuf)
+        {
+            STRERROR("realloc");
+        }
+        prd->buf = newbuf;
+        prd->bufsize = newsize;
     }
-    size_t i = 0;
-    dchar_t *p = pstr->pstr;
-    while ((p = _strpbrk(p, set)) != NULL)
+    ssize_t got;
+    do
     {
-        //printf("pos: %ld\n", p - pstr->pstr);
-        seqPos[i++] = p - pstr->pstr;
-        ++p;
+        got = read(prd->fd, prd->buf + prd->end, prd->bufsize - prd->end);
+    } while (got == -1 && errno == EINTR);
+    if (got == -1)
+    {
+        STRERROR("read");
     }
-    i = 0; // The current element to be moved to the left (or left alone)
-    size_t seqInd = 0; // The index of the next sequence to be ecnountered
-    size_t offset = 0; // The offset by which to move elements to the left
-    while (i < pstr->strlen + 1) // Plus 1 to copy '/0'
+    if (got == 0)
     {
-        //printf("i: %ld\n", i);
-        if (seqInd < count && i == seqPos[seqInd])
+        prd->eof = 1;
+    }
+    prd->end += got;
+    return got;
+}
+
+/*@brief Internal function that finds the next record ending with delim. Returns 1 and its bytes in *rec and *len (without the delimiter)
+or 0 at the end of the file. The last record doesn't need a delimiter. The bytes stay valid until the next read.*/
+int __str_readernext(str_reader_t *prd, char delim, const char **rec, size_t *len)
+{
+    size_t scanned = prd->pos; // Everything before this has been searched already
+    for (;;)
+    {
+        const char *hit = (const char*)memchr(prd->buf + scanned, delim, prd->end - scanned); // memchr is vectorized by the C library
+        if (hit)
         {
-            offset++;
-            seqInd++;
+            *rec = prd->buf + prd->pos;
+            *len = hit - *rec;
+            prd->pos = hit + 1 - prd->buf;
+            return 1;
         }
-        else if (offset > 0)
+        if (prd->eof || (scanned = prd->end - prd->pos, __str_readerfill(prd) == 0))
         {
-            pstr->pstr[i - offset] = pstr->pstr[i];
+            if (prd->pos == prd->end)
+            {
+                return 0;
+            }
+            *rec = prd->buf + prd->pos;
+            *len = prd->end - prd->pos;
+            prd->pos = prd->end;
+            return 1;
         }
-        i++;
+        // Filling moved the unread data to the front of the buffer
     }
-    free(seqPos);
-    pstr->strlen = newLen;
-    //pstr->pstr[pstr->strlen-1] = '\0';
-    return count;
 }
 
-#pragma endregion
+/*@brief Internal function that replaces the contents of the string with len bytes read from a file, decoding them from UTF-8 in wide builds.*/
+void __str_readerassign(str_t *pstr, const char *p, size_t len, const char *message)
+{
+    #ifdef DOOTSTR_USE_WCHAR
+    if (str_assignu8(pstr, p, len) != STR_OK)
+    {
+        STRFAIL(message);
+    }
+    #else
+    (void)message; // Not used when STR_UTF8_CHECK() checks nothing
+    (void)STR_UTF8_CHECK(p, len, message);
+    __str_mutate(pstr, 0);
+    pstr->strlen = 0;
+    __str_appendn(pstr, p, len);
+    #endif
+}
 
-#pragma region LOGICAL
-int str_isempty(str_t *pstr)
+/*@brief Reads the next record ending with delim into the string, without the delimiter. The string's memory is reused, so in a loop it's
+only reallocated for records longer than any before. Returns 1 if a record was read and 0 at the end of the file, the string is empty then.
+Wide builds decode the records from UTF-8.*/
+int str_readuntil(str_reader_t *prd, char delim, str_t *out)
 {
-    if (!pstr)
+    if (!prd || !out)
     {
-        STRFAIL("str_isempty: The address of a str_t was null.");
+        STRFAIL("str_readuntil: The address of a str_reader_t or a str_t was null.");
     }
-    return !pstr->pstr || (pstr->strlen == 0);
+    const char *rec;
+    size_t len;
+    int found = __str_readernext(prd, delim, &rec, &len);
+    __str_readerassign(out, rec, found ? len : 0, "str_readuntil: The record is not valid UTF-8.");
+    return found;
 }
 
-int str_isalnum(str_t *pstr)
+/*@brief Reads the next line into the string, without the line break. Lines end with "\n" or "\r\n". Works like str_readuntil().*/
+int str_readline(str_reader_t *prd, str_t *out)
 {
-    if (!pstr)
+    if (!prd || !out)
     {
-        STRFAIL("str_isalnum: The address of a str_t was null.");
+        STRFAIL("str_readline: The address of a str_reader_t or a str_t was null.");
     }
-    if (!pstr->pstr)
+    const char *rec;
+    size_t len;
+    int found = __str_readernext(prd, '\n', &rec, &len);
+    if (!found)
     {
-        return 0;
+        len = 0;
     }
-    dchar_t *p = pstr->pstr;
-    while (*p)
+    else if (len > 0 && rec[len - 1] == '\r')
     {
-        if (!isalnum(*p))
-        {
-            return 0;
-        }
-        ++p;
+        len--;
     }
-    return 1;
+    __str_readerassign(out, rec, len, "str_readline: The line is not valid UTF-8.");
+    return found;
 }
 
-int str_isalpha(str_t *pstr)
+#ifndef DOOTSTR_USE_WCHAR
+/*@brief Like str_readuntil(), but gives a view of the record inside the reader's buffer instead of copying it. The view is valid until the
+next read.*/
+int str_readuntil_v(str_reader_t *prd, char delim, str_view_t *out)
 {
-    if (!pstr)
-    {
-        STRFAIL("str_isalpha: The address of a str_t was null.");
-    }
-    if (!pstr->pstr)
+    if (!prd || !out)
     {
-        return 0;
+        STRFAIL("str_readuntil_v: The address of a str_reader_t or a str_view_t was null.");
     }
-    dchar_t *p = pstr->pstr;
-    while (*p)
+    int found = __str_readernext(prd, delim, &out->pstr, &out->strlen);
+    if (!found)
     {
-        if (!isalpha(*p))
-        {
-            return 0;
-        }
-        ++p;
+        out->pstr = STR_EMPTY;
+        out->strlen = 0;
     }
-    return 1;
+    (void)STR_UTF8_CHECK(out->pstr, out->strlen, "str_readuntil_v: The record is not valid UTF-8.");
+    return found;
 }
 
-int str_isdigit(str_t *pstr)
+/*@brief Like str_readline(), but gives a view of the line inside the reader's buffer instead of copying it. The view is valid until the
+next read.*/
+int str_readline_v(str_reader_t *prd, str_view_t *out)
 {
-    if (!pstr)
+    if (!prd || !out)
     {
-        STRFAIL("str_isdigit: The address of a str_t was null.");
+        STRFAIL("str_readline_v: The address of a str_reader_t or a str_view_t was null.");
     }
-    if (!pstr->pstr)
+    int found = str_readuntil_v(prd, '\n', out);
+    if (out->strlen > 0 && out->pstr[out->strlen - 1] == '\r')
     {
-        return 0;
+        out->strlen--;
     }
-    dchar_t *p = pstr->pstr;
-    while (*p)
+    return found;
+}
+#endif
+
+#ifndef DOOTSTR_USE_WCHAR
+#define STR_STREAM_WINDOW (1 << 20) // Default window size of the streaming searches
+
+/*@brief Internal function that returns a pointer to the first occurrence of seq (seqlen > 0 bytes) in the len bytes at p, or null.
+The candidates are found with memchr() looking for seq[anchor], which should be the sequence's rarest byte.*/
+const char *__str_memfind(const char *p, size_t len, const char *seq, size_t seqlen, size_t anchor)
+{
+    if (len < seqlen)
     {
-        if (!isdigit(*p))
+        return NULL;
+    }
+    const char *last = p + (len - seqlen); // The last position a match can start at
+    const char *q = p + anchor;
+    while (q <= last + anchor && (q = (const char*)memchr(q, seq[anchor], last + anchor - q + 1)) != NULL)
+    {
+        if (memcmp(q - anchor, seq, seqlen) == 0)
         {
-            return 0;
+            return q - anchor;
         }
-        ++p;
+        q++;
     }
-    return 1;
+    return NULL;
 }
 
-int str_islower(str_t *pstr)
+/*@brief Internal function that picks the byte of seq that's least frequent in the len bytes at p, for __str_memfind().*/
+size_t __str_memanchor(const char *p, size_t len, const char *seq, size_t seqlen)
 {
-    if (!pstr)
-    {
-        STRFAIL("str_islower: The address of a str_t was null.");
-    }
-    if (!pstr->pstr)
+    size_t freq[256] = {0};
+    for (size_t i = 0; i < len; i++)
     {
-        return 0;
+        freq[(unsigned char)p[i]]++;
     }
-    dchar_t *p = pstr->pstr;
-    while (*p)
+    size_t anchor = 0;
+    for (size_t i = 1; i < seqlen; i++)
     {
-        if (isalpha(*p) && !islower(*p))
+        if (freq[(unsigned char)seq[i]] < freq[(unsigned char)seq[anchor]])
         {
-            return 0;
+            anchor = i;
         }
-        ++p;
     }
-    return 1;
+    return anchor;
 }
 
-int str_isupper(str_t *pstr)
+/*@brief Internal function that streams fd through a buffer of window + strlen(seq) - 1 bytes and calls found (if not null) with the
+offset of every (possibly overlapping) occurrence of seq. The last strlen(seq) - 1 bytes of each window are kept for the next one, so
+matches crossing the boundary are found exactly once. Stops after limit matches. Returns the number of matches.*/
+size_t __str_fdscan(int fd, const char *seq, size_t window, size_t limit, void (*found)(off_t offset, void *arg), void *arg,
+    const char *message)
 {
-    if (!pstr)
+    if (fd < 0 || !seq || !(*seq))
     {
-        STRFAIL("str_isupper: The address of a str_t was null.");
+        STRFAIL(message);
     }
-    if (!pstr->pstr)
+    size_t seqlen = strlen(seq);
+    if (window == 0)
     {
-        return 0;
+        window = STR_STREAM_WINDOW;
     }
-    dchar_t *p = pstr->pstr;
-    while (*p)
+    size_t anchor = SIZE_MAX; // Chosen from the first window
+    char *buf = (char*)malloc(window + seqlen - 1);
+    if (!buf)
     {
-        if (isalpha(*p) && !isupper(*p))
+        STRERROR("malloc");
+    }
+    off_t base = lseek(fd, 0, SEEK_CUR); // Offset of buf[0], pipes and sockets count from 0
+    if (base < 0)
+    {
+        base = 0;
+    }
+    size_t carry = 0; // Bytes kept from the previous window
+    size_t count = 0;
+    while (count < limit)
+    {
+        ssize_t got = read(fd, buf + carry, window);
+        if (got < 0)
         {
-            return 0;
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            STRERROR("read");
         }
-        ++p;
+        if (got == 0)
+        {
+            break;
+        }
+        size_t len = carry + (size_t)got;
+        if (anchor == SIZE_MAX)
+        {
+            anchor = (seqlen > 1) ? __str_memanchor(buf, len, seq, seqlen) : 0;
+        }
+        const char *p = buf;
+        while (count < limit && (p = __str_memfind(p, len - (p - buf), seq, seqlen, anchor)) != NULL)
+        {
+            if (found)
+            {
+                found(base + (p - buf), arg);
+            }
+            count++;
+            p++;
+        }
+        carry = (len < seqlen - 1) ? len : seqlen - 1; // No whole match fits in the carried bytes, so none is counted twice
+        memmove(buf, buf + len - carry, carry);
+        base += len - carry;
     }
-    return 1;
+    free(buf);
+    return count;
 }
 
-int str_isspace(str_t *pstr)
+/*@brief Counts how many times seq occurs in the rest of the file, reading it in windows of window bytes (0 for STR_STREAM_WINDOW) so
+the memory used doesn't depend on the file's size. Counts overlapping occurrences like str_count(). The file is searched as raw bytes.*/
+size_t str_fdcount(int fd, const char *seq, size_t window)
 {
-    if (!pstr)
+    return __str_fdscan(fd, seq, window, SIZE_MAX, NULL, NULL, "str_fdcount: Invalid file descriptor or null or empty sequence.");
+}
+
+/*@brief Internal callback of str_fdindex() that remembers the offset.*/
+void __str_fdsetindex(off_t offset, void *arg)
+{
+    *(off_t*)arg = offset;
+}
+
+/*@brief Returns the offset of the first occurrence of seq in the rest of the file, or -1. Reads the file like str_fdcount() and stops at
+the first match. Offsets are positions in the file, for pipes and sockets they're counted from the first byte read.*/
+off_t str_fdindex(int fd, const char *seq, size_t window)
+{
+    off_t index = -1;
+    __str_fdscan(fd, seq, window, 1, __str_fdsetindex, &index, "str_fdindex: Invalid file descriptor or null or empty sequence.");
+    return index;
+}
+
+/*@brief Calls found with the offset of every occurrence of seq in the rest of the file, in order, and returns their number. Reads the file
+like str_fdcount(), offsets are like in str_fdindex(). arg is passed on to found.*/
+size_t str_fdfindall(int fd, const char *seq, size_t window, void (*found)(off_t offset, void *arg), void *arg)
+{
+    if (!found)
     {
-        STRFAIL("str_isspace: The address of a str_t was null.");
+        STRFAIL("str_fdfindall: The callback was null.");
     }
-    if (!pstr->pstr)
+    return __str_fdscan(fd, seq, window, SIZE_MAX, found, arg, "str_fdfindall: Invalid file descriptor or null or empty sequence.");
+}
+#endif
+#pragma endregion
+
+#pragma region SERIALIZATION
+/*
+The binary format of str_save() and str_asave(), in the byte order of the machine that wrote it:
+    header   strfilehdr_t, 32 bytes
+    offsets  count + 1 uint64_t, offsets[i] is where string i starts in data (in characters), offsets[count] is the number of characters
+    data     the strings one after another, each with its null terminator, zero padded to a multiple of 8 bytes
+The checksum covers the offsets and the data, which are both read as uint64_t words. The strings of a mapped file can be used in place.
+*/
+#define STR_FILE_MAGIC "DSTR"
+#define STR_FILE_VERSION 1
+#define STR_FILE_BOM 0x0102 // Reads as 0x0201 on a machine with the other byte order
+
+/*@brief Internal struct of the header of a file written by str_save() or str_asave().*/
+typedef struct strfilehdr
+{
+    char magic[4]; /*STR_FILE_MAGIC*/
+    uint8_t version; /*STR_FILE_VERSION*/
+    uint8_t charsize; /*sizeof(dchar_t) of the build that wrote the file*/
+    uint16_t bom; /*STR_FILE_BOM*/
+    uint64_t count; /*Number of strings*/
+    uint64_t datasize; /*Size of the data in bytes, padding included*/
+    uint64_t checksum; /*See __str_sumfeed()*/
+} strfilehdr_t;
+
+/** @struct str_table_t
+ *  @brief Read-only table of the strings loaded with str_tableread() or str_tablemap(). Everything lives in one block of memory (or one
+ *  mapping of the file), use str_tableget() to look at a string.
+ */
+typedef struct strtable
+{
+    size_t count; /*Number of strings*/
+    const uint64_t *offsets; /*count + 1 offsets into data, see the format above*/
+    const dchar_t *data; /*The null terminated strings one after another*/
+    size_t datalen; /*Number of characters in data, padding included*/
+    void *map; /*The mapping of the file, null if the table was read*/
+    size_t mapped; /*Size of the mapping*/
+} str_table_t;
+
+/*@brief Internal struct holding the state of a checksum computed over pieces of any length.*/
+typedef struct strsum
+{
+    uint64_t hash; /*Hash of the whole words so far*/
+    uint64_t word; /*Bytes of the unfinished word*/
+    size_t fill; /*Number of bytes in word*/
+} strsum_t;
+
+/*@brief Internal function that feeds n bytes to the checksum. It's FNV-1a over 64-bit words instead of bytes, which makes it about 8 times
+faster while still catching truncated, reordered and flipped data.*/
+void __str_sumfeed(strsum_t *ps, const void *src, size_t n)
+{
+    const unsigned char *p = (const unsigned char*)src;
+    while (ps->fill > 0 && ps->fill < 8 && n > 0)
     {
-        return 0;
+        ((unsigned char*)&ps->word)[ps->fill++] = *p++;
+        n--;
     }
-    dchar_t *p = pstr->pstr;
-    while (*p)
+    if (ps->fill == 8)
     {
-        if (isspace(*p))
-        {
-            return 0;
-        }
-        ++p;
+        ps->hash = (ps->hash ^ ps->word) * 0x100000001B3ULL;
+        ps->fill = 0;
+    }
+    for (; n >= 8; p += 8, n -= 8)
+    {
+        uint64_t w;
+        memcpy(&w, p, 8);
+        ps->hash = (ps->hash ^ w) * 0x100000001B3ULL;
+    }
+    for (; n > 0; n--)
+    {
+        ((unsigned char*)&ps->word)[ps->fill++] = *p++;
     }
-    return 1;
 }
 
-/*Returns 1 if the string contains only characters from a given set*/
-int str_containsOnly(str_t *pstr, const dchar_t *set)
+/*@brief Internal function that writes count strings with their header and offsets in one writev(). Returns the number of bytes written.*/
+size_t __str_savestrs(str_t *const *strs, size_t count, int fd, const char *message)
 {
-    if (!pstr)
-    {
-        STRFAIL("str_containsOnly: The address of a str_t was null.");
-    }
-    if (!pstr->pstr)
+    uint64_t *offsets = (uint64_t*)malloc((count + 1) * sizeof(uint64_t));
+    struct iovec *iov = (struct iovec*)malloc((count + 3) * sizeof(struct iovec));
+    if (!offsets || !iov)
     {
-        return 0;
+        STRERROR("malloc");
     }
-    dchar_t *p = pstr->pstr;
-    while (*p)
+    static const uint64_t zero = 0;
+    strfilehdr_t hdr = { STR_FILE_MAGIC, STR_FILE_VERSION, sizeof(dchar_t), STR_FILE_BOM, count, 0, 0 };
+    strsum_t sum = { 0xCBF29CE484222325ULL, 0, 0 };
+    offsets[0] = 0;
+    for (size_t i = 0; i < count; i++)
     {
-        if (_strpbrk(p, set) != p)
+        if (!strs[i])
         {
-            return 0;
+            STRFAIL(message);
         }
-        ++p;
-    }
-    return 1;
+        offsets[i + 1] = offsets[i] + strs[i]->strlen + 1;
+    }
+    size_t bytes = offsets[count] * sizeof(dchar_t);
+    hdr.datasize = (bytes + 7) & ~(uint64_t)7;
+    __str_sumfeed(&sum, offsets, (count + 1) * sizeof(uint64_t));
+    iov[0].iov_base = &hdr;
+    iov[0].iov_len = sizeof(hdr);
+    iov[1].iov_base = offsets;
+    iov[1].iov_len = (count + 1) * sizeof(uint64_t);
+    for (size_t i = 0; i < count; i++)
+    {
+        iov[i + 2].iov_base = strs[i]->pstr ? (void *)strs[i]->pstr : (void *)&zero; // The terminator is written with the string
+        iov[i + 2].iov_len = (strs[i]->strlen + 1) * sizeof(dchar_t);
+        __str_sumfeed(&sum, iov[i + 2].iov_base, iov[i + 2].iov_len);
+    }
+    iov[count + 2].iov_base = (void *)&zero;
+    iov[count + 2].iov_len = hdr.datasize - bytes;
+    __str_sumfeed(&sum, &zero, hdr.datasize - bytes);
+    hdr.checksum = sum.hash;
+    size_t written = __str_writevall(fd, iov, count + 3);
+    free(iov);
+    free(offsets);
+    return written;
 }
 
-/*Returns 1 if the string contains any of the characters characters from a given set.
-The function is just a wrapper for _strpbrk(), but I kept it for convenience.*/
-int str_containsAny(str_t *pstr, const dchar_t *set)
+/*@brief Writes the string to a file descriptor in the binary format read by str_load(). Returns the number of bytes written.*/
+size_t str_save(const str_t *pstr, int fd)
 {
     if (!pstr)
     {
-        STRFAIL("str_containsAny: The address of a str_t was null.");
+        STRFAIL("str_save: The address of a str_t was null.");
     }
-    if (!pstr->pstr)
+    return __str_savestrs((str_t *const *)&pstr, 1, fd, "str_save: The address of a str_t was null.");
+}
+
+/*@brief Writes all strings of the sarr_t to a file descriptor in one binary file that can be read back with str_aload(), str_tableread()
+or str_tablemap(). Returns the number of bytes written.*/
+size_t str_asave(const sarr_t *parr, int fd)
+{
+    if (!parr)
     {
-        return 0;
+        STRFAIL("str_asave: The address of a sarr_t was null.");
     }
-    return _strpbrk(pstr->pstr, set) != NULL;
+    return __str_savestrs(parr->strArr, parr->size, fd, "str_asave: One of the strings in the sarr_t was null.");
 }
 
-/*Returns 1 if the string contains seq as a substr.
-The function is just a wrapper for _strstr() but I kept it for convenience.*/
-int str_containsSeq(str_t *pstr, const dchar_t *seq)
+/*@brief Internal function that checks the header and returns the size of everything after it, or 0 if it's not a valid header of this build.
+avail is the number of bytes left in the file, or SIZE_MAX if it's unknown.*/
+size_t __str_checkhdr(const strfilehdr_t *phdr, size_t avail)
 {
-    if (!pstr)
+    if (memcmp(phdr->magic, STR_FILE_MAGIC, 4) != 0 || phdr->version != STR_FILE_VERSION || phdr->charsize != sizeof(dchar_t) ||
+        phdr->bom != STR_FILE_BOM || phdr->datasize % 8 != 0 || phdr->count >= SIZE_MAX / sizeof(uint64_t) - 1)
     {
-        STRFAIL("str_containsAny: The address of a str_t was null.");
+        return 0;
     }
-    if (!pstr->pstr)
+    size_t size = (phdr->count + 1) * sizeof(uint64_t);
+    if (phdr->datasize > avail - sizeof(strfilehdr_t) || phdr->datasize > SIZE_MAX - size || size + phdr->datasize > avail - sizeof(strfilehdr_t))
     {
         return 0;
     }
-    return _strstr(pstr->pstr, seq) != NULL;
+    return size + phdr->datasize;
 }
-#pragma endregion
 
-#pragma region TRANSFORM
-void str_upper(str_t *pstr)
+/*@brief Internal function that checks the checksum and the offsets of a loaded table. Returns STR_OK or the error.*/
+str_err_t __str_checktable(const str_table_t *pt, uint64_t checksum, int verify)
 {
-    if (!pstr)
+    if (verify)
     {
-        STRFAIL("str_upper: The passed address was null.");
+        strsum_t sum = { 0xCBF29CE484222325ULL, 0, 0 };
+        __str_sumfeed(&sum, pt->offsets, (pt->count + 1) * sizeof(uint64_t));
+        __str_sumfeed(&sum, pt->data, pt->datalen * sizeof(dchar_t));
+        if (sum.hash != checksum)
+        {
+            return STR_ERR_CHECKSUM;
+        }
     }
-    dchar_t *p = pstr->pstr;
-    while (*p)
+    if (pt->offsets[0] != 0 || pt->offsets[pt->count] > pt->datalen)
     {
-        *p = toupper(*p); 
-        ++p;
+        return STR_ERR_FORMAT;
     }
+    return STR_OK;
 }
 
-void str_lower(str_t *pstr)
+/*@brief Internal function that reads exactly n bytes. Returns STR_OK, STR_ERR_IO (errno is set) or STR_ERR_FORMAT if the file ended early.*/
+str_err_t __str_readall(int fd, void *dst, size_t n)
 {
-    if (!pstr)
+    char *p = (char*)dst;
+    while (n > 0)
     {
-        STRFAIL("str_upper: The passed address was null.");
+        ssize_t got = read(fd, p, n);
+        if (got < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return STR_ERR_IO;
+        }
+        if (got == 0)
+        {
+            return STR_ERR_FORMAT;
+        }
+        p += got;
+        n -= got;
     }
-    dchar_t *p = pstr->pstr;
-    while (*p)
+    return STR_OK;
+}
+
+/*@brief Internal function that sets *err (if it's not null) and returns null.*/
+void *__str_loadfail(str_err_t *err, str_err_t code)
+{
+    if (err)
     {
-        *p = tolower(*p);
-        ++p;
+        *err = code;
     }
+    return NULL;
 }
 
-void str_swapcase(str_t *pstr)
+/*@brief Reads a file written by str_save() or str_asave() from a file descriptor into a single allocation, checking its checksum.
+Returns null and sets *err (if err isn't null) on failure: STR_ERR_IO if reading failed (errno says why), STR_ERR_FORMAT if the file isn't
+in the format of this build (wide and narrow builds can't read each other's files) and STR_ERR_CHECKSUM if it's damaged.*/
+str_table_t *str_tableread(int fd, str_err_t *err)
 {
-    if (!pstr)
+    strfilehdr_t hdr;
+    str_err_t res = __str_readall(fd, &hdr, sizeof(hdr));
+    if (res != STR_OK)
     {
-        STRFAIL("str_swapcase: The passed address was null.");
+        return __str_loadfail(err, res);
     }
-    if (!pstr->pstr)
+    size_t avail = SIZE_MAX;
+    struct stat st;
+    off_t pos = lseek(fd, 0, SEEK_CUR);
+    if (pos >= 0 && fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
     {
-        return;
+        avail = (st.st_size > pos) ? (size_t)(st.st_size - pos) + sizeof(hdr) : sizeof(hdr); // Don't trust a damaged count with malloc()
     }
-    dchar_t *p = pstr->pstr;
-    while (*p)
+    size_t size = __str_checkhdr(&hdr, avail);
+    if (size == 0)
     {
-        if (isupper(*p))
-        {
-            *p = tolower(*p);
-        }
-        else if (islower(*p))
-        {
-            *p = toupper(*p);
-        }
-        p++;
+        return __str_loadfail(err, STR_ERR_FORMAT);
+    }
+    str_table_t *pt = (str_table_t*)malloc(sizeof(str_table_t) + size);
+    if (!pt)
+    {
+        STRERROR("malloc");
+    }
+    res = __str_readall(fd, pt + 1, size);
+    if (res != STR_OK)
+    {
+        free(pt);
+        return __str_loadfail(err, res);
+    }
+    pt->count = hdr.count;
+    pt->offsets = (const uint64_t*)(pt + 1);
+    pt->data = (const dchar_t*)(pt->offsets + hdr.count + 1);
+    pt->datalen = hdr.datasize / sizeof(dchar_t);
+    pt->map = NULL;
+    pt->mapped = 0;
+    res = __str_checktable(pt, hdr.checksum, 1);
+    if (res != STR_OK)
+    {
+        free(pt);
+        return __str_loadfail(err, res);
+    }
+    if (err)
+    {
+        *err = STR_OK;
     }
+    return pt;
 }
 
-/*@brief Counts how many times a sequence is found in a string.*/
-size_t str_count(str_t *pstr, const dchar_t * seq)
+/*@brief Maps a file written by str_save() or str_asave() into memory. Nothing is parsed or copied, the strings are read straight from the
+mapping. The checksum is only checked (which reads the whole file) if verify is non zero. Errors are reported like in str_tableread().*/
+str_table_t *str_tablemap(const char *path, int verify, str_err_t *err)
 {
-    if (!pstr)
+    if (!path)
     {
-        STRFAIL("str_count: The passed address was null.");
+        STRFAIL("str_tablemap: The path was null.");
     }
-    if (!pstr->pstr)
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
     {
-        return 0;
+        return __str_loadfail(err, STR_ERR_IO);
     }
-    if (!seq)
+    struct stat st;
+    if (fstat(fd, &st) < 0)
     {
-        STRFAIL("str_count: The passed address of seq was null.");
+        close(fd);
+        return __str_loadfail(err, STR_ERR_IO);
     }
-    if (!(*seq))
+    if ((size_t)st.st_size < sizeof(strfilehdr_t))
     {
-        STRFAIL("str_count: The passed sequence is empty.");
+        close(fd);
+        return __str_loadfail(err, STR_ERR_FORMAT);
     }
-    size_t count = 0;
-    dchar_t *p = pstr->pstr;
-    while ((p = _strstr(p, seq)) != NULL)
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
     {
-        count++;
-        p++;
+        return __str_loadfail(err, STR_ERR_IO);
     }
-    return count;
-}
-
-/*@brief Counts how many times a character from a set is found in the string.*/
-size_t str_countAny(str_t *pstr, const dchar_t * set)
-{
-    if (!pstr)
+    const strfilehdr_t *phdr = (const strfilehdr_t*)map;
+    if (__str_checkhdr(phdr, st.st_size) == 0)
     {
-        STRFAIL("str_countAny: The passed address was null.");
+        munmap(map, st.st_size);
+        return __str_loadfail(err, STR_ERR_FORMAT);
     }
-    if (!pstr->pstr)
+    str_table_t *pt = (str_table_t*)malloc(sizeof(str_table_t));
+    if (!pt)
     {
-        return 0;
+        STRERROR("malloc");
     }
-    if (!set)
+    pt->count = phdr->count;
+    pt->offsets = (const uint64_t*)(phdr + 1);
+    pt->data = (const dchar_t*)(pt->offsets + phdr->count + 1);
+    pt->datalen = phdr->datasize / sizeof(dchar_t);
+    pt->map = map;
+    pt->mapped = st.st_size;
+    str_err_t res = __str_checktable(pt, phdr->checksum, verify);
+    if (res != STR_OK)
     {
-        STRFAIL("str_countAny: The passed address of set was null.");
+        munmap(map, st.st_size);
+        free(pt);
+        return __str_loadfail(err, res);
     }
-    if (!(*set))
+    if (err)
     {
-        STRFAIL("str_count: The passed set is empty.");
+        *err = STR_OK;
     }
-    size_t count = 0;
-    dchar_t *p = pstr->pstr;
-    while ((p = _strpbrk(p, set)) != NULL)
+    return pt;
+}
+
+/*@brief Returns a view of the i-th string of the table, the characters are also null terminated. A damaged table that wasn't verified
+gives wrong strings but never reads outside of the table.*/
+str_view_t str_tableget(const str_table_t *pt, size_t i)
+{
+    if (!pt)
     {
-        count++;
-        p++;
+        STRFAIL("str_tableget: The address of a str_table_t was null.");
     }
-    return count;
+    if (i >= pt->count)
+    {
+        STRFAIL("str_tableget: Index out of bounds.");
+    }
+    size_t end = (pt->offsets[i + 1] < pt->datalen) ? pt->offsets[i + 1] : pt->datalen;
+    size_t beg = (pt->offsets[i] < end) ? pt->offsets[i] : end;
+    str_view_t view = { pt->data + beg, (end > beg) ? end - beg - 1 : 0 };
+    return view;
 }
 
-/*@brief Replaces each full occurance of oldval with newval. Returns the number of replaced instances. Always causes reallocation.
-NOTE: This *can* be used for removing substrings, but isn't recomended as this function causes an unnecessary reallocation. In such cases
-use str_remove() instead!*/
-size_t str_replace(str_t *pstr, const dchar_t *oldval, const dchar_t *newval)  // I suck at C, debugging this was hell...
+/*@brief Safely free a str_table_t by passing the address of a pointer variable. The pointer will be set to null afterwards.
+Views taken from the table become invalid.*/
+void str_tablefree(str_table_t **ppt)
 {
-    if (!pstr)
+    if (!ppt)
     {
-        STRFAIL("str_replace: The passed address was null.");
+        STRFAIL("str_tablefree: The address of a str_table_t pointer variable was null.");
     }
-    if (!oldval)
+    if (!*ppt)
     {
-        STRFAIL("str_replace: The passed address of oldval was null.");
+        return;
     }
-    if (!newval)
+    if ((*ppt)->map)
     {
-        STRFAIL("str_replace: The passed address of newval was null.");
+        munmap((*ppt)->map, (*ppt)->mapped);
     }
-    size_t count = str_count(pstr, oldval);
-    size_t rlen = _strlen(newval), llen = _strlen(oldval);
-    size_t newLen = (rlen > llen) ? pstr->strlen + count*(rlen-llen) : pstr->strlen - count*(llen-rlen);
-    size_t *offsets = (size_t*)malloc(sizeof(size_t)*count);
-    if (!offsets)
+    free(*ppt);
+    *ppt = NULL;
+}
+
+/*@brief Internal function that returns a new string holding a copy of the view.*/
+str_t *__str_newview(str_view_t view)
+{
+    str_t *pstr = str_new(view.strlen + 1);
+    __str_appendn(pstr, view.pstr, view.strlen);
+    return pstr;
+}
+
+/*@brief Reads a string written by str_save() from a file descriptor. Errors are reported like in str_tableread(), a file holding more
+than one string is STR_ERR_FORMAT.*/
+str_t *str_load(int fd, str_err_t *err)
+{
+    str_table_t *pt = str_tableread(fd, err);
+    if (!pt)
     {
-        STRERROR("malloc");
+        return NULL;
     }
-    size_t i = 0;
-    dchar_t *p = pstr->pstr;
-    while ((p = _strstr(p, oldval)) != NULL)
+    if (pt->count != 1)
     {
-        offsets[i++] = p - pstr->pstr;
-        p += llen;
+        str_tablefree(&pt);
+        return __str_loadfail(err, STR_ERR_FORMAT);
     }
+    str_t *pstr = __str_newview(str_tableget(pt, 0));
+    str_tablefree(&pt);
+    return pstr;
+}
 
-    dchar_t *newblock;
-    size_t blocksize;
-    if (pstr->capacity < newLen + 1)
+/*@brief Reads an array of strings written by str_asave() from a file descriptor. Errors are reported like in str_tableread().
+Use str_tableread() or str_tablemap() instead when the strings don't have to be modifiable, it doesn't allocate every string.*/
+sarr_t *str_aload(int fd, str_err_t *err)
+{
+    str_table_t *pt = str_tableread(fd, err);
+    if (!pt)
     {
-        blocksize = newLen + 1;
+        return NULL;
     }
-    else
+    sarr_t *parr = (sarr_t*)malloc(sizeof(sarr_t));
+    if (!parr)
     {
-        blocksize = pstr->capacity;
+        STRERROR("malloc");
     }
-    newblock = (dchar_t *)malloc(sizeof(dchar_t) * blocksize);
-    memset(newblock, 0, blocksize);
-    STR_LOG_ALLOC(pstr->capacity, blocksize);
-    if (!newblock)
+    parr->strArr = (str_t**)malloc(sizeof(str_t*) * (pt->count ? pt->count : 1));
+    if (!parr->strArr)
     {
         STRERROR("malloc");
     }
+    parr->size = pt->count;
+    for (size_t i = 0; i < pt->count; i++)
+    {
+        parr->strArr[i] = __str_newview(str_tableget(pt, i));
+    }
+    str_tablefree(&pt);
+    return parr;
+}
+#pragma endregion
 
-    i = 0;
-    size_t indOff = 0;
-    size_t oldpos = 0;
-    while (i < newLen + 1) // Plus 1 to copy '/0'
+#pragma region PARALLEL
+/*
+Parallel scans split the string into chunks that are handed to a small pool of worker threads, started the first time it's needed.
+Every chunk also looks strlen(seq) - 1 characters past its end, so each match is found by the chunk it starts in. Results are combined
+in chunk order, which makes them the same as the serial ones. Strings shorter than STR_PARALLEL_MIN are done by the calling thread.
+Define DOOTSTR_NO_THREADS to build without pthreads, the _mt functions then always run serially.
+*/
+#define STR_PARALLEL_MIN (1 << 20) // Length (in characters) below which the _mt functions don't start any threads
+#define STR_PARALLEL_CHUNK (1 << 18) // Smallest number of characters given to one task
+#define STR_MAX_THREADS 16 // Most threads working on one call, the calling thread included
+
+#ifndef DOOTSTR_NO_THREADS
+/*@brief Internal struct of the thread pool running the tasks of one parallel call at a time.*/
+typedef struct strpool
+{
+    pthread_mutex_t lock; /*Guards the fields below*/
+    pthread_cond_t wake; /*Signalled when a new job is posted*/
+    pthread_cond_t done; /*Signalled when the last task of the job finishes*/
+    pthread_mutex_t busy; /*Held by the thread whose job is running, other callers run their tasks alone*/
+    size_t nthreads; /*Number of worker threads*/
+    void (*task)(void *arg, size_t i); /*The job's task*/
+    void *arg; /*Argument of the task*/
+    size_t ntasks; /*Number of tasks in the job*/
+    size_t next; /*The next task to be claimed*/
+    size_t pending; /*Number of tasks that didn't finish yet*/
+} strpool_t;
+
+strpool_t __str_pool = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+    0, NULL, NULL, 0, 0, 0 };
+pthread_once_t __str_poolonce = PTHREAD_ONCE_INIT;
+
+/*@brief Internal function run by the worker threads: claims and runs tasks of the current job, forever.*/
+void *__str_poolworker(void *unused)
+{
+    (void)unused;
+    pthread_mutex_lock(&__str_pool.lock);
+    for (;;)
     {
-        if (indOff < count && oldpos == offsets[indOff])
+        while (__str_pool.next >= __str_pool.ntasks)
         {
-            memcpy(newblock + i, newval, rlen * sizeof(dchar_t));
-            i += rlen;
-            oldpos += llen;
-            indOff++;
+            pthread_cond_wait(&__str_pool.wake, &__str_pool.lock);
         }
-        else
+        void (*task)(void*, size_t) = __str_pool.task;
+        void *arg = __str_pool.arg;
+        size_t i = __str_pool.next++;
+        pthread_mutex_unlock(&__str_pool.lock);
+        task(arg, i);
+        pthread_mutex_lock(&__str_pool.lock);
+        if (--__str_pool.pending == 0)
         {
-            newblock[i++] = pstr->pstr[oldpos];
-            oldpos++;
-        }   
+            pthread_cond_signal(&__str_pool.done);
+        }
     }
-    //newblock[blocksize-1] = '\0';
-    free(pstr->pstr);
-    free(offsets);
-    pstr->pstr = newblock;
-    pstr->capacity = blocksize;
-    pstr->strlen = newLen;
-    return count;
+    return NULL;
 }
 
-/*@brief Replaces any of the characters in set with newval. Returns the number of replaced instances. Always causes reallocation.
-NOTE: This *can* be used for removing characters, but isn't recomended as this function causes an unnecessary reallocation. In such cases
-use str_removeAny() instead!*/
-size_t str_replaceAny(str_t *pstr, const dchar_t *set, const dchar_t *newval)
+/*@brief Internal function that starts one worker per CPU, besides the calling thread. If threads can't be created, fewer are used.*/
+void __str_poolstart(void)
 {
-    if (!pstr)
-    {
-        STRFAIL("str_replaceAny: The passed address was null.");
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t want = (cpus > STR_MAX_THREADS) ? STR_MAX_THREADS - 1 : (cpus > 1) ? (size_t)cpus - 1 : 0;
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    for (size_t i = 0; i < want; i++)
+    {
+        pthread_t thread;
+        if (pthread_create(&thread, &attr, __str_poolworker, NULL) != 0)
+        {
+            break;
+        }
+        __str_pool.nthreads++;
     }
-    if (!set)
-    {
-        STRFAIL("str_replaceAny: The passed address of set was null.");
+    pthread_attr_destroy(&attr);
+}
+#endif
+
+/*@brief Internal function that returns how many threads can work on one call, the calling thread included.*/
+size_t __str_poolsize(void)
+{
+    #ifdef DOOTSTR_NO_THREADS
+    return 1;
+    #else
+    pthread_once(&__str_poolonce, __str_poolstart);
+    return __str_pool.nthreads + 1;
+    #endif
+}
+
+/*@brief Internal function that runs task(arg, i) for every i in [0, ntasks) on the pool and the calling thread, and returns when all
+of them are done. If the pool is busy with another call, the calling thread runs all the tasks itself.*/
+void __str_parallel(void (*task)(void *arg, size_t i), void *arg, size_t ntasks)
+{
+    #ifndef DOOTSTR_NO_THREADS
+    if (ntasks > 1 && __str_poolsize() > 1 && pthread_mutex_trylock(&__str_pool.busy) == 0)
+    {
+        pthread_mutex_lock(&__str_pool.lock);
+        __str_pool.task = task;
+        __str_pool.arg = arg;
+        __str_pool.ntasks = ntasks;
+        __str_pool.next = 0;
+        __str_pool.pending = ntasks;
+        pthread_cond_broadcast(&__str_pool.wake);
+        while (__str_pool.next < ntasks)
+        {
+            size_t i = __str_pool.next++;
+            pthread_mutex_unlock(&__str_pool.lock);
+            task(arg, i);
+            pthread_mutex_lock(&__str_pool.lock);
+            __str_pool.pending--;
+        }
+        while (__str_pool.pending > 0)
+        {
+            pthread_cond_wait(&__str_pool.done, &__str_pool.lock);
+        }
+        pthread_mutex_unlock(&__str_pool.lock);
+        pthread_mutex_unlock(&__str_pool.busy);
+        return;
     }
-    if (!newval)
+    #endif
+    for (size_t i = 0; i < ntasks; i++)
     {
-        STRFAIL("str_replaceAny: The passed address of newval was null.");
+        task(arg, i);
     }
-    size_t count = str_countAny(pstr, set);
-    size_t rlen = _strlen(newval);
-    size_t extraChars = count * rlen - count; // Additional needed characters
-    size_t *offsets = (size_t*)malloc(sizeof(size_t)*count);
-    if (!offsets)
+}
+
+/*@brief Internal function that returns a pointer to the first occurrence of seq (seqlen > 0 characters) in the len characters at p,
+or null. Candidates are found with memchr()/wmemchr() looking for seq[anchor].*/
+const dchar_t *__str_dfind(const dchar_t *p, size_t len, const dchar_t *seq, size_t seqlen, size_t anchor)
+{
+    #ifdef DOOTSTR_USE_WCHAR
+    if (len < seqlen)
     {
-        STRERROR("malloc");
+        return NULL;
     }
-    size_t i = 0;
-    dchar_t *p = pstr->pstr;
-    while ((p = _strpbrk(p, set)) != NULL)
+    const dchar_t *last = p + (len - seqlen);
+    const dchar_t *q = p + anchor;
+    while (q <= last + anchor && (q = wmemchr(q, seq[anchor], last + anchor - q + 1)) != NULL)
     {
-        offsets[i++] = p - pstr->pstr;
-        p++;
+        if (wmemcmp(q - anchor, seq, seqlen) == 0)
+        {
+            return q - anchor;
+        }
+        q++;
     }
+    return NULL;
+    #else
+    return __str_memfind(p, len, seq, seqlen, anchor);
+    #endif
+}
 
-    dchar_t *newblock;
-    size_t blocksize;
-    if (pstr->capacity < pstr->strlen + extraChars + 1)
-    {
-        blocksize = pstr->strlen + extraChars + 1;
-    }
-    else
-    {
-        blocksize = pstr->capacity;
+/*@brief Internal struct shared by the tasks of one parallel scan.*/
+typedef struct strscan
+{
+    const dchar_t *pstr; /*The scanned characters*/
+    size_t strlen; /*Number of scanned characters*/
+    const dchar_t *seq; /*The searched sequence*/
+    size_t seqlen; /*Length of seq*/
+    size_t anchor; /*Position in seq looked for first, see __str_dfind()*/
+    size_t chunk; /*Number of characters per task*/
+    size_t nchunks; /*Number of tasks*/
+    size_t *counts; /*Result of every task*/
+    size_t **offsets; /*Match offsets of every task (replace only)*/
+    size_t found; /*Lowest task that found a match (index only)*/
+    const dchar_t *newval; /*Replacement (replace only)*/
+    size_t newlen; /*Length of newval*/
+    size_t *starts; /*First input character copied by every task (replace only)*/
+    dchar_t *out; /*The new block (replace only)*/
+} strscan_t;
+
+/*@brief Internal function that prepares a scan of the string, choosing the number of chunks and the anchor.*/
+void __str_scaninit(strscan_t *ps, const str_t *pstr, const dchar_t *seq)
+{
+    memset(ps, 0, sizeof(strscan_t));
+    ps->pstr = pstr->pstr;
+    ps->strlen = pstr->strlen;
+    ps->seq = seq;
+    ps->seqlen = _strlen(seq);
+    ps->nchunks = 1;
+    if (ps->strlen >= STR_PARALLEL_MIN)
+    {
+        size_t most = ps->strlen / STR_PARALLEL_CHUNK;
+        ps->nchunks = __str_poolsize() * 4; // A few tasks per thread even out chunks that have more matches
+        if (ps->nchunks > most)
+        {
+            ps->nchunks = most;
+        }
     }
-    newblock = (dchar_t *)malloc(sizeof(dchar_t) * blocksize);
-    STR_LOG_ALLOC(pstr->capacity, blocksize);
-    if (!newblock)
+    ps->chunk = (ps->strlen + ps->nchunks - 1) / ps->nchunks;
+    #ifndef DOOTSTR_USE_WCHAR
+    if (ps->seqlen > 1)
     {
-        STRERROR("malloc");
+        ps->anchor = __str_memanchor(ps->pstr, (ps->strlen < 65536) ? ps->strlen : 65536, seq, ps->seqlen);
     }
+    #endif
+    ps->found = SIZE_MAX;
+}
 
-    i = 0;
-    size_t indOff = 0;
-    size_t oldpos = 0;
-    while (i < pstr->strlen + extraChars + 1) // Plus 1 to copy '/0'
+/*@brief Internal function that gives the range of characters a match of task i can start in, and how far it may search.*/
+void __str_scanrange(const strscan_t *ps, size_t i, size_t *beg, size_t *end, size_t *limit)
+{
+    *beg = i * ps->chunk;
+    *end = (*beg + ps->chunk < ps->strlen) ? *beg + ps->chunk : ps->strlen;
+    *limit = (*end + ps->seqlen - 1 < ps->strlen) ? *end + ps->seqlen - 1 : ps->strlen;
+}
+
+/*@brief Internal task that counts the (possibly overlapping) matches starting in its chunk.*/
+void __str_counttask(void *arg, size_t i)
+{
+    strscan_t *ps = (strscan_t*)arg;
+    size_t beg, end, limit, count = 0;
+    __str_scanrange(ps, i, &beg, &end, &limit);
+    const dchar_t *p = ps->pstr + beg, *stop = ps->pstr + end, *lim = ps->pstr + limit;
+    while ((p = __str_dfind(p, lim - p, ps->seq, ps->seqlen, ps->anchor)) != NULL && p < stop)
     {
-        if (indOff < count && oldpos == offsets[indOff])
-        {
-            memcpy(newblock + i, newval, rlen * sizeof(dchar_t));
-            i += rlen;
-            indOff++;
-        }
-        else
-        {
-            newblock[i++] = pstr->pstr[oldpos];
-        }
-        oldpos++;
+        count++;
+        p++;
     }
-    free(pstr->pstr);
-    free(offsets);
-    pstr->pstr = newblock;
-    pstr->capacity = blocksize;
-    pstr->strlen = pstr->strlen + extraChars;
-    return count;
+    ps->counts[i] = count;
 }
 
-/*@brief Replaces any of the characters in set with a char c. Returns the number of replaced instances.*/
-size_t str_replaceAnyCh(str_t *pstr, const dchar_t *set, char c)
+/*@brief Like str_count(), but splits long strings between several threads.*/
+size_t str_count_mt(const str_t *pstr, const dchar_t *seq)
 {
-    if (!pstr)
+    if (!pstr || !seq)
     {
-        STRFAIL("str_replaceAnyCh: The passed address was null.");
+        STRFAIL("str_count_mt: The address of a str_t or seq was null.");
     }
-    if (!pstr->pstr)
+    if (!(*seq))
     {
-        return 0;
+        STRFAIL("str_count_mt: The passed sequence is empty.");
     }
-    if (!set)
+    if (pstr->strlen == 0)
     {
-        STRFAIL("str_replaceAnyCh: The passed address of seq was null.");
+        return 0;
     }
-    size_t count = 0;
-    dchar_t *p = pstr->pstr;
-    while ((p = _strpbrk(p, set)) != NULL)
+    strscan_t scan;
+    __str_scaninit(&scan, pstr, seq);
+    size_t counts[STR_MAX_THREADS * 4];
+    scan.counts = counts;
+    __str_parallel(__str_counttask, &scan, scan.nchunks);
+    size_t total = 0;
+    for (size_t i = 0; i < scan.nchunks; i++)
     {
-        *p = c;
-        count++;
-        p++;
+        total += counts[i];
     }
-    return count;
+    return total;
 }
 
-/*@brief Removes all preceding and trailing whitespaces.*/
-void str_strip(str_t *pstr)
+/*@brief Internal task that finds the first match starting in its chunk, unless an earlier chunk already found one.*/
+void __str_indextask(void *arg, size_t i)
 {
-    if (!pstr)
+    strscan_t *ps = (strscan_t*)arg;
+    if (__atomic_load_n(&ps->found, __ATOMIC_RELAXED) < i)
     {
-        STRFAIL("str_strip: The passed address of str_t was null.");
+        return;
     }
-    if (!pstr->pstr)
+    size_t beg, end, limit;
+    __str_scanrange(ps, i, &beg, &end, &limit);
+    const dchar_t *p = __str_dfind(ps->pstr + beg, limit - beg, ps->seq, ps->seqlen, ps->anchor);
+    if (p && p < ps->pstr + end)
     {
-        return;
+        ps->counts[i] = p - ps->pstr;
+        size_t best = __atomic_load_n(&ps->found, __ATOMIC_RELAXED);
+        while (i < best && !__atomic_compare_exchange_n(&ps->found, &best, i, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {
+        }
     }
-    size_t leftoff = 0, rightoff = 0;
-    dchar_t *p = pstr->pstr;
-    while (*p && isspace(*p))
+}
+
+/*@brief Like str_index(), but splits long strings between several threads. Chunks after the one holding a match stop early.*/
+ssize_t str_index_mt(const str_t *pstr, const dchar_t *seq)
+{
+    if (!pstr || !seq)
     {
-        ++leftoff;
-        ++p;
+        STRFAIL("str_index_mt: The address of a str_t or seq was null.");
     }
-    if (leftoff == pstr->strlen)
+    if (!(*seq))
     {
-        pstr->pstr[0] = '\0';
-        pstr->strlen = 0;
-        return;
+        return 0;
     }
-    p = pstr->pstr + pstr->strlen - 1;
-    while (p >= pstr->pstr && isspace(*p))
+    if (pstr->strlen == 0)
     {
-        ++rightoff;
-        --p;
+        return -1;
     }
-    if (leftoff > 0)
-    {
-        for (size_t i = leftoff; i < pstr->strlen - rightoff; ++i)
+    strscan_t scan;
+    __str_scaninit(&scan, pstr, seq);
+    size_t firsts[STR_MAX_THREADS * 4];
+    scan.counts = firsts;
+    __str_parallel(__str_indextask, &scan, scan.nchunks);
+    return (scan.found == SIZE_MAX) ? -1 : (ssize_t)firsts[scan.found];
+}
+
+/*@brief Internal task that collects the non overlapping matches found by searching from the start of its chunk.*/
+void __str_findtask(void *arg, size_t i)
+{
+    strscan_t *ps = (strscan_t*)arg;
+    size_t beg, end, limit, count = 0, capacity = 0;
+    size_t *offsets = NULL;
+    __str_scanrange(ps, i, &beg, &end, &limit);
+    const dchar_t *p = ps->pstr + beg, *stop = ps->pstr + end, *lim = ps->pstr + limit;
+    while ((p = __str_dfind(p, lim - p, ps->seq, ps->seqlen, ps->anchor)) != NULL && p < stop)
+    {
+        if (count == capacity)
         {
-            pstr->pstr[i - leftoff] = pstr->pstr[i];
+            capacity = capacity ? capacity * 2 : 64;
+            offsets = (size_t*)realloc(offsets, capacity * sizeof(size_t));
+            if (!offsets)
+            {
+                STRERROR("realloc");
+            }
         }
+        offsets[count++] = p - ps->pstr;
+        p += ps->seqlen;
     }
-    pstr->pstr[pstr->strlen - rightoff - leftoff] = '\0';
+    ps->offsets[i] = offsets;
+    ps->counts[i] = count;
 }
 
-/*@brief Removes all preceding whitespaces.*/
-void str_lstrip(str_t *pstr)
+/*@brief Internal function that turns the matches every chunk found on its own into the ones a serial left to right search finds.
+A chunk's list is only wrong up to its first match that doesn't overlap the previous chunk's last one, so only the first seqlen - 1
+characters after that match need searching again. Fills ps->starts and returns the total number of matches.*/
+size_t __str_mergematches(strscan_t *ps)
 {
-    if (!pstr)
+    size_t resume = 0; // End of the last accepted match
+    size_t total = 0;
+    for (size_t i = 0; i < ps->nchunks; i++)
+    {
+        size_t beg, end, limit;
+        __str_scanrange(ps, i, &beg, &end, &limit);
+        ps->starts[i] = (resume > beg) ? resume : beg;
+        size_t *offsets = ps->offsets[i], n = ps->counts[i], from = 0, kept = 0;
+        while (resume > beg)
+        {
+            while (from < n && offsets[from] < resume)
+            {
+                from++;
+            }
+            size_t next = (from < n) ? offsets[from] : end;
+            size_t stop = (resume + ps->seqlen - 1 < next) ? resume + ps->seqlen - 1 : next; // A skipped match starts before this
+            const dchar_t *p = (resume < stop) ? __str_dfind(ps->pstr + resume, limit - resume, ps->seq, ps->seqlen, ps->anchor) : NULL;
+            if (!p || (size_t)(p - ps->pstr) >= stop)
+            {
+                break; // From offsets[from] on, the chunk's list is right
+            }
+            if (kept == from) // No room in front of the remaining ones
+            {
+                offsets = (size_t*)realloc(offsets, (n + 1) * sizeof(size_t));
+                if (!offsets)
+                {
+                    STRERROR("realloc");
+                }
+                memmove(offsets + from + 1, offsets + from, (n - from) * sizeof(size_t));
+                n++;
+                from++;
+                ps->offsets[i] = offsets;
+            }
+            offsets[kept++] = p - ps->pstr;
+            resume = p - ps->pstr + ps->seqlen;
+        }
+        if (kept != from)
+        {
+            memmove(offsets + kept, offsets + from, (n - from) * sizeof(size_t));
+        }
+        n = kept + (n - from);
+        ps->counts[i] = n;
+        if (n > 0 && offsets[n - 1] + ps->seqlen > resume)
+        {
+            resume = offsets[n - 1] + ps->seqlen;
+        }
+        total += n;
+    }
+    return total;
+}
+
+/*@brief Internal task that copies its chunk into the new block, replacing its matches.*/
+void __str_copytask(void *arg, size_t i)
+{
+    strscan_t *ps = (strscan_t*)arg;
+    size_t before = 0; // Matches in the earlier chunks
+    for (size_t k = 0; k < i; k++)
     {
-        STRFAIL("str_strip: The passed address of str_t was null.");
+        before += ps->counts[k];
     }
-    if (!pstr->pstr)
+    size_t pos = ps->starts[i];
+    size_t stop = (i + 1 < ps->nchunks) ? ps->starts[i + 1] : ps->strlen;
+    dchar_t *out = ps->out + (pos + before * ps->newlen - before * ps->seqlen);
+    for (size_t k = 0; k < ps->counts[i]; k++)
     {
-        return;
+        size_t at = ps->offsets[i][k];
+        memcpy(out, ps->pstr + pos, (at - pos) * sizeof(dchar_t));
+        out += at - pos;
+        memcpy(out, ps->newval, ps->newlen * sizeof(dchar_t));
+        out += ps->newlen;
+        pos = at + ps->seqlen;
     }
-    size_t leftoff = 0;
-    dchar_t *p = pstr->pstr;
-    while (*p && isspace(*p))
+    memcpy(out, ps->pstr + pos, (stop - pos) * sizeof(dchar_t));
+}
+
+/*@brief Like str_replace(), but splits long strings between several threads, both to find the matches and to copy the result.
+Matches don't overlap and are taken from left to right, exactly like the serial search does. Doesn't reallocate if nothing was found.*/
+size_t str_replace_mt(str_t *pstr, const dchar_t *oldval, const dchar_t *newval)
+{
+    if (!pstr || !oldval || !newval)
     {
-        ++leftoff;
-        ++p;
+        STRFAIL("str_replace_mt: The address of a str_t, oldval or newval was null.");
     }
-    if (leftoff == pstr->strlen)
+    if (!(*oldval))
     {
-        pstr->pstr[0] = '\0';
-        pstr->strlen = 0;
-        return;
+        STRFAIL("str_replace_mt: The passed sequence is empty.");
     }
-    if (leftoff > 0)
+    if (pstr->strlen == 0)
     {
-        for (size_t i = leftoff; i < pstr->strlen; ++i)
+        return 0;
+    }
+    strscan_t scan;
+    __str_scaninit(&scan, pstr, oldval);
+    size_t counts[STR_MAX_THREADS * 4], starts[STR_MAX_THREADS * 4];
+    size_t *offsets[STR_MAX_THREADS * 4];
+    scan.counts = counts;
+    scan.starts = starts;
+    scan.offsets = offsets;
+    scan.newval = newval;
+    scan.newlen = _strlen(newval);
+    __str_parallel(__str_findtask, &scan, scan.nchunks);
+    size_t total = __str_mergematches(&scan);
+    if (total > 0)
+    {
+        size_t first = 0;
+        while (counts[first] == 0)
         {
-            pstr->pstr[i - leftoff] = pstr->pstr[i];
+            first++;
         }
-    }
-    pstr->pstr[pstr->strlen - leftoff] = '\0';
+        __str_mutate(pstr, offsets[first][0]);
+        scan.pstr = pstr->pstr; // Mapped strings were just copied
+        size_t newlen = pstr->strlen - total * scan.seqlen + total * scan.newlen;
+        size_t blocksize = (pstr->capacity < newlen + 1) ? newlen + 1 : pstr->capacity;
+        scan.out = __str_blockalloc(&blocksize);
+        STR_STAT_REALLOC(STR_CALLER, pstr->pstr, blocksize, newlen + 1);
+        __str_parallel(__str_copytask, &scan, scan.nchunks);
+        scan.out[newlen] = '\0';
+        __str_dropblock(pstr);
+        pstr->pstr = scan.out;
+        pstr->capacity = blocksize;
+        pstr->strlen = newlen;
+    }
+    for (size_t i = 0; i < scan.nchunks; i++)
+    {
+        free(offsets[i]);
+    }
+    return total;
+}
+#pragma endregion
+
+#pragma region UNCHECKED
+/*
+Unchecked versions of the functions most often called in inner loops. They're meant for inputs that were already validated, so they don't
+check for null pointers or invalid UTF-8 (those are only assert()ed, which goes away with NDEBUG) and never exit the process because of
+the arguments: a position or length outside the string is reported with STR_ERR_INDEX and leaves the string unchanged. Failing to allocate
+memory still fails like everywhere else. Being static inline, the short ones compile down to a few instructions at the call site.
+The characters added must not point into the string itself.
+*/
+#ifdef DOOTSTR_USE_UTF8
+#define STR_UTF8_ASSERT(cstring, len) assert(__str_u8valid((cstring), (len)))
+#else
+#define STR_UTF8_ASSERT(cstring, len) ((void)0)
+#endif
+
+/*@brief Returns the i-th character of the string, without from-the-end indexing. i can be the string's length, for the null terminator.*/
+static inline dchar_t str_at_unchecked(const str_t *pstr, size_t i)
+{
+    assert(pstr && pstr->pstr && i <= pstr->strlen);
+    return pstr->pstr[i];
 }
 
-/*@brief Removes all trailing whitespaces.*/
-void str_rstrip(str_t *pstr)
+/*@brief Appends exactly len characters, which don't have to be null terminated.*/
+static inline str_err_t str_appendn_unchecked(str_t *pstr, const dchar_t *p, size_t len)
 {
-    if (!pstr)
-    {
-        STRFAIL("str_strip: The passed address of str_t was null.");
-    }
-    if (!pstr->pstr)
+    assert(pstr && (p || len == 0));
+    STR_UTF8_ASSERT(p, len);
+    __str_appendn(pstr, p, len);
+    return STR_OK;
+}
+
+/*@brief Appends a c string.*/
+static inline str_err_t str_append_c_unchecked(str_t *pstr, const dchar_t *cstring)
+{
+    assert(cstring);
+    return str_appendn_unchecked(pstr, cstring, _strlen(cstring));
+}
+
+/*@brief Appends another string.*/
+static inline str_err_t str_append_unchecked(str_t *pleft, const str_t *pright)
+{
+    assert(pright);
+    return str_appendn_unchecked(pleft, pright->pstr, pright->strlen);
+}
+
+/*@brief Inserts exactly len characters at position, which can be at most the string's length. Returns STR_ERR_INDEX otherwise.*/
+static inline str_err_t str_insertn_unchecked(str_t *pstr, const dchar_t *p, size_t len, size_t position)
+{
+    assert(pstr && (p || len == 0));
+    STR_UTF8_ASSERT(p, len);
+    if (position > pstr->strlen)
     {
-        return;
+        return STR_ERR_INDEX;
     }
-    size_t rightoff = 0;
-    dchar_t *p = pstr->pstr + pstr->strlen - 1;
-    while (p >= pstr->pstr && isspace(*p))
+    __str_mutate(pstr, position);
+    __str_reserve(pstr, len);
+    memmove(pstr->pstr + position + len, pstr->pstr + position, (pstr->strlen - position) * sizeof(dchar_t));
+    if (len > 0)
     {
-        ++rightoff;
-        --p;
+        memcpy(pstr->pstr + position, p, len * sizeof(dchar_t));
     }
-    pstr->pstr[pstr->strlen - rightoff] = '\0';
+    pstr->strlen += len;
+    pstr->pstr[pstr->strlen] = '\0';
+    return STR_OK;
 }
-//TODO: Investigate what other cleanup fnc could be usefull.
 
-#pragma endregion
+/*@brief Inserts a c string at position, which can be at most the string's length. Returns STR_ERR_INDEX otherwise.*/
+static inline str_err_t str_insert_c_unchecked(str_t *pstr, const dchar_t *cstring, size_t position)
+{
+    assert(cstring);
+    return str_insertn_unchecked(pstr, cstring, _strlen(cstring), position);
+}
 
-#pragma region SPLITTING
-/*@brief Searches the string and returns the index where seq first occurs. -1 otherwise.*/
-ssize_t str_index(str_t *pstr, const dchar_t *seq)
+/*@brief Removes length characters starting at position. Returns STR_ERR_INDEX if they don't all fit in the string.*/
+static inline str_err_t str_cut_unchecked(str_t *pstr, size_t position, size_t length)
 {
-    if (!pstr)
+    assert(pstr);
+    if (position > pstr->strlen || length > pstr->strlen - position)
     {
-        STRFAIL("str_index: The passed address is null.");
+        return STR_ERR_INDEX;
     }
-    if (!pstr->pstr)
+    if (length == 0)
     {
-        return -1;
+        return STR_OK;
     }
-    if (!seq)
+    if (position == 0)
     {
-        STRFAIL("str_index: The passed address of seq is null.");
+        __str_advance(pstr, length);
+        return STR_OK;
     }
-    if (!(*seq))
+    __str_mutate(pstr, position);
+    memmove(pstr->pstr + position, pstr->pstr + position + length, (pstr->strlen - position - length + 1) * sizeof(dchar_t));
+    pstr->strlen -= length;
+    return STR_OK;
+}
+
+/*@brief Returns the index where seq first occurs in the string, -1 if it doesn't. An empty seq is found at 0.*/
+static inline ssize_t str_index_unchecked(const str_t *pstr, const dchar_t *seq)
+{
+    assert(pstr && seq);
+    if (!pstr->pstr)
+    {
+        return *seq ? -1 : 0;
+    }
+    const dchar_t *p = _strstr(pstr->pstr, seq);
+    return p ? p - pstr->pstr : -1;
+}
+
+/*@brief Counts the (overlapping) occurrences of seq in the string, like str_count(). An empty seq is counted 0 times.*/
+static inline size_t str_count_unchecked(const str_t *pstr, const dchar_t *seq)
+{
+    assert(pstr && seq);
+    if (!pstr->pstr || !*seq)
     {
         return 0;
     }
-    ssize_t found = -1;
-    ssize_t i = 0;
-    const dchar_t *ps = seq;
-    // This could be _strstr(pstr->pstr) - pstr->pstr; But this is more easily modifiable.
-    while (pstr->pstr[i])
+    size_t count = 0;
+    for (const dchar_t *p = pstr->pstr; (p = _strstr(p, seq)) != NULL; p++)
     {
-        found = i;
-        while (pstr->pstr[i] && pstr->pstr[i] == *ps)
-        {
-            ps++;
-            if (!(*ps))
-            {
-                return found;
-            }
-            i++;
-        }
-        ps = seq;
-        i = found + 1;
-        continue;
-        i++;
+        count++;
     }
-    return -1;
+    return count;
 }
+#pragma endregion
 
-/*@brief Searches the string and returns the index where seq last occurs. -1 otherwise.*/
-ssize_t str_rindex(str_t *pstr, const dchar_t *seq)
+#pragma region VIEWS
+/*
+Functions that take str_view_t instead of str_t and c strings. The length of a view is known, so nothing is measured again, and a view
+can cover part of a string (see str_subview()) without copying it out. Views don't have to be null terminated.
+*/
+#define STR_VIEW_ANCHORSCAN 4096 // Characters looked at to pick the search anchor of str_count_v() and str_index_v()
+
+/*@brief Returns a view of the whole string. It's valid until the string is modified or freed.*/
+str_view_t str_view(const str_t *pstr)
 {
     if (!pstr)
     {
-        STRFAIL("str_index: The passed address is null.");
+        STRFAIL("str_view: The address of a str_t was null.");
     }
-    if (!pstr->pstr)
+    str_view_t view = { pstr->pstr ? pstr->pstr : STR_EMPTY, pstr->strlen };
+    return view;
+}
+
+/*@brief Returns a view of a c string, measuring it once.*/
+str_view_t str_view_c(const dchar_t *cstring)
+{
+    if (!cstring)
     {
-        return -1;
+        STRFAIL("str_view_c: The address of a c string was null.");
     }
-    if (!seq)
+    str_view_t view = { cstring, _strlen(cstring) };
+    return view;
+}
+
+/*@brief Returns a view of len characters at p, which don't have to be null terminated.*/
+str_view_t str_viewn(const dchar_t *p, size_t len)
+{
+    if (!p && len)
     {
-        STRFAIL("str_rindex: The passed address of seq is null.");
+        STRFAIL("str_viewn: The address of the characters was null.");
     }
-    if (!(*seq))
+    str_view_t view = { p ? p : STR_EMPTY, len };
+    return view;
+}
+
+/*@brief Returns a view of the characters [beg, end) of another view. end can be STR_END.*/
+str_view_t str_subview(str_view_t view, size_t beg, size_t end)
+{
+    if (end == STR_END)
     {
-        return 0;
+        end = view.strlen;
     }
-    ssize_t ending = -1;
-    ssize_t i = pstr->strlen -1;
-    ssize_t rlen = _strlen(seq);
-    const dchar_t *ps = seq + rlen - 1;
-    while (i >= 0)
+    if (beg > end || end > view.strlen)
     {
-        ending = i;
-        while (i >= 0 && pstr->pstr[i] == *ps)
-        {
-            ps--;
-            if (ps < seq)
-            {
-                return i;
-            }
-            i--;
-        }
-        ps = seq;
-        i = ending - 1;
-        continue;
-        i--;
+        STRFAIL("str_subview: The range goes out of bounds of the view.");
     }
-    return -1;
+    str_view_t sub = { view.pstr + beg, end - beg };
+    return sub;
 }
 
-/*@brief Finds the first occurance of pivot and splits the string by it.
-The passed output strings can but don't have to be initialized.
-@param[in] pstr input string (non empty)
-@param[in] pivot pivot sequence
-@param[in] pivot str_t containing the substring before the pivot.
-@param[in] outleft str_t containing the substring before the pivot.
-@param[in] outmid str_t containing the substring before the pivot.*/
-void str_partition(str_t *pstr, const dchar_t *pivot, str_t **outleft, str_t **outmid, str_t **outright)
+/*@brief Internal function that returns the offset of the view's characters in the string's block, or SIZE_MAX if they aren't in it.*/
+size_t __str_viewoffset(const str_t *pstr, str_view_t view)
 {
-    if (!pstr)
+    if (pstr->pstr && view.pstr >= pstr->pstr && view.pstr <= pstr->pstr + pstr->strlen)
     {
-        STRFAIL("str_partition: The passed address of a str_t was null.");
+        return view.pstr - pstr->pstr;
     }
-    if (!pstr->pstr)
+    return SIZE_MAX;
+}
+
+/*@brief Internal function that inserts the characters of a view at position, which is checked by the caller. The view may point into
+the string itself.*/
+void __str_insertview(str_t *pstr, str_view_t view, size_t position)
+{
+    size_t from = __str_viewoffset(pstr, view);
+    __str_mutate(pstr, position);
+    __str_reserve(pstr, view.strlen);
+    dchar_t *p = pstr->pstr + position;
+    memmove(p + view.strlen, p, (pstr->strlen - position) * sizeof(dchar_t));
+    if (from == SIZE_MAX)
     {
-        STRFAIL("str_partition: The passed string was empty.");
+        memcpy(p, view.pstr, view.strlen * sizeof(dchar_t));
     }
-    if (!pivot)
+    else
     {
-        STRFAIL("str_partition: The passed address of pivot was null.");
+        // The view's characters after position were just moved by its length, so the part that was split off comes from there
+        size_t before = (from < position) ? ((position - from < view.strlen) ? position - from : view.strlen) : 0;
+        memmove(p, pstr->pstr + from, before * sizeof(dchar_t));
+        memmove(p + before, pstr->pstr + ((from < position) ? position : from) + view.strlen, (view.strlen - before) * sizeof(dchar_t));
     }
-    if (!(*pivot))
+    pstr->strlen += view.strlen;
+    pstr->pstr[pstr->strlen] = '\0';
+}
+
+/*@brief Appends the characters of a view. The view may be part of the string itself.*/
+void str_append_v(str_t *pstr, str_view_t view)
+{
+    if (!pstr || (!view.pstr && view.strlen))
     {
-        STRFAIL("str_partition: The passed pivot was empty.");
+        STRFAIL("str_append_v: The address of a str_t or of the viewed characters was null.");
     }
-    if (!outleft || !outmid || !outright)
+    (void)STR_UTF8_CHECK(view.pstr, view.strlen, "str_append_v: The view is not valid UTF-8.");
+    __str_insertview(pstr, view, pstr->strlen);
+}
+
+/*@brief Inserts the characters of a view at position, which can be at most the string's length. The view may be part of the string.*/
+void str_insert_v(str_t *pstr, str_view_t view, size_t position)
+{
+    if (!pstr || (!view.pstr && view.strlen))
     {
-        STRFAIL("str_partition: One of the passed addreses of output str_t pointer variables was null.");
+        STRFAIL("str_insert_v: The address of a str_t or of the viewed characters was null.");
     }
-    if (!*outleft)
+    if (position > pstr->strlen)
     {
-        *outleft = str_new(0);
+        STRFAIL("str_insert_v: Position has to be no greater than string length.");
     }
-    if (!*outmid)
+    (void)STR_UTF8_CHECK(view.pstr, view.strlen, "str_insert_v: The view is not valid UTF-8.");
+    __str_insertview(pstr, view, position);
+}
+
+/*@brief Replaces the contents of the string with the characters of a view. The view may be part of the string itself.*/
+void str_assign_v(str_t *pstr, str_view_t view)
+{
+    if (!pstr || (!view.pstr && view.strlen))
     {
-        *outmid = str_new(0);
+        STRFAIL("str_assign_v: The address of a str_t or of the viewed characters was null.");
     }
-    if (!*outright)
+    (void)STR_UTF8_CHECK(view.pstr, view.strlen, "str_assign_v: The view is not valid UTF-8.");
+    size_t from = __str_viewoffset(pstr, view);
+    __str_mutate(pstr, 0);
+    if (from != SIZE_MAX)
     {
-        *outright = str_new(0);
+        memmove(pstr->pstr, pstr->pstr + from, view.strlen * sizeof(dchar_t)); // Part of the string, so it fits
     }
-    ssize_t pivInd = str_index(pstr, pivot);
-    size_t pivLen = _strlen(pivot);
-    if (pivInd == -1)
+    else
     {
-        str_assign_c(*outright, STR_EMPTY);
-        str_assign_c(*outmid, pivot);
-        str_assign_c(*outright, STR_EMPTY);
+        pstr->strlen = 0;
+        __str_reserve(pstr, view.strlen);
+        if (view.strlen)
+        {
+            memcpy(pstr->pstr, view.pstr, view.strlen * sizeof(dchar_t));
+        }
     }
-    else
+    pstr->strlen = view.strlen;
+    pstr->pstr[pstr->strlen] = '\0';
+}
+
+/*@brief Internal function that picks the character of seq that __str_dfind() looks for first when searching view.*/
+size_t __str_viewanchor(str_view_t view, str_view_t seq)
+{
+    #ifndef DOOTSTR_USE_WCHAR
+    if (seq.strlen > 1)
     {
-        str_assignSlice(*outleft, pstr->pstr, 0, pivInd, 1);
-        str_assign_c(*outmid, pivot);
-        str_assignSlice(*outright, pstr->pstr, pivInd + pivLen, pstr->strlen, 1);
+        return __str_memanchor(view.pstr, (view.strlen < STR_VIEW_ANCHORSCAN) ? view.strlen : STR_VIEW_ANCHORSCAN, seq.pstr, seq.strlen);
     }
+    #endif
+    (void)view;
+    (void)seq;
+    return 0;
 }
 
-void str_rpartition(str_t *pstr, const dchar_t *pivot, str_t **outleft, str_t **outmid, str_t **outright)
+/*@brief Returns the index where seq first occurs in the view, -1 if it doesn't. An empty seq is found at 0.*/
+ssize_t str_index_v(str_view_t view, str_view_t seq)
 {
-    if (!pstr)
+    if ((!view.pstr && view.strlen) || (!seq.pstr && seq.strlen))
     {
-        STRFAIL("str_rpartition: The passed address of a str_t was null.");
+        STRFAIL("str_index_v: The address of the viewed characters was null.");
     }
-    if (!pstr->pstr)
+    if (!seq.strlen)
     {
-        STRFAIL("str_rpartition: The passed string was empty.");
+        return 0;
     }
-    if (!pivot)
+    const dchar_t *p = __str_dfind(view.pstr, view.strlen, seq.pstr, seq.strlen, __str_viewanchor(view, seq));
+    return p ? p - view.pstr : -1;
+}
+
+/*@brief Returns the index where seq last occurs in the view, -1 if it doesn't. An empty seq is found at the view's length.*/
+ssize_t str_rindex_v(str_view_t view, str_view_t seq)
+{
+    if ((!view.pstr && view.strlen) || (!seq.pstr && seq.strlen))
     {
-        STRFAIL("str_rpartition: The passed address of pivot was null.");
+        STRFAIL("str_rindex_v: The address of the viewed characters was null.");
     }
-    if (!(*pivot))
+    if (!seq.strlen)
     {
-        STRFAIL("str_rpartition: The passed pivot was empty.");
+        return view.strlen;
     }
-    if (!outleft || !outmid || !outright)
+    if (seq.strlen > view.strlen)
     {
-        STRFAIL("str_rpartition: One of the passed addreses of output str_t pointer variables was null.");
+        return -1;
     }
-    if (!*outleft)
+    for (size_t i = view.strlen - seq.strlen + 1; i-- > 0;)
     {
-        *outleft = str_new(0);
+        if (view.pstr[i] == seq.pstr[0] && memcmp(view.pstr + i, seq.pstr, seq.strlen * sizeof(dchar_t)) == 0)
+        {
+            return i;
+        }
     }
-    if (!*outmid)
+    return -1;
+}
+
+/*@brief Counts how many times seq occurs in the view, overlapping occurrences included like in str_count().*/
+size_t str_count_v(str_view_t view, str_view_t seq)
+{
+    if ((!view.pstr && view.strlen) || !seq.pstr)
     {
-        *outmid = str_new(0);
+        STRFAIL("str_count_v: The address of the viewed characters was null.");
     }
-    if (!*outright)
+    if (!seq.strlen)
     {
-        *outright = str_new(0);
+        STRFAIL("str_count_v: The passed sequence is empty.");
     }
-    ssize_t pivInd = str_rindex(pstr, pivot);
-    size_t pivLen = _strlen(pivot);
-    if (pivInd == -1)
+    size_t anchor = __str_viewanchor(view, seq), count = 0;
+    const dchar_t *p = view.pstr, *end = view.pstr + view.strlen;
+    while ((p = __str_dfind(p, end - p, seq.pstr, seq.strlen, anchor)) != NULL)
     {
-        str_assign_c(*outright, STR_EMPTY);
-        str_assign_c(*outmid, pivot);
-        str_assign_c(*outright, STR_EMPTY);
+        count++;
+        p++;
+    }
+    return count;
+}
+
+/*@brief Internal function that returns 1 if c is one of the set.strlen characters of set.*/
+int __str_viewhas(str_view_t set, dchar_t c)
+{
+    #ifdef DOOTSTR_USE_WCHAR
+    return wmemchr(set.pstr, c, set.strlen) != NULL;
+    #else
+    return memchr(set.pstr, c, set.strlen) != NULL;
+    #endif
+}
+
+/*@brief Counts how many characters of the view are in set.*/
+size_t str_countAny_v(str_view_t view, str_view_t set)
+{
+    if ((!view.pstr && view.strlen) || (!set.pstr && set.strlen))
+    {
+        STRFAIL("str_countAny_v: The address of the viewed characters was null.");
     }
-    else
+    size_t count = 0;
+    for (size_t i = 0; i < view.strlen; i++)
     {
-        str_assignSlice(*outleft, pstr->pstr, 0, pivInd, 1);
-        str_assign_c(*outmid, pivot);
-        str_assignSlice(*outright, pstr->pstr, pivInd + pivLen, pstr->strlen, 1);
+        count += __str_viewhas(set, view.pstr[i]);
     }
+    return count;
 }
 
-/*
-@brief This struct represents an array of str_t objects. It's used by some dootstr functions, to make dealing with many strings easier
-and safer. Now ideally this would be a dynamic vector, but at this point just use C++. This struct is mostly meant to be recieved by the user from
-str_ functions, not necessarily created.
-*/
-typedef struct sarr
+/*@brief Returns 1 if seq occurs in the view.*/
+int str_containsSeq_v(str_view_t view, str_view_t seq)
 {
-    str_t **strArr; /*The array of str_t pointers (to single str_t structs).*/
-    size_t size; /*The number of strings in the array.*/
-} sarr_t;
+    return str_index_v(view, seq) != -1;
+}
 
-/*@brief Create a sarr_t by taking onwership of an existing array of c-style strings.
-The cstring pointer is freed, dangling and unusable afterwards. Make sure that the provided array is of size n,
-otherwise excpect read violations. Please be careful with this.*/
-sarr_t *str_asteal(dchar_t **cstrings, size_t n)
+/*@brief Returns 1 if the view contains any of the characters of set.*/
+int str_containsAny_v(str_view_t view, str_view_t set)
 {
-    if (!cstrings)
+    if ((!view.pstr && view.strlen) || (!set.pstr && set.strlen))
     {
-        STRFAIL("str_asteal: The passed address to cstrings is null.");
+        STRFAIL("str_containsAny_v: The address of the viewed characters was null.");
     }
-    for (size_t i = 0; i < n; i++)
+    for (size_t i = 0; i < view.strlen; i++)
     {
-        if (!(cstrings[i]))
+        if (__str_viewhas(set, view.pstr[i]))
         {
-            STRFAIL("str_asteal: One of the strings in the cstrings array is null");
+            return 1;
         }
     }
+    return 0;
+}
 
-    sarr_t *parr = (sarr_t*)malloc(sizeof(sarr_t));
-    if (!parr)
+/*@brief Returns 1 if the view isn't empty and contains only characters of set.*/
+int str_containsOnly_v(str_view_t view, str_view_t set)
+{
+    if ((!view.pstr && view.strlen) || (!set.pstr && set.strlen))
     {
-        STRERROR("malloc");
+        STRFAIL("str_containsOnly_v: The address of the viewed characters was null.");
     }
-    parr->strArr = (str_t**)malloc(sizeof(str_t*) * n);
-    if (!parr->strArr)
+    for (size_t i = 0; i < view.strlen; i++)
     {
-        STRERROR("malloc");
+        if (!__str_viewhas(set, view.pstr[i]))
+        {
+            return 0;
+        }
     }
-    parr->size = n;
-    for (size_t i = 0; i < n; i++)
+    return view.strlen > 0;
+}
+
+/*@brief Compares two views character by character, a view that's a prefix of the other is smaller. Returns -1, 0 or 1.*/
+int str_cmp_v(str_view_t a, str_view_t b)
+{
+    size_t n = (a.strlen < b.strlen) ? a.strlen : b.strlen;
+    #ifdef DOOTSTR_USE_WCHAR
+    int res = n ? wmemcmp(a.pstr, b.pstr, n) : 0;
+    #else
+    int res = n ? memcmp(a.pstr, b.pstr, n) : 0;
+    #endif
+    if (res)
     {
-        parr->strArr[i] = str_steal(cstrings[i]);
+        return (res < 0) ? -1 : 1;
     }
-    free(cstrings);
-    return parr;
+    return (a.strlen == b.strlen) ? 0 : ((a.strlen < b.strlen) ? -1 : 1);
 }
 
-/*@brief Create a sarr_t by copying an already existing array of c-style strings.*/
-sarr_t *str_afrom(dchar_t **cstrings, size_t n)
+/*@brief Compares two views without case, like str_casecmp(). Returns -1, 0 or 1.*/
+int str_casecmp_v(str_view_t a, str_view_t b)
 {
-    if (!cstrings)
+    if ((!a.pstr && a.strlen) || (!b.pstr && b.strlen))
     {
-        STRFAIL("str_afrom: The passed address to cstrings is null.");
+        STRFAIL("str_casecmp_v: The address of the viewed characters was null.");
     }
-    for (size_t i = 0; i < n; i++)
+    return __str_casecmpn(a.pstr, a.pstr + a.strlen, b.pstr, b.pstr + b.strlen);
+}
+
+/*@brief Splits the view around the first occurrence of pivot into views of the part before it, the pivot and the part after it.
+Returns 1 if pivot was found. Otherwise left is the whole view and mid and right are empty. Nothing is allocated or copied.*/
+int str_partition_v(str_view_t view, str_view_t pivot, str_view_t *left, str_view_t *mid, str_view_t *right)
+{
+    if (!left || !mid || !right)
     {
-        if (!(cstrings[i]))
-        {
-            STRFAIL("str_afrom: One of the strings in the cstrings array is null");
-        }
+        STRFAIL("str_partition_v: One of the passed addresses of output str_view_t variables was null.");
     }
-
-    sarr_t *parr = (sarr_t*)malloc(sizeof(sarr_t));
-    if (!parr)
+    if (!pivot.strlen)
     {
-        STRERROR("malloc");
+        STRFAIL("str_partition_v: The passed pivot was empty.");
     }
-    parr->strArr = (str_t**)malloc(sizeof(str_t*) * n);
-    if (!parr->strArr)
+    ssize_t at = str_index_v(view, pivot);
+    size_t beg = (at == -1) ? view.strlen : (size_t)at, end = (at == -1) ? view.strlen : beg + pivot.strlen;
+    *left = str_subview(view, 0, beg);
+    *mid = str_subview(view, beg, end);
+    *right = str_subview(view, end, view.strlen);
+    return at != -1;
+}
+
+/*@brief Splits the view around the last occurrence of pivot, like str_partition_v(). If pivot isn't found right is the whole view.*/
+int str_rpartition_v(str_view_t view, str_view_t pivot, str_view_t *left, str_view_t *mid, str_view_t *right)
+{
+    if (!left || !mid || !right)
     {
-        STRERROR("malloc");
+        STRFAIL("str_rpartition_v: One of the passed addresses of output str_view_t variables was null.");
     }
-    parr->size = n;
-    for (size_t i = 0; i < n; i++)
+    if (!pivot.strlen)
     {
-        parr->strArr[i] = str_newfrom(cstrings[i]);
+        STRFAIL("str_rpartition_v: The passed pivot was empty.");
     }
-    return parr;
+    ssize_t at = str_rindex_v(view, pivot);
+    size_t beg = (at == -1) ? 0 : (size_t)at, end = (at == -1) ? 0 : beg + pivot.strlen;
+    *left = str_subview(view, 0, beg);
+    *mid = str_subview(view, beg, end);
+    *right = str_subview(view, end, view.strlen);
+    return at != -1;
 }
 
-/*Safely free a sarr_t by passing the addres of a str_t* variable. The variable will be set to NULL afterwards.*/
-void str_afree(sarr_t **pparr)
+/*@brief Internal function that returns 1 if the view isn't empty and every character has one of the anyOf classes (or anyOf is 0) and
+none of the noneOf classes, which are STR_U8_* classes like in __str_u8all().*/
+int __str_viewall(str_view_t view, unsigned anyOf, unsigned noneOf)
 {
-    if (!pparr)
-    {
-        STRFAIL("str_afree: The passed address of a sarr_t* variable is null.");
-    }
-    if (!*pparr)
+    if (!view.pstr && view.strlen)
     {
-        return;
+        STRFAIL("str_is*_v: The address of the viewed characters was null.");
     }
-    if (!(*pparr)->strArr)
+    if (!view.strlen)
     {
-        (*pparr)->size = 0;
-        free(*pparr);
-        *pparr = NULL;
-        return;
+        return 0;
     }
-    for (size_t i = 0; i < (*pparr)->size; i++)
+    #ifdef DOOTSTR_USE_UTF8
+    return __str_u8all(view.pstr, view.pstr + view.strlen, anyOf, noneOf);
+    #else
+    for (size_t i = 0; i < view.strlen; i++)
     {
-        str_free((*pparr)->strArr + i);
+        #ifdef DOOTSTR_USE_WCHAR
+        wint_t c = view.pstr[i];
+        unsigned flags = (iswalpha(c) ? STR_U8_ALPHA : 0) | (iswdigit(c) ? STR_U8_DIGIT : 0) | (iswupper(c) ? STR_U8_UPPER : 0) |
+            (iswlower(c) ? STR_U8_LOWER : 0) | (iswspace(c) ? STR_U8_SPACE : 0);
+        #else
+        unsigned char c = view.pstr[i];
+        unsigned flags = (isalpha(c) ? STR_U8_ALPHA : 0) | (isdigit(c) ? STR_U8_DIGIT : 0) | (isupper(c) ? STR_U8_UPPER : 0) |
+            (islower(c) ? STR_U8_LOWER : 0) | (isspace(c) ? STR_U8_SPACE : 0);
+        #endif
+        if ((anyOf && !(flags & anyOf)) || (flags & noneOf))
+        {
+            return 0;
+        }
     }
-    free((*pparr)->strArr);
-    (*pparr)->strArr = NULL;
-    (*pparr)->size = 0;
-    free(*pparr);
-    *pparr = NULL;
+    return 1;
+    #endif
 }
 
-/*@brief Internal function that counts how many parts spliting the string by delim will result in.
-I have a feeling this is horribly written and could be rewritten to 1/2 the length. This is godawful, but works.*/
-size_t __str_countSplits(str_t *pstr, const dchar_t *delim, size_t *dsize)
+/*@brief Returns 1 if the view isn't empty and all of its characters are letters or digits.*/
+int str_isalnum_v(str_view_t view)
 {
-    if (!pstr)
+    return __str_viewall(view, STR_U8_ALPHA | STR_U8_DIGIT, 0);
+}
+
+/*@brief Returns 1 if the view isn't empty and all of its characters are letters.*/
+int str_isalpha_v(str_view_t view)
+{
+    return __str_viewall(view, STR_U8_ALPHA, 0);
+}
+
+/*@brief Returns 1 if the view isn't empty and all of its characters are digits.*/
+int str_isdigit_v(str_view_t view)
+{
+    return __str_viewall(view, STR_U8_DIGIT, 0);
+}
+
+/*@brief Returns 1 if the view has no upper case letters. Like str_islower() of an empty string, an empty view counts as lower case.*/
+int str_islower_v(str_view_t view)
+{
+    return !view.strlen || __str_viewall(view, 0, STR_U8_UPPER);
+}
+
+/*@brief Returns 1 if the view has no lower case letters. Like str_isupper() of an empty string, an empty view counts as upper case.*/
+int str_isupper_v(str_view_t view)
+{
+    return !view.strlen || __str_viewall(view, 0, STR_U8_LOWER);
+}
+
+/*@brief Returns 1 if the view isn't empty and all of its characters are white space.*/
+int str_isspace_v(str_view_t view)
+{
+    return __str_viewall(view, STR_U8_SPACE, 0);
+}
+#pragma endregion
+
+#pragma region EDITS
+/*
+Edit batches. Inserting into or cutting from a long string moves everything after the edit, so hundreds of small edits cost hundreds of
+passes over the string. A str_edits_t collects insertions, deletions and replacements at positions of the original string, and
+str_editsapply() builds the result in one pass and one allocation.
+Edits are applied in the order of their positions. At the same position the insertions come first, in the order they were added, and
+then the deletion or replacement that starts there. An insertion where a deletion ends comes after the deletion's replacement text.
+Deletions and replacements may touch (one ends where the next starts) but not overlap, and nothing may be inserted strictly inside a
+deleted range. Such batches are rejected with STR_ERR_OVERLAP.
+*/
+
+/*@brief Internal struct describing a single edit of a str_edits_t.*/
+typedef struct stredit
+{
+    size_t pos; /*Position in the original string*/
+    size_t len; /*Number of original characters removed from pos*/
+    size_t text; /*Offset of the inserted characters in the batch's text buffer*/
+    size_t textlen; /*Number of inserted characters*/
+    size_t order; /*Index of the edit in the order it was added*/
+} stredit_t;
+
+/** @struct str_edits_t
+ *  @brief A batch of edits of a string, applied all at once by str_editsapply(). The inserted characters are copied into the batch.
+ */
+typedef struct stredits
+{
+    stredit_t *edits; /*Array of the recorded edits*/
+    size_t count; /*Number of recorded edits*/
+    size_t capacity; /*Size of the edits array*/
+    dchar_t *text; /*Inserted characters of all edits*/
+    size_t textlen; /*Number of characters in text*/
+    size_t textcap; /*Size of the text buffer*/
+    int sorted; /*1 if the edits are in the order they are applied in*/
+} str_edits_t;
+
+/*@brief Returns a pointer to a new, empty batch of edits.*/
+str_edits_t *str_editsnew(void)
+{
+    str_edits_t *pe = (str_edits_t*)calloc(1, sizeof(str_edits_t));
+    if (!pe)
     {
-        STRFAIL("str_split: The passed address of str_t was null.");
+        STRERROR("calloc");
     }
-    if (pstr->strlen == 0)
+    pe->sorted = 1;
+    return pe;
+}
+
+/*@brief Forgets all edits, keeping the memory of the batch for reuse.*/
+void str_editsclear(str_edits_t *pe)
+{
+    if (!pe)
     {
-        return 0;
+        STRFAIL("str_editsclear: The address of a str_edits_t was null.");
     }
-    if (!delim)
+    pe->count = 0;
+    pe->textlen = 0;
+    pe->sorted = 1;
+}
+
+/*@brief Safely free a str_edits_t by passing the address of a pointer variable. The pointer will be set to null afterwards.*/
+void str_editsfree(str_edits_t **ppe)
+{
+    if (!ppe)
     {
-        STRFAIL("str_split: The passed delim is null.");
+        STRFAIL("str_editsfree: The address of a str_edits_t pointer variable was null.");
     }
-    if (!*delim)
+    if (!*ppe)
     {
-        return 1;
+        return;
     }
-    size_t dlen = _strlen(delim);
-    if (dsize)
+    free((*ppe)->edits);
+    free((*ppe)->text);
+    free(*ppe);
+    *ppe = NULL;
+}
+
+/*@brief Replaces the len characters at pos of the original string with the characters of a view. The characters are copied.*/
+void str_editreplace_v(str_edits_t *pe, size_t pos, size_t len, str_view_t view)
+{
+    if (!pe || (!view.pstr && view.strlen))
     {
-        *dsize = dlen;
+        STRFAIL("str_editreplace_v: The address of a str_edits_t or of the viewed characters was null.");
     }
-    const dchar_t *p = pstr->pstr, *plast = p;
-    size_t count = 0;
-    short anyDelim = 0;
-    while ((p = _strstr(p, delim)) != NULL)
+    (void)STR_UTF8_CHECK(view.pstr, view.strlen, "str_editreplace_v: The inserted text is not valid UTF-8.");
+    if (pe->count == pe->capacity)
     {
-        // Check if character to the left is not outside or part of another delim sequence
-        if (p == pstr->pstr || (plast + dlen >= p && anyDelim))
+        size_t newcap = (pe->capacity == 0) ? 16 : pe->capacity * 2;
+        stredit_t *newedits = (stredit_t*)realloc(pe->edits, sizeof(stredit_t) * newcap);
+        if (!newedits)
         {
-            anyDelim = 1;
-            plast = p;
-            p += dlen;
-            continue;
+            STRERROR("realloc");
         }
-        anyDelim = 1;
-        count++;
-        plast = p;
-        p += dlen;
+        pe->edits = newedits;
+        pe->capacity = newcap;
     }
-    if (plast == pstr->pstr)
+    if (pe->textcap - pe->textlen < view.strlen)
     {
-        //There was either no delim or a single delim at the beginning or 
-        if (anyDelim)
+        size_t newcap = STR_NEWCAPACITY(pe->textlen + view.strlen);
+        dchar_t *newtext = (dchar_t*)realloc(pe->text, sizeof(dchar_t) * newcap);
+        if (!newtext)
         {
-            return pstr->strlen > dlen;
+            STRERROR("realloc");
         }
-        return 1;
+        pe->text = newtext;
+        pe->textcap = newcap;
     }
-    if (plast + dlen - pstr->pstr < pstr->strlen)
+    if (view.strlen)
     {
-        count ++; // Count the last one
+        memcpy(pe->text + pe->textlen, view.pstr, view.strlen * sizeof(dchar_t));
     }
-    return count;
+    stredit_t *ped = pe->edits + pe->count;
+    ped->pos = pos;
+    ped->len = len;
+    ped->text = pe->textlen;
+    ped->textlen = view.strlen;
+    ped->order = pe->count;
+    if (pe->count > 0 && (pos < ped[-1].pos || (pos == ped[-1].pos && len == 0 && ped[-1].len != 0)))
+    {
+        pe->sorted = 0;
+    }
+    pe->textlen += view.strlen;
+    pe->count++;
 }
 
-/*@brief Splits the string by delim and returns an array (sarr_t) of resulting strings.*/
-sarr_t *str_split(str_t *pstr, const dchar_t *delim)
+/*@brief Replaces the len characters at pos of the original string with a c string.*/
+void str_editreplace(str_edits_t *pe, size_t pos, size_t len, const dchar_t *cstring)
 {
-    size_t dlen;
-    size_t numSplits = __str_countSplits(pstr, delim, &dlen);
-    sarr_t *parr = (sarr_t*)malloc(sizeof(sarr_t));
-    if (!parr)
-    {
-        STRERROR("malloc");
-    }
-    parr->size = numSplits;
-    if (parr->size == 0)
+    if (!cstring)
     {
-        parr->strArr = NULL;
-        return parr;
+        STRFAIL("str_editreplace: The address of a c string was null.");
     }
+    str_editreplace_v(pe, pos, len, str_view_c(cstring));
+}
 
-    parr->strArr = (str_t**)malloc(sizeof(str_t*)*parr->size);
-    if (!parr->strArr)
-    {
-        STRERROR("malloc");
-    }
-    if (parr->size == 1)
-    {
-        parr->strArr[0] = str_newfrom(pstr->pstr);
-        return parr;
-    }
-    parr->strArr = (str_t**)malloc(sizeof(str_t*)*parr->size);
-    if (!parr->strArr)
+/*@brief Inserts a c string before the character at pos of the original string (pos can be its length).*/
+void str_editinsert(str_edits_t *pe, size_t pos, const dchar_t *cstring)
+{
+    if (!cstring)
     {
-        STRERROR("malloc");
+        STRFAIL("str_editinsert: The address of a c string was null.");
     }
-    
-    // size_t dlen = _strlen(dlen);
-    // size_t ind = 0;
-    // const dchar_t *p = pstr->pstr;
-    // const dchar_t *plast = p;
-    // while ((p = _strstr(p, delim)) != NULL)
-    // {
-    //     //parr->strArr[ind] = str_newslice(plast, dlen, p - plast);
-    //     plast = p;
-    //     p++;
-    //     ind++;
-
-    // }
-    return NULL;
+    str_editreplace_v(pe, pos, 0, str_view_c(cstring));
 }
 
-/*
-splitlines()
-join()
-split => returns a string array with a size
-*/
-
-typedef struct dootview
+/*@brief Inserts the characters of a view before the character at pos of the original string.*/
+void str_editinsert_v(str_edits_t *pe, size_t pos, str_view_t view)
 {
-    int x;
-    // Struct that contains state of a str_t search, view, tokenization or alike
-} dootview_t;
-
-/* HOW IT'S MEANT TO BE USED:
-dootview_t view;
-str_setview(&view, str_t string);
-for ...
-    str_t *token = str_nextok(&view, delimset)
+    str_editreplace_v(pe, pos, 0, view);
+}
 
-*/
-#pragma endregion
+/*@brief Deletes the len characters at pos of the original string.*/
+void str_editdelete(str_edits_t *pe, size_t pos, size_t len)
+{
+    str_editreplace_v(pe, pos, len, str_viewn(NULL, 0));
+}
 
-#pragma region VIEWING
-/*Safely access the i-th string character with bound checking and from-the-end indexing support.*/
-char str_at(str_t* pstr, size_t i)
+/*@brief Internal comparison for qsort() that orders edits by position, insertions before deletions at the same position and otherwise
+in the order they were added.*/
+int __str_editcmp(const void *a, const void *b)
 {
-    size_t boundInd = __str_boundIndex(i, pstr->strlen);
-    if (boundInd > pstr->strlen)
+    const stredit_t *pa = (const stredit_t*)a, *pb = (const stredit_t*)b;
+    if (pa->pos != pb->pos)
     {
-        STRFAIL("str_at: Index is out of bounds from the right side.");
+        return (pa->pos < pb->pos) ? -1 : 1;
     }
-    return pstr->pstr[boundInd];
+    if ((pa->len != 0) != (pb->len != 0))
+    {
+        return (pa->len != 0) ? 1 : -1;
+    }
+    return (pa->order < pb->order) ? -1 : (pa->order > pb->order);
 }
-#pragma endregion
 
-#pragma region FORMATTING
-//Time to do this bitch... later
-void str_format()
+/*@brief Applies all edits of the batch to the string in one pass, with a single allocation. Positions refer to the string as it is
+before the call. Returns STR_ERR_INDEX if an edit goes past the end of the string and STR_ERR_OVERLAP if two edits overlap (see the
+top of the EDITS region), and leaves the string unchanged then. The batch stays as it is, so it can be applied again or cleared.*/
+str_err_t str_editsapply(str_edits_t *pe, str_t *pstr)
 {
-
+    if (!pe || !pstr)
+    {
+        STRFAIL("str_editsapply: The address of a str_edits_t or a str_t was null.");
+    }
+    if (pe->count == 0)
+    {
+        return STR_OK;
+    }
+    if (!pe->sorted)
+    {
+        qsort(pe->edits, pe->count, sizeof(stredit_t), __str_editcmp);
+        pe->sorted = 1;
+    }
+    size_t removed = 0, end = 0; // end is where the last deletion so far ends
+    for (size_t i = 0; i < pe->count; i++)
+    {
+        const stredit_t *ped = pe->edits + i;
+        if (ped->pos > pstr->strlen || ped->len > pstr->strlen - ped->pos)
+        {
+            return STR_ERR_INDEX;
+        }
+        if (ped->pos < end)
+        {
+            return STR_ERR_OVERLAP;
+        }
+        if (ped->len)
+        {
+            end = ped->pos + ped->len;
+        }
+        removed += ped->len;
+    }
+    size_t newlen = pstr->strlen - removed + pe->textlen;
+    (void)STR_EXPR_TESTOVERFLOW((newlen + 1) / 2);
+    __str_mutate(pstr, pe->edits[0].pos);
+    size_t blocksize = newlen + 1;
+    dchar_t *newblock = __str_blockalloc(&blocksize);
+    STR_STAT_REALLOC(STR_CALLER, pstr->pstr, blocksize, newlen + 1);
+    const dchar_t *src = pstr->pstr ? pstr->pstr : STR_EMPTY;
+    dchar_t *w = newblock;
+    size_t from = 0; // Original characters before from were already copied or deleted
+    for (size_t i = 0; i < pe->count; i++)
+    {
+        const stredit_t *ped = pe->edits + i;
+        memcpy(w, src + from, (ped->pos - from) * sizeof(dchar_t));
+        w += ped->pos - from;
+        if (ped->textlen) // Batches of deletions only don't have a text buffer
+        {
+            memcpy(w, pe->text + ped->text, ped->textlen * sizeof(dchar_t));
+            w += ped->textlen;
+        }
+        from = ped->pos + ped->len;
+    }
+    memcpy(w, src + from, (pstr->strlen - from) * sizeof(dchar_t));
+    newblock[newlen] = '\0';
+    __str_dropblock(pstr);
+    pstr->pstr = newblock;
+    pstr->strlen = newlen;
+    pstr->capacity = blocksize;
+    return STR_OK;
 }
 #pragma endregion
 
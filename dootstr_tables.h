@@ -0,0 +1,5019 @@
+/*
+Generated by tools/gentables.py, do not edit by hand.
+*/
+
+#ifndef __DOOTSTR_TABLES_INC
+#define __DOOTSTR_TABLES_INC
+
+#include <stdint.h>
+
+/*128-bit truncated powers of five from 5^-342 to 5^308, high word first*/
+const uint64_t __str_pow5_128[1302] = {
+    0xeef453d6923bd65aULL, 0x113faa2906a13b3fULL, 0x9558b4661b6565f8ULL, 0x4ac7ca59a424c507ULL,
+    0xbaaee17fa23ebf76ULL, 0x5d79bcf00d2df649ULL, 0xe95a99df8ace6f53ULL, 0xf4d82c2c107973dcULL,
+    0x91d8a02bb6c10594ULL, 0x79071b9b8a4be869ULL, 0xb64ec836a47146f9ULL, 0x9748e2826cdee284ULL,
+    0xe3e27a444d8d98b7ULL, 0xfd1b1b2308169b25ULL, 0x8e6d8c6ab0787f72ULL, 0xfe30f0f5e50e20f7ULL,
+    0xb208ef855c969f4fULL, 0xbdbd2d335e51a935ULL, 0xde8b2b66b3bc4723ULL, 0xad2c788035e61382ULL,
+    0x8b16fb203055ac76ULL, 0x4c3bcb5021afcc31ULL, 0xaddcb9e83c6b1793ULL, 0xdf4abe242a1bbf3dULL,
+    0xd953e8624b85dd78ULL, 0xd71d6dad34a2af0dULL, 0x87d4713d6f33aa6bULL, 0x8672648c40e5ad68ULL,
+    0xa9c98d8ccb009506ULL, 0x680efdaf511f18c2ULL, 0xd43bf0effdc0ba48ULL, 0x0212bd1b2566def2ULL,
+    0x84a57695fe98746dULL, 0x014bb630f7604b57ULL, 0xa5ced43b7e3e9188ULL, 0x419ea3bd35385e2dULL,
+    0xcf42894a5dce35eaULL, 0x52064cac828675b9ULL, 0x818995ce7aa0e1b2ULL, 0x7343efebd1940993ULL,
+    0xa1ebfb4219491a1fULL, 0x1014ebe6c5f90bf8ULL, 0xca66fa129f9b60a6ULL, 0xd41a26e077774ef6ULL,
+    0xfd00b897478238d0ULL, 0x8920b098955522b4ULL, 0x9e20735e8cb16382ULL, 0x55b46e5f5d5535b0ULL,
+    0xc5a890362fddbc62ULL, 0xeb2189f734aa831dULL, 0xf712b443bbd52b7bULL, 0xa5e9ec7501d523e4ULL,
+    0x9a6bb0aa55653b2dULL, 0x47b233c92125366eULL, 0xc1069cd4eabe89f8ULL, 0x999ec0bb696e840aULL,
+    0xf148440a256e2c76ULL, 0xc00670ea43ca250dULL, 0x96cd2a865764dbcaULL, 0x380406926a5e5728ULL,
+    0xbc807527ed3e12bcULL, 0xc605083704f5ecf2ULL, 0xeba09271e88d976bULL, 0xf7864a44c633682eULL,
+    0x93445b8731587ea3ULL, 0x7ab3ee6afbe0211dULL, 0xb8157268fdae9e4cULL, 0x5960ea05bad82964ULL,
+    0xe61acf033d1a45dfULL, 0x6fb92487298e33bdULL, 0x8fd0c16206306babULL, 0xa5d3b6d479f8e056ULL,
+    0xb3c4f1ba87bc8696ULL, 0x8f48a4899877186cULL, 0xe0b62e2929aba83cULL, 0x331acdabfe94de87ULL,
+    0x8c71dcd9ba0b4925ULL, 0x9ff0c08b7f1d0b14ULL, 0xaf8e5410288e1b6fULL, 0x07ecf0ae5ee44dd9ULL,
+    0xdb71e91432b1a24aULL, 0xc9e82cd9f69d6150ULL, 0x892731ac9faf056eULL, 0xbe311c083a225cd2ULL,
+    0xab70fe17c79ac6caULL, 0x6dbd630a48aaf406ULL, 0xd64d3d9db981787dULL, 0x092cbbccdad5b108ULL,
+    0x85f0468293f0eb4eULL, 0x25bbf56008c58ea5ULL, 0xa76c582338ed2621ULL, 0xaf2af2b80af6f24eULL,
+    0xd1476e2c07286faaULL, 0x1af5af660db4aee1ULL, 0x82cca4db847945caULL, 0x50d98d9fc890ed4dULL,
+    0xa37fce126597973cULL, 0xe50ff107bab528a0ULL, 0xcc5fc196fefd7d0cULL, 0x1e53ed49a96272c8ULL,
+    0xff77b1fcbebcdc4fULL, 0x25e8e89c13bb0f7aULL, 0x9faacf3df73609b1ULL, 0x77b191618c54e9acULL,
+    0xc795830d75038c1dULL, 0xd59df5b9ef6a2417ULL, 0xf97ae3d0d2446f25ULL, 0x4b0573286b44ad1dULL,
+    0x9becce62836ac577ULL, 0x4ee367f9430aec32ULL, 0xc2e801fb244576d5ULL, 0x229c41f793cda73fULL,
+    0xf3a20279ed56d48aULL, 0x6b43527578c1110fULL, 0x9845418c345644d6ULL, 0x830a13896b78aaa9ULL,
+    0xbe5691ef416bd60cULL, 0x23cc986bc656d553ULL, 0xedec366b11c6cb8fULL, 0x2cbfbe86b7ec8aa8ULL,
+    0x94b3a202eb1c3f39ULL, 0x7bf7d71432f3d6a9ULL, 0xb9e08a83a5e34f07ULL, 0xdaf5ccd93fb0cc53ULL,
+    0xe858ad248f5c22c9ULL, 0xd1b3400f8f9cff68ULL, 0x91376c36d99995beULL, 0x23100809b9c21fa1ULL,
+    0xb58547448ffffb2dULL, 0xabd40a0c2832a78aULL, 0xe2e69915b3fff9f9ULL, 0x16c90c8f323f516cULL,
+    0x8dd01fad907ffc3bULL, 0xae3da7d97f6792e3ULL, 0xb1442798f49ffb4aULL, 0x99cd11cfdf41779cULL,
+    0xdd95317f31c7fa1dULL, 0x40405643d711d583ULL, 0x8a7d3eef7f1cfc52ULL, 0x482835ea666b2572ULL,
+    0xad1c8eab5ee43b66ULL, 0xda3243650005eecfULL, 0xd863b256369d4a40ULL, 0x90bed43e40076a82ULL,
+    0x873e4f75e2224e68ULL, 0x5a7744a6e804a291ULL, 0xa90de3535aaae202ULL, 0x711515d0a205cb36ULL,
+    0xd3515c2831559a83ULL, 0x0d5a5b44ca873e03ULL, 0x8412d9991ed58091ULL, 0xe858790afe9486c2ULL,
+    0xa5178fff668ae0b6ULL, 0x626e974dbe39a872ULL, 0xce5d73ff402d98e3ULL, 0xfb0a3d212dc8128fULL,
+    0x80fa687f881c7f8eULL, 0x7ce66634bc9d0b99ULL, 0xa139029f6a239f72ULL, 0x1c1fffc1ebc44e80ULL,
+    0xc987434744ac874eULL, 0xa327ffb266b56220ULL, 0xfbe9141915d7a922ULL, 0x4bf1ff9f0062baa8ULL,
+    0x9d71ac8fada6c9b5ULL, 0x6f773fc3603db4a9ULL, 0xc4ce17b399107c22ULL, 0xcb550fb4384d21d3ULL,
+    0xf6019da07f549b2bULL, 0x7e2a53a146606a48ULL, 0x99c102844f94e0fbULL, 0x2eda7444cbfc426dULL,
+    0xc0314325637a1939ULL, 0xfa911155fefb5308ULL, 0xf03d93eebc589f88ULL, 0x793555ab7eba27caULL,
+    0x96267c7535b763b5ULL, 0x4bc1558b2f3458deULL, 0xbbb01b9283253ca2ULL, 0x9eb1aaedfb016f16ULL,
+    0xea9c227723ee8bcbULL, 0x465e15a979c1cadcULL, 0x92a1958a7675175fULL, 0x0bfacd89ec191ec9ULL,
+    0xb749faed14125d36ULL, 0xcef980ec671f667bULL, 0xe51c79a85916f484ULL, 0x82b7e12780e7401aULL,
+    0x8f31cc0937ae58d2ULL, 0xd1b2ecb8b0908810ULL, 0xb2fe3f0b8599ef07ULL, 0x861fa7e6dcb4aa15ULL,
+    0xdfbdcece67006ac9ULL, 0x67a791e093e1d49aULL, 0x8bd6a141006042bdULL, 0xe0c8bb2c5c6d24e0ULL,
+    0xaecc49914078536dULL, 0x58fae9f773886e18ULL, 0xda7f5bf590966848ULL, 0xaf39a475506a899eULL,
+    0x888f99797a5e012dULL, 0x6d8406c952429603ULL, 0xaab37fd7d8f58178ULL, 0xc8e5087ba6d33b83ULL,
+    0xd5605fcdcf32e1d6ULL, 0xfb1e4a9a90880a64ULL, 0x855c3be0a17fcd26ULL, 0x5cf2eea09a55067fULL,
+    0xa6b34ad8c9dfc06fULL, 0xf42faa48c0ea481eULL, 0xd0601d8efc57b08bULL, 0xf13b94daf124da26ULL,
+    0x823c12795db6ce57ULL, 0x76c53d08d6b70858ULL, 0xa2cb1717b52481edULL, 0x54768c4b0c64ca6eULL,
+    0xcb7ddcdda26da268ULL, 0xa9942f5dcf7dfd09ULL, 0xfe5d54150b090b02ULL, 0xd3f93b35435d7c4cULL,
+    0x9efa548d26e5a6e1ULL, 0xc47bc5014a1a6dafULL, 0xc6b8e9b0709f109aULL, 0x359ab6419ca1091bULL,
+    0xf867241c8cc6d4c0ULL, 0xc30163d203c94b62ULL, 0x9b407691d7fc44f8ULL, 0x79e0de63425dcf1dULL,
+    0xc21094364dfb5636ULL, 0x985915fc12f542e4ULL, 0xf294b943e17a2bc4ULL, 0x3e6f5b7b17b2939dULL,
+    0x979cf3ca6cec5b5aULL, 0xa705992ceecf9c42ULL, 0xbd8430bd08277231ULL, 0x50c6ff782a838353ULL,
+    0xece53cec4a314ebdULL, 0xa4f8bf5635246428ULL, 0x940f4613ae5ed136ULL, 0x871b7795e136be99ULL,
+    0xb913179899f68584ULL, 0x28e2557b59846e3fULL, 0xe757dd7ec07426e5ULL, 0x331aeada2fe589cfULL,
+    0x9096ea6f3848984fULL, 0x3ff0d2c85def7621ULL, 0xb4bca50b065abe63ULL, 0x0fed077a756b53a9ULL,
+    0xe1ebce4dc7f16dfbULL, 0xd3e8495912c62894ULL, 0x8d3360f09cf6e4bdULL, 0x64712dd7abbbd95cULL,
+    0xb080392cc4349decULL, 0xbd8d794d96aacfb3ULL, 0xdca04777f541c567ULL, 0xecf0d7a0fc5583a0ULL,
+    0x89e42caaf9491b60ULL, 0xf41686c49db57244ULL, 0xac5d37d5b79b6239ULL, 0x311c2875c522ced5ULL,
+    0xd77485cb25823ac7ULL, 0x7d633293366b828bULL, 0x86a8d39ef77164bcULL, 0xae5dff9c02033197ULL,
+    0xa8530886b54dbdebULL, 0xd9f57f830283fdfcULL, 0xd267caa862a12d66ULL, 0xd072df63c324fd7bULL,
+    0x8380dea93da4bc60ULL, 0x4247cb9e59f71e6dULL, 0xa46116538d0deb78ULL, 0x52d9be85f074e608ULL,
+    0xcd795be870516656ULL, 0x67902e276c921f8bULL, 0x806bd9714632dff6ULL, 0x00ba1cd8a3db53b6ULL,
+    0xa086cfcd97bf97f3ULL, 0x80e8a40eccd228a4ULL, 0xc8a883c0fdaf7df0ULL, 0x6122cd128006b2cdULL,
+    0xfad2a4b13d1b5d6cULL, 0x796b805720085f81ULL, 0x9cc3a6eec6311a63ULL, 0xcbe3303674053bb0ULL,
+    0xc3f490aa77bd60fcULL, 0xbedbfc4411068a9cULL, 0xf4f1b4d515acb93bULL, 0xee92fb5515482d44ULL,
+    0x991711052d8bf3c5ULL, 0x751bdd152d4d1c4aULL, 0xbf5cd54678eef0b6ULL, 0xd262d45a78a0635dULL,
+    0xef340a98172aace4ULL, 0x86fb897116c87c34ULL, 0x9580869f0e7aac0eULL, 0xd45d35e6ae3d4da0ULL,
+    0xbae0a846d2195712ULL, 0x8974836059cca109ULL, 0xe998d258869facd7ULL, 0x2bd1a438703fc94bULL,
+    0x91ff83775423cc06ULL, 0x7b6306a34627ddcfULL, 0xb67f6455292cbf08ULL, 0x1a3bc84c17b1d542ULL,
+    0xe41f3d6a7377eecaULL, 0x20caba5f1d9e4a93ULL, 0x8e938662882af53eULL, 0x547eb47b7282ee9cULL,
+    0xb23867fb2a35b28dULL, 0xe99e619a4f23aa43ULL, 0xdec681f9f4c31f31ULL, 0x6405fa00e2ec94d4ULL,
+    0x8b3c113c38f9f37eULL, 0xde83bc408dd3dd04ULL, 0xae0b158b4738705eULL, 0x9624ab50b148d445ULL,
+    0xd98ddaee19068c76ULL, 0x3badd624dd9b0957ULL, 0x87f8a8d4cfa417c9ULL, 0xe54ca5d70a80e5d6ULL,
+    0xa9f6d30a038d1dbcULL, 0x5e9fcf4ccd211f4cULL, 0xd47487cc8470652bULL, 0x7647c3200069671fULL,
+    0x84c8d4dfd2c63f3bULL, 0x29ecd9f40041e073ULL, 0xa5fb0a17c777cf09ULL, 0xf468107100525890ULL,
+    0xcf79cc9db955c2ccULL, 0x7182148d4066eeb4ULL, 0x81ac1fe293d599bfULL, 0xc6f14cd848405530ULL,
+    0xa21727db38cb002fULL, 0xb8ada00e5a506a7cULL, 0xca9cf1d206fdc03bULL, 0xa6d90811f0e4851cULL,
+    0xfd442e4688bd304aULL, 0x908f4a166d1da663ULL, 0x9e4a9cec15763e2eULL, 0x9a598e4e043287feULL,
+    0xc5dd44271ad3cdbaULL, 0x40eff1e1853f29fdULL, 0xf7549530e188c128ULL, 0xd12bee59e68ef47cULL,
+    0x9a94dd3e8cf578b9ULL, 0x82bb74f8301958ceULL, 0xc13a148e3032d6e7ULL, 0xe36a52363c1faf01ULL,
+    0xf18899b1bc3f8ca1ULL, 0xdc44e6c3cb279ac1ULL, 0x96f5600f15a7b7e5ULL, 0x29ab103a5ef8c0b9ULL,
+    0xbcb2b812db11a5deULL, 0x7415d448f6b6f0e7ULL, 0xebdf661791d60f56ULL, 0x111b495b3464ad21ULL,
+    0x936b9fcebb25c995ULL, 0xcab10dd900beec34ULL, 0xb84687c269ef3bfbULL, 0x3d5d514f40eea742ULL,
+    0xe65829b3046b0afaULL, 0x0cb4a5a3112a5112ULL, 0x8ff71a0fe2c2e6dcULL, 0x47f0e785eaba72abULL,
+    0xb3f4e093db73a093ULL, 0x59ed216765690f56ULL, 0xe0f218b8d25088b8ULL, 0x306869c13ec3532cULL,
+    0x8c974f7383725573ULL, 0x1e414218c73a13fbULL, 0xafbd2350644eeacfULL, 0xe5d1929ef90898faULL,
+    0xdbac6c247d62a583ULL, 0xdf45f746b74abf39ULL, 0x894bc396ce5da772ULL, 0x6b8bba8c328eb783ULL,
+    0xab9eb47c81f5114fULL, 0x066ea92f3f326564ULL, 0xd686619ba27255a2ULL, 0xc80a537b0efefebdULL,
+    0x8613fd0145877585ULL, 0xbd06742ce95f5f36ULL, 0xa798fc4196e952e7ULL, 0x2c48113823b73704ULL,
+    0xd17f3b51fca3a7a0ULL, 0xf75a15862ca504c5ULL, 0x82ef85133de648c4ULL, 0x9a984d73dbe722fbULL,
+    0xa3ab66580d5fdaf5ULL, 0xc13e60d0d2e0ebbaULL, 0xcc963fee10b7d1b3ULL, 0x318df905079926a8ULL,
+    0xffbbcfe994e5c61fULL, 0xfdf17746497f7052ULL, 0x9fd561f1fd0f9bd3ULL, 0xfeb6ea8bedefa633ULL,
+    0xc7caba6e7c5382c8ULL, 0xfe64a52ee96b8fc0ULL, 0xf9bd690a1b68637bULL, 0x3dfdce7aa3c673b0ULL,
+    0x9c1661a651213e2dULL, 0x06bea10ca65c084eULL, 0xc31bfa0fe5698db8ULL, 0x486e494fcff30a62ULL,
+    0xf3e2f893dec3f126ULL, 0x5a89dba3c3efccfaULL, 0x986ddb5c6b3a76b7ULL, 0xf89629465a75e01cULL,
+    0xbe89523386091465ULL, 0xf6bbb397f1135823ULL, 0xee2ba6c0678b597fULL, 0x746aa07ded582e2cULL,
+    0x94db483840b717efULL, 0xa8c2a44eb4571cdcULL, 0xba121a4650e4ddebULL, 0x92f34d62616ce413ULL,
+    0xe896a0d7e51e1566ULL, 0x77b020baf9c81d17ULL, 0x915e2486ef32cd60ULL, 0x0ace1474dc1d122eULL,
+    0xb5b5ada8aaff80b8ULL, 0x0d819992132456baULL, 0xe3231912d5bf60e6ULL, 0x10e1fff697ed6c69ULL,
+    0x8df5efabc5979c8fULL, 0xca8d3ffa1ef463c1ULL, 0xb1736b96b6fd83b3ULL, 0xbd308ff8a6b17cb2ULL,
+    0xddd0467c64bce4a0ULL, 0xac7cb3f6d05ddbdeULL, 0x8aa22c0dbef60ee4ULL, 0x6bcdf07a423aa96bULL,
+    0xad4ab7112eb3929dULL, 0x86c16c98d2c953c6ULL, 0xd89d64d57a607744ULL, 0xe871c7bf077ba8b7ULL,
+    0x87625f056c7c4a8bULL, 0x11471cd764ad4972ULL, 0xa93af6c6c79b5d2dULL, 0xd598e40d3dd89bcfULL,
+    0xd389b47879823479ULL, 0x4aff1d108d4ec2c3ULL, 0x843610cb4bf160cbULL, 0xcedf722a585139baULL,
+    0xa54394fe1eedb8feULL, 0xc2974eb4ee658828ULL, 0xce947a3da6a9273eULL, 0x733d226229feea32ULL,
+    0x811ccc668829b887ULL, 0x0806357d5a3f525fULL, 0xa163ff802a3426a8ULL, 0xca07c2dcb0cf26f7ULL,
+    0xc9bcff6034c13052ULL, 0xfc89b393dd02f0b5ULL, 0xfc2c3f3841f17c67ULL, 0xbbac2078d443ace2ULL,
+    0x9d9ba7832936edc0ULL, 0xd54b944b84aa4c0dULL, 0xc5029163f384a931ULL, 0x0a9e795e65d4df11ULL,
+    0xf64335bcf065d37dULL, 0x4d4617b5ff4a16d5ULL, 0x99ea0196163fa42eULL, 0x504bced1bf8e4e45ULL,
+    0xc06481fb9bcf8d39ULL, 0xe45ec2862f71e1d6ULL, 0xf07da27a82c37088ULL, 0x5d767327bb4e5a4cULL,
+    0x964e858c91ba2655ULL, 0x3a6a07f8d510f86fULL, 0xbbe226efb628afeaULL, 0x890489f70a55368bULL,
+    0xeadab0aba3b2dbe5ULL, 0x2b45ac74ccea842eULL, 0x92c8ae6b464fc96fULL, 0x3b0b8bc90012929dULL,
+    0xb77ada0617e3bbcbULL, 0x09ce6ebb40173744ULL, 0xe55990879ddcaabdULL, 0xcc420a6a101d0515ULL,
+    0x8f57fa54c2a9eab6ULL, 0x9fa946824a12232dULL, 0xb32df8e9f3546564ULL, 0x47939822dc96abf9ULL,
+    0xdff9772470297ebdULL, 0x59787e2b93bc56f7ULL, 0x8bfbea76c619ef36ULL, 0x57eb4edb3c55b65aULL,
+    0xaefae51477a06b03ULL, 0xede622920b6b23f1ULL, 0xdab99e59958885c4ULL, 0xe95fab368e45ecedULL,
+    0x88b402f7fd75539bULL, 0x11dbcb0218ebb414ULL, 0xaae103b5fcd2a881ULL, 0xd652bdc29f26a119ULL,
+    0xd59944a37c0752a2ULL, 0x4be76d3346f0495fULL, 0x857fcae62d8493a5ULL, 0x6f70a4400c562ddbULL,
+    0xa6dfbd9fb8e5b88eULL, 0xcb4ccd500f6bb952ULL, 0xd097ad07a71f26b2ULL, 0x7e2000a41346a7a7ULL,
+    0x825ecc24c873782fULL, 0x8ed400668c0c28c8ULL, 0xa2f67f2dfa90563bULL, 0x728900802f0f32faULL,
+    0xcbb41ef979346bcaULL, 0x4f2b40a03ad2ffb9ULL, 0xfea126b7d78186bcULL, 0xe2f610c84987bfa8ULL,
+    0x9f24b832e6b0f436ULL, 0x0dd9ca7d2df4d7c9ULL, 0xc6ede63fa05d3143ULL, 0x91503d1c79720dbbULL,
+    0xf8a95fcf88747d94ULL, 0x75a44c6397ce912aULL, 0x9b69dbe1b548ce7cULL, 0xc986afbe3ee11abaULL,
+    0xc24452da229b021bULL, 0xfbe85badce996168ULL, 0xf2d56790ab41c2a2ULL, 0xfae27299423fb9c3ULL,
+    0x97c560ba6b0919a5ULL, 0xdccd879fc967d41aULL, 0xbdb6b8e905cb600fULL, 0x5400e987bbc1c920ULL,
+    0xed246723473e3813ULL, 0x290123e9aab23b68ULL, 0x9436c0760c86e30bULL, 0xf9a0b6720aaf6521ULL,
+    0xb94470938fa89bceULL, 0xf808e40e8d5b3e69ULL, 0xe7958cb87392c2c2ULL, 0xb60b1d1230b20e04ULL,
+    0x90bd77f3483bb9b9ULL, 0xb1c6f22b5e6f48c2ULL, 0xb4ecd5f01a4aa828ULL, 0x1e38aeb6360b1af3ULL,
+    0xe2280b6c20dd5232ULL, 0x25c6da63c38de1b0ULL, 0x8d590723948a535fULL, 0x579c487e5a38ad0eULL,
+    0xb0af48ec79ace837ULL, 0x2d835a9df0c6d851ULL, 0xdcdb1b2798182244ULL, 0xf8e431456cf88e65ULL,
+    0x8a08f0f8bf0f156bULL, 0x1b8e9ecb641b58ffULL, 0xac8b2d36eed2dac5ULL, 0xe272467e3d222f3fULL,
+    0xd7adf884aa879177ULL, 0x5b0ed81dcc6abb0fULL, 0x86ccbb52ea94baeaULL, 0x98e947129fc2b4e9ULL,
+    0xa87fea27a539e9a5ULL, 0x3f2398d747b36224ULL, 0xd29fe4b18e88640eULL, 0x8eec7f0d19a03aadULL,
+    0x83a3eeeef9153e89ULL, 0x1953cf68300424acULL, 0xa48ceaaab75a8e2bULL, 0x5fa8c3423c052dd7ULL,
+    0xcdb02555653131b6ULL, 0x3792f412cb06794dULL, 0x808e17555f3ebf11ULL, 0xe2bbd88bbee40bd0ULL,
+    0xa0b19d2ab70e6ed6ULL, 0x5b6aceaeae9d0ec4ULL, 0xc8de047564d20a8bULL, 0xf245825a5a445275ULL,
+    0xfb158592be068d2eULL, 0xeed6e2f0f0d56712ULL, 0x9ced737bb6c4183dULL, 0x55464dd69685606bULL,
+    0xc428d05aa4751e4cULL, 0xaa97e14c3c26b886ULL, 0xf53304714d9265dfULL, 0xd53dd99f4b3066a8ULL,
+    0x993fe2c6d07b7fabULL, 0xe546a8038efe4029ULL, 0xbf8fdb78849a5f96ULL, 0xde98520472bdd033ULL,
+    0xef73d256a5c0f77cULL, 0x963e66858f6d4440ULL, 0x95a8637627989aadULL, 0xdde7001379a44aa8ULL,
+    0xbb127c53b17ec159ULL, 0x5560c018580d5d52ULL, 0xe9d71b689dde71afULL, 0xaab8f01e6e10b4a6ULL,
+    0x9226712162ab070dULL, 0xcab3961304ca70e8ULL, 0xb6b00d69bb55c8d1ULL, 0x3d607b97c5fd0d22ULL,
+    0xe45c10c42a2b3b05ULL, 0x8cb89a7db77c506aULL, 0x8eb98a7a9a5b04e3ULL, 0x77f3608e92adb242ULL,
+    0xb267ed1940f1c61cULL, 0x55f038b237591ed3ULL, 0xdf01e85f912e37a3ULL, 0x6b6c46dec52f6688ULL,
+    0x8b61313bbabce2c6ULL, 0x2323ac4b3b3da015ULL, 0xae397d8aa96c1b77ULL, 0xabec975e0a0d081aULL,
+    0xd9c7dced53c72255ULL, 0x96e7bd358c904a21ULL, 0x881cea14545c7575ULL, 0x7e50d64177da2e54ULL,
+    0xaa242499697392d2ULL, 0xdde50bd1d5d0b9e9ULL, 0xd4ad2dbfc3d07787ULL, 0x955e4ec64b44e864ULL,
+    0x84ec3c97da624ab4ULL, 0xbd5af13bef0b113eULL, 0xa6274bbdd0fadd61ULL, 0xecb1ad8aeacdd58eULL,
+    0xcfb11ead453994baULL, 0x67de18eda5814af2ULL, 0x81ceb32c4b43fcf4ULL, 0x80eacf948770ced7ULL,
+    0xa2425ff75e14fc31ULL, 0xa1258379a94d028dULL, 0xcad2f7f5359a3b3eULL, 0x096ee45813a04330ULL,
+    0xfd87b5f28300ca0dULL, 0x8bca9d6e188853fcULL, 0x9e74d1b791e07e48ULL, 0x775ea264cf55347eULL,
+    0xc612062576589ddaULL, 0x95364afe032a819eULL, 0xf79687aed3eec551ULL, 0x3a83ddbd83f52205ULL,
+    0x9abe14cd44753b52ULL, 0xc4926a9672793543ULL, 0xc16d9a0095928a27ULL, 0x75b7053c0f178294ULL,
+    0xf1c90080baf72cb1ULL, 0x5324c68b12dd6339ULL, 0x971da05074da7beeULL, 0xd3f6fc16ebca5e04ULL,
+    0xbce5086492111aeaULL, 0x88f4bb1ca6bcf585ULL, 0xec1e4a7db69561a5ULL, 0x2b31e9e3d06c32e6ULL,
+    0x9392ee8e921d5d07ULL, 0x3aff322e62439fd0ULL, 0xb877aa3236a4b449ULL, 0x09befeb9fad487c3ULL,
+    0xe69594bec44de15bULL, 0x4c2ebe687989a9b4ULL, 0x901d7cf73ab0acd9ULL, 0x0f9d37014bf60a11ULL,
+    0xb424dc35095cd80fULL, 0x538484c19ef38c95ULL, 0xe12e13424bb40e13ULL, 0x2865a5f206b06fbaULL,
+    0x8cbccc096f5088cbULL, 0xf93f87b7442e45d4ULL, 0xafebff0bcb24aafeULL, 0xf78f69a51539d749ULL,
+    0xdbe6fecebdedd5beULL, 0xb573440e5a884d1cULL, 0x89705f4136b4a597ULL, 0x31680a88f8953031ULL,
+    0xabcc77118461cefcULL, 0xfdc20d2b36ba7c3eULL, 0xd6bf94d5e57a42bcULL, 0x3d32907604691b4dULL,
+    0x8637bd05af6c69b5ULL, 0xa63f9a49c2c1b110ULL, 0xa7c5ac471b478423ULL, 0x0fcf80dc33721d54ULL,
+    0xd1b71758e219652bULL, 0xd3c36113404ea4a9ULL, 0x83126e978d4fdf3bULL, 0x645a1cac083126eaULL,
+    0xa3d70a3d70a3d70aULL, 0x3d70a3d70a3d70a4ULL, 0xccccccccccccccccULL, 0xcccccccccccccccdULL,
+    0x8000000000000000ULL, 0x0000000000000000ULL, 0xa000000000000000ULL, 0x0000000000000000ULL,
+    0xc800000000000000ULL, 0x0000000000000000ULL, 0xfa00000000000000ULL, 0x0000000000000000ULL,
+    0x9c40000000000000ULL, 0x0000000000000000ULL, 0xc350000000000000ULL, 0x0000000000000000ULL,
+    0xf424000000000000ULL, 0x0000000000000000ULL, 0x9896800000000000ULL, 0x0000000000000000ULL,
+    0xbebc200000000000ULL, 0x0000000000000000ULL, 0xee6b280000000000ULL, 0x0000000000000000ULL,
+    0x9502f90000000000ULL, 0x0000000000000000ULL, 0xba43b74000000000ULL, 0x0000000000000000ULL,
+    0xe8d4a51000000000ULL, 0x0000000000000000ULL, 0x9184e72a00000000ULL, 0x0000000000000000ULL,
+    0xb5e620f480000000ULL, 0x0000000000000000ULL, 0xe35fa931a0000000ULL, 0x0000000000000000ULL,
+    0x8e1bc9bf04000000ULL, 0x0000000000000000ULL, 0xb1a2bc2ec5000000ULL, 0x0000000000000000ULL,
+    0xde0b6b3a76400000ULL, 0x0000000000000000ULL, 0x8ac7230489e80000ULL, 0x0000000000000000ULL,
+    0xad78ebc5ac620000ULL, 0x0000000000000000ULL, 0xd8d726b7177a8000ULL, 0x0000000000000000ULL,
+    0x878678326eac9000ULL, 0x0000000000000000ULL, 0xa968163f0a57b400ULL, 0x0000000000000000ULL,
+    0xd3c21bcecceda100ULL, 0x0000000000000000ULL, 0x84595161401484a0ULL, 0x0000000000000000ULL,
+    0xa56fa5b99019a5c8ULL, 0x0000000000000000ULL, 0xcecb8f27f4200f3aULL, 0x0000000000000000ULL,
+    0x813f3978f8940984ULL, 0x4000000000000000ULL, 0xa18f07d736b90be5ULL, 0x5000000000000000ULL,
+    0xc9f2c9cd04674edeULL, 0xa400000000000000ULL, 0xfc6f7c4045812296ULL, 0x4d00000000000000ULL,
+    0x9dc5ada82b70b59dULL, 0xf020000000000000ULL, 0xc5371912364ce305ULL, 0x6c28000000000000ULL,
+    0xf684df56c3e01bc6ULL, 0xc732000000000000ULL, 0x9a130b963a6c115cULL, 0x3c7f400000000000ULL,
+    0xc097ce7bc90715b3ULL, 0x4b9f100000000000ULL, 0xf0bdc21abb48db20ULL, 0x1e86d40000000000ULL,
+    0x96769950b50d88f4ULL, 0x1314448000000000ULL, 0xbc143fa4e250eb31ULL, 0x17d955a000000000ULL,
+    0xeb194f8e1ae525fdULL, 0x5dcfab0800000000ULL, 0x92efd1b8d0cf37beULL, 0x5aa1cae500000000ULL,
+    0xb7abc627050305adULL, 0xf14a3d9e40000000ULL, 0xe596b7b0c643c719ULL, 0x6d9ccd05d0000000ULL,
+    0x8f7e32ce7bea5c6fULL, 0xe4820023a2000000ULL, 0xb35dbf821ae4f38bULL, 0xdda2802c8a800000ULL,
+    0xe0352f62a19e306eULL, 0xd50b2037ad200000ULL, 0x8c213d9da502de45ULL, 0x4526f422cc340000ULL,
+    0xaf298d050e4395d6ULL, 0x9670b12b7f410000ULL, 0xdaf3f04651d47b4cULL, 0x3c0cdd765f114000ULL,
+    0x88d8762bf324cd0fULL, 0xa5880a69fb6ac800ULL, 0xab0e93b6efee0053ULL, 0x8eea0d047a457a00ULL,
+    0xd5d238a4abe98068ULL, 0x72a4904598d6d880ULL, 0x85a36366eb71f041ULL, 0x47a6da2b7f864750ULL,
+    0xa70c3c40a64e6c51ULL, 0x999090b65f67d924ULL, 0xd0cf4b50cfe20765ULL, 0xfff4b4e3f741cf6dULL,
+    0x82818f1281ed449fULL, 0xbff8f10e7a8921a4ULL, 0xa321f2d7226895c7ULL, 0xaff72d52192b6a0dULL,
+    0xcbea6f8ceb02bb39ULL, 0x9bf4f8a69f764490ULL, 0xfee50b7025c36a08ULL, 0x02f236d04753d5b4ULL,
+    0x9f4f2726179a2245ULL, 0x01d762422c946590ULL, 0xc722f0ef9d80aad6ULL, 0x424d3ad2b7b97ef5ULL,
+    0xf8ebad2b84e0d58bULL, 0xd2e0898765a7deb2ULL, 0x9b934c3b330c8577ULL, 0x63cc55f49f88eb2fULL,
+    0xc2781f49ffcfa6d5ULL, 0x3cbf6b71c76b25fbULL, 0xf316271c7fc3908aULL, 0x8bef464e3945ef7aULL,
+    0x97edd871cfda3a56ULL, 0x97758bf0e3cbb5acULL, 0xbde94e8e43d0c8ecULL, 0x3d52eeed1cbea317ULL,
+    0xed63a231d4c4fb27ULL, 0x4ca7aaa863ee4bddULL, 0x945e455f24fb1cf8ULL, 0x8fe8caa93e74ef6aULL,
+    0xb975d6b6ee39e436ULL, 0xb3e2fd538e122b44ULL, 0xe7d34c64a9c85d44ULL, 0x60dbbca87196b616ULL,
+    0x90e40fbeea1d3a4aULL, 0xbc8955e946fe31cdULL, 0xb51d13aea4a488ddULL, 0x6babab6398bdbe41ULL,
+    0xe264589a4dcdab14ULL, 0xc696963c7eed2dd1ULL, 0x8d7eb76070a08aecULL, 0xfc1e1de5cf543ca2ULL,
+    0xb0de65388cc8ada8ULL, 0x3b25a55f43294bcbULL, 0xdd15fe86affad912ULL, 0x49ef0eb713f39ebeULL,
+    0x8a2dbf142dfcc7abULL, 0x6e3569326c784337ULL, 0xacb92ed9397bf996ULL, 0x49c2c37f07965404ULL,
+    0xd7e77a8f87daf7fbULL, 0xdc33745ec97be906ULL, 0x86f0ac99b4e8dafdULL, 0x69a028bb3ded71a3ULL,
+    0xa8acd7c0222311bcULL, 0xc40832ea0d68ce0cULL, 0xd2d80db02aabd62bULL, 0xf50a3fa490c30190ULL,
+    0x83c7088e1aab65dbULL, 0x792667c6da79e0faULL, 0xa4b8cab1a1563f52ULL, 0x577001b891185938ULL,
+    0xcde6fd5e09abcf26ULL, 0xed4c0226b55e6f86ULL, 0x80b05e5ac60b6178ULL, 0x544f8158315b05b4ULL,
+    0xa0dc75f1778e39d6ULL, 0x696361ae3db1c721ULL, 0xc913936dd571c84cULL, 0x03bc3a19cd1e38e9ULL,
+    0xfb5878494ace3a5fULL, 0x04ab48a04065c723ULL, 0x9d174b2dcec0e47bULL, 0x62eb0d64283f9c76ULL,
+    0xc45d1df942711d9aULL, 0x3ba5d0bd324f8394ULL, 0xf5746577930d6500ULL, 0xca8f44ec7ee36479ULL,
+    0x9968bf6abbe85f20ULL, 0x7e998b13cf4e1ecbULL, 0xbfc2ef456ae276e8ULL, 0x9e3fedd8c321a67eULL,
+    0xefb3ab16c59b14a2ULL, 0xc5cfe94ef3ea101eULL, 0x95d04aee3b80ece5ULL, 0xbba1f1d158724a12ULL,
+    0xbb445da9ca61281fULL, 0x2a8a6e45ae8edc97ULL, 0xea1575143cf97226ULL, 0xf52d09d71a3293bdULL,
+    0x924d692ca61be758ULL, 0x593c2626705f9c56ULL, 0xb6e0c377cfa2e12eULL, 0x6f8b2fb00c77836cULL,
+    0xe498f455c38b997aULL, 0x0b6dfb9c0f956447ULL, 0x8edf98b59a373fecULL, 0x4724bd4189bd5eacULL,
+    0xb2977ee300c50fe7ULL, 0x58edec91ec2cb657ULL, 0xdf3d5e9bc0f653e1ULL, 0x2f2967b66737e3edULL,
+    0x8b865b215899f46cULL, 0xbd79e0d20082ee74ULL, 0xae67f1e9aec07187ULL, 0xecd8590680a3aa11ULL,
+    0xda01ee641a708de9ULL, 0xe80e6f4820cc9495ULL, 0x884134fe908658b2ULL, 0x3109058d147fdcddULL,
+    0xaa51823e34a7eedeULL, 0xbd4b46f0599fd415ULL, 0xd4e5e2cdc1d1ea96ULL, 0x6c9e18ac7007c91aULL,
+    0x850fadc09923329eULL, 0x03e2cf6bc604ddb0ULL, 0xa6539930bf6bff45ULL, 0x84db8346b786151cULL,
+    0xcfe87f7cef46ff16ULL, 0xe612641865679a63ULL, 0x81f14fae158c5f6eULL, 0x4fcb7e8f3f60c07eULL,
+    0xa26da3999aef7749ULL, 0xe3be5e330f38f09dULL, 0xcb090c8001ab551cULL, 0x5cadf5bfd3072cc5ULL,
+    0xfdcb4fa002162a63ULL, 0x73d9732fc7c8f7f6ULL, 0x9e9f11c4014dda7eULL, 0x2867e7fddcdd9afaULL,
+    0xc646d63501a1511dULL, 0xb281e1fd541501b8ULL, 0xf7d88bc24209a565ULL, 0x1f225a7ca91a4226ULL,
+    0x9ae757596946075fULL, 0x3375788de9b06958ULL, 0xc1a12d2fc3978937ULL, 0x0052d6b1641c83aeULL,
+    0xf209787bb47d6b84ULL, 0xc0678c5dbd23a49aULL, 0x9745eb4d50ce6332ULL, 0xf840b7ba963646e0ULL,
+    0xbd176620a501fbffULL, 0xb650e5a93bc3d898ULL, 0xec5d3fa8ce427affULL, 0xa3e51f138ab4cebeULL,
+    0x93ba47c980e98cdfULL, 0xc66f336c36b10137ULL, 0xb8a8d9bbe123f017ULL, 0xb80b0047445d4184ULL,
+    0xe6d3102ad96cec1dULL, 0xa60dc059157491e5ULL, 0x9043ea1ac7e41392ULL, 0x87c89837ad68db2fULL,
+    0xb454e4a179dd1877ULL, 0x29babe4598c311fbULL, 0xe16a1dc9d8545e94ULL, 0xf4296dd6fef3d67aULL,
+    0x8ce2529e2734bb1dULL, 0x1899e4a65f58660cULL, 0xb01ae745b101e9e4ULL, 0x5ec05dcff72e7f8fULL,
+    0xdc21a1171d42645dULL, 0x76707543f4fa1f73ULL, 0x899504ae72497ebaULL, 0x6a06494a791c53a8ULL,
+    0xabfa45da0edbde69ULL, 0x0487db9d17636892ULL, 0xd6f8d7509292d603ULL, 0x45a9d2845d3c42b6ULL,
+    0x865b86925b9bc5c2ULL, 0x0b8a2392ba45a9b2ULL, 0xa7f26836f282b732ULL, 0x8e6cac7768d7141eULL,
+    0xd1ef0244af2364ffULL, 0x3207d795430cd926ULL, 0x8335616aed761f1fULL, 0x7f44e6bd49e807b8ULL,
+    0xa402b9c5a8d3a6e7ULL, 0x5f16206c9c6209a6ULL, 0xcd036837130890a1ULL, 0x36dba887c37a8c0fULL,
+    0x802221226be55a64ULL, 0xc2494954da2c9789ULL, 0xa02aa96b06deb0fdULL, 0xf2db9baa10b7bd6cULL,
+    0xc83553c5c8965d3dULL, 0x6f92829494e5acc7ULL, 0xfa42a8b73abbf48cULL, 0xcb772339ba1f17f9ULL,
+    0x9c69a97284b578d7ULL, 0xff2a760414536efbULL, 0xc38413cf25e2d70dULL, 0xfef5138519684abaULL,
+    0xf46518c2ef5b8cd1ULL, 0x7eb258665fc25d69ULL, 0x98bf2f79d5993802ULL, 0xef2f773ffbd97a61ULL,
+    0xbeeefb584aff8603ULL, 0xaafb550ffacfd8faULL, 0xeeaaba2e5dbf6784ULL, 0x95ba2a53f983cf38ULL,
+    0x952ab45cfa97a0b2ULL, 0xdd945a747bf26183ULL, 0xba756174393d88dfULL, 0x94f971119aeef9e4ULL,
+    0xe912b9d1478ceb17ULL, 0x7a37cd5601aab85dULL, 0x91abb422ccb812eeULL, 0xac62e055c10ab33aULL,
+    0xb616a12b7fe617aaULL, 0x577b986b314d6009ULL, 0xe39c49765fdf9d94ULL, 0xed5a7e85fda0b80bULL,
+    0x8e41ade9fbebc27dULL, 0x14588f13be847307ULL, 0xb1d219647ae6b31cULL, 0x596eb2d8ae258fc8ULL,
+    0xde469fbd99a05fe3ULL, 0x6fca5f8ed9aef3bbULL, 0x8aec23d680043beeULL, 0x25de7bb9480d5854ULL,
+    0xada72ccc20054ae9ULL, 0xaf561aa79a10ae6aULL, 0xd910f7ff28069da4ULL, 0x1b2ba1518094da04ULL,
+    0x87aa9aff79042286ULL, 0x90fb44d2f05d0842ULL, 0xa99541bf57452b28ULL, 0x353a1607ac744a53ULL,
+    0xd3fa922f2d1675f2ULL, 0x42889b8997915ce8ULL, 0x847c9b5d7c2e09b7ULL, 0x69956135febada11ULL,
+    0xa59bc234db398c25ULL, 0x43fab9837e699095ULL, 0xcf02b2c21207ef2eULL, 0x94f967e45e03f4bbULL,
+    0x8161afb94b44f57dULL, 0x1d1be0eebac278f5ULL, 0xa1ba1ba79e1632dcULL, 0x6462d92a69731732ULL,
+    0xca28a291859bbf93ULL, 0x7d7b8f7503cfdcfeULL, 0xfcb2cb35e702af78ULL, 0x5cda735244c3d43eULL,
+    0x9defbf01b061adabULL, 0x3a0888136afa64a7ULL, 0xc56baec21c7a1916ULL, 0x088aaa1845b8fdd0ULL,
+    0xf6c69a72a3989f5bULL, 0x8aad549e57273d45ULL, 0x9a3c2087a63f6399ULL, 0x36ac54e2f678864bULL,
+    0xc0cb28a98fcf3c7fULL, 0x84576a1bb416a7ddULL, 0xf0fdf2d3f3c30b9fULL, 0x656d44a2a11c51d5ULL,
+    0x969eb7c47859e743ULL, 0x9f644ae5a4b1b325ULL, 0xbc4665b596706114ULL, 0x873d5d9f0dde1feeULL,
+    0xeb57ff22fc0c7959ULL, 0xa90cb506d155a7eaULL, 0x9316ff75dd87cbd8ULL, 0x09a7f12442d588f2ULL,
+    0xb7dcbf5354e9beceULL, 0x0c11ed6d538aeb2fULL, 0xe5d3ef282a242e81ULL, 0x8f1668c8a86da5faULL,
+    0x8fa475791a569d10ULL, 0xf96e017d694487bcULL, 0xb38d92d760ec4455ULL, 0x37c981dcc395a9acULL,
+    0xe070f78d3927556aULL, 0x85bbe253f47b1417ULL, 0x8c469ab843b89562ULL, 0x93956d7478ccec8eULL,
+    0xaf58416654a6babbULL, 0x387ac8d1970027b2ULL, 0xdb2e51bfe9d0696aULL, 0x06997b05fcc0319eULL,
+    0x88fcf317f22241e2ULL, 0x441fece3bdf81f03ULL, 0xab3c2fddeeaad25aULL, 0xd527e81cad7626c3ULL,
+    0xd60b3bd56a5586f1ULL, 0x8a71e223d8d3b074ULL, 0x85c7056562757456ULL, 0xf6872d5667844e49ULL,
+    0xa738c6bebb12d16cULL, 0xb428f8ac016561dbULL, 0xd106f86e69d785c7ULL, 0xe13336d701beba52ULL,
+    0x82a45b450226b39cULL, 0xecc0024661173473ULL, 0xa34d721642b06084ULL, 0x27f002d7f95d0190ULL,
+    0xcc20ce9bd35c78a5ULL, 0x31ec038df7b441f4ULL, 0xff290242c83396ceULL, 0x7e67047175a15271ULL,
+    0x9f79a169bd203e41ULL, 0x0f0062c6e984d386ULL, 0xc75809c42c684dd1ULL, 0x52c07b78a3e60868ULL,
+    0xf92e0c3537826145ULL, 0xa7709a56ccdf8a82ULL, 0x9bbcc7a142b17ccbULL, 0x88a66076400bb691ULL,
+    0xc2abf989935ddbfeULL, 0x6acff893d00ea435ULL, 0xf356f7ebf83552feULL, 0x0583f6b8c4124d43ULL,
+    0x98165af37b2153deULL, 0xc3727a337a8b704aULL, 0xbe1bf1b059e9a8d6ULL, 0x744f18c0592e4c5cULL,
+    0xeda2ee1c7064130cULL, 0x1162def06f79df73ULL, 0x9485d4d1c63e8be7ULL, 0x8addcb5645ac2ba8ULL,
+    0xb9a74a0637ce2ee1ULL, 0x6d953e2bd7173692ULL, 0xe8111c87c5c1ba99ULL, 0xc8fa8db6ccdd0437ULL,
+    0x910ab1d4db9914a0ULL, 0x1d9c9892400a22a2ULL, 0xb54d5e4a127f59c8ULL, 0x2503beb6d00cab4bULL,
+    0xe2a0b5dc971f303aULL, 0x2e44ae64840fd61dULL, 0x8da471a9de737e24ULL, 0x5ceaecfed289e5d2ULL,
+    0xb10d8e1456105dadULL, 0x7425a83e872c5f47ULL, 0xdd50f1996b947518ULL, 0xd12f124e28f77719ULL,
+    0x8a5296ffe33cc92fULL, 0x82bd6b70d99aaa6fULL, 0xace73cbfdc0bfb7bULL, 0x636cc64d1001550bULL,
+    0xd8210befd30efa5aULL, 0x3c47f7e05401aa4eULL, 0x8714a775e3e95c78ULL, 0x65acfaec34810a71ULL,
+    0xa8d9d1535ce3b396ULL, 0x7f1839a741a14d0dULL, 0xd31045a8341ca07cULL, 0x1ede48111209a050ULL,
+    0x83ea2b892091e44dULL, 0x934aed0aab460432ULL, 0xa4e4b66b68b65d60ULL, 0xf81da84d5617853fULL,
+    0xce1de40642e3f4b9ULL, 0x36251260ab9d668eULL, 0x80d2ae83e9ce78f3ULL, 0xc1d72b7c6b426019ULL,
+    0xa1075a24e4421730ULL, 0xb24cf65b8612f81fULL, 0xc94930ae1d529cfcULL, 0xdee033f26797b627ULL,
+    0xfb9b7cd9a4a7443cULL, 0x169840ef017da3b1ULL, 0x9d412e0806e88aa5ULL, 0x8e1f289560ee864eULL,
+    0xc491798a08a2ad4eULL, 0xf1a6f2bab92a27e2ULL, 0xf5b5d7ec8acb58a2ULL, 0xae10af696774b1dbULL,
+    0x9991a6f3d6bf1765ULL, 0xacca6da1e0a8ef29ULL, 0xbff610b0cc6edd3fULL, 0x17fd090a58d32af3ULL,
+    0xeff394dcff8a948eULL, 0xddfc4b4cef07f5b0ULL, 0x95f83d0a1fb69cd9ULL, 0x4abdaf101564f98eULL,
+    0xbb764c4ca7a4440fULL, 0x9d6d1ad41abe37f1ULL, 0xea53df5fd18d5513ULL, 0x84c86189216dc5edULL,
+    0x92746b9be2f8552cULL, 0x32fd3cf5b4e49bb4ULL, 0xb7118682dbb66a77ULL, 0x3fbc8c33221dc2a1ULL,
+    0xe4d5e82392a40515ULL, 0x0fabaf3feaa5334aULL, 0x8f05b1163ba6832dULL, 0x29cb4d87f2a7400eULL,
+    0xb2c71d5bca9023f8ULL, 0x743e20e9ef511012ULL, 0xdf78e4b2bd342cf6ULL, 0x914da9246b255416ULL,
+    0x8bab8eefb6409c1aULL, 0x1ad089b6c2f7548eULL, 0xae9672aba3d0c320ULL, 0xa184ac2473b529b1ULL,
+    0xda3c0f568cc4f3e8ULL, 0xc9e5d72d90a2741eULL, 0x8865899617fb1871ULL, 0x7e2fa67c7a658892ULL,
+    0xaa7eebfb9df9de8dULL, 0xddbb901b98feeab7ULL, 0xd51ea6fa85785631ULL, 0x552a74227f3ea565ULL,
+    0x8533285c936b35deULL, 0xd53a88958f87275fULL, 0xa67ff273b8460356ULL, 0x8a892abaf368f137ULL,
+    0xd01fef10a657842cULL, 0x2d2b7569b0432d85ULL, 0x8213f56a67f6b29bULL, 0x9c3b29620e29fc73ULL,
+    0xa298f2c501f45f42ULL, 0x8349f3ba91b47b8fULL, 0xcb3f2f7642717713ULL, 0x241c70a936219a73ULL,
+    0xfe0efb53d30dd4d7ULL, 0xed238cd383aa0110ULL, 0x9ec95d1463e8a506ULL, 0xf4363804324a40aaULL,
+    0xc67bb4597ce2ce48ULL, 0xb143c6053edcd0d5ULL, 0xf81aa16fdc1b81daULL, 0xdd94b7868e94050aULL,
+    0x9b10a4e5e9913128ULL, 0xca7cf2b4191c8326ULL, 0xc1d4ce1f63f57d72ULL, 0xfd1c2f611f63a3f0ULL,
+    0xf24a01a73cf2dccfULL, 0xbc633b39673c8cecULL, 0x976e41088617ca01ULL, 0xd5be0503e085d813ULL,
+    0xbd49d14aa79dbc82ULL, 0x4b2d8644d8a74e18ULL, 0xec9c459d51852ba2ULL, 0xddf8e7d60ed1219eULL,
+    0x93e1ab8252f33b45ULL, 0xcabb90e5c942b503ULL, 0xb8da1662e7b00a17ULL, 0x3d6a751f3b936243ULL,
+    0xe7109bfba19c0c9dULL, 0x0cc512670a783ad4ULL, 0x906a617d450187e2ULL, 0x27fb2b80668b24c5ULL,
+    0xb484f9dc9641e9daULL, 0xb1f9f660802dedf6ULL, 0xe1a63853bbd26451ULL, 0x5e7873f8a0396973ULL,
+    0x8d07e33455637eb2ULL, 0xdb0b487b6423e1e8ULL, 0xb049dc016abc5e5fULL, 0x91ce1a9a3d2cda62ULL,
+    0xdc5c5301c56b75f7ULL, 0x7641a140cc7810fbULL, 0x89b9b3e11b6329baULL, 0xa9e904c87fcb0a9dULL,
+    0xac2820d9623bf429ULL, 0x546345fa9fbdcd44ULL, 0xd732290fbacaf133ULL, 0xa97c177947ad4095ULL,
+    0x867f59a9d4bed6c0ULL, 0x49ed8eabcccc485dULL, 0xa81f301449ee8c70ULL, 0x5c68f256bfff5a74ULL,
+    0xd226fc195c6a2f8cULL, 0x73832eec6fff3111ULL, 0x83585d8fd9c25db7ULL, 0xc831fd53c5ff7eabULL,
+    0xa42e74f3d032f525ULL, 0xba3e7ca8b77f5e55ULL, 0xcd3a1230c43fb26fULL, 0x28ce1bd2e55f35ebULL,
+    0x80444b5e7aa7cf85ULL, 0x7980d163cf5b81b3ULL, 0xa0555e361951c366ULL, 0xd7e105bcc332621fULL,
+    0xc86ab5c39fa63440ULL, 0x8dd9472bf3fefaa7ULL, 0xfa856334878fc150ULL, 0xb14f98f6f0feb951ULL,
+    0x9c935e00d4b9d8d2ULL, 0x6ed1bf9a569f33d3ULL, 0xc3b8358109e84f07ULL, 0x0a862f80ec4700c8ULL,
+    0xf4a642e14c6262c8ULL, 0xcd27bb612758c0faULL, 0x98e7e9cccfbd7dbdULL, 0x8038d51cb897789cULL,
+    0xbf21e44003acdd2cULL, 0xe0470a63e6bd56c3ULL, 0xeeea5d5004981478ULL, 0x1858ccfce06cac74ULL,
+    0x95527a5202df0ccbULL, 0x0f37801e0c43ebc8ULL, 0xbaa718e68396cffdULL, 0xd30560258f54e6baULL,
+    0xe950df20247c83fdULL, 0x47c6b82ef32a2069ULL, 0x91d28b7416cdd27eULL, 0x4cdc331d57fa5441ULL,
+    0xb6472e511c81471dULL, 0xe0133fe4adf8e952ULL, 0xe3d8f9e563a198e5ULL, 0x58180fddd97723a6ULL,
+    0x8e679c2f5e44ff8fULL, 0x570f09eaa7ea7648ULL,
+};
+
+/*Powers of five for Ryu, 125 bits each, low word first*/
+const uint64_t __str_ryu_pow5[652] = {
+    0x0000000000000000ULL, 0x1000000000000000ULL, 0x0000000000000000ULL, 0x1400000000000000ULL,
+    0x0000000000000000ULL, 0x1900000000000000ULL, 0x0000000000000000ULL, 0x1f40000000000000ULL,
+    0x0000000000000000ULL, 0x1388000000000000ULL, 0x0000000000000000ULL, 0x186a000000000000ULL,
+    0x0000000000000000ULL, 0x1e84800000000000ULL, 0x0000000000000000ULL, 0x1312d00000000000ULL,
+    0x0000000000000000ULL, 0x17d7840000000000ULL, 0x0000000000000000ULL, 0x1dcd650000000000ULL,
+    0x0000000000000000ULL, 0x12a05f2000000000ULL, 0x0000000000000000ULL, 0x174876e800000000ULL,
+    0x0000000000000000ULL, 0x1d1a94a200000000ULL, 0x0000000000000000ULL, 0x12309ce540000000ULL,
+    0x0000000000000000ULL, 0x16bcc41e90000000ULL, 0x0000000000000000ULL, 0x1c6bf52634000000ULL,
+    0x0000000000000000ULL, 0x11c37937e0800000ULL, 0x0000000000000000ULL, 0x16345785d8a00000ULL,
+    0x0000000000000000ULL, 0x1bc16d674ec80000ULL, 0x0000000000000000ULL, 0x1158e460913d0000ULL,
+    0x0000000000000000ULL, 0x15af1d78b58c4000ULL, 0x0000000000000000ULL, 0x1b1ae4d6e2ef5000ULL,
+    0x0000000000000000ULL, 0x10f0cf064dd59200ULL, 0x0000000000000000ULL, 0x152d02c7e14af680ULL,
+    0x0000000000000000ULL, 0x1a784379d99db420ULL, 0x0000000000000000ULL, 0x108b2a2c28029094ULL,
+    0x0000000000000000ULL, 0x14adf4b7320334b9ULL, 0x4000000000000000ULL, 0x19d971e4fe8401e7ULL,
+    0x8800000000000000ULL, 0x1027e72f1f128130ULL, 0xaa00000000000000ULL, 0x1431e0fae6d7217cULL,
+    0xd480000000000000ULL, 0x193e5939a08ce9dbULL, 0xc9a0000000000000ULL, 0x1f8def8808b02452ULL,
+    0xbe04000000000000ULL, 0x13b8b5b5056e16b3ULL, 0xad85000000000000ULL, 0x18a6e32246c99c60ULL,
+    0xd8e6400000000000ULL, 0x1ed09bead87c0378ULL, 0x878fe80000000000ULL, 0x13426172c74d822bULL,
+    0x6973e20000000000ULL, 0x1812f9cf7920e2b6ULL, 0x03d0da8000000000ULL, 0x1e17b84357691b64ULL,
+    0x8262889000000000ULL, 0x12ced32a16a1b11eULL, 0x22fb2ab400000000ULL, 0x178287f49c4a1d66ULL,
+    0xabb9f56100000000ULL, 0x1d6329f1c35ca4bfULL, 0xcb54395ca0000000ULL, 0x125dfa371a19e6f7ULL,
+    0xbe2947b3c8000000ULL, 0x16f578c4e0a060b5ULL, 0x2db399a0ba000000ULL, 0x1cb2d6f618c878e3ULL,
+    0xfc90400474400000ULL, 0x11efc659cf7d4b8dULL, 0x7bb4500591500000ULL, 0x166bb7f0435c9e71ULL,
+    0xdaa16406f5a40000ULL, 0x1c06a5ec5433c60dULL, 0xa8a4de8459868000ULL, 0x118427b3b4a05bc8ULL,
+    0xd2ce16256fe82000ULL, 0x15e531a0a1c872baULL, 0x87819baecbe22800ULL, 0x1b5e7e08ca3a8f69ULL,
+    0xf4b1014d3f6d5900ULL, 0x111b0ec57e6499a1ULL, 0x71dd41a08f48af40ULL, 0x1561d276ddfdc00aULL,
+    0x0e549208b31adb10ULL, 0x1aba4714957d300dULL, 0x28f4db456ff0c8eaULL, 0x10b46c6cdd6e3e08ULL,
+    0x33321216cbecfb24ULL, 0x14e1878814c9cd8aULL, 0xbffe969c7ee839edULL, 0x1a19e96a19fc40ecULL,
+    0xf7ff1e21cf512434ULL, 0x105031e2503da893ULL, 0xf5fee5aa43256d41ULL, 0x14643e5ae44d12b8ULL,
+    0x337e9f14d3eec892ULL, 0x197d4df19d605767ULL, 0x005e46da08ea7ab6ULL, 0x1fdca16e04b86d41ULL,
+    0xa03aec4845928cb2ULL, 0x13e9e4e4c2f34448ULL, 0xc849a75a56f72fdeULL, 0x18e45e1df3b0155aULL,
+    0x7a5c1130ecb4fbd6ULL, 0x1f1d75a5709c1ab1ULL, 0xec798abe93f11d65ULL, 0x13726987666190aeULL,
+    0xa797ed6e38ed64bfULL, 0x184f03e93ff9f4daULL, 0x517de8c9c728bdefULL, 0x1e62c4e38ff87211ULL,
+    0xd2eeb17e1c7976b5ULL, 0x12fdbb0e39fb474aULL, 0x87aa5ddda397d462ULL, 0x17bd29d1c87a191dULL,
+    0xe994f5550c7dc97bULL, 0x1dac74463a989f64ULL, 0x11fd195527ce9dedULL, 0x128bc8abe49f639fULL,
+    0xd67c5faa71c24568ULL, 0x172ebad6ddc73c86ULL, 0x8c1b77950e32d6c2ULL, 0x1cfa698c95390ba8ULL,
+    0x57912abd28dfc639ULL, 0x121c81f7dd43a749ULL, 0xad75756c7317b7c8ULL, 0x16a3a275d494911bULL,
+    0x98d2d2c78fdda5baULL, 0x1c4c8b1349b9b562ULL, 0x9f83c3bcb9ea8794ULL, 0x11afd6ec0e14115dULL,
+    0x0764b4abe8652979ULL, 0x161bcca7119915b5ULL, 0x493de1d6e27e73d7ULL, 0x1ba2bfd0d5ff5b22ULL,
+    0x6dc6ad264d8f0866ULL, 0x1145b7e285bf98f5ULL, 0xc938586fe0f2ca80ULL, 0x159725db272f7f32ULL,
+    0x7b866e8bd92f7d20ULL, 0x1afcef51f0fb5effULL, 0xad34051767bdae34ULL, 0x10de1593369d1b5fULL,
+    0x9881065d41ad19c1ULL, 0x15159af804446237ULL, 0x7ea147f492186032ULL, 0x1a5b01b605557ac5ULL,
+    0x6f24ccf8db4f3c1fULL, 0x1078e111c3556cbbULL, 0x4aee003712230b27ULL, 0x14971956342ac7eaULL,
+    0xdda98044d6abcdf0ULL, 0x19bcdfabc13579e4ULL, 0x0a89f02b062b60b6ULL, 0x10160bcb58c16c2fULL,
+    0xcd2c6c35c7b638e4ULL, 0x141b8ebe2ef1c73aULL, 0x8077874339a3c71dULL, 0x1922726dbaae3909ULL,
+    0xe0956914080cb8e4ULL, 0x1f6b0f092959c74bULL, 0x6c5d61ac8507f38eULL, 0x13a2e965b9d81c8fULL,
+    0x4774ba17a649f072ULL, 0x188ba3bf284e23b3ULL, 0x1951e89d8fdc6c8fULL, 0x1eae8caef261aca0ULL,
+    0x0fd3316279e9c3d9ULL, 0x132d17ed577d0be4ULL, 0x13c7fdbb186434cfULL, 0x17f85de8ad5c4eddULL,
+    0x58b9fd29de7d4203ULL, 0x1df67562d8b36294ULL, 0xb7743e3a2b0e4942ULL, 0x12ba095dc7701d9cULL,
+    0xe5514dc8b5d1db92ULL, 0x17688bb5394c2503ULL, 0xdea5a13ae3465277ULL, 0x1d42aea2879f2e44ULL,
+    0x0b2784c4ce0bf38aULL, 0x1249ad2594c37cebULL, 0xcdf165f6018ef06dULL, 0x16dc186ef9f45c25ULL,
+    0x416dbf7381f2ac88ULL, 0x1c931e8ab871732fULL, 0x88e497a83137abd5ULL, 0x11dbf316b346e7fdULL,
+    0xeb1dbd923d8596caULL, 0x1652efdc6018a1fcULL, 0x25e52cf6cce6fc7dULL, 0x1be7abd3781eca7cULL,
+    0x97af3c1a40105dceULL, 0x1170cb642b133e8dULL, 0xfd9b0b20d0147542ULL, 0x15ccfe3d35d80e30ULL,
+    0x3d01cde904199292ULL, 0x1b403dcc834e11bdULL, 0x462120b1a28ffb9bULL, 0x1108269fd210cb16ULL,
+    0xd7a968de0b33fa82ULL, 0x154a3047c694fddbULL, 0xcd93c3158e00f923ULL, 0x1a9cbc59b83a3d52ULL,
+    0xc07c59ed78c09bb6ULL, 0x10a1f5b813246653ULL, 0xb09b7068d6f0c2a3ULL, 0x14ca732617ed7fe8ULL,
+    0xdcc24c830cacf34cULL, 0x19fd0fef9de8dfe2ULL, 0xc9f96fd1e7ec180fULL, 0x103e29f5c2b18bedULL,
+    0x3c77cbc661e71e13ULL, 0x144db473335deee9ULL, 0x8b95beb7fa60e598ULL, 0x1961219000356aa3ULL,
+    0x6e7b2e65f8f91efeULL, 0x1fb969f40042c54cULL, 0xc50cfcffbb9bb35fULL, 0x13d3e2388029bb4fULL,
+    0xb6503c3faa82a037ULL, 0x18c8dac6a0342a23ULL, 0xa3e44b4f95234844ULL, 0x1efb1178484134acULL,
+    0xe66eaf11bd360d2bULL, 0x135ceaeb2d28c0ebULL, 0xe00a5ad62c839075ULL, 0x183425a5f872f126ULL,
+    0x980cf18bb7a47493ULL, 0x1e412f0f768fad70ULL, 0x5f0816f752c6c8dcULL, 0x12e8bd69aa19cc66ULL,
+    0xf6ca1cb527787b13ULL, 0x17a2ecc414a03f7fULL, 0xf47ca3e2715699d7ULL, 0x1d8ba7f519c84f5fULL,
+    0xf8cde66d86d62026ULL, 0x127748f9301d319bULL, 0xf7016008e88ba830ULL, 0x17151b377c247e02ULL,
+    0xb4c1b80b22ae923cULL, 0x1cda62055b2d9d83ULL, 0x50f91306f5ad1b65ULL, 0x12087d4358fc8272ULL,
+    0xe53757c8b318623fULL, 0x168a9c942f3ba30eULL, 0x9e852dbadfde7acfULL, 0x1c2d43b93b0a8bd2ULL,
+    0xa3133c94cbeb0cc1ULL, 0x119c4a53c4e69763ULL, 0x8bd80bb9fee5cff1ULL, 0x16035ce8b6203d3cULL,
+    0xaece0ea87e9f43eeULL, 0x1b843422e3a84c8bULL, 0x4d40c9294f238a75ULL, 0x1132a095ce492fd7ULL,
+    0x2090fb73a2ec6d12ULL, 0x157f48bb41db7bcdULL, 0x68b53a508ba78856ULL, 0x1adf1aea12525ac0ULL,
+    0x417144725748b536ULL, 0x10cb70d24b7378b8ULL, 0x51cd958eed1ae283ULL, 0x14fe4d06de5056e6ULL,
+    0xe640faf2a8619b24ULL, 0x1a3de04895e46c9fULL, 0xefe89cd7a93d00f7ULL, 0x1066ac2d5daec3e3ULL,
+    0xebe2c40d938c4134ULL, 0x14805738b51a74dcULL, 0x26db7510f86f5181ULL, 0x19a06d06e2611214ULL,
+    0x9849292a9b4592f1ULL, 0x100444244d7cab4cULL, 0xbe5b73754216f7adULL, 0x1405552d60dbd61fULL,
+    0xadf25052929cb598ULL, 0x1906aa78b912cba7ULL, 0x996ee4673743e2ffULL, 0x1f485516e7577e91ULL,
+    0xffe54ec0828a6ddfULL, 0x138d352e5096af1aULL, 0xbfdea270a32d0957ULL, 0x18708279e4bc5ae1ULL,
+    0x2fd64b0ccbf84badULL, 0x1e8ca3185deb719aULL, 0x5de5eee7ff7b2f4cULL, 0x1317e5ef3ab32700ULL,
+    0x755f6aa1ff59fb1fULL, 0x17dddf6b095ff0c0ULL, 0x92b7454a7f3079e7ULL, 0x1dd55745cbb7ecf0ULL,
+    0x5bb28b4e8f7e4c30ULL, 0x12a5568b9f52f416ULL, 0xf29f2e22335ddf3cULL, 0x174eac2e8727b11bULL,
+    0xef46f9aac035570bULL, 0x1d22573a28f19d62ULL, 0xd58c5c0ab8215667ULL, 0x123576845997025dULL,
+    0x4aef730d6629ac01ULL, 0x16c2d4256ffcc2f5ULL, 0x9dab4fd0bfb41701ULL, 0x1c73892ecbfbf3b2ULL,
+    0xa28b11e277d08e60ULL, 0x11c835bd3f7d784fULL, 0x8b2dd65b15c4b1f9ULL, 0x163a432c8f5cd663ULL,
+    0x6df94bf1db35de77ULL, 0x1bc8d3f7b3340bfcULL, 0xc4bbcf772901ab0aULL, 0x115d847ad000877dULL,
+    0x35eac354f34215cdULL, 0x15b4e5998400a95dULL, 0x8365742a30129b40ULL, 0x1b221effe500d3b4ULL,
+    0xd21f689a5e0ba108ULL, 0x10f5535fef208450ULL, 0x06a742c0f58e894aULL, 0x1532a837eae8a565ULL,
+    0x4851137132f22b9dULL, 0x1a7f5245e5a2cebeULL, 0xed32ac26bfd75b42ULL, 0x108f936baf85c136ULL,
+    0xa87f57306fcd3212ULL, 0x14b378469b673184ULL, 0xd29f2cfc8bc07e97ULL, 0x19e056584240fde5ULL,
+    0xa3a37c1dd7584f1eULL, 0x102c35f729689eafULL, 0x8c8c5b254d2e62e6ULL, 0x14374374f3c2c65bULL,
+    0x6faf71eea079fb9fULL, 0x1945145230b377f2ULL, 0x0b9b4e6a48987a87ULL, 0x1f965966bce055efULL,
+    0x674111026d5f4c94ULL, 0x13bdf7e0360c35b5ULL, 0xc111554308b71fbaULL, 0x18ad75d8438f4322ULL,
+    0x7155aa93cae4e7a8ULL, 0x1ed8d34e547313ebULL, 0x26d58a9c5ecf10c9ULL, 0x13478410f4c7ec73ULL,
+    0xf08aed437682d4fbULL, 0x1819651531f9e78fULL, 0xecada89454238a3aULL, 0x1e1fbe5a7e786173ULL,
+    0x73ec895cb4963664ULL, 0x12d3d6f88f0b3ce8ULL, 0x90e7abb3e1bbc3fdULL, 0x1788ccb6b2ce0c22ULL,
+    0x352196a0da2ab4fdULL, 0x1d6affe45f818f2bULL, 0x0134fe24885ab11eULL, 0x1262dfeebbb0f97bULL,
+    0xc1823dadaa715d65ULL, 0x16fb97ea6a9d37d9ULL, 0x31e2cd19150db4bfULL, 0x1cba7de5054485d0ULL,
+    0x1f2dc02fad2890f7ULL, 0x11f48eaf234ad3a2ULL, 0xa6f9303b9872b535ULL, 0x1671b25aec1d888aULL,
+    0x50b77c4a7e8f6282ULL, 0x1c0e1ef1a724eaadULL, 0x5272adae8f199d91ULL, 0x1188d357087712acULL,
+    0x670f591a32e004f6ULL, 0x15eb082cca94d757ULL, 0x40d32f60bf980633ULL, 0x1b65ca37fd3a0d2dULL,
+    0x4883fd9c77bf03e0ULL, 0x111f9e62fe44483cULL, 0x5aa4fd0395aec4d8ULL, 0x156785fbbdd55a4bULL,
+    0x314e3c447b1a760eULL, 0x1ac1677aad4ab0deULL, 0xded0e5aaccf089c9ULL, 0x10b8e0acac4eae8aULL,
+    0x96851f15802cac3bULL, 0x14e718d7d7625a2dULL, 0xfc2666dae037d74aULL, 0x1a20df0dcd3af0b8ULL,
+    0x9d980048cc22e68eULL, 0x10548b68a044d673ULL, 0x84fe005aff2ba032ULL, 0x1469ae42c8560c10ULL,
+    0xa63d8071bef6883eULL, 0x198419d37a6b8f14ULL, 0xcfcce08e2eb42a4eULL, 0x1fe52048590672d9ULL,
+    0x21e00c58dd309a70ULL, 0x13ef342d37a407c8ULL, 0x2a580f6f147cc10dULL, 0x18eb0138858d09baULL,
+    0xb4ee134ad99bf150ULL, 0x1f25c186a6f04c28ULL, 0x7114cc0ec80176d2ULL, 0x137798f428562f99ULL,
+    0xcd59ff127a01d486ULL, 0x18557f31326bbb7fULL, 0xc0b07ed7188249a8ULL, 0x1e6adefd7f06aa5fULL,
+    0xd86e4f466f516e09ULL, 0x1302cb5e6f642a7bULL, 0xce89e3180b25c98bULL, 0x17c37e360b3d351aULL,
+    0x822c5bde0def3beeULL, 0x1db45dc38e0c8261ULL, 0xf15bb96ac8b58575ULL, 0x1290ba9a38c7d17cULL,
+    0x2db2a7c57ae2e6d2ULL, 0x1734e940c6f9c5dcULL, 0x391f51b6d99ba086ULL, 0x1d022390f8b83753ULL,
+    0x03b3931248014454ULL, 0x1221563a9b732294ULL, 0x04a077d6da019569ULL, 0x16a9abc9424feb39ULL,
+    0x45c895cc9081fac3ULL, 0x1c5416bb92e3e607ULL, 0x8b9d5d9fda513cbaULL, 0x11b48e353bce6fc4ULL,
+    0xae84b507d0e58be8ULL, 0x1621b1c28ac20bb5ULL, 0x1a25e249c51eeee3ULL, 0x1baa1e332d728ea3ULL,
+    0xf057ad6e1b33554dULL, 0x114a52dffc679925ULL, 0x6c6d98c9a2002aa1ULL, 0x159ce797fb817f6fULL,
+    0x4788fefc0a803549ULL, 0x1b04217dfa61df4bULL, 0x0cb59f5d8690214eULL, 0x10e294eebc7d2b8fULL,
+    0xcfe30734e83429a1ULL, 0x151b3a2a6b9c7672ULL, 0x83dbc9022241340aULL, 0x1a6208b50683940fULL,
+    0xb2695da15568c086ULL, 0x107d457124123c89ULL, 0x1f03b509aac2f0a7ULL, 0x149c96cd6d16cbacULL,
+    0x26c4a24c1573acd1ULL, 0x19c3bc80c85c7e97ULL, 0x783ae56f8d684c03ULL, 0x101a55d07d39cf1eULL,
+    0x16499ecb70c25f03ULL, 0x1420eb449c8842e6ULL, 0x9bdc067e4cf2f6c4ULL, 0x19292615c3aa539fULL,
+    0x82d3081de02fb476ULL, 0x1f736f9b3494e887ULL, 0xb1c3e512ac1dd0c9ULL, 0x13a825c100dd1154ULL,
+    0xde34de57572544fcULL, 0x18922f31411455a9ULL, 0x55c215ed2cee963bULL, 0x1eb6bafd91596b14ULL,
+    0xb5994db43c151de5ULL, 0x133234de7ad7e2ecULL, 0xe2ffa1214b1a655eULL, 0x17fec216198ddba7ULL,
+    0xdbbf89699de0feb6ULL, 0x1dfe729b9ff15291ULL, 0x2957b5e202ac9f31ULL, 0x12bf07a143f6d39bULL,
+    0xf3ada35a8357c6feULL, 0x176ec98994f48881ULL, 0x70990c31242db8bdULL, 0x1d4a7bebfa31aaa2ULL,
+    0x865fa79eb69c9376ULL, 0x124e8d737c5f0aa5ULL, 0xe7f791866443b854ULL, 0x16e230d05b76cd4eULL,
+    0xa1f575e7fd54a669ULL, 0x1c9abd04725480a2ULL, 0xa53969b0fe54e801ULL, 0x11e0b622c774d065ULL,
+    0x0e87c41d3dea2202ULL, 0x1658e3ab7952047fULL, 0xd229b5248d64aa82ULL, 0x1bef1c9657a6859eULL,
+    0x435a1136d85eea91ULL, 0x117571ddf6c81383ULL, 0x143095848e76a536ULL, 0x15d2ce55747a1864ULL,
+    0x193cbae5b2144e83ULL, 0x1b4781ead1989e7dULL, 0x2fc5f4cf8f4cb112ULL, 0x110cb132c2ff630eULL,
+    0xbbb77203731fdd56ULL, 0x154fdd7f73bf3bd1ULL, 0x2aa54e844fe7d4acULL, 0x1aa3d4df50af0ac6ULL,
+    0xdaa75112b1f0e4ebULL, 0x10a6650b926d66bbULL, 0xd15125575e6d1e26ULL, 0x14cffe4e7708c06aULL,
+    0x85a56ead360865b0ULL, 0x1a03fde214caf085ULL, 0x7387652c41c53f8eULL, 0x10427ead4cfed653ULL,
+    0x50693e7752368f71ULL, 0x14531e58a03e8be8ULL, 0x64838e1526c4334eULL, 0x1967e5eec84e2ee2ULL,
+    0xfda4719a70754022ULL, 0x1fc1df6a7a61ba9aULL, 0xde86c70086494815ULL, 0x13d92ba28c7d14a0ULL,
+    0x162878c0a7db9a1aULL, 0x18cf768b2f9c59c9ULL, 0x5bb296f0d1d280a1ULL, 0x1f03542dfb83703bULL,
+    0x194f9e5683239064ULL, 0x1362149cbd322625ULL, 0x5fa385ec23ec747eULL, 0x183a99c3ec7eafaeULL,
+    0xf78c67672ce7919dULL, 0x1e494034e79e5b99ULL, 0x3ab7c0a07c10bb02ULL, 0x12edc82110c2f940ULL,
+    0x4965b0c89b14e9c3ULL, 0x17a93a2954f3b790ULL, 0x5bbf1cfac1da2433ULL, 0x1d9388b3aa30a574ULL,
+    0xb957721cb92856a0ULL, 0x127c35704a5e6768ULL, 0xe7ad4ea3e7726c48ULL, 0x171b42cc5cf60142ULL,
+    0xa198a24ce14f075aULL, 0x1ce2137f74338193ULL, 0x44ff65700cd16498ULL, 0x120d4c2fa8a030fcULL,
+    0x563f3ecc1005bdbeULL, 0x16909f3b92c83d3bULL, 0x2bcf0e7f14072d2eULL, 0x1c34c70a777a4c8aULL,
+    0x5b61690f6c847c3dULL, 0x11a0fc668aac6fd6ULL, 0xf239c35347a59b4cULL, 0x16093b802d578bcbULL,
+    0xeec83428198f021fULL, 0x1b8b8a6038ad6ebeULL, 0x553d20990ff96153ULL, 0x1137367c236c6537ULL,
+    0x2a8c68bf53f7b9a8ULL, 0x1585041b2c477e85ULL, 0x752f82ef28f5a812ULL, 0x1ae64521f7595e26ULL,
+    0x093db1d57999890bULL, 0x10cfeb353a97dad8ULL, 0x0b8d1e4ad7ffeb4eULL, 0x1503e602893dd18eULL,
+    0x8e7065dd8dffe622ULL, 0x1a44df832b8d45f1ULL, 0xf9063faa78bfefd5ULL, 0x106b0bb1fb384bb6ULL,
+    0xb747cf9516efebcaULL, 0x1485ce9e7a065ea4ULL, 0xe519c37a5cabe6bdULL, 0x19a742461887f64dULL,
+    0xaf301a2c79eb7036ULL, 0x1008896bcf54f9f0ULL, 0xdafc20b798664c43ULL, 0x140aabc6c32a386cULL,
+    0x11bb28e57e7fdf54ULL, 0x190d56b873f4c688ULL, 0x1629f31ede1fd72aULL, 0x1f50ac6690f1f82aULL,
+    0x4dda37f34ad3e67aULL, 0x13926bc01a973b1aULL, 0xe150c5f01d88e019ULL, 0x187706b0213d09e0ULL,
+    0x19a4f76c24eb181fULL, 0x1e94c85c298c4c59ULL, 0xb0071aa39712ef13ULL, 0x131cfd3999f7afb7ULL,
+    0x9c08e14c7cd7aad8ULL, 0x17e43c8800759ba5ULL, 0x030b199f9c0d958eULL, 0x1ddd4baa0093028fULL,
+    0x61e6f003c1887d79ULL, 0x12aa4f4a405be199ULL, 0xba60ac04b1ea9cd7ULL, 0x1754e31cd072d9ffULL,
+    0xa8f8d705de65440dULL, 0x1d2a1be4048f907fULL, 0xc99b8663aaff4a88ULL, 0x123a516e82d9ba4fULL,
+    0xbc0267fc95bf1d2aULL, 0x16c8e5ca239028e3ULL, 0xab0301fbbb2ee474ULL, 0x1c7b1f3cac74331cULL,
+    0xeae1e13d54fd4ec9ULL, 0x11ccf385ebc89ff1ULL, 0x659a598caa3ca27bULL, 0x1640306766bac7eeULL,
+    0xff00efefd4cbcb1aULL, 0x1bd03c81406979e9ULL, 0x3f6095f5e4ff5ef0ULL, 0x116225d0c841ec32ULL,
+    0xcf38bb735e3f36acULL, 0x15baaf44fa52673eULL, 0x8306ea5035cf0457ULL, 0x1b295b1638e7010eULL,
+    0x11e4527221a162b6ULL, 0x10f9d8ede39060a9ULL, 0x565d670eaa09bb64ULL, 0x15384f295c7478d3ULL,
+    0x2bf4c0d2548c2a3dULL, 0x1a8662f3b3919708ULL, 0x1b78f88374d79a66ULL, 0x1093fdd8503afe65ULL,
+    0x625736a4520d8100ULL, 0x14b8fd4e6449bdfeULL, 0xfaed044d6690e140ULL, 0x19e73ca1fd5c2d7dULL,
+    0xbcd422b0601a8cc8ULL, 0x103085e53e599c6eULL, 0x6c092b5c78212ffaULL, 0x143ca75e8df0038aULL,
+    0x070b763396297bf8ULL, 0x194bd136316c046dULL, 0x48ce53c07bb3daf6ULL, 0x1f9ec583bdc70588ULL,
+    0x2d80f4584d5068daULL, 0x13c33b72569c6375ULL, 0x78e1316e60a48310ULL, 0x18b40a4eec437c52ULL,
+};
+
+/*Inverse powers of five for Ryu, 125 bits each, low word first*/
+const uint64_t __str_ryu_pow5inv[684] = {
+    0x0000000000000001ULL, 0x2000000000000000ULL, 0x999999999999999aULL, 0x1999999999999999ULL,
+    0x47ae147ae147ae15ULL, 0x147ae147ae147ae1ULL, 0x6c8b4395810624deULL, 0x10624dd2f1a9fbe7ULL,
+    0x7a786c226809d496ULL, 0x1a36e2eb1c432ca5ULL, 0x61f9f01b866e43abULL, 0x14f8b588e368f084ULL,
+    0xb4c7f34938583622ULL, 0x10c6f7a0b5ed8d36ULL, 0x87a6520ec08d236aULL, 0x1ad7f29abcaf4857ULL,
+    0x9fb841a566d74f88ULL, 0x15798ee2308c39dfULL, 0xe62d01511f12a607ULL, 0x112e0be826d694b2ULL,
+    0xd6ae6881cb5109a4ULL, 0x1b7cdfd9d7bdbab7ULL, 0xdef1ed34a2a73aeaULL, 0x15fd7fe17964955fULL,
+    0x7f27f0f6e885c8bbULL, 0x119799812dea1119ULL, 0x650cb4be40d60df8ULL, 0x1c25c268497681c2ULL,
+    0xea70909833de7193ULL, 0x16849b86a12b9b01ULL, 0x21f3a6e0297ec143ULL, 0x1203af9ee756159bULL,
+    0x6985d7cd0f313537ULL, 0x1cd2b297d889bc2bULL, 0x2137dfd73f5a90f9ULL, 0x170ef54646d49689ULL,
+    0xe75fe645cc4873faULL, 0x12725dd1d243aba0ULL, 0xa5663d3c7a0d865dULL, 0x1d83c94fb6d2ac34ULL,
+    0x511e976394d79eb1ULL, 0x179ca10c9242235dULL, 0xda7edf82dd794bc1ULL, 0x12e3b40a0e9b4f7dULL,
+    0x2a6498d1625bac68ULL, 0x1e392010175ee596ULL, 0xeeb6e0a781e2f053ULL, 0x182db34012b25144ULL,
+    0x58924d52ce4f26a9ULL, 0x1357c299a88ea76aULL, 0x27507bb7b07ea441ULL, 0x1ef2d0f5da7dd8aaULL,
+    0x52a6c95fc0655034ULL, 0x18c240c4aecb13bbULL, 0x0eebd44c99eaa690ULL, 0x13ce9a36f23c0fc9ULL,
+    0xb17953adc3110a80ULL, 0x1fb0f6be50601941ULL, 0xc12ddc8b02740867ULL, 0x195a5efea6b34767ULL,
+    0x3424b06f3529a052ULL, 0x14484bfeebc29f86ULL, 0x901d59f290ee19dbULL, 0x1039d66589687f9eULL,
+    0x4cfbc31db4b0295fULL, 0x19f623d5a8a73297ULL, 0x3d9635b15d59bab2ULL, 0x14c4e977ba1f5bacULL,
+    0x97ab5e277de16228ULL, 0x109d8792fb4c4956ULL, 0xf2abc9d8c9689d0dULL, 0x1a95a5b7f87a0ef0ULL,
+    0x5bbca17a3aba173eULL, 0x154484932d2e725aULL, 0xafca1ac82efb45cbULL, 0x11039d428a8b8eaeULL,
+    0xb2dcf7a6b1920945ULL, 0x1b38fb9daa78e44aULL, 0xf57d92ebc141a104ULL, 0x15c72fb1552d836eULL,
+    0xc46475896767b403ULL, 0x116c262777579c58ULL, 0x6d6d88dbd8a5ecd2ULL, 0x1be03d0bf225c6f4ULL,
+    0x8abe071646eb23dbULL, 0x164cfda3281e38c3ULL, 0x6efe6c11d255b649ULL, 0x11d7314f534b609cULL,
+    0xb197134fb6ef8a0eULL, 0x1c8b821885456760ULL, 0x27ac0f72f8bfa1a5ULL, 0x16d601ad376ab91aULL,
+    0xb95672c260994e1eULL, 0x1244ce242c5560e1ULL, 0xf5571e03cdc21695ULL, 0x1d3ae36d13bbce35ULL,
+    0x2aac18030b01ababULL, 0x17624f8a762fd82bULL, 0xbbbce0026f348956ULL, 0x12b50c6ec4f31355ULL,
+    0x92c7ccd0b1eda889ULL, 0x1dee7a4ad4b81eefULL, 0xdbd30a408e57ba07ULL, 0x17f1fb6f10934bf2ULL,
+    0x7ca8d50071dfc806ULL, 0x1327fc58da0f6ff5ULL, 0xfaa7bb33e9660cd6ULL, 0x1ea6608e29b24cbbULL,
+    0x9552fc298784d711ULL, 0x18851a0b548ea3c9ULL, 0xaaa8c9bad2d0ac0eULL, 0x139dae6f76d88307ULL,
+    0xdddadc5e1e1aace3ULL, 0x1f62b0b257c0d1a5ULL, 0x7e48b04b4b488a4fULL, 0x191bc08eac9a4151ULL,
+    0xcb6d59d5d5d3a1d9ULL, 0x141633a556e1cddaULL, 0x3c577b1177dc817bULL, 0x1011c2eaabe7d7e2ULL,
+    0xc6f25e825960cf2aULL, 0x19b604aaaca62636ULL, 0x6bf518684780a5bbULL, 0x14919d5556eb51c5ULL,
+    0x232a79ed06008496ULL, 0x10747ddddf22a7d1ULL, 0xd1dd8fe1a3340756ULL, 0x1a53fc9631d10c81ULL,
+    0xa7e4731ae8f66c45ULL, 0x150ffd44f4a73d34ULL, 0x531d28e253f8569eULL, 0x10d9976a5d52975dULL,
+    0xeb61db03b98d5762ULL, 0x1af5bf109550f22eULL, 0xbc4e48cfc7a445e8ULL, 0x159165a6ddda5b58ULL,
+    0x6371d3d96c836b20ULL, 0x11411e1f17e1e2adULL, 0x9f1c8628ad9f11cdULL, 0x1b9b6364f3030448ULL,
+    0xe5b06b53be18db0bULL, 0x1615e91d8f359d06ULL, 0xeaf3890fcb4715a2ULL, 0x11ab20e472914a6bULL,
+    0x44b8db4c7871bc37ULL, 0x1c45016d841baa46ULL, 0x03c715d6c6c1635fULL, 0x169d9abe03495505ULL,
+    0x3638de456bcde919ULL, 0x1217aefe69077737ULL, 0x56c163a2461641c1ULL, 0x1cf2b1970e725858ULL,
+    0xdf011c81d1ab67ceULL, 0x17288e1271f51379ULL, 0x7f3416ce4155eca5ULL, 0x1286d80ec190dc61ULL,
+    0x6520247d3556476eULL, 0x1da48ce468e7c702ULL, 0xea801d30f7783925ULL, 0x17b6d71d20b96c01ULL,
+    0xbb99b0f3f92cfa84ULL, 0x12f8ac174d612334ULL, 0x5f5c4e532847f739ULL, 0x1e5aacf215683854ULL,
+    0x7f7d0b75b9d32c2eULL, 0x18488a5b44536043ULL, 0x9930d5f7c7dc2358ULL, 0x136d3b7c36a919cfULL,
+    0x8eb4898c72f9d226ULL, 0x1f152bf9f10e8fb2ULL, 0x722a07a38f2e41b8ULL, 0x18ddbcc7f40ba628ULL,
+    0xc1bb394fa5be9afaULL, 0x13e497065cd61e86ULL, 0x9c5ec2190930f7f6ULL, 0x1fd424d6faf030d7ULL,
+    0x49e56814075a5ff8ULL, 0x197683df2f268d79ULL, 0x6e51201005e1e660ULL, 0x145ecfe5bf520ac7ULL,
+    0xf1da800cd181851aULL, 0x104bd984990e6f05ULL, 0x4fc400148268d4f5ULL, 0x1a12f5a0f4e3e4d6ULL,
+    0xd96999aa01ed772bULL, 0x14dbf7b3f71cb711ULL, 0xadee1488018ac5bcULL, 0x10aff95cc5b09274ULL,
+    0x497ceda668de092cULL, 0x1ab328946f80ea54ULL, 0x3aca57b853e4d424ULL, 0x155c2076bf9a5510ULL,
+    0x623b7960431d7683ULL, 0x1116805effaeaa73ULL, 0x9d2bf566d1c8bd9eULL, 0x1b5733cb32b110b8ULL,
+    0x7dbcc452416d647fULL, 0x15df5ca28ef40d60ULL, 0xcafd69db678ab6ccULL, 0x117f7d4ed8c33de6ULL,
+    0xab2f0fc572778adfULL, 0x1bff2ee48e052fd7ULL, 0x88f273045b92d580ULL, 0x1665bf1d3e6a8cacULL,
+    0xd3f528d049424466ULL, 0x11eaff4a98553d56ULL, 0xb988414d4203a0a3ULL, 0x1cab3210f3bb9557ULL,
+    0x6139cdd76802e6e9ULL, 0x16ef5b40c2fc7779ULL, 0xe761717920025254ULL, 0x125915cd68c9f92dULL,
+    0xa568b58e999d5086ULL, 0x1d5b561574765b7cULL, 0x5120913ee14aa6d2ULL, 0x177c44ddf6c515fdULL,
+    0xa74d40ff1aa21f0eULL, 0x12c9d0b1923744caULL, 0x0baece64f769cb4aULL, 0x1e0fb44f50586e11ULL,
+    0x3c8bd850c5ee3c3bULL, 0x180c903f7379f1a7ULL, 0xca0979da37f1c9c9ULL, 0x133d4032c2c7f485ULL,
+    0xa9a8c2f6bfe942dbULL, 0x1ec866b79e0cba6fULL, 0x2153cf2bccba9be3ULL, 0x18a0522c7e709526ULL,
+    0x1aa9728970954982ULL, 0x13b374f06526ddb8ULL, 0xf775840f1a88759dULL, 0x1f8587e7083e2f8cULL,
+    0x5f9136727ba05e17ULL, 0x19379fec0698260aULL, 0x1940f85b9619e4dfULL, 0x142c7ff0054684d5ULL,
+    0xe100c6afab47ea4cULL, 0x1023998cd1053710ULL, 0xce67a44c453fdd47ULL, 0x19d28f47b4d524e7ULL,
+    0xd852e9d69dccb106ULL, 0x14a8729fc3ddb71fULL, 0x79dbee454b0a2738ULL, 0x1086c219697e2c19ULL,
+    0x295fe3a211a9d859ULL, 0x1a71368f0f30468fULL, 0xbab31c81a7bb137aULL, 0x15275ed8d8f36ba5ULL,
+    0x6228e39aec95a92fULL, 0x10ec4be0ad8f8951ULL, 0x9d0e38f7e0ef7517ULL, 0x1b13ac9aaf4c0ee8ULL,
+    0xb0d82d931a592a79ULL, 0x15a956e225d67253ULL, 0x8d79be0f4847552eULL, 0x11544581b7dec1dcULL,
+    0x158f967eda0bbb7cULL, 0x1bba08cf8c979c94ULL, 0x77a611ff14d62f97ULL, 0x162e6d72d6dfb076ULL,
+    0xf951a7ff43de8c79ULL, 0x11bebdf578b2f391ULL, 0xc21c3ffed2fdad8eULL, 0x1c6463225ab7ec1cULL,
+    0x01b0333242648ad8ULL, 0x16b6b5b5155ff017ULL, 0x0159c28e9b83a246ULL, 0x122bc490dde659acULL,
+    0xcef604175f3903a3ULL, 0x1d12d41afca3c2acULL, 0x725e69ac4c2d9c83ULL, 0x17424348ca1c9bbdULL,
+    0xf5185489d68ae39cULL, 0x129b69070816e2fdULL, 0xee8d540fbdab05c6ULL, 0x1dc574d80cf16b2fULL,
+    0xbed77672fe226b05ULL, 0x17d12a4670c1228cULL, 0xff12c528cb4ebc04ULL, 0x130dbb6b8d674ed6ULL,
+    0xcb513b74787df9a0ULL, 0x1e7c5f127bd87e24ULL, 0x090dc929f9fe614dULL, 0x18637f41fcad31b7ULL,
+    0xa0d7d42194cb810aULL, 0x1382cc34ca2427c5ULL, 0x67bfb9cf5478ce77ULL, 0x1f37ad21436d0c6fULL,
+    0x1fcc94a5dd2d71f9ULL, 0x18f9574dcf8a7059ULL, 0x7fd6dd517dbdf4c7ULL, 0x13faac3e3fa1f37aULL,
+    0xffbe2ee8c92fee0bULL, 0x1ff779fd329cb8c3ULL, 0x6631bf20a0f324d6ULL, 0x1992c7fdc216fa36ULL,
+    0xb827cc1a1a5c1d78ULL, 0x14756ccb01abfb5eULL, 0x935309ae7b7ce460ULL, 0x105df0a267bcc918ULL,
+    0x1eeb42b0c594a099ULL, 0x1a2fe76a3f9474f4ULL, 0xe58902270476e6e1ULL, 0x14f31f8832dd2a5cULL,
+    0xb7a0ce859d2bebe7ULL, 0x10c27fa028b0eeb0ULL, 0x59014a6f61dfdfd8ULL, 0x1ad0cc33744e4ab4ULL,
+    0xe0cdd525e7e64cadULL, 0x1573d68f903ea229ULL, 0x4d7177518651d6f1ULL, 0x11297872d9cbb4eeULL,
+    0x7be8bee8d6e957e8ULL, 0x1b758d848fac54b0ULL, 0xfcba3253df211320ULL, 0x15f7a46a0c89dd59ULL,
+    0x63c8284318e74280ULL, 0x1192e9ee706e4aaeULL, 0x060d0d3827d86a66ULL, 0x1c1e43171a4a1117ULL,
+    0x6b3da42cecad21ebULL, 0x167e9c127b6e7412ULL, 0x88fe1cf0bd574e56ULL, 0x11fee341fc585cdbULL,
+    0x419694b462254a23ULL, 0x1ccb0536608d615fULL, 0x67abaa29e81dd4e9ULL, 0x1708d0f84d3de77fULL,
+    0xb95621bb2017dd87ULL, 0x126d73f9d764b932ULL, 0xc223692b668c95a5ULL, 0x1d7becc2f23ac1eaULL,
+    0xce82ba891ed6de1dULL, 0x179657025b6234bbULL, 0xa53562074bdf1818ULL, 0x12deac01e2b4f6fcULL,
+    0x3b889cd87964f359ULL, 0x1e3113363787f194ULL, 0xfc6d4a46c783f5e1ULL, 0x18274291c6065adcULL,
+    0x30576e9f06032b1aULL, 0x13529ba7d19eaf17ULL, 0x1a257dcb3cd1de90ULL, 0x1eea92a61c311825ULL,
+    0x481dfe3c30a7e540ULL, 0x18bba884e35a79b7ULL, 0xd34b31c9c0865100ULL, 0x13c9539d82aec7c5ULL,
+    0x5211e942cda3b4cdULL, 0x1fa885c8d117a609ULL, 0x74db21023e1c90a4ULL, 0x19539e3a40dfb807ULL,
+    0xf715b401cb4a0d50ULL, 0x1442e4fb67196005ULL, 0xf8de299b09080aa7ULL, 0x103583fc527ab337ULL,
+    0x8e304291a80cddd7ULL, 0x19ef3993b72ab859ULL, 0x3e8d020e200a4b13ULL, 0x14bf6142f8eef9e1ULL,
+    0x653d9b3e80083c0fULL, 0x10991a9bfa58c7e7ULL, 0x6ec8f864000d2ce4ULL, 0x1a8e90f9908e0ca5ULL,
+    0x8bd3f9e999a423eaULL, 0x153eda614071a3b7ULL, 0x3ca994bae1501cbbULL, 0x10ff151a99f482f9ULL,
+    0xc775bac49bb3612bULL, 0x1b31bb5dc320d18eULL, 0xd2c4956a16291a89ULL, 0x15c162b168e70e0bULL,
+    0xdbd0778811ba7ba1ULL, 0x11678227871f3e6fULL, 0x2c80bf401c5d929bULL, 0x1bd8d03f3e9863e6ULL,
+    0xbd33cc3349e47549ULL, 0x16470cff6546b651ULL, 0xca8fd68f6e505dd4ULL, 0x11d270cc51055ea7ULL,
+    0x4419574be3b3c953ULL, 0x1c83e7ad4e6efdd9ULL, 0x0347790982f63aa9ULL, 0x16cfec8aa52597e1ULL,
+    0xcf6c60d468c4fbbaULL, 0x123ff06eea847980ULL, 0xe57a34870e07f92aULL, 0x1d331a4b10d3f59aULL,
+    0x512e906c0b399422ULL, 0x175c1508da432ae2ULL, 0xda8ba6bcd5c7a9b5ULL, 0x12b010d3e1cf5581ULL,
+    0x90df712e22d90f87ULL, 0x1de6815302e5559cULL, 0xda4c5a8b4f140c6cULL, 0x17eb9aa8cf1dde16ULL,
+    0xaea37ba2a5a9a38aULL, 0x1322e220a5b17e78ULL, 0x7dd25f6aa2a905a9ULL, 0x1e9e369aa2b59727ULL,
+    0x97db7f888220d154ULL, 0x187e92154ef7ac1fULL, 0x797c6606ce80a777ULL, 0x139874ddd8c6234cULL,
+    0x8f2d700ae4010bf1ULL, 0x1f5a549627a36badULL, 0x0c2459a25000d65aULL, 0x191510781fb5efbeULL,
+    0x701d1481d99a4515ULL, 0x1410d9f9b2f7f2feULL, 0xc017439b147b6a77ULL, 0x100d7b2e28c65bfeULL,
+    0xccf205c4ed9243f2ULL, 0x19af2b7d0e0a2ccaULL, 0x0a5b37d0be0e9cc2ULL, 0x148c22ca71a1bd6fULL,
+    0x0848f973cb3ee3ceULL, 0x10701bd527b4978cULL, 0xda0e5bec78649fb0ULL, 0x1a4cf9550c5425acULL,
+    0x7b3eaff060507fc0ULL, 0x150a6110d6a9b7bdULL, 0x95cbbff380406633ULL, 0x10d51a73deee2c97ULL,
+    0xefac665266cd7052ULL, 0x1aee90b964b04758ULL, 0x2623850eb8a459dbULL, 0x158ba6fab6f36c47ULL,
+    0x1e82d0d893b6ae49ULL, 0x113c85955f29236cULL, 0xfd9e1af41f8ab075ULL, 0x1b9408eefea838acULL,
+    0x97b1af29b2d559f7ULL, 0x16100725988693bdULL, 0xac8e25baf5777b2cULL, 0x11a66c1e139edc97ULL,
+    0x7a7d092b2258c513ULL, 0x1c3d79c9b8fe2dbfULL, 0x61fda0ef4ead6a76ULL, 0x169794a160cb57ccULL,
+    0xe7fe1a590bbdeec5ULL, 0x1212dd4de7091309ULL, 0xa6635d5b45fcb13aULL, 0x1ceafbafd80e84dcULL,
+    0x851c4aaf6b308dc8ULL, 0x172262f3133ed0b0ULL, 0xd0e36ef2bc26d7d4ULL, 0x1281e8c275cbda26ULL,
+    0xb49f17eac6a48c86ULL, 0x1d9ca79d894629d7ULL, 0x2a18dfef0550706bULL, 0x17b08617a104ee46ULL,
+    0x54e0b3259dd9f389ULL, 0x12f39e794d9d8b6bULL, 0x87cdeb6f62f65274ULL, 0x1e5297287c2f4578ULL,
+    0xd30b22bf825ea85dULL, 0x18421286c9bf6ac6ULL, 0x0f3c1bcc684bb9e4ULL, 0x13680ed23aff889fULL,
+    0x18602c7a4079296dULL, 0x1f0ce4839198da98ULL, 0x46b356c833942124ULL, 0x18d71d360e13e213ULL,
+    0x388f78a029434db6ULL, 0x13df4a91a4dcb4dcULL, 0x5a7f2766a86baf8aULL, 0x1fcbaa82a1612160ULL,
+    0x153285ebb9efbfa2ULL, 0x196fbb9bb44db44dULL, 0xaa8ed189618c994eULL, 0x145962e2f6a4903dULL,
+    0xeed8a7a11ad6e10cULL, 0x1047824f2bb6d9caULL, 0x7e27729b5e249b45ULL, 0x1a0c03b1df8af611ULL,
+    0xfe85f549181d4904ULL, 0x14d6695b193bf80dULL, 0xcb9e5dd4134aa0d0ULL, 0x10ab877c142ff9a4ULL,
+    0xdf63c9535211014dULL, 0x1aac0bf9b9e65c3aULL, 0x191ca10f74da6771ULL, 0x15566ffafb1eb02fULL,
+    0xadb080d92a4852c1ULL, 0x1111f32f2f4bc025ULL, 0x15e7348eaa0d5134ULL, 0x1b4feb7eb212cd09ULL,
+    0xab1f5d3eee710dc4ULL, 0x15d98932280f0a6dULL, 0xbc1917658b8da49dULL, 0x117ad428200c0857ULL,
+    0x2cf4f23c127c3a94ULL, 0x1bf7b9d9cce00d59ULL, 0xf0c3f4fcdb969543ULL, 0x165fc7e170b33de0ULL,
+    0x5a365d9716121103ULL, 0x11e6398126f5cb1aULL, 0x9056fc24f01ce804ULL, 0x1ca38f350b22de90ULL,
+    0xd9df301d8ce3ecd0ULL, 0x16e93f5da2824ba6ULL, 0xe17f59b13d8323daULL, 0x125432b14ecea2ebULL,
+    0x68cbc2b52f38395cULL, 0x1d53844ee47dd179ULL, 0x53d6355dbf602de3ULL, 0x177603725064a794ULL,
+    0xa9782ab165e68b1cULL, 0x12c4cf8ea6b6ec76ULL, 0x0f26aab56fd744faULL, 0x1e07b27dd78b13f1ULL,
+    0x3f52222abfdf6a62ULL, 0x18062864ac6f4327ULL, 0x65db4e88997f884eULL, 0x1338205089f29c1fULL,
+    0x6fc54a7428cc0d4aULL, 0x1ec033b40fea9365ULL, 0x596aa1f68709a43bULL, 0x1899c2f673220f84ULL,
+    0xadeee7f86c07b696ULL, 0x13ae3591f5b4d936ULL, 0x497e3ff3e00c5756ULL, 0x1f7d228322baf524ULL,
+    0xd464fff64cd6ac45ULL, 0x1930e868e89590e9ULL, 0x4383fff83d7889d1ULL, 0x14272053ed4473eeULL,
+    0xcf9cccc69793a174ULL, 0x101f4d0ff1038ff1ULL, 0x7f6147a425b90252ULL, 0x19cbae7fe805b31cULL,
+    0xcc4dd2e9b7c7350fULL, 0x14a2f1ffecd15c16ULL, 0x3d0b0f215fd290d9ULL, 0x10825b3323dab012ULL,
+    0x61ab4b689950e7c1ULL, 0x1a6a2b85062ab350ULL, 0x4e22a2ba1440b967ULL, 0x1521bc6a6b555c40ULL,
+    0x0b4ee894dd009453ULL, 0x10e7c9eebc4449cdULL, 0x1217da87c800ed51ULL, 0x1b0c764ac6d3a948ULL,
+    0xdb46486ca000bddaULL, 0x15a391d56bdc876cULL, 0x490506bd4ccd64afULL, 0x114fa7ddefe39f8aULL,
+    0xa8080ac87ae23ab1ULL, 0x1bb2a62fe638ff43ULL, 0x5339a239fbe82ef4ULL, 0x162884f31e93ff69ULL,
+    0x75c7b4fb2fecf25dULL, 0x11ba03f5b20fff87ULL, 0x22d92191e647ea2eULL, 0x1c5cd322b67fff3fULL,
+    0xb57a8141850654f2ULL, 0x16b0a8e891ffff65ULL, 0xc4620101373843f5ULL, 0x1226ed86db3332b7ULL,
+    0x3a366801f1f39feeULL, 0x1d0b15a491eb8459ULL, 0xfb5eb99b27f6198bULL, 0x173c115074bc69e0ULL,
+    0x2f7efae2865e7ad6ULL, 0x129674405d6387e7ULL, 0xe597f7d0d6fd9156ULL, 0x1dbd86cd6238d971ULL,
+    0x8479930d78cadaabULL, 0x17cad23de82d7ac1ULL, 0xd06142712d6f1556ULL, 0x1308a831868ac89aULL,
+    0x4d686a4eaf182222ULL, 0x1e74404f3daada91ULL, 0xa453883ef279b4e8ULL, 0x185d003f6488aedaULL,
+    0xe9dc6cff28615d87ULL, 0x137d99cc506d58aeULL, 0xa960ae650d6895a4ULL, 0x1f2f5c7a1a488de4ULL,
+    0xbab3beb73ded4483ULL, 0x18f2b061aea07183ULL, 0x2ef6322c318a9d36ULL, 0x13f559e7bee6c136ULL,
+    0xe4bd1d13827761f0ULL, 0x1feef63f97d79b89ULL, 0x83ca7da9352c4e5aULL, 0x198bf832dfdfafa1ULL,
+    0x9ca1fe20f756a515ULL, 0x146ff9c24cb2f2e7ULL, 0x4a1b31b3f9121daaULL, 0x1059949b708f28b9ULL,
+    0x435eb5ecc1b695ddULL, 0x1a28edc580e50df5ULL, 0x35e55e57015ede4aULL, 0x14ed8b04671da4c4ULL,
+    0xc4b77eac0118b1d5ULL, 0x10be08d0527e1d69ULL, 0xa12597799b5ab622ULL, 0x1ac9a7b3b7302f0fULL,
+    0x4db7ac6149155e81ULL, 0x156e1fc2f8f358d9ULL, 0xd7c6238107444b9bULL, 0x1124e63593f5e0adULL,
+    0x593d059b3ed3ac2bULL, 0x1b6e3d2286563449ULL, 0xe0fd9e15cbdc89bcULL, 0x15f1ca820511c36dULL,
+    0xb3fe18116fe3a163ULL, 0x118e3b9b37416924ULL, 0x866359b57fd29bd1ULL, 0x1c16c5c525357507ULL,
+    0xd1e91491330ee30eULL, 0x16789e3750f790d2ULL, 0x74ba76da8f3f1c0bULL, 0x11fa182c40c60d75ULL,
+    0xedf72490e531c678ULL, 0x1cc359e067a348bbULL, 0x8b2c1d40b75b052dULL, 0x1702ae4d1fb5d3c9ULL,
+    0x6f567dcd5f7c0424ULL, 0x12688b70e62b0fd4ULL, 0x7ef0c94898c66d06ULL, 0x1d74124e3d11b2edULL,
+    0x98c0a106e09ebd9fULL, 0x17900ea4fda7c257ULL, 0x470080d24d4bcae6ULL, 0x12d9a550caec9b79ULL,
+    0xd800ce1d487944a2ULL, 0x1e29088144adc58eULL, 0x1333d8176d2dd082ULL, 0x1820d39a9d57d13fULL,
+    0xa8f646792424a6ceULL, 0x134d76154aaca765ULL, 0x74bd3d8ea03aa47dULL, 0x1ee25688777aa56fULL,
+    0x5d64313ee6955064ULL, 0x18b51206c5fbb78cULL, 0x4ab68dcbebaaa6b7ULL, 0x13c40e6bd1962c70ULL,
+    0x1124161312aaa457ULL, 0x1fa01712e8f0471aULL, 0xda8344dc0eeee9dfULL, 0x194cdf4253f36c14ULL,
+    0xe2029d7cd8bf2180ULL, 0x143d7f6843292343ULL, 0x4e687dfd7a328133ULL, 0x103132b9cf541c36ULL,
+    0x4a40c9959050ceb8ULL, 0x19e851294bb9c6bdULL, 0x0833d477a6a70bc6ULL, 0x14b9da876fc7d231ULL,
+    0xa02976c61eec096bULL, 0x1094aed2bfd30e8dULL, 0x004257a364acdbdfULL, 0x1a877e1dffb81749ULL,
+    0xcd01dfb5ea23e319ULL, 0x153931b1996012a0ULL, 0x70ce4c91881cb5aeULL, 0x10fa8e27ade6754dULL,
+    0x1ae3adb5a69455e2ULL, 0x1b2a7d0c4970bbafULL, 0x7be957c4854377e8ULL, 0x15bb973d078d62f2ULL,
+    0xc987796a0435f987ULL, 0x1162df64060ab58eULL, 0x75a58f1006bcc271ULL, 0x1bd1656cd67788e4ULL,
+    0xf7b7a5a66bca3527ULL, 0x16411df0ab92d3e9ULL, 0x5fc61e1ebca1c41fULL, 0x11cdb18d560f0feeULL,
+    0xffa363646102d365ULL, 0x1c7c4f4889b1b316ULL, 0x32e91c504d9bdc51ULL, 0x16c9d906d48e28dfULL,
+    0x8f20e37371497d0eULL, 0x123b140576d820b2ULL, 0x7e9b0585820f2e7cULL, 0x1d2b533bf159cdeaULL,
+    0xcbaf379e01a5becaULL, 0x1755dc2ff447d7eeULL, 0x0958f94b348498a1ULL, 0x12ab168cc36cacbfULL,
+};
+
+#define STR_UNICODE_VERSION "14.0.0"
+
+/*Character classes of ASCII code points*/
+const uint32_t __str_asciiclass[128] = {
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000010, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000010, 0x00000010, 0x00000010,
+    0x00000010, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000025, 0x00000025, 0x00000025, 0x00000025, 0x00000025, 0x00000025, 0x00000025,
+    0x00000025, 0x00000025, 0x00000025, 0x00000025, 0x00000025, 0x00000025, 0x00000025, 0x00000025,
+    0x00000025, 0x00000025, 0x00000025, 0x00000025, 0x00000025, 0x00000025, 0x00000025, 0x00000025,
+    0x00000025, 0x00000025, 0x00000025, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000029, 0x00000029, 0x00000029, 0x00000029, 0x00000029, 0x00000029, 0x00000029,
+    0x00000029, 0x00000029, 0x00000029, 0x00000029, 0x00000029, 0x00000029, 0x00000029, 0x00000029,
+    0x00000029, 0x00000029, 0x00000029, 0x00000029, 0x00000029, 0x00000029, 0x00000029, 0x00000029,
+    0x00000029, 0x00000029, 0x00000029, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
+
+/*Character class ranges of the other code points, (first | class << 24, last) pairs*/
+const uint32_t __str_uniclass[3848] = {
+    0x10000085, 0x00000085, 0x100000a0, 0x000000a0, 0x290000aa, 0x000000aa, 0x290000b5, 0x000000b5,
+    0x290000ba, 0x000000ba, 0x250000c0, 0x000000d6, 0x250000d8, 0x000000de, 0x290000df, 0x000000f6,
+    0x290000f8, 0x000000ff, 0x25000100, 0x00000100, 0x29000101, 0x00000101, 0x25000102, 0x00000102,
+    0x29000103, 0x00000103, 0x25000104, 0x00000104, 0x29000105, 0x00000105, 0x25000106, 0x00000106,
+    0x29000107, 0x00000107, 0x25000108, 0x00000108, 0x29000109, 0x00000109, 0x2500010a, 0x0000010a,
+    0x2900010b, 0x0000010b, 0x2500010c, 0x0000010c, 0x2900010d, 0x0000010d, 0x2500010e, 0x0000010e,
+    0x2900010f, 0x0000010f, 0x25000110, 0x00000110, 0x29000111, 0x00000111, 0x25000112, 0x00000112,
+    0x29000113, 0x00000113, 0x25000114, 0x00000114, 0x29000115, 0x00000115, 0x25000116, 0x00000116,
+    0x29000117, 0x00000117, 0x25000118, 0x00000118, 0x29000119, 0x00000119, 0x2500011a, 0x0000011a,
+    0x2900011b, 0x0000011b, 0x2500011c, 0x0000011c, 0x2900011d, 0x0000011d, 0x2500011e, 0x0000011e,
+    0x2900011f, 0x0000011f, 0x25000120, 0x00000120, 0x29000121, 0x00000121, 0x25000122, 0x00000122,
+    0x29000123, 0x00000123, 0x25000124, 0x00000124, 0x29000125, 0x00000125, 0x25000126, 0x00000126,
+    0x29000127, 0x00000127, 0x25000128, 0x00000128, 0x29000129, 0x00000129, 0x2500012a, 0x0000012a,
+    0x2900012b, 0x0000012b, 0x2500012c, 0x0000012c, 0x2900012d, 0x0000012d, 0x2500012e, 0x0000012e,
+    0x2900012f, 0x0000012f, 0x25000130, 0x00000130, 0x29000131, 0x00000131, 0x25000132, 0x00000132,
+    0x29000133, 0x00000133, 0x25000134, 0x00000134, 0x29000135, 0x00000135, 0x25000136, 0x00000136,
+    0x29000137, 0x00000138, 0x25000139, 0x00000139, 0x2900013a, 0x0000013a, 0x2500013b, 0x0000013b,
+    0x2900013c, 0x0000013c, 0x2500013d, 0x0000013d, 0x2900013e, 0x0000013e, 0x2500013f, 0x0000013f,
+    0x29000140, 0x00000140, 0x25000141, 0x00000141, 0x29000142, 0x00000142, 0x25000143, 0x00000143,
+    0x29000144, 0x00000144, 0x25000145, 0x00000145, 0x29000146, 0x00000146, 0x25000147, 0x00000147,
+    0x29000148, 0x00000149, 0x2500014a, 0x0000014a, 0x2900014b, 0x0000014b, 0x2500014c, 0x0000014c,
+    0x2900014d, 0x0000014d, 0x2500014e, 0x0000014e, 0x2900014f, 0x0000014f, 0x25000150, 0x00000150,
+    0x29000151, 0x00000151, 0x25000152, 0x00000152, 0x29000153, 0x00000153, 0x25000154, 0x00000154,
+    0x29000155, 0x00000155, 0x25000156, 0x00000156, 0x29000157, 0x00000157, 0x25000158, 0x00000158,
+    0x29000159, 0x00000159, 0x2500015a, 0x0000015a, 0x2900015b, 0x0000015b, 0x2500015c, 0x0000015c,
+    0x2900015d, 0x0000015d, 0x2500015e, 0x0000015e, 0x2900015f, 0x0000015f, 0x25000160, 0x00000160,
+    0x29000161, 0x00000161, 0x25000162, 0x00000162, 0x29000163, 0x00000163, 0x25000164, 0x00000164,
+    0x29000165, 0x00000165, 0x25000166, 0x00000166, 0x29000167, 0x00000167, 0x25000168, 0x00000168,
+    0x29000169, 0x00000169, 0x2500016a, 0x0000016a, 0x2900016b, 0x0000016b, 0x2500016c, 0x0000016c,
+    0x2900016d, 0x0000016d, 0x2500016e, 0x0000016e, 0x2900016f, 0x0000016f, 0x25000170, 0x00000170,
+    0x29000171, 0x00000171, 0x25000172, 0x00000172, 0x29000173, 0x00000173, 0x25000174, 0x00000174,
+    0x29000175, 0x00000175, 0x25000176, 0x00000176, 0x29000177, 0x00000177, 0x25000178, 0x00000179,
+    0x2900017a, 0x0000017a, 0x2500017b, 0x0000017b, 0x2900017c, 0x0000017c, 0x2500017d, 0x0000017d,
+    0x2900017e, 0x00000180, 0x25000181, 0x00000182, 0x29000183, 0x00000183, 0x25000184, 0x00000184,
+    0x29000185, 0x00000185, 0x25000186, 0x00000187, 0x29000188, 0x00000188, 0x25000189, 0x0000018b,
+    0x2900018c, 0x0000018d, 0x2500018e, 0x00000191, 0x29000192, 0x00000192, 0x25000193, 0x00000194,
+    0x29000195, 0x00000195, 0x25000196, 0x00000198, 0x29000199, 0x0000019b, 0x2500019c, 0x0000019d,
+    0x2900019e, 0x0000019e, 0x2500019f, 0x000001a0, 0x290001a1, 0x000001a1, 0x250001a2, 0x000001a2,
+    0x290001a3, 0x000001a3, 0x250001a4, 0x000001a4, 0x290001a5, 0x000001a5, 0x250001a6, 0x000001a7,
+    0x290001a8, 0x000001a8, 0x250001a9, 0x000001a9, 0x290001aa, 0x000001ab, 0x250001ac, 0x000001ac,
+    0x290001ad, 0x000001ad, 0x250001ae, 0x000001af, 0x290001b0, 0x000001b0, 0x250001b1, 0x000001b3,
+    0x290001b4, 0x000001b4, 0x250001b5, 0x000001b5, 0x290001b6, 0x000001b6, 0x250001b7, 0x000001b8,
+    0x290001b9, 0x000001ba, 0x010001bb, 0x000001bb, 0x250001bc, 0x000001bc, 0x290001bd, 0x000001bf,
+    0x010001c0, 0x000001c3, 0x250001c4, 0x000001c4, 0x210001c5, 0x000001c5, 0x290001c6, 0x000001c6,
+    0x250001c7, 0x000001c7, 0x210001c8, 0x000001c8, 0x290001c9, 0x000001c9, 0x250001ca, 0x000001ca,
+    0x210001cb, 0x000001cb, 0x290001cc, 0x000001cc, 0x250001cd, 0x000001cd, 0x290001ce, 0x000001ce,
+    0x250001cf, 0x000001cf, 0x290001d0, 0x000001d0, 0x250001d1, 0x000001d1, 0x290001d2, 0x000001d2,
+    0x250001d3, 0x000001d3, 0x290001d4, 0x000001d4, 0x250001d5, 0x000001d5, 0x290001d6, 0x000001d6,
+    0x250001d7, 0x000001d7, 0x290001d8, 0x000001d8, 0x250001d9, 0x000001d9, 0x290001da, 0x000001da,
+    0x250001db, 0x000001db, 0x290001dc, 0x000001dd, 0x250001de, 0x000001de, 0x290001df, 0x000001df,
+    0x250001e0, 0x000001e0, 0x290001e1, 0x000001e1, 0x250001e2, 0x000001e2, 0x290001e3, 0x000001e3,
+    0x250001e4, 0x000001e4, 0x290001e5, 0x000001e5, 0x250001e6, 0x000001e6, 0x290001e7, 0x000001e7,
+    0x250001e8, 0x000001e8, 0x290001e9, 0x000001e9, 0x250001ea, 0x000001ea, 0x290001eb, 0x000001eb,
+    0x250001ec, 0x000001ec, 0x290001ed, 0x000001ed, 0x250001ee, 0x000001ee, 0x290001ef, 0x000001f0,
+    0x250001f1, 0x000001f1, 0x210001f2, 0x000001f2, 0x290001f3, 0x000001f3, 0x250001f4, 0x000001f4,
+    0x290001f5, 0x000001f5, 0x250001f6, 0x000001f8, 0x290001f9, 0x000001f9, 0x250001fa, 0x000001fa,
+    0x290001fb, 0x000001fb, 0x250001fc, 0x000001fc, 0x290001fd, 0x000001fd, 0x250001fe, 0x000001fe,
+    0x290001ff, 0x000001ff, 0x25000200, 0x00000200, 0x29000201, 0x00000201, 0x25000202, 0x00000202,
+    0x29000203, 0x00000203, 0x25000204, 0x00000204, 0x29000205, 0x00000205, 0x25000206, 0x00000206,
+    0x29000207, 0x00000207, 0x25000208, 0x00000208, 0x29000209, 0x00000209, 0x2500020a, 0x0000020a,
+    0x2900020b, 0x0000020b, 0x2500020c, 0x0000020c, 0x2900020d, 0x0000020d, 0x2500020e, 0x0000020e,
+    0x2900020f, 0x0000020f, 0x25000210, 0x00000210, 0x29000211, 0x00000211, 0x25000212, 0x00000212,
+    0x29000213, 0x00000213, 0x25000214, 0x00000214, 0x29000215, 0x00000215, 0x25000216, 0x00000216,
+    0x29000217, 0x00000217, 0x25000218, 0x00000218, 0x29000219, 0x00000219, 0x2500021a, 0x0000021a,
+    0x2900021b, 0x0000021b, 0x2500021c, 0x0000021c, 0x2900021d, 0x0000021d, 0x2500021e, 0x0000021e,
+    0x2900021f, 0x0000021f, 0x25000220, 0x00000220, 0x29000221, 0x00000221, 0x25000222, 0x00000222,
+    0x29000223, 0x00000223, 0x25000224, 0x00000224, 0x29000225, 0x00000225, 0x25000226, 0x00000226,
+    0x29000227, 0x00000227, 0x25000228, 0x00000228, 0x29000229, 0x00000229, 0x2500022a, 0x0000022a,
+    0x2900022b, 0x0000022b, 0x2500022c, 0x0000022c, 0x2900022d, 0x0000022d, 0x2500022e, 0x0000022e,
+    0x2900022f, 0x0000022f, 0x25000230, 0x00000230, 0x29000231, 0x00000231, 0x25000232, 0x00000232,
+    0x29000233, 0x00000239, 0x2500023a, 0x0000023b, 0x2900023c, 0x0000023c, 0x2500023d, 0x0000023e,
+    0x2900023f, 0x00000240, 0x25000241, 0x00000241, 0x29000242, 0x00000242, 0x25000243, 0x00000246,
+    0x29000247, 0x00000247, 0x25000248, 0x00000248, 0x29000249, 0x00000249, 0x2500024a, 0x0000024a,
+    0x2900024b, 0x0000024b, 0x2500024c, 0x0000024c, 0x2900024d, 0x0000024d, 0x2500024e, 0x0000024e,
+    0x2900024f, 0x00000293, 0x01000294, 0x00000294, 0x29000295, 0x000002b8, 0x010002b9, 0x000002bf,
+    0x290002c0, 0x000002c1, 0x010002c6, 0x000002d1, 0x290002e0, 0x000002e4, 0x010002ec, 0x000002ec,
+    0x010002ee, 0x000002ee, 0x28000345, 0x00000345, 0x25000370, 0x00000370, 0x29000371, 0x00000371,
+    0x25000372, 0x00000372, 0x29000373, 0x00000373, 0x01000374, 0x00000374, 0x25000376, 0x00000376,
+    0x29000377, 0x00000377, 0x2900037a, 0x0000037d, 0x2500037f, 0x0000037f, 0x25000386, 0x00000386,
+    0x25000388, 0x0000038a, 0x2500038c, 0x0000038c, 0x2500038e, 0x0000038f, 0x29000390, 0x00000390,
+    0x25000391, 0x000003a1, 0x250003a3, 0x000003ab, 0x290003ac, 0x000003ce, 0x250003cf, 0x000003cf,
+    0x290003d0, 0x000003d1, 0x250003d2, 0x000003d4, 0x290003d5, 0x000003d7, 0x250003d8, 0x000003d8,
+    0x290003d9, 0x000003d9, 0x250003da, 0x000003da, 0x290003db, 0x000003db, 0x250003dc, 0x000003dc,
+    0x290003dd, 0x000003dd, 0x250003de, 0x000003de, 0x290003df, 0x000003df, 0x250003e0, 0x000003e0,
+    0x290003e1, 0x000003e1, 0x250003e2, 0x000003e2, 0x290003e3, 0x000003e3, 0x250003e4, 0x000003e4,
+    0x290003e5, 0x000003e5, 0x250003e6, 0x000003e6, 0x290003e7, 0x000003e7, 0x250003e8, 0x000003e8,
+    0x290003e9, 0x000003e9, 0x250003ea, 0x000003ea, 0x290003eb, 0x000003eb, 0x250003ec, 0x000003ec,
+    0x290003ed, 0x000003ed, 0x250003ee, 0x000003ee, 0x290003ef, 0x000003f3, 0x250003f4, 0x000003f4,
+    0x290003f5, 0x000003f5, 0x250003f7, 0x000003f7, 0x290003f8, 0x000003f8, 0x250003f9, 0x000003fa,
+    0x290003fb, 0x000003fc, 0x250003fd, 0x0000042f, 0x29000430, 0x0000045f, 0x25000460, 0x00000460,
+    0x29000461, 0x00000461, 0x25000462, 0x00000462, 0x29000463, 0x00000463, 0x25000464, 0x00000464,
+    0x29000465, 0x00000465, 0x25000466, 0x00000466, 0x29000467, 0x00000467, 0x25000468, 0x00000468,
+    0x29000469, 0x00000469, 0x2500046a, 0x0000046a, 0x2900046b, 0x0000046b, 0x2500046c, 0x0000046c,
+    0x2900046d, 0x0000046d, 0x2500046e, 0x0000046e, 0x2900046f, 0x0000046f, 0x25000470, 0x00000470,
+    0x29000471, 0x00000471, 0x25000472, 0x00000472, 0x29000473, 0x00000473, 0x25000474, 0x00000474,
+    0x29000475, 0x00000475, 0x25000476, 0x00000476, 0x29000477, 0x00000477, 0x25000478, 0x00000478,
+    0x29000479, 0x00000479, 0x2500047a, 0x0000047a, 0x2900047b, 0x0000047b, 0x2500047c, 0x0000047c,
+    0x2900047d, 0x0000047d, 0x2500047e, 0x0000047e, 0x2900047f, 0x0000047f, 0x25000480, 0x00000480,
+    0x29000481, 0x00000481, 0x2500048a, 0x0000048a, 0x2900048b, 0x0000048b, 0x2500048c, 0x0000048c,
+    0x2900048d, 0x0000048d, 0x2500048e, 0x0000048e, 0x2900048f, 0x0000048f, 0x25000490, 0x00000490,
+    0x29000491, 0x00000491, 0x25000492, 0x00000492, 0x29000493, 0x00000493, 0x25000494, 0x00000494,
+    0x29000495, 0x00000495, 0x25000496, 0x00000496, 0x29000497, 0x00000497, 0x25000498, 0x00000498,
+    0x29000499, 0x00000499, 0x2500049a, 0x0000049a, 0x2900049b, 0x0000049b, 0x2500049c, 0x0000049c,
+    0x2900049d, 0x0000049d, 0x2500049e, 0x0000049e, 0x2900049f, 0x0000049f, 0x250004a0, 0x000004a0,
+    0x290004a1, 0x000004a1, 0x250004a2, 0x000004a2, 0x290004a3, 0x000004a3, 0x250004a4, 0x000004a4,
+    0x290004a5, 0x000004a5, 0x250004a6, 0x000004a6, 0x290004a7, 0x000004a7, 0x250004a8, 0x000004a8,
+    0x290004a9, 0x000004a9, 0x250004aa, 0x000004aa, 0x290004ab, 0x000004ab, 0x250004ac, 0x000004ac,
+    0x290004ad, 0x000004ad, 0x250004ae, 0x000004ae, 0x290004af, 0x000004af, 0x250004b0, 0x000004b0,
+    0x290004b1, 0x000004b1, 0x250004b2, 0x000004b2, 0x290004b3, 0x000004b3, 0x250004b4, 0x000004b4,
+    0x290004b5, 0x000004b5, 0x250004b6, 0x000004b6, 0x290004b7, 0x000004b7, 0x250004b8, 0x000004b8,
+    0x290004b9, 0x000004b9, 0x250004ba, 0x000004ba, 0x290004bb, 0x000004bb, 0x250004bc, 0x000004bc,
+    0x290004bd, 0x000004bd, 0x250004be, 0x000004be, 0x290004bf, 0x000004bf, 0x250004c0, 0x000004c1,
+    0x290004c2, 0x000004c2, 0x250004c3, 0x000004c3, 0x290004c4, 0x000004c4, 0x250004c5, 0x000004c5,
+    0x290004c6, 0x000004c6, 0x250004c7, 0x000004c7, 0x290004c8, 0x000004c8, 0x250004c9, 0x000004c9,
+    0x290004ca, 0x000004ca, 0x250004cb, 0x000004cb, 0x290004cc, 0x000004cc, 0x250004cd, 0x000004cd,
+    0x290004ce, 0x000004cf, 0x250004d0, 0x000004d0, 0x290004d1, 0x000004d1, 0x250004d2, 0x000004d2,
+    0x290004d3, 0x000004d3, 0x250004d4, 0x000004d4, 0x290004d5, 0x000004d5, 0x250004d6, 0x000004d6,
+    0x290004d7, 0x000004d7, 0x250004d8, 0x000004d8, 0x290004d9, 0x000004d9, 0x250004da, 0x000004da,
+    0x290004db, 0x000004db, 0x250004dc, 0x000004dc, 0x290004dd, 0x000004dd, 0x250004de, 0x000004de,
+    0x290004df, 0x000004df, 0x250004e0, 0x000004e0, 0x290004e1, 0x000004e1, 0x250004e2, 0x000004e2,
+    0x290004e3, 0x000004e3, 0x250004e4, 0x000004e4, 0x290004e5, 0x000004e5, 0x250004e6, 0x000004e6,
+    0x290004e7, 0x000004e7, 0x250004e8, 0x000004e8, 0x290004e9, 0x000004e9, 0x250004ea, 0x000004ea,
+    0x290004eb, 0x000004eb, 0x250004ec, 0x000004ec, 0x290004ed, 0x000004ed, 0x250004ee, 0x000004ee,
+    0x290004ef, 0x000004ef, 0x250004f0, 0x000004f0, 0x290004f1, 0x000004f1, 0x250004f2, 0x000004f2,
+    0x290004f3, 0x000004f3, 0x250004f4, 0x000004f4, 0x290004f5, 0x000004f5, 0x250004f6, 0x000004f6,
+    0x290004f7, 0x000004f7, 0x250004f8, 0x000004f8, 0x290004f9, 0x000004f9, 0x250004fa, 0x000004fa,
+    0x290004fb, 0x000004fb, 0x250004fc, 0x000004fc, 0x290004fd, 0x000004fd, 0x250004fe, 0x000004fe,
+    0x290004ff, 0x000004ff, 0x25000500, 0x00000500, 0x29000501, 0x00000501, 0x25000502, 0x00000502,
+    0x29000503, 0x00000503, 0x25000504, 0x00000504, 0x29000505, 0x00000505, 0x25000506, 0x00000506,
+    0x29000507, 0x00000507, 0x25000508, 0x00000508, 0x29000509, 0x00000509, 0x2500050a, 0x0000050a,
+    0x2900050b, 0x0000050b, 0x2500050c, 0x0000050c, 0x2900050d, 0x0000050d, 0x2500050e, 0x0000050e,
+    0x2900050f, 0x0000050f, 0x25000510, 0x00000510, 0x29000511, 0x00000511, 0x25000512, 0x00000512,
+    0x29000513, 0x00000513, 0x25000514, 0x00000514, 0x29000515, 0x00000515, 0x25000516, 0x00000516,
+    0x29000517, 0x00000517, 0x25000518, 0x00000518, 0x29000519, 0x00000519, 0x2500051a, 0x0000051a,
+    0x2900051b, 0x0000051b, 0x2500051c, 0x0000051c, 0x2900051d, 0x0000051d, 0x2500051e, 0x0000051e,
+    0x2900051f, 0x0000051f, 0x25000520, 0x00000520, 0x29000521, 0x00000521, 0x25000522, 0x00000522,
+    0x29000523, 0x00000523, 0x25000524, 0x00000524, 0x29000525, 0x00000525, 0x25000526, 0x00000526,
+    0x29000527, 0x00000527, 0x25000528, 0x00000528, 0x29000529, 0x00000529, 0x2500052a, 0x0000052a,
+    0x2900052b, 0x0000052b, 0x2500052c, 0x0000052c, 0x2900052d, 0x0000052d, 0x2500052e, 0x0000052e,
+    0x2900052f, 0x0000052f, 0x25000531, 0x00000556, 0x01000559, 0x00000559, 0x29000560, 0x00000588,
+    0x010005d0, 0x000005ea, 0x010005ef, 0x000005f2, 0x01000620, 0x0000064a, 0x02000660, 0x00000669,
+    0x0100066e, 0x0000066f, 0x01000671, 0x000006d3, 0x010006d5, 0x000006d5, 0x010006e5, 0x000006e6,
+    0x010006ee, 0x000006ef, 0x020006f0, 0x000006f9, 0x010006fa, 0x000006fc, 0x010006ff, 0x000006ff,
+    0x01000710, 0x00000710, 0x01000712, 0x0000072f, 0x0100074d, 0x000007a5, 0x010007b1, 0x000007b1,
+    0x020007c0, 0x000007c9, 0x010007ca, 0x000007ea, 0x010007f4, 0x000007f5, 0x010007fa, 0x000007fa,
+    0x01000800, 0x00000815, 0x0100081a, 0x0000081a, 0x01000824, 0x00000824, 0x01000828, 0x00000828,
+    0x01000840, 0x00000858, 0x01000860, 0x0000086a, 0x01000870, 0x00000887, 0x01000889, 0x0000088e,
+    0x010008a0, 0x000008c9, 0x01000904, 0x00000939, 0x0100093d, 0x0000093d, 0x01000950, 0x00000950,
+    0x01000958, 0x00000961, 0x02000966, 0x0000096f, 0x01000971, 0x00000980, 0x01000985, 0x0000098c,
+    0x0100098f, 0x00000990, 0x01000993, 0x000009a8, 0x010009aa, 0x000009b0, 0x010009b2, 0x000009b2,
+    0x010009b6, 0x000009b9, 0x010009bd, 0x000009bd, 0x010009ce, 0x000009ce, 0x010009dc, 0x000009dd,
+    0x010009df, 0x000009e1, 0x020009e6, 0x000009ef, 0x010009f0, 0x000009f1, 0x010009fc, 0x000009fc,
+    0x01000a05, 0x00000a0a, 0x01000a0f, 0x00000a10, 0x01000a13, 0x00000a28, 0x01000a2a, 0x00000a30,
+    0x01000a32, 0x00000a33, 0x01000a35, 0x00000a36, 0x01000a38, 0x00000a39, 0x01000a59, 0x00000a5c,
+    0x01000a5e, 0x00000a5e, 0x02000a66, 0x00000a6f, 0x01000a72, 0x00000a74, 0x01000a85, 0x00000a8d,
+    0x01000a8f, 0x00000a91, 0x01000a93, 0x00000aa8, 0x01000aaa, 0x00000ab0, 0x01000ab2, 0x00000ab3,
+    0x01000ab5, 0x00000ab9, 0x01000abd, 0x00000abd, 0x01000ad0, 0x00000ad0, 0x01000ae0, 0x00000ae1,
+    0x02000ae6, 0x00000aef, 0x01000af9, 0x00000af9, 0x01000b05, 0x00000b0c, 0x01000b0f, 0x00000b10,
+    0x01000b13, 0x00000b28, 0x01000b2a, 0x00000b30, 0x01000b32, 0x00000b33, 0x01000b35, 0x00000b39,
+    0x01000b3d, 0x00000b3d, 0x01000b5c, 0x00000b5d, 0x01000b5f, 0x00000b61, 0x02000b66, 0x00000b6f,
+    0x01000b71, 0x00000b71, 0x01000b83, 0x00000b83, 0x01000b85, 0x00000b8a, 0x01000b8e, 0x00000b90,
+    0x01000b92, 0x00000b95, 0x01000b99, 0x00000b9a, 0x01000b9c, 0x00000b9c, 0x01000b9e, 0x00000b9f,
+    0x01000ba3, 0x00000ba4, 0x01000ba8, 0x00000baa, 0x01000bae, 0x00000bb9, 0x01000bd0, 0x00000bd0,
+    0x02000be6, 0x00000bef, 0x01000c05, 0x00000c0c, 0x01000c0e, 0x00000c10, 0x01000c12, 0x00000c28,
+    0x01000c2a, 0x00000c39, 0x01000c3d, 0x00000c3d, 0x01000c58, 0x00000c5a, 0x01000c5d, 0x00000c5d,
+    0x01000c60, 0x00000c61, 0x02000c66, 0x00000c6f, 0x01000c80, 0x00000c80, 0x01000c85, 0x00000c8c,
+    0x01000c8e, 0x00000c90, 0x01000c92, 0x00000ca8, 0x01000caa, 0x00000cb3, 0x01000cb5, 0x00000cb9,
+    0x01000cbd, 0x00000cbd, 0x01000cdd, 0x00000cde, 0x01000ce0, 0x00000ce1, 0x02000ce6, 0x00000cef,
+    0x01000cf1, 0x00000cf2, 0x01000d04, 0x00000d0c, 0x01000d0e, 0x00000d10, 0x01000d12, 0x00000d3a,
+    0x01000d3d, 0x00000d3d, 0x01000d4e, 0x00000d4e, 0x01000d54, 0x00000d56, 0x01000d5f, 0x00000d61,
+    0x02000d66, 0x00000d6f, 0x01000d7a, 0x00000d7f, 0x01000d85, 0x00000d96, 0x01000d9a, 0x00000db1,
+    0x01000db3, 0x00000dbb, 0x01000dbd, 0x00000dbd, 0x01000dc0, 0x00000dc6, 0x02000de6, 0x00000def,
+    0x01000e01, 0x00000e30, 0x01000e32, 0x00000e33, 0x01000e40, 0x00000e46, 0x02000e50, 0x00000e59,
+    0x01000e81, 0x00000e82, 0x01000e84, 0x00000e84, 0x01000e86, 0x00000e8a, 0x01000e8c, 0x00000ea3,
+    0x01000ea5, 0x00000ea5, 0x01000ea7, 0x00000eb0, 0x01000eb2, 0x00000eb3, 0x01000ebd, 0x00000ebd,
+    0x01000ec0, 0x00000ec4, 0x01000ec6, 0x00000ec6, 0x02000ed0, 0x00000ed9, 0x01000edc, 0x00000edf,
+    0x01000f00, 0x00000f00, 0x02000f20, 0x00000f29, 0x01000f40, 0x00000f47, 0x01000f49, 0x00000f6c,
+    0x01000f88, 0x00000f8c, 0x01001000, 0x0000102a, 0x0100103f, 0x0000103f, 0x02001040, 0x00001049,
+    0x01001050, 0x00001055, 0x0100105a, 0x0000105d, 0x01001061, 0x00001061, 0x01001065, 0x00001066,
+    0x0100106e, 0x00001070, 0x01001075, 0x00001081, 0x0100108e, 0x0000108e, 0x02001090, 0x00001099,
+    0x250010a0, 0x000010c5, 0x250010c7, 0x000010c7, 0x250010cd, 0x000010cd, 0x290010d0, 0x000010fa,
+    0x010010fc, 0x000010fc, 0x290010fd, 0x000010ff, 0x01001100, 0x00001248, 0x0100124a, 0x0000124d,
+    0x01001250, 0x00001256, 0x01001258, 0x00001258, 0x0100125a, 0x0000125d, 0x01001260, 0x00001288,
+    0x0100128a, 0x0000128d, 0x01001290, 0x000012b0, 0x010012b2, 0x000012b5, 0x010012b8, 0x000012be,
+    0x010012c0, 0x000012c0, 0x010012c2, 0x000012c5, 0x010012c8, 0x000012d6, 0x010012d8, 0x00001310,
+    0x01001312, 0x00001315, 0x01001318, 0x0000135a, 0x01001380, 0x0000138f, 0x250013a0, 0x000013f5,
+    0x290013f8, 0x000013fd, 0x01001401, 0x0000166c, 0x0100166f, 0x0000167f, 0x10001680, 0x00001680,
+    0x01001681, 0x0000169a, 0x010016a0, 0x000016ea, 0x010016f1, 0x000016f8, 0x01001700, 0x00001711,
+    0x0100171f, 0x00001731, 0x01001740, 0x00001751, 0x01001760, 0x0000176c, 0x0100176e, 0x00001770,
+    0x01001780, 0x000017b3, 0x010017d7, 0x000017d7, 0x010017dc, 0x000017dc, 0x020017e0, 0x000017e9,
+    0x02001810, 0x00001819, 0x01001820, 0x00001878, 0x01001880, 0x00001884, 0x01001887, 0x000018a8,
+    0x010018aa, 0x000018aa, 0x010018b0, 0x000018f5, 0x01001900, 0x0000191e, 0x02001946, 0x0000194f,
+    0x01001950, 0x0000196d, 0x01001970, 0x00001974, 0x01001980, 0x000019ab, 0x010019b0, 0x000019c9,
+    0x020019d0, 0x000019d9, 0x01001a00, 0x00001a16, 0x01001a20, 0x00001a54, 0x02001a80, 0x00001a89,
+    0x02001a90, 0x00001a99, 0x01001aa7, 0x00001aa7, 0x01001b05, 0x00001b33, 0x01001b45, 0x00001b4c,
+    0x02001b50, 0x00001b59, 0x01001b83, 0x00001ba0, 0x01001bae, 0x00001baf, 0x02001bb0, 0x00001bb9,
+    0x01001bba, 0x00001be5, 0x01001c00, 0x00001c23, 0x02001c40, 0x00001c49, 0x01001c4d, 0x00001c4f,
+    0x02001c50, 0x00001c59, 0x01001c5a, 0x00001c7d, 0x29001c80, 0x00001c88, 0x25001c90, 0x00001cba,
+    0x25001cbd, 0x00001cbf, 0x01001ce9, 0x00001cec, 0x01001cee, 0x00001cf3, 0x01001cf5, 0x00001cf6,
+    0x01001cfa, 0x00001cfa, 0x29001d00, 0x00001dbf, 0x25001e00, 0x00001e00, 0x29001e01, 0x00001e01,
+    0x25001e02, 0x00001e02, 0x29001e03, 0x00001e03, 0x25001e04, 0x00001e04, 0x29001e05, 0x00001e05,
+    0x25001e06, 0x00001e06, 0x29001e07, 0x00001e07, 0x25001e08, 0x00001e08, 0x29001e09, 0x00001e09,
+    0x25001e0a, 0x00001e0a, 0x29001e0b, 0x00001e0b, 0x25001e0c, 0x00001e0c, 0x29001e0d, 0x00001e0d,
+    0x25001e0e, 0x00001e0e, 0x29001e0f, 0x00001e0f, 0x25001e10, 0x00001e10, 0x29001e11, 0x00001e11,
+    0x25001e12, 0x00001e12, 0x29001e13, 0x00001e13, 0x25001e14, 0x00001e14, 0x29001e15, 0x00001e15,
+    0x25001e16, 0x00001e16, 0x29001e17, 0x00001e17, 0x25001e18, 0x00001e18, 0x29001e19, 0x00001e19,
+    0x25001e1a, 0x00001e1a, 0x29001e1b, 0x00001e1b, 0x25001e1c, 0x00001e1c, 0x29001e1d, 0x00001e1d,
+    0x25001e1e, 0x00001e1e, 0x29001e1f, 0x00001e1f, 0x25001e20, 0x00001e20, 0x29001e21, 0x00001e21,
+    0x25001e22, 0x00001e22, 0x29001e23, 0x00001e23, 0x25001e24, 0x00001e24, 0x29001e25, 0x00001e25,
+    0x25001e26, 0x00001e26, 0x29001e27, 0x00001e27, 0x25001e28, 0x00001e28, 0x29001e29, 0x00001e29,
+    0x25001e2a, 0x00001e2a, 0x29001e2b, 0x00001e2b, 0x25001e2c, 0x00001e2c, 0x29001e2d, 0x00001e2d,
+    0x25001e2e, 0x00001e2e, 0x29001e2f, 0x00001e2f, 0x25001e30, 0x00001e30, 0x29001e31, 0x00001e31,
+    0x25001e32, 0x00001e32, 0x29001e33, 0x00001e33, 0x25001e34, 0x00001e34, 0x29001e35, 0x00001e35,
+    0x25001e36, 0x00001e36, 0x29001e37, 0x00001e37, 0x25001e38, 0x00001e38, 0x29001e39, 0x00001e39,
+    0x25001e3a, 0x00001e3a, 0x29001e3b, 0x00001e3b, 0x25001e3c, 0x00001e3c, 0x29001e3d, 0x00001e3d,
+    0x25001e3e, 0x00001e3e, 0x29001e3f, 0x00001e3f, 0x25001e40, 0x00001e40, 0x29001e41, 0x00001e41,
+    0x25001e42, 0x00001e42, 0x29001e43, 0x00001e43, 0x25001e44, 0x00001e44, 0x29001e45, 0x00001e45,
+    0x25001e46, 0x00001e46, 0x29001e47, 0x00001e47, 0x25001e48, 0x00001e48, 0x29001e49, 0x00001e49,
+    0x25001e4a, 0x00001e4a, 0x29001e4b, 0x00001e4b, 0x25001e4c, 0x00001e4c, 0x29001e4d, 0x00001e4d,
+    0x25001e4e, 0x00001e4e, 0x29001e4f, 0x00001e4f, 0x25001e50, 0x00001e50, 0x29001e51, 0x00001e51,
+    0x25001e52, 0x00001e52, 0x29001e53, 0x00001e53, 0x25001e54, 0x00001e54, 0x29001e55, 0x00001e55,
+    0x25001e56, 0x00001e56, 0x29001e57, 0x00001e57, 0x25001e58, 0x00001e58, 0x29001e59, 0x00001e59,
+    0x25001e5a, 0x00001e5a, 0x29001e5b, 0x00001e5b, 0x25001e5c, 0x00001e5c, 0x29001e5d, 0x00001e5d,
+    0x25001e5e, 0x00001e5e, 0x29001e5f, 0x00001e5f, 0x25001e60, 0x00001e60, 0x29001e61, 0x00001e61,
+    0x25001e62, 0x00001e62, 0x29001e63, 0x00001e63, 0x25001e64, 0x00001e64, 0x29001e65, 0x00001e65,
+    0x25001e66, 0x00001e66, 0x29001e67, 0x00001e67, 0x25001e68, 0x00001e68, 0x29001e69, 0x00001e69,
+    0x25001e6a, 0x00001e6a, 0x29001e6b, 0x00001e6b, 0x25001e6c, 0x00001e6c, 0x29001e6d, 0x00001e6d,
+    0x25001e6e, 0x00001e6e, 0x29001e6f, 0x00001e6f, 0x25001e70, 0x00001e70, 0x29001e71, 0x00001e71,
+    0x25001e72, 0x00001e72, 0x29001e73, 0x00001e73, 0x25001e74, 0x00001e74, 0x29001e75, 0x00001e75,
+    0x25001e76, 0x00001e76, 0x29001e77, 0x00001e77, 0x25001e78, 0x00001e78, 0x29001e79, 0x00001e79,
+    0x25001e7a, 0x00001e7a, 0x29001e7b, 0x00001e7b, 0x25001e7c, 0x00001e7c, 0x29001e7d, 0x00001e7d,
+    0x25001e7e, 0x00001e7e, 0x29001e7f, 0x00001e7f, 0x25001e80, 0x00001e80, 0x29001e81, 0x00001e81,
+    0x25001e82, 0x00001e82, 0x29001e83, 0x00001e83, 0x25001e84, 0x00001e84, 0x29001e85, 0x00001e85,
+    0x25001e86, 0x00001e86, 0x29001e87, 0x00001e87, 0x25001e88, 0x00001e88, 0x29001e89, 0x00001e89,
+    0x25001e8a, 0x00001e8a, 0x29001e8b, 0x00001e8b, 0x25001e8c, 0x00001e8c, 0x29001e8d, 0x00001e8d,
+    0x25001e8e, 0x00001e8e, 0x29001e8f, 0x00001e8f, 0x25001e90, 0x00001e90, 0x29001e91, 0x00001e91,
+    0x25001e92, 0x00001e92, 0x29001e93, 0x00001e93, 0x25001e94, 0x00001e94, 0x29001e95, 0x00001e9d,
+    0x25001e9e, 0x00001e9e, 0x29001e9f, 0x00001e9f, 0x25001ea0, 0x00001ea0, 0x29001ea1, 0x00001ea1,
+    0x25001ea2, 0x00001ea2, 0x29001ea3, 0x00001ea3, 0x25001ea4, 0x00001ea4, 0x29001ea5, 0x00001ea5,
+    0x25001ea6, 0x00001ea6, 0x29001ea7, 0x00001ea7, 0x25001ea8, 0x00001ea8, 0x29001ea9, 0x00001ea9,
+    0x25001eaa, 0x00001eaa, 0x29001eab, 0x00001eab, 0x25001eac, 0x00001eac, 0x29001ead, 0x00001ead,
+    0x25001eae, 0x00001eae, 0x29001eaf, 0x00001eaf, 0x25001eb0, 0x00001eb0, 0x29001eb1, 0x00001eb1,
+    0x25001eb2, 0x00001eb2, 0x29001eb3, 0x00001eb3, 0x25001eb4, 0x00001eb4, 0x29001eb5, 0x00001eb5,
+    0x25001eb6, 0x00001eb6, 0x29001eb7, 0x00001eb7, 0x25001eb8, 0x00001eb8, 0x29001eb9, 0x00001eb9,
+    0x25001eba, 0x00001eba, 0x29001ebb, 0x00001ebb, 0x25001ebc, 0x00001ebc, 0x29001ebd, 0x00001ebd,
+    0x25001ebe, 0x00001ebe, 0x29001ebf, 0x00001ebf, 0x25001ec0, 0x00001ec0, 0x29001ec1, 0x00001ec1,
+    0x25001ec2, 0x00001ec2, 0x29001ec3, 0x00001ec3, 0x25001ec4, 0x00001ec4, 0x29001ec5, 0x00001ec5,
+    0x25001ec6, 0x00001ec6, 0x29001ec7, 0x00001ec7, 0x25001ec8, 0x00001ec8, 0x29001ec9, 0x00001ec9,
+    0x25001eca, 0x00001eca, 0x29001ecb, 0x00001ecb, 0x25001ecc, 0x00001ecc, 0x29001ecd, 0x00001ecd,
+    0x25001ece, 0x00001ece, 0x29001ecf, 0x00001ecf, 0x25001ed0, 0x00001ed0, 0x29001ed1, 0x00001ed1,
+    0x25001ed2, 0x00001ed2, 0x29001ed3, 0x00001ed3, 0x25001ed4, 0x00001ed4, 0x29001ed5, 0x00001ed5,
+    0x25001ed6, 0x00001ed6, 0x29001ed7, 0x00001ed7, 0x25001ed8, 0x00001ed8, 0x29001ed9, 0x00001ed9,
+    0x25001eda, 0x00001eda, 0x29001edb, 0x00001edb, 0x25001edc, 0x00001edc, 0x29001edd, 0x00001edd,
+    0x25001ede, 0x00001ede, 0x29001edf, 0x00001edf, 0x25001ee0, 0x00001ee0, 0x29001ee1, 0x00001ee1,
+    0x25001ee2, 0x00001ee2, 0x29001ee3, 0x00001ee3, 0x25001ee4, 0x00001ee4, 0x29001ee5, 0x00001ee5,
+    0x25001ee6, 0x00001ee6, 0x29001ee7, 0x00001ee7, 0x25001ee8, 0x00001ee8, 0x29001ee9, 0x00001ee9,
+    0x25001eea, 0x00001eea, 0x29001eeb, 0x00001eeb, 0x25001eec, 0x00001eec, 0x29001eed, 0x00001eed,
+    0x25001eee, 0x00001eee, 0x29001eef, 0x00001eef, 0x25001ef0, 0x00001ef0, 0x29001ef1, 0x00001ef1,
+    0x25001ef2, 0x00001ef2, 0x29001ef3, 0x00001ef3, 0x25001ef4, 0x00001ef4, 0x29001ef5, 0x00001ef5,
+    0x25001ef6, 0x00001ef6, 0x29001ef7, 0x00001ef7, 0x25001ef8, 0x00001ef8, 0x29001ef9, 0x00001ef9,
+    0x25001efa, 0x00001efa, 0x29001efb, 0x00001efb, 0x25001efc, 0x00001efc, 0x29001efd, 0x00001efd,
+    0x25001efe, 0x00001efe, 0x29001eff, 0x00001f07, 0x25001f08, 0x00001f0f, 0x29001f10, 0x00001f15,
+    0x25001f18, 0x00001f1d, 0x29001f20, 0x00001f27, 0x25001f28, 0x00001f2f, 0x29001f30, 0x00001f37,
+    0x25001f38, 0x00001f3f, 0x29001f40, 0x00001f45, 0x25001f48, 0x00001f4d, 0x29001f50, 0x00001f57,
+    0x25001f59, 0x00001f59, 0x25001f5b, 0x00001f5b, 0x25001f5d, 0x00001f5d, 0x25001f5f, 0x00001f5f,
+    0x29001f60, 0x00001f67, 0x25001f68, 0x00001f6f, 0x29001f70, 0x00001f7d, 0x29001f80, 0x00001f87,
+    0x21001f88, 0x00001f8f, 0x29001f90, 0x00001f97, 0x21001f98, 0x00001f9f, 0x29001fa0, 0x00001fa7,
+    0x21001fa8, 0x00001faf, 0x29001fb0, 0x00001fb4, 0x29001fb6, 0x00001fb7, 0x25001fb8, 0x00001fbb,
+    0x21001fbc, 0x00001fbc, 0x29001fbe, 0x00001fbe, 0x29001fc2, 0x00001fc4, 0x29001fc6, 0x00001fc7,
+    0x25001fc8, 0x00001fcb, 0x21001fcc, 0x00001fcc, 0x29001fd0, 0x00001fd3, 0x29001fd6, 0x00001fd7,
+    0x25001fd8, 0x00001fdb, 0x29001fe0, 0x00001fe7, 0x25001fe8, 0x00001fec, 0x29001ff2, 0x00001ff4,
+    0x29001ff6, 0x00001ff7, 0x25001ff8, 0x00001ffb, 0x21001ffc, 0x00001ffc, 0x10002000, 0x0000200a,
+    0x10002028, 0x00002029, 0x1000202f, 0x0000202f, 0x1000205f, 0x0000205f, 0x29002071, 0x00002071,
+    0x2900207f, 0x0000207f, 0x29002090, 0x0000209c, 0x25002102, 0x00002102, 0x25002107, 0x00002107,
+    0x2900210a, 0x0000210a, 0x2500210b, 0x0000210d, 0x2900210e, 0x0000210f, 0x25002110, 0x00002112,
+    0x29002113, 0x00002113, 0x25002115, 0x00002115, 0x25002119, 0x0000211d, 0x25002124, 0x00002124,
+    0x25002126, 0x00002126, 0x25002128, 0x00002128, 0x2500212a, 0x0000212d, 0x2900212f, 0x0000212f,
+    0x25002130, 0x00002133, 0x29002134, 0x00002134, 0x01002135, 0x00002138, 0x29002139, 0x00002139,
+    0x2900213c, 0x0000213d, 0x2500213e, 0x0000213f, 0x25002145, 0x00002145, 0x29002146, 0x00002149,
+    0x2900214e, 0x0000214e, 0x24002160, 0x0000216f, 0x28002170, 0x0000217f, 0x25002183, 0x00002183,
+    0x29002184, 0x00002184, 0x240024b6, 0x000024cf, 0x280024d0, 0x000024e9, 0x25002c00, 0x00002c2f,
+    0x29002c30, 0x00002c5f, 0x25002c60, 0x00002c60, 0x29002c61, 0x00002c61, 0x25002c62, 0x00002c64,
+    0x29002c65, 0x00002c66, 0x25002c67, 0x00002c67, 0x29002c68, 0x00002c68, 0x25002c69, 0x00002c69,
+    0x29002c6a, 0x00002c6a, 0x25002c6b, 0x00002c6b, 0x29002c6c, 0x00002c6c, 0x25002c6d, 0x00002c70,
+    0x29002c71, 0x00002c71, 0x25002c72, 0x00002c72, 0x29002c73, 0x00002c74, 0x25002c75, 0x00002c75,
+    0x29002c76, 0x00002c7d, 0x25002c7e, 0x00002c80, 0x29002c81, 0x00002c81, 0x25002c82, 0x00002c82,
+    0x29002c83, 0x00002c83, 0x25002c84, 0x00002c84, 0x29002c85, 0x00002c85, 0x25002c86, 0x00002c86,
+    0x29002c87, 0x00002c87, 0x25002c88, 0x00002c88, 0x29002c89, 0x00002c89, 0x25002c8a, 0x00002c8a,
+    0x29002c8b, 0x00002c8b, 0x25002c8c, 0x00002c8c, 0x29002c8d, 0x00002c8d, 0x25002c8e, 0x00002c8e,
+    0x29002c8f, 0x00002c8f, 0x25002c90, 0x00002c90, 0x29002c91, 0x00002c91, 0x25002c92, 0x00002c92,
+    0x29002c93, 0x00002c93, 0x25002c94, 0x00002c94, 0x29002c95, 0x00002c95, 0x25002c96, 0x00002c96,
+    0x29002c97, 0x00002c97, 0x25002c98, 0x00002c98, 0x29002c99, 0x00002c99, 0x25002c9a, 0x00002c9a,
+    0x29002c9b, 0x00002c9b, 0x25002c9c, 0x00002c9c, 0x29002c9d, 0x00002c9d, 0x25002c9e, 0x00002c9e,
+    0x29002c9f, 0x00002c9f, 0x25002ca0, 0x00002ca0, 0x29002ca1, 0x00002ca1, 0x25002ca2, 0x00002ca2,
+    0x29002ca3, 0x00002ca3, 0x25002ca4, 0x00002ca4, 0x29002ca5, 0x00002ca5, 0x25002ca6, 0x00002ca6,
+    0x29002ca7, 0x00002ca7, 0x25002ca8, 0x00002ca8, 0x29002ca9, 0x00002ca9, 0x25002caa, 0x00002caa,
+    0x29002cab, 0x00002cab, 0x25002cac, 0x00002cac, 0x29002cad, 0x00002cad, 0x25002cae, 0x00002cae,
+    0x29002caf, 0x00002caf, 0x25002cb0, 0x00002cb0, 0x29002cb1, 0x00002cb1, 0x25002cb2, 0x00002cb2,
+    0x29002cb3, 0x00002cb3, 0x25002cb4, 0x00002cb4, 0x29002cb5, 0x00002cb5, 0x25002cb6, 0x00002cb6,
+    0x29002cb7, 0x00002cb7, 0x25002cb8, 0x00002cb8, 0x29002cb9, 0x00002cb9, 0x25002cba, 0x00002cba,
+    0x29002cbb, 0x00002cbb, 0x25002cbc, 0x00002cbc, 0x29002cbd, 0x00002cbd, 0x25002cbe, 0x00002cbe,
+    0x29002cbf, 0x00002cbf, 0x25002cc0, 0x00002cc0, 0x29002cc1, 0x00002cc1, 0x25002cc2, 0x00002cc2,
+    0x29002cc3, 0x00002cc3, 0x25002cc4, 0x00002cc4, 0x29002cc5, 0x00002cc5, 0x25002cc6, 0x00002cc6,
+    0x29002cc7, 0x00002cc7, 0x25002cc8, 0x00002cc8, 0x29002cc9, 0x00002cc9, 0x25002cca, 0x00002cca,
+    0x29002ccb, 0x00002ccb, 0x25002ccc, 0x00002ccc, 0x29002ccd, 0x00002ccd, 0x25002cce, 0x00002cce,
+    0x29002ccf, 0x00002ccf, 0x25002cd0, 0x00002cd0, 0x29002cd1, 0x00002cd1, 0x25002cd2, 0x00002cd2,
+    0x29002cd3, 0x00002cd3, 0x25002cd4, 0x00002cd4, 0x29002cd5, 0x00002cd5, 0x25002cd6, 0x00002cd6,
+    0x29002cd7, 0x00002cd7, 0x25002cd8, 0x00002cd8, 0x29002cd9, 0x00002cd9, 0x25002cda, 0x00002cda,
+    0x29002cdb, 0x00002cdb, 0x25002cdc, 0x00002cdc, 0x29002cdd, 0x00002cdd, 0x25002cde, 0x00002cde,
+    0x29002cdf, 0x00002cdf, 0x25002ce0, 0x00002ce0, 0x29002ce1, 0x00002ce1, 0x25002ce2, 0x00002ce2,
+    0x29002ce3, 0x00002ce4, 0x25002ceb, 0x00002ceb, 0x29002cec, 0x00002cec, 0x25002ced, 0x00002ced,
+    0x29002cee, 0x00002cee, 0x25002cf2, 0x00002cf2, 0x29002cf3, 0x00002cf3, 0x29002d00, 0x00002d25,
+    0x29002d27, 0x00002d27, 0x29002d2d, 0x00002d2d, 0x01002d30, 0x00002d67, 0x01002d6f, 0x00002d6f,
+    0x01002d80, 0x00002d96, 0x01002da0, 0x00002da6, 0x01002da8, 0x00002dae, 0x01002db0, 0x00002db6,
+    0x01002db8, 0x00002dbe, 0x01002dc0, 0x00002dc6, 0x01002dc8, 0x00002dce, 0x01002dd0, 0x00002dd6,
+    0x01002dd8, 0x00002dde, 0x01002e2f, 0x00002e2f, 0x10003000, 0x00003000, 0x01003005, 0x00003006,
+    0x01003031, 0x00003035, 0x0100303b, 0x0000303c, 0x01003041, 0x00003096, 0x0100309d, 0x0000309f,
+    0x010030a1, 0x000030fa, 0x010030fc, 0x000030ff, 0x01003105, 0x0000312f, 0x01003131, 0x0000318e,
+    0x010031a0, 0x000031bf, 0x010031f0, 0x000031ff, 0x01003400, 0x00004dbf, 0x01004e00, 0x0000a48c,
+    0x0100a4d0, 0x0000a4fd, 0x0100a500, 0x0000a60c, 0x0100a610, 0x0000a61f, 0x0200a620, 0x0000a629,
+    0x0100a62a, 0x0000a62b, 0x2500a640, 0x0000a640, 0x2900a641, 0x0000a641, 0x2500a642, 0x0000a642,
+    0x2900a643, 0x0000a643, 0x2500a644, 0x0000a644, 0x2900a645, 0x0000a645, 0x2500a646, 0x0000a646,
+    0x2900a647, 0x0000a647, 0x2500a648, 0x0000a648, 0x2900a649, 0x0000a649, 0x2500a64a, 0x0000a64a,
+    0x2900a64b, 0x0000a64b, 0x2500a64c, 0x0000a64c, 0x2900a64d, 0x0000a64d, 0x2500a64e, 0x0000a64e,
+    0x2900a64f, 0x0000a64f, 0x2500a650, 0x0000a650, 0x2900a651, 0x0000a651, 0x2500a652, 0x0000a652,
+    0x2900a653, 0x0000a653, 0x2500a654, 0x0000a654, 0x2900a655, 0x0000a655, 0x2500a656, 0x0000a656,
+    0x2900a657, 0x0000a657, 0x2500a658, 0x0000a658, 0x2900a659, 0x0000a659, 0x2500a65a, 0x0000a65a,
+    0x2900a65b, 0x0000a65b, 0x2500a65c, 0x0000a65c, 0x2900a65d, 0x0000a65d, 0x2500a65e, 0x0000a65e,
+    0x2900a65f, 0x0000a65f, 0x2500a660, 0x0000a660, 0x2900a661, 0x0000a661, 0x2500a662, 0x0000a662,
+    0x2900a663, 0x0000a663, 0x2500a664, 0x0000a664, 0x2900a665, 0x0000a665, 0x2500a666, 0x0000a666,
+    0x2900a667, 0x0000a667, 0x2500a668, 0x0000a668, 0x2900a669, 0x0000a669, 0x2500a66a, 0x0000a66a,
+    0x2900a66b, 0x0000a66b, 0x2500a66c, 0x0000a66c, 0x2900a66d, 0x0000a66d, 0x0100a66e, 0x0000a66e,
+    0x0100a67f, 0x0000a67f, 0x2500a680, 0x0000a680, 0x2900a681, 0x0000a681, 0x2500a682, 0x0000a682,
+    0x2900a683, 0x0000a683, 0x2500a684, 0x0000a684, 0x2900a685, 0x0000a685, 0x2500a686, 0x0000a686,
+    0x2900a687, 0x0000a687, 0x2500a688, 0x0000a688, 0x2900a689, 0x0000a689, 0x2500a68a, 0x0000a68a,
+    0x2900a68b, 0x0000a68b, 0x2500a68c, 0x0000a68c, 0x2900a68d, 0x0000a68d, 0x2500a68e, 0x0000a68e,
+    0x2900a68f, 0x0000a68f, 0x2500a690, 0x0000a690, 0x2900a691, 0x0000a691, 0x2500a692, 0x0000a692,
+    0x2900a693, 0x0000a693, 0x2500a694, 0x0000a694, 0x2900a695, 0x0000a695, 0x2500a696, 0x0000a696,
+    0x2900a697, 0x0000a697, 0x2500a698, 0x0000a698, 0x2900a699, 0x0000a699, 0x2500a69a, 0x0000a69a,
+    0x2900a69b, 0x0000a69d, 0x0100a6a0, 0x0000a6e5, 0x0100a717, 0x0000a71f, 0x2500a722, 0x0000a722,
+    0x2900a723, 0x0000a723, 0x2500a724, 0x0000a724, 0x2900a725, 0x0000a725, 0x2500a726, 0x0000a726,
+    0x2900a727, 0x0000a727, 0x2500a728, 0x0000a728, 0x2900a729, 0x0000a729, 0x2500a72a, 0x0000a72a,
+    0x2900a72b, 0x0000a72b, 0x2500a72c, 0x0000a72c, 0x2900a72d, 0x0000a72d, 0x2500a72e, 0x0000a72e,
+    0x2900a72f, 0x0000a731, 0x2500a732, 0x0000a732, 0x2900a733, 0x0000a733, 0x2500a734, 0x0000a734,
+    0x2900a735, 0x0000a735, 0x2500a736, 0x0000a736, 0x2900a737, 0x0000a737, 0x2500a738, 0x0000a738,
+    0x2900a739, 0x0000a739, 0x2500a73a, 0x0000a73a, 0x2900a73b, 0x0000a73b, 0x2500a73c, 0x0000a73c,
+    0x2900a73d, 0x0000a73d, 0x2500a73e, 0x0000a73e, 0x2900a73f, 0x0000a73f, 0x2500a740, 0x0000a740,
+    0x2900a741, 0x0000a741, 0x2500a742, 0x0000a742, 0x2900a743, 0x0000a743, 0x2500a744, 0x0000a744,
+    0x2900a745, 0x0000a745, 0x2500a746, 0x0000a746, 0x2900a747, 0x0000a747, 0x2500a748, 0x0000a748,
+    0x2900a749, 0x0000a749, 0x2500a74a, 0x0000a74a, 0x2900a74b, 0x0000a74b, 0x2500a74c, 0x0000a74c,
+    0x2900a74d, 0x0000a74d, 0x2500a74e, 0x0000a74e, 0x2900a74f, 0x0000a74f, 0x2500a750, 0x0000a750,
+    0x2900a751, 0x0000a751, 0x2500a752, 0x0000a752, 0x2900a753, 0x0000a753, 0x2500a754, 0x0000a754,
+    0x2900a755, 0x0000a755, 0x2500a756, 0x0000a756, 0x2900a757, 0x0000a757, 0x2500a758, 0x0000a758,
+    0x2900a759, 0x0000a759, 0x2500a75a, 0x0000a75a, 0x2900a75b, 0x0000a75b, 0x2500a75c, 0x0000a75c,
+    0x2900a75d, 0x0000a75d, 0x2500a75e, 0x0000a75e, 0x2900a75f, 0x0000a75f, 0x2500a760, 0x0000a760,
+    0x2900a761, 0x0000a761, 0x2500a762, 0x0000a762, 0x2900a763, 0x0000a763, 0x2500a764, 0x0000a764,
+    0x2900a765, 0x0000a765, 0x2500a766, 0x0000a766, 0x2900a767, 0x0000a767, 0x2500a768, 0x0000a768,
+    0x2900a769, 0x0000a769, 0x2500a76a, 0x0000a76a, 0x2900a76b, 0x0000a76b, 0x2500a76c, 0x0000a76c,
+    0x2900a76d, 0x0000a76d, 0x2500a76e, 0x0000a76e, 0x2900a76f, 0x0000a778, 0x2500a779, 0x0000a779,
+    0x2900a77a, 0x0000a77a, 0x2500a77b, 0x0000a77b, 0x2900a77c, 0x0000a77c, 0x2500a77d, 0x0000a77e,
+    0x2900a77f, 0x0000a77f, 0x2500a780, 0x0000a780, 0x2900a781, 0x0000a781, 0x2500a782, 0x0000a782,
+    0x2900a783, 0x0000a783, 0x2500a784, 0x0000a784, 0x2900a785, 0x0000a785, 0x2500a786, 0x0000a786,
+    0x2900a787, 0x0000a787, 0x0100a788, 0x0000a788, 0x2500a78b, 0x0000a78b, 0x2900a78c, 0x0000a78c,
+    0x2500a78d, 0x0000a78d, 0x2900a78e, 0x0000a78e, 0x0100a78f, 0x0000a78f, 0x2500a790, 0x0000a790,
+    0x2900a791, 0x0000a791, 0x2500a792, 0x0000a792, 0x2900a793, 0x0000a795, 0x2500a796, 0x0000a796,
+    0x2900a797, 0x0000a797, 0x2500a798, 0x0000a798, 0x2900a799, 0x0000a799, 0x2500a79a, 0x0000a79a,
+    0x2900a79b, 0x0000a79b, 0x2500a79c, 0x0000a79c, 0x2900a79d, 0x0000a79d, 0x2500a79e, 0x0000a79e,
+    0x2900a79f, 0x0000a79f, 0x2500a7a0, 0x0000a7a0, 0x2900a7a1, 0x0000a7a1, 0x2500a7a2, 0x0000a7a2,
+    0x2900a7a3, 0x0000a7a3, 0x2500a7a4, 0x0000a7a4, 0x2900a7a5, 0x0000a7a5, 0x2500a7a6, 0x0000a7a6,
+    0x2900a7a7, 0x0000a7a7, 0x2500a7a8, 0x0000a7a8, 0x2900a7a9, 0x0000a7a9, 0x2500a7aa, 0x0000a7ae,
+    0x2900a7af, 0x0000a7af, 0x2500a7b0, 0x0000a7b4, 0x2900a7b5, 0x0000a7b5, 0x2500a7b6, 0x0000a7b6,
+    0x2900a7b7, 0x0000a7b7, 0x2500a7b8, 0x0000a7b8, 0x2900a7b9, 0x0000a7b9, 0x2500a7ba, 0x0000a7ba,
+    0x2900a7bb, 0x0000a7bb, 0x2500a7bc, 0x0000a7bc, 0x2900a7bd, 0x0000a7bd, 0x2500a7be, 0x0000a7be,
+    0x2900a7bf, 0x0000a7bf, 0x2500a7c0, 0x0000a7c0, 0x2900a7c1, 0x0000a7c1, 0x2500a7c2, 0x0000a7c2,
+    0x2900a7c3, 0x0000a7c3, 0x2500a7c4, 0x0000a7c7, 0x2900a7c8, 0x0000a7c8, 0x2500a7c9, 0x0000a7c9,
+    0x2900a7ca, 0x0000a7ca, 0x2500a7d0, 0x0000a7d0, 0x2900a7d1, 0x0000a7d1, 0x2900a7d3, 0x0000a7d3,
+    0x2900a7d5, 0x0000a7d5, 0x2500a7d6, 0x0000a7d6, 0x2900a7d7, 0x0000a7d7, 0x2500a7d8, 0x0000a7d8,
+    0x2900a7d9, 0x0000a7d9, 0x0100a7f2, 0x0000a7f4, 0x2500a7f5, 0x0000a7f5, 0x2900a7f6, 0x0000a7f6,
+    0x0100a7f7, 0x0000a7f7, 0x2900a7f8, 0x0000a7fa, 0x0100a7fb, 0x0000a801, 0x0100a803, 0x0000a805,
+    0x0100a807, 0x0000a80a, 0x0100a80c, 0x0000a822, 0x0100a840, 0x0000a873, 0x0100a882, 0x0000a8b3,
+    0x0200a8d0, 0x0000a8d9, 0x0100a8f2, 0x0000a8f7, 0x0100a8fb, 0x0000a8fb, 0x0100a8fd, 0x0000a8fe,
+    0x0200a900, 0x0000a909, 0x0100a90a, 0x0000a925, 0x0100a930, 0x0000a946, 0x0100a960, 0x0000a97c,
+    0x0100a984, 0x0000a9b2, 0x0100a9cf, 0x0000a9cf, 0x0200a9d0, 0x0000a9d9, 0x0100a9e0, 0x0000a9e4,
+    0x0100a9e6, 0x0000a9ef, 0x0200a9f0, 0x0000a9f9, 0x0100a9fa, 0x0000a9fe, 0x0100aa00, 0x0000aa28,
+    0x0100aa40, 0x0000aa42, 0x0100aa44, 0x0000aa4b, 0x0200aa50, 0x0000aa59, 0x0100aa60, 0x0000aa76,
+    0x0100aa7a, 0x0000aa7a, 0x0100aa7e, 0x0000aaaf, 0x0100aab1, 0x0000aab1, 0x0100aab5, 0x0000aab6,
+    0x0100aab9, 0x0000aabd, 0x0100aac0, 0x0000aac0, 0x0100aac2, 0x0000aac2, 0x0100aadb, 0x0000aadd,
+    0x0100aae0, 0x0000aaea, 0x0100aaf2, 0x0000aaf4, 0x0100ab01, 0x0000ab06, 0x0100ab09, 0x0000ab0e,
+    0x0100ab11, 0x0000ab16, 0x0100ab20, 0x0000ab26, 0x0100ab28, 0x0000ab2e, 0x2900ab30, 0x0000ab5a,
+    0x2900ab5c, 0x0000ab68, 0x0100ab69, 0x0000ab69, 0x2900ab70, 0x0000abbf, 0x0100abc0, 0x0000abe2,
+    0x0200abf0, 0x0000abf9, 0x0100ac00, 0x0000d7a3, 0x0100d7b0, 0x0000d7c6, 0x0100d7cb, 0x0000d7fb,
+    0x0100f900, 0x0000fa6d, 0x0100fa70, 0x0000fad9, 0x2900fb00, 0x0000fb06, 0x2900fb13, 0x0000fb17,
+    0x0100fb1d, 0x0000fb1d, 0x0100fb1f, 0x0000fb28, 0x0100fb2a, 0x0000fb36, 0x0100fb38, 0x0000fb3c,
+    0x0100fb3e, 0x0000fb3e, 0x0100fb40, 0x0000fb41, 0x0100fb43, 0x0000fb44, 0x0100fb46, 0x0000fbb1,
+    0x0100fbd3, 0x0000fd3d, 0x0100fd50, 0x0000fd8f, 0x0100fd92, 0x0000fdc7, 0x0100fdf0, 0x0000fdfb,
+    0x0100fe70, 0x0000fe74, 0x0100fe76, 0x0000fefc, 0x0200ff10, 0x0000ff19, 0x2500ff21, 0x0000ff3a,
+    0x2900ff41, 0x0000ff5a, 0x0100ff66, 0x0000ffbe, 0x0100ffc2, 0x0000ffc7, 0x0100ffca, 0x0000ffcf,
+    0x0100ffd2, 0x0000ffd7, 0x0100ffda, 0x0000ffdc, 0x01010000, 0x0001000b, 0x0101000d, 0x00010026,
+    0x01010028, 0x0001003a, 0x0101003c, 0x0001003d, 0x0101003f, 0x0001004d, 0x01010050, 0x0001005d,
+    0x01010080, 0x000100fa, 0x01010280, 0x0001029c, 0x010102a0, 0x000102d0, 0x01010300, 0x0001031f,
+    0x0101032d, 0x00010340, 0x01010342, 0x00010349, 0x01010350, 0x00010375, 0x01010380, 0x0001039d,
+    0x010103a0, 0x000103c3, 0x010103c8, 0x000103cf, 0x25010400, 0x00010427, 0x29010428, 0x0001044f,
+    0x01010450, 0x0001049d, 0x020104a0, 0x000104a9, 0x250104b0, 0x000104d3, 0x290104d8, 0x000104fb,
+    0x01010500, 0x00010527, 0x01010530, 0x00010563, 0x25010570, 0x0001057a, 0x2501057c, 0x0001058a,
+    0x2501058c, 0x00010592, 0x25010594, 0x00010595, 0x29010597, 0x000105a1, 0x290105a3, 0x000105b1,
+    0x290105b3, 0x000105b9, 0x290105bb, 0x000105bc, 0x01010600, 0x00010736, 0x01010740, 0x00010755,
+    0x01010760, 0x00010767, 0x29010780, 0x00010780, 0x01010781, 0x00010782, 0x29010783, 0x00010785,
+    0x29010787, 0x000107b0, 0x290107b2, 0x000107ba, 0x01010800, 0x00010805, 0x01010808, 0x00010808,
+    0x0101080a, 0x00010835, 0x01010837, 0x00010838, 0x0101083c, 0x0001083c, 0x0101083f, 0x00010855,
+    0x01010860, 0x00010876, 0x01010880, 0x0001089e, 0x010108e0, 0x000108f2, 0x010108f4, 0x000108f5,
+    0x01010900, 0x00010915, 0x01010920, 0x00010939, 0x01010980, 0x000109b7, 0x010109be, 0x000109bf,
+    0x01010a00, 0x00010a00, 0x01010a10, 0x00010a13, 0x01010a15, 0x00010a17, 0x01010a19, 0x00010a35,
+    0x01010a60, 0x00010a7c, 0x01010a80, 0x00010a9c, 0x01010ac0, 0x00010ac7, 0x01010ac9, 0x00010ae4,
+    0x01010b00, 0x00010b35, 0x01010b40, 0x00010b55, 0x01010b60, 0x00010b72, 0x01010b80, 0x00010b91,
+    0x01010c00, 0x00010c48, 0x25010c80, 0x00010cb2, 0x29010cc0, 0x00010cf2, 0x01010d00, 0x00010d23,
+    0x02010d30, 0x00010d39, 0x01010e80, 0x00010ea9, 0x01010eb0, 0x00010eb1, 0x01010f00, 0x00010f1c,
+    0x01010f27, 0x00010f27, 0x01010f30, 0x00010f45, 0x01010f70, 0x00010f81, 0x01010fb0, 0x00010fc4,
+    0x01010fe0, 0x00010ff6, 0x01011003, 0x00011037, 0x02011066, 0x0001106f, 0x01011071, 0x00011072,
+    0x01011075, 0x00011075, 0x01011083, 0x000110af, 0x010110d0, 0x000110e8, 0x020110f0, 0x000110f9,
+    0x01011103, 0x00011126, 0x02011136, 0x0001113f, 0x01011144, 0x00011144, 0x01011147, 0x00011147,
+    0x01011150, 0x00011172, 0x01011176, 0x00011176, 0x01011183, 0x000111b2, 0x010111c1, 0x000111c4,
+    0x020111d0, 0x000111d9, 0x010111da, 0x000111da, 0x010111dc, 0x000111dc, 0x01011200, 0x00011211,
+    0x01011213, 0x0001122b, 0x01011280, 0x00011286, 0x01011288, 0x00011288, 0x0101128a, 0x0001128d,
+    0x0101128f, 0x0001129d, 0x0101129f, 0x000112a8, 0x010112b0, 0x000112de, 0x020112f0, 0x000112f9,
+    0x01011305, 0x0001130c, 0x0101130f, 0x00011310, 0x01011313, 0x00011328, 0x0101132a, 0x00011330,
+    0x01011332, 0x00011333, 0x01011335, 0x00011339, 0x0101133d, 0x0001133d, 0x01011350, 0x00011350,
+    0x0101135d, 0x00011361, 0x01011400, 0x00011434, 0x01011447, 0x0001144a, 0x02011450, 0x00011459,
+    0x0101145f, 0x00011461, 0x01011480, 0x000114af, 0x010114c4, 0x000114c5, 0x010114c7, 0x000114c7,
+    0x020114d0, 0x000114d9, 0x01011580, 0x000115ae, 0x010115d8, 0x000115db, 0x01011600, 0x0001162f,
+    0x01011644, 0x00011644, 0x02011650, 0x00011659, 0x01011680, 0x000116aa, 0x010116b8, 0x000116b8,
+    0x020116c0, 0x000116c9, 0x01011700, 0x0001171a, 0x02011730, 0x00011739, 0x01011740, 0x00011746,
+    0x01011800, 0x0001182b, 0x250118a0, 0x000118bf, 0x290118c0, 0x000118df, 0x020118e0, 0x000118e9,
+    0x010118ff, 0x00011906, 0x01011909, 0x00011909, 0x0101190c, 0x00011913, 0x01011915, 0x00011916,
+    0x01011918, 0x0001192f, 0x0101193f, 0x0001193f, 0x01011941, 0x00011941, 0x02011950, 0x00011959,
+    0x010119a0, 0x000119a7, 0x010119aa, 0x000119d0, 0x010119e1, 0x000119e1, 0x010119e3, 0x000119e3,
+    0x01011a00, 0x00011a00, 0x01011a0b, 0x00011a32, 0x01011a3a, 0x00011a3a, 0x01011a50, 0x00011a50,
+    0x01011a5c, 0x00011a89, 0x01011a9d, 0x00011a9d, 0x01011ab0, 0x00011af8, 0x01011c00, 0x00011c08,
+    0x01011c0a, 0x00011c2e, 0x01011c40, 0x00011c40, 0x02011c50, 0x00011c59, 0x01011c72, 0x00011c8f,
+    0x01011d00, 0x00011d06, 0x01011d08, 0x00011d09, 0x01011d0b, 0x00011d30, 0x01011d46, 0x00011d46,
+    0x02011d50, 0x00011d59, 0x01011d60, 0x00011d65, 0x01011d67, 0x00011d68, 0x01011d6a, 0x00011d89,
+    0x01011d98, 0x00011d98, 0x02011da0, 0x00011da9, 0x01011ee0, 0x00011ef2, 0x01011fb0, 0x00011fb0,
+    0x01012000, 0x00012399, 0x01012480, 0x00012543, 0x01012f90, 0x00012ff0, 0x01013000, 0x0001342e,
+    0x01014400, 0x00014646, 0x01016800, 0x00016a38, 0x01016a40, 0x00016a5e, 0x02016a60, 0x00016a69,
+    0x01016a70, 0x00016abe, 0x02016ac0, 0x00016ac9, 0x01016ad0, 0x00016aed, 0x01016b00, 0x00016b2f,
+    0x01016b40, 0x00016b43, 0x02016b50, 0x00016b59, 0x01016b63, 0x00016b77, 0x01016b7d, 0x00016b8f,
+    0x25016e40, 0x00016e5f, 0x29016e60, 0x00016e7f, 0x01016f00, 0x00016f4a, 0x01016f50, 0x00016f50,
+    0x01016f93, 0x00016f9f, 0x01016fe0, 0x00016fe1, 0x01016fe3, 0x00016fe3, 0x01017000, 0x000187f7,
+    0x01018800, 0x00018cd5, 0x01018d00, 0x00018d08, 0x0101aff0, 0x0001aff3, 0x0101aff5, 0x0001affb,
+    0x0101affd, 0x0001affe, 0x0101b000, 0x0001b122, 0x0101b150, 0x0001b152, 0x0101b164, 0x0001b167,
+    0x0101b170, 0x0001b2fb, 0x0101bc00, 0x0001bc6a, 0x0101bc70, 0x0001bc7c, 0x0101bc80, 0x0001bc88,
+    0x0101bc90, 0x0001bc99, 0x2501d400, 0x0001d419, 0x2901d41a, 0x0001d433, 0x2501d434, 0x0001d44d,
+    0x2901d44e, 0x0001d454, 0x2901d456, 0x0001d467, 0x2501d468, 0x0001d481, 0x2901d482, 0x0001d49b,
+    0x2501d49c, 0x0001d49c, 0x2501d49e, 0x0001d49f, 0x2501d4a2, 0x0001d4a2, 0x2501d4a5, 0x0001d4a6,
+    0x2501d4a9, 0x0001d4ac, 0x2501d4ae, 0x0001d4b5, 0x2901d4b6, 0x0001d4b9, 0x2901d4bb, 0x0001d4bb,
+    0x2901d4bd, 0x0001d4c3, 0x2901d4c5, 0x0001d4cf, 0x2501d4d0, 0x0001d4e9, 0x2901d4ea, 0x0001d503,
+    0x2501d504, 0x0001d505, 0x2501d507, 0x0001d50a, 0x2501d50d, 0x0001d514, 0x2501d516, 0x0001d51c,
+    0x2901d51e, 0x0001d537, 0x2501d538, 0x0001d539, 0x2501d53b, 0x0001d53e, 0x2501d540, 0x0001d544,
+    0x2501d546, 0x0001d546, 0x2501d54a, 0x0001d550, 0x2901d552, 0x0001d56b, 0x2501d56c, 0x0001d585,
+    0x2901d586, 0x0001d59f, 0x2501d5a0, 0x0001d5b9, 0x2901d5ba, 0x0001d5d3, 0x2501d5d4, 0x0001d5ed,
+    0x2901d5ee, 0x0001d607, 0x2501d608, 0x0001d621, 0x2901d622, 0x0001d63b, 0x2501d63c, 0x0001d655,
+    0x2901d656, 0x0001d66f, 0x2501d670, 0x0001d689, 0x2901d68a, 0x0001d6a5, 0x2501d6a8, 0x0001d6c0,
+    0x2901d6c2, 0x0001d6da, 0x2901d6dc, 0x0001d6e1, 0x2501d6e2, 0x0001d6fa, 0x2901d6fc, 0x0001d714,
+    0x2901d716, 0x0001d71b, 0x2501d71c, 0x0001d734, 0x2901d736, 0x0001d74e, 0x2901d750, 0x0001d755,
+    0x2501d756, 0x0001d76e, 0x2901d770, 0x0001d788, 0x2901d78a, 0x0001d78f, 0x2501d790, 0x0001d7a8,
+    0x2901d7aa, 0x0001d7c2, 0x2901d7c4, 0x0001d7c9, 0x2501d7ca, 0x0001d7ca, 0x2901d7cb, 0x0001d7cb,
+    0x0201d7ce, 0x0001d7ff, 0x2901df00, 0x0001df09, 0x0101df0a, 0x0001df0a, 0x2901df0b, 0x0001df1e,
+    0x0101e100, 0x0001e12c, 0x0101e137, 0x0001e13d, 0x0201e140, 0x0001e149, 0x0101e14e, 0x0001e14e,
+    0x0101e290, 0x0001e2ad, 0x0101e2c0, 0x0001e2eb, 0x0201e2f0, 0x0001e2f9, 0x0101e7e0, 0x0001e7e6,
+    0x0101e7e8, 0x0001e7eb, 0x0101e7ed, 0x0001e7ee, 0x0101e7f0, 0x0001e7fe, 0x0101e800, 0x0001e8c4,
+    0x2501e900, 0x0001e921, 0x2901e922, 0x0001e943, 0x0101e94b, 0x0001e94b, 0x0201e950, 0x0001e959,
+    0x0101ee00, 0x0001ee03, 0x0101ee05, 0x0001ee1f, 0x0101ee21, 0x0001ee22, 0x0101ee24, 0x0001ee24,
+    0x0101ee27, 0x0001ee27, 0x0101ee29, 0x0001ee32, 0x0101ee34, 0x0001ee37, 0x0101ee39, 0x0001ee39,
+    0x0101ee3b, 0x0001ee3b, 0x0101ee42, 0x0001ee42, 0x0101ee47, 0x0001ee47, 0x0101ee49, 0x0001ee49,
+    0x0101ee4b, 0x0001ee4b, 0x0101ee4d, 0x0001ee4f, 0x0101ee51, 0x0001ee52, 0x0101ee54, 0x0001ee54,
+    0x0101ee57, 0x0001ee57, 0x0101ee59, 0x0001ee59, 0x0101ee5b, 0x0001ee5b, 0x0101ee5d, 0x0001ee5d,
+    0x0101ee5f, 0x0001ee5f, 0x0101ee61, 0x0001ee62, 0x0101ee64, 0x0001ee64, 0x0101ee67, 0x0001ee6a,
+    0x0101ee6c, 0x0001ee72, 0x0101ee74, 0x0001ee77, 0x0101ee79, 0x0001ee7c, 0x0101ee7e, 0x0001ee7e,
+    0x0101ee80, 0x0001ee89, 0x0101ee8b, 0x0001ee9b, 0x0101eea1, 0x0001eea3, 0x0101eea5, 0x0001eea9,
+    0x0101eeab, 0x0001eebb, 0x2401f130, 0x0001f149, 0x2401f150, 0x0001f169, 0x2401f170, 0x0001f189,
+    0x0201fbf0, 0x0001fbf9, 0x01020000, 0x0002a6df, 0x0102a700, 0x0002b738, 0x0102b740, 0x0002b81d,
+    0x0102b820, 0x0002cea1, 0x0102ceb0, 0x0002ebe0, 0x0102f800, 0x0002fa1d, 0x01030000, 0x0003134a,
+};
+
+/*Case mapping block of every 128 code points*/
+const uint8_t __str_casestage1[8704] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 13, 12, 12, 12, 12, 12, 14, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 15, 16, 17, 18, 19, 20, 21,
+    12, 12, 22, 23, 12, 12, 12, 12, 12, 24, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 25, 26, 27, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 28, 29, 30, 31,
+    12, 12, 12, 12, 12, 12, 32, 33, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 34, 12, 12, 12, 12, 12, 12, 12, 35, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 36, 37, 38, 39, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 40, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 41, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 42, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 43, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+};
+
+/*Case mapping record of every code point of each block*/
+const uint16_t __str_casestage2[5632] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 5,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    8, 9, 6, 7, 6, 7, 6, 7, 0, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 10, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 11, 6, 7, 6, 7, 6, 7, 12,
+    13, 14, 6, 7, 6, 7, 15, 6, 7, 16, 16, 6, 7, 0, 17, 18,
+    19, 6, 7, 16, 20, 21, 22, 23, 6, 7, 24, 0, 22, 25, 26, 27,
+    6, 7, 6, 7, 6, 7, 28, 6, 7, 28, 0, 0, 6, 7, 28, 6,
+    7, 29, 29, 6, 7, 6, 7, 30, 6, 7, 0, 0, 6, 7, 0, 31,
+    0, 0, 0, 0, 32, 33, 34, 32, 33, 34, 32, 33, 34, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 35, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    36, 32, 33, 34, 6, 7, 37, 38, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    39, 0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 0, 0, 0, 0, 0, 0, 40, 6, 7, 41, 42, 43,
+    43, 6, 7, 44, 45, 46, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    47, 48, 49, 50, 51, 0, 52, 52, 0, 53, 0, 54, 55, 0, 0, 0,
+    52, 56, 0, 57, 0, 58, 59, 0, 60, 61, 59, 62, 63, 0, 0, 61,
+    0, 64, 65, 0, 0, 66, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0,
+    68, 0, 69, 68, 0, 0, 0, 70, 68, 71, 72, 72, 73, 0, 0, 0,
+    0, 0, 74, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 76, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 77, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 7, 6, 7, 0, 0, 6, 7, 0, 0, 0, 26, 26, 26, 0, 78,
+    0, 0, 0, 0, 0, 0, 79, 0, 80, 80, 80, 0, 81, 0, 82, 82,
+    83, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 84, 85, 85, 85,
+    86, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 87, 2, 2, 2, 2, 2, 2, 2, 2, 2, 88, 89, 89, 90,
+    91, 92, 0, 0, 0, 93, 94, 95, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    96, 97, 98, 99, 100, 101, 0, 6, 7, 102, 6, 7, 0, 39, 39, 39,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    105, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 106,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    0, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+    107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+    107, 107, 107, 107, 107, 107, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+    108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+    108, 108, 108, 108, 108, 108, 108, 109, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 0, 110, 0, 0, 0, 0, 0, 110, 0, 0,
+    111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 0, 0, 111, 111, 111,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+    112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+    112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+    112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+    112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,
+    113, 113, 113, 113, 113, 113, 0, 0, 114, 114, 114, 114, 114, 114, 0, 0,
+    115, 116, 117, 118, 118, 119, 120, 121, 122, 0, 0, 0, 0, 0, 0, 0,
+    123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+    123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
+    123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 0, 0, 123, 123, 123,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 124, 0, 0, 0, 125, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 127, 128, 129, 130, 131, 132, 0, 0, 133, 0,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    134, 134, 134, 134, 134, 134, 134, 134, 135, 135, 135, 135, 135, 135, 135, 135,
+    134, 134, 134, 134, 134, 134, 0, 0, 135, 135, 135, 135, 135, 135, 0, 0,
+    134, 134, 134, 134, 134, 134, 134, 134, 135, 135, 135, 135, 135, 135, 135, 135,
+    134, 134, 134, 134, 134, 134, 134, 134, 135, 135, 135, 135, 135, 135, 135, 135,
+    134, 134, 134, 134, 134, 134, 0, 0, 135, 135, 135, 135, 135, 135, 0, 0,
+    136, 134, 137, 134, 138, 134, 139, 134, 0, 135, 0, 135, 0, 135, 0, 135,
+    134, 134, 134, 134, 134, 134, 134, 134, 135, 135, 135, 135, 135, 135, 135, 135,
+    140, 140, 141, 141, 141, 141, 142, 142, 143, 143, 144, 144, 145, 145, 0, 0,
+    146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161,
+    162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177,
+    178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193,
+    134, 134, 194, 195, 196, 0, 197, 198, 135, 135, 199, 199, 200, 0, 201, 0,
+    0, 0, 202, 203, 204, 0, 205, 206, 207, 207, 207, 207, 208, 0, 0, 0,
+    134, 134, 209, 83, 0, 0, 210, 211, 135, 135, 212, 212, 0, 0, 0, 0,
+    134, 134, 213, 86, 214, 98, 215, 216, 135, 135, 217, 217, 102, 0, 0, 0,
+    0, 0, 218, 219, 220, 0, 221, 222, 223, 223, 224, 224, 225, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 226, 0, 0, 0, 227, 228, 0, 0, 0, 0,
+    0, 0, 229, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+    232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+    0, 0, 0, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+    233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+    107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+    107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+    108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+    108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+    108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+    6, 7, 235, 236, 237, 238, 239, 6, 7, 6, 7, 6, 7, 240, 241, 242,
+    243, 0, 6, 7, 0, 6, 7, 0, 0, 0, 0, 0, 0, 0, 244, 244,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 0, 0, 0, 0, 0, 0, 0, 6, 7, 6, 7, 0,
+    0, 0, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245,
+    245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245, 245,
+    245, 245, 245, 245, 245, 245, 0, 245, 0, 0, 0, 0, 0, 245, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    0, 0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 6, 7, 246, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 0, 0, 0, 6, 7, 247, 0, 0,
+    6, 7, 6, 7, 248, 0, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 249, 250, 251, 252, 249, 0,
+    253, 254, 255, 256, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 257, 258, 259, 6, 7, 6, 7, 0, 0, 0, 0, 0,
+    6, 7, 0, 0, 0, 0, 6, 7, 6, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 260, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+    261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+    261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+    261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+    261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261, 261,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    262, 263, 264, 265, 266, 267, 267, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 268, 269, 270, 271, 272, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+    273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+    273, 273, 273, 273, 273, 273, 273, 273, 274, 274, 274, 274, 274, 274, 274, 274,
+    274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+    274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+    273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+    273, 273, 273, 273, 0, 0, 0, 0, 274, 274, 274, 274, 274, 274, 274, 274,
+    274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+    274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 275, 275, 275, 275,
+    275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 275, 0, 275, 275, 275, 275,
+    275, 275, 275, 0, 275, 275, 0, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+    276, 276, 0, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+    276, 276, 0, 276, 276, 276, 276, 276, 276, 276, 0, 276, 276, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81, 81,
+    81, 81, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+    88, 88, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277,
+    277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277,
+    277, 277, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278,
+    278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278,
+    278, 278, 278, 278, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/*Case mapping records, (upper, lower, fold) triples*/
+const int32_t __str_caserecords[837] = {
+    0, 0, 0, 0, 32, 32, -32, 0, 0, 743, 0, 775,
+    1073872896, 0, 1073872898, 121, 0, 0, 0, 1, 1, -1, 0, 0,
+    0, 1073872900, 1073872900, -232, 0, 0, 1073872902, 0, 1073872904, 0, -121, -121,
+    -300, 0, -268, 195, 0, 0, 0, 210, 210, 0, 206, 206,
+    0, 205, 205, 0, 79, 79, 0, 202, 202, 0, 203, 203,
+    0, 207, 207, 97, 0, 0, 0, 211, 211, 0, 209, 209,
+    163, 0, 0, 0, 213, 213, 130, 0, 0, 0, 214, 214,
+    0, 218, 218, 0, 217, 217, 0, 219, 219, 56, 0, 0,
+    0, 2, 2, -1, 1, 1, -2, 0, 0, -79, 0, 0,
+    1073872906, 0, 1073872908, 0, -97, -97, 0, -56, -56, 0, -130, -130,
+    0, 10795, 10795, 0, -163, -163, 0, 10792, 10792, 10815, 0, 0,
+    0, -195, -195, 0, 69, 69, 0, 71, 71, 10783, 0, 0,
+    10780, 0, 0, 10782, 0, 0, -210, 0, 0, -206, 0, 0,
+    -205, 0, 0, -202, 0, 0, -203, 0, 0, 42319, 0, 0,
+    42315, 0, 0, -207, 0, 0, 42280, 0, 0, 42308, 0, 0,
+    -209, 0, 0, -211, 0, 0, 10743, 0, 0, 42305, 0, 0,
+    10749, 0, 0, -213, 0, 0, -214, 0, 0, 10727, 0, 0,
+    -218, 0, 0, 42307, 0, 0, 42282, 0, 0, -69, 0, 0,
+    -217, 0, 0, -71, 0, 0, -219, 0, 0, 42261, 0, 0,
+    42258, 0, 0, 84, 0, 116, 0, 116, 116, 0, 38, 38,
+    0, 37, 37, 0, 64, 64, 0, 63, 63, 1073938446, 0, 1073938449,
+    -38, 0, 0, -37, 0, 0, 1073938452, 0, 1073938455, -31, 0, 1,
+    -64, 0, 0, -63, 0, 0, 0, 8, 8, -62, 0, -30,
+    -57, 0, -25, -47, 0, -15, -54, 0, -22, -8, 0, 0,
+    -86, 0, -54, -80, 0, -48, 7, 0, 0, -116, 0, 0,
+    0, -60, -60, -96, 0, -64, 0, -7, -7, 0, 80, 80,
+    -80, 0, 0, 0, 15, 15, -15, 0, 0, 0, 48, 48,
+    -48, 0, 0, 1073872922, 0, 1073872924, 0, 7264, 7264, 3008, 0, 0,
+    0, 38864, 0, 0, 8, 0, -8, 0, -8, -6254, 0, -6222,
+    -6253, 0, -6221, -6244, 0, -6212, -6242, 0, -6210, -6243, 0, -6211,
+    -6236, 0, -6204, -6181, 0, -6180, 35266, 0, 35267, 0, -3008, -3008,
+    35332, 0, 0, 3814, 0, 0, 35384, 0, 0, 1073872926, 0, 1073872928,
+    1073872930, 0, 1073872932, 1073872934, 0, 1073872936, 1073872938, 0, 1073872940, 1073872942, 0, 1073872944,
+    -59, 0, -58, 0, -7615, 1073872898, 8, 0, 0, 0, -8, -8,
+    1073872946, 0, 1073872948, 1073938486, 0, 1073938489, 1073938492, 0, 1073938495, 1073938498, 0, 1073938501,
+    74, 0, 0, 86, 0, 0, 100, 0, 0, 128, 0, 0,
+    112, 0, 0, 126, 0, 0, 1073872968, 0, 1073872970, 1073872972, 0, 1073872974,
+    1073872976, 0, 1073872978, 1073872980, 0, 1073872982, 1073872984, 0, 1073872986, 1073872988, 0, 1073872990,
+    1073872992, 0, 1073872994, 1073872996, 0, 1073872998, 1073872968, -8, 1073872970, 1073872972, -8, 1073872974,
+    1073872976, -8, 1073872978, 1073872980, -8, 1073872982, 1073872984, -8, 1073872986, 1073872988, -8, 1073872990,
+    1073872992, -8, 1073872994, 1073872996, -8, 1073872998, 1073873000, 0, 1073873002, 1073873004, 0, 1073873006,
+    1073873008, 0, 1073873010, 1073873012, 0, 1073873014, 1073873016, 0, 1073873018, 1073873020, 0, 1073873022,
+    1073873024, 0, 1073873026, 1073873028, 0, 1073873030, 1073873000, -8, 1073873002, 1073873004, -8, 1073873006,
+    1073873008, -8, 1073873010, 1073873012, -8, 1073873014, 1073873016, -8, 1073873018, 1073873020, -8, 1073873022,
+    1073873024, -8, 1073873026, 1073873028, -8, 1073873030, 1073873032, 0, 1073873034, 1073873036, 0, 1073873038,
+    1073873040, 0, 1073873042, 1073873044, 0, 1073873046, 1073873048, 0, 1073873050, 1073873052, 0, 1073873054,
+    1073873056, 0, 1073873058, 1073873060, 0, 1073873062, 1073873032, -8, 1073873034, 1073873036, -8, 1073873038,
+    1073873040, -8, 1073873042, 1073873044, -8, 1073873046, 1073873048, -8, 1073873050, 1073873052, -8, 1073873054,
+    1073873056, -8, 1073873058, 1073873060, -8, 1073873062, 1073873064, 0, 1073873066, 1073873068, 0, 1073873070,
+    1073873072, 0, 1073873074, 1073873076, 0, 1073873078, 1073938616, 0, 1073938619, 0, -74, -74,
+    1073873068, -9, 1073873070, -7205, 0, -7173, 1073873086, 0, 1073873088, 1073873090, 0, 1073873092,
+    1073873094, 0, 1073873096, 1073873098, 0, 1073873100, 1073938638, 0, 1073938641, 0, -86, -86,
+    1073873090, -9, 1073873092, 1073938644, 0, 1073938647, 1073873114, 0, 1073873116, 1073938654, 0, 1073938657,
+    0, -100, -100, 1073938660, 0, 1073938663, 1073873130, 0, 1073873132, 1073873134, 0, 1073873136,
+    1073938674, 0, 1073938677, 0, -112, -112, 1073873144, 0, 1073873146, 1073873148, 0, 1073873150,
+    1073873152, 0, 1073873154, 1073873156, 0, 1073873158, 1073938696, 0, 1073938699, 0, -128, -128,
+    0, -126, -126, 1073873148, -9, 1073873150, 0, -7517, -7517, 0, -8383, -8383,
+    0, -8262, -8262, 0, 28, 28, -28, 0, 0, 0, 16, 16,
+    -16, 0, 0, 0, 26, 26, -26, 0, 0, 0, -10743, -10743,
+    0, -3814, -3814, 0, -10727, -10727, -10795, 0, 0, -10792, 0, 0,
+    0, -10780, -10780, 0, -10749, -10749, 0, -10783, -10783, 0, -10782, -10782,
+    0, -10815, -10815, -7264, 0, 0, 0, -35332, -35332, 0, -42280, -42280,
+    48, 0, 0, 0, -42308, -42308, 0, -42319, -42319, 0, -42315, -42315,
+    0, -42305, -42305, 0, -42258, -42258, 0, -42282, -42282, 0, -42261, -42261,
+    0, 928, 928, 0, -48, -48, 0, -42307, -42307, 0, -35384, -35384,
+    -928, 0, 0, -38864, 0, -38864, 1073873166, 0, 1073873168, 1073873170, 0, 1073873172,
+    1073873174, 0, 1073873176, 1073938714, 0, 1073938717, 1073938720, 0, 1073938723, 1073873190, 0, 1073873192,
+    1073873194, 0, 1073873196, 1073873198, 0, 1073873200, 1073873202, 0, 1073873204, 1073873206, 0, 1073873208,
+    1073873210, 0, 1073873212, 0, 40, 40, -40, 0, 0, 0, 39, 39,
+    -39, 0, 0, 0, 34, 34, -34, 0, 0,
+};
+
+/*Code points of the mappings to several code points*/
+const uint32_t __str_casespecials[318] = {
+    0x00000053, 0x00000053, 0x00000073, 0x00000073, 0x00000069, 0x00000307, 0x000002bc, 0x0000004e,
+    0x000002bc, 0x0000006e, 0x0000004a, 0x0000030c, 0x0000006a, 0x0000030c, 0x00000399, 0x00000308,
+    0x00000301, 0x000003b9, 0x00000308, 0x00000301, 0x000003a5, 0x00000308, 0x00000301, 0x000003c5,
+    0x00000308, 0x00000301, 0x00000535, 0x00000552, 0x00000565, 0x00000582, 0x00000048, 0x00000331,
+    0x00000068, 0x00000331, 0x00000054, 0x00000308, 0x00000074, 0x00000308, 0x00000057, 0x0000030a,
+    0x00000077, 0x0000030a, 0x00000059, 0x0000030a, 0x00000079, 0x0000030a, 0x00000041, 0x000002be,
+    0x00000061, 0x000002be, 0x000003a5, 0x00000313, 0x000003c5, 0x00000313, 0x000003a5, 0x00000313,
+    0x00000300, 0x000003c5, 0x00000313, 0x00000300, 0x000003a5, 0x00000313, 0x00000301, 0x000003c5,
+    0x00000313, 0x00000301, 0x000003a5, 0x00000313, 0x00000342, 0x000003c5, 0x00000313, 0x00000342,
+    0x00001f08, 0x00000399, 0x00001f00, 0x000003b9, 0x00001f09, 0x00000399, 0x00001f01, 0x000003b9,
+    0x00001f0a, 0x00000399, 0x00001f02, 0x000003b9, 0x00001f0b, 0x00000399, 0x00001f03, 0x000003b9,
+    0x00001f0c, 0x00000399, 0x00001f04, 0x000003b9, 0x00001f0d, 0x00000399, 0x00001f05, 0x000003b9,
+    0x00001f0e, 0x00000399, 0x00001f06, 0x000003b9, 0x00001f0f, 0x00000399, 0x00001f07, 0x000003b9,
+    0x00001f28, 0x00000399, 0x00001f20, 0x000003b9, 0x00001f29, 0x00000399, 0x00001f21, 0x000003b9,
+    0x00001f2a, 0x00000399, 0x00001f22, 0x000003b9, 0x00001f2b, 0x00000399, 0x00001f23, 0x000003b9,
+    0x00001f2c, 0x00000399, 0x00001f24, 0x000003b9, 0x00001f2d, 0x00000399, 0x00001f25, 0x000003b9,
+    0x00001f2e, 0x00000399, 0x00001f26, 0x000003b9, 0x00001f2f, 0x00000399, 0x00001f27, 0x000003b9,
+    0x00001f68, 0x00000399, 0x00001f60, 0x000003b9, 0x00001f69, 0x00000399, 0x00001f61, 0x000003b9,
+    0x00001f6a, 0x00000399, 0x00001f62, 0x000003b9, 0x00001f6b, 0x00000399, 0x00001f63, 0x000003b9,
+    0x00001f6c, 0x00000399, 0x00001f64, 0x000003b9, 0x00001f6d, 0x00000399, 0x00001f65, 0x000003b9,
+    0x00001f6e, 0x00000399, 0x00001f66, 0x000003b9, 0x00001f6f, 0x00000399, 0x00001f67, 0x000003b9,
+    0x00001fba, 0x00000399, 0x00001f70, 0x000003b9, 0x00000391, 0x00000399, 0x000003b1, 0x000003b9,
+    0x00000386, 0x00000399, 0x000003ac, 0x000003b9, 0x00000391, 0x00000342, 0x000003b1, 0x00000342,
+    0x00000391, 0x00000342, 0x00000399, 0x000003b1, 0x00000342, 0x000003b9, 0x00001fca, 0x00000399,
+    0x00001f74, 0x000003b9, 0x00000397, 0x00000399, 0x000003b7, 0x000003b9, 0x00000389, 0x00000399,
+    0x000003ae, 0x000003b9, 0x00000397, 0x00000342, 0x000003b7, 0x00000342, 0x00000397, 0x00000342,
+    0x00000399, 0x000003b7, 0x00000342, 0x000003b9, 0x00000399, 0x00000308, 0x00000300, 0x000003b9,
+    0x00000308, 0x00000300, 0x00000399, 0x00000342, 0x000003b9, 0x00000342, 0x00000399, 0x00000308,
+    0x00000342, 0x000003b9, 0x00000308, 0x00000342, 0x000003a5, 0x00000308, 0x00000300, 0x000003c5,
+    0x00000308, 0x00000300, 0x000003a1, 0x00000313, 0x000003c1, 0x00000313, 0x000003a5, 0x00000342,
+    0x000003c5, 0x00000342, 0x000003a5, 0x00000308, 0x00000342, 0x000003c5, 0x00000308, 0x00000342,
+    0x00001ffa, 0x00000399, 0x00001f7c, 0x000003b9, 0x000003a9, 0x00000399, 0x000003c9, 0x000003b9,
+    0x0000038f, 0x00000399, 0x000003ce, 0x000003b9, 0x000003a9, 0x00000342, 0x000003c9, 0x00000342,
+    0x000003a9, 0x00000342, 0x00000399, 0x000003c9, 0x00000342, 0x000003b9, 0x00000046, 0x00000046,
+    0x00000066, 0x00000066, 0x00000046, 0x00000049, 0x00000066, 0x00000069, 0x00000046, 0x0000004c,
+    0x00000066, 0x0000006c, 0x00000046, 0x00000046, 0x00000049, 0x00000066, 0x00000066, 0x00000069,
+    0x00000046, 0x00000046, 0x0000004c, 0x00000066, 0x00000066, 0x0000006c, 0x00000053, 0x00000054,
+    0x00000073, 0x00000074, 0x00000544, 0x00000546, 0x00000574, 0x00000576, 0x00000544, 0x00000535,
+    0x00000574, 0x00000565, 0x00000544, 0x0000053b, 0x00000574, 0x0000056b, 0x0000054e, 0x00000546,
+    0x0000057e, 0x00000576, 0x00000544, 0x0000053d, 0x00000574, 0x0000056d,
+};
+
+/*Normalization properties block of every 128 code points*/
+const uint8_t __str_normstage1[8704] = {
+    0, 1, 2, 3, 4, 0, 5, 6, 7, 8, 0, 9, 10, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    30, 31, 32, 33, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 35, 36,
+    0, 37, 38, 0, 39, 40, 41, 42, 43, 44, 0, 45, 46, 47, 48, 49,
+    50, 51, 52, 53, 54, 55, 56, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 57, 0, 0, 0, 58, 59, 60, 0, 0, 0, 0,
+    61, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 64, 0, 0,
+    65, 66, 67, 68, 0, 69, 0, 70, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 71,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 72, 72, 73, 74, 75, 0, 0, 0, 0, 0, 76, 0, 0, 0,
+    0, 0, 0, 77, 0, 78, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 80, 81, 0, 0, 0, 0, 82, 0, 0, 83, 84, 85,
+    86, 87, 88, 89, 90, 91, 92, 0, 93, 94, 0, 95, 96, 97, 98, 0,
+    99, 0, 100, 101, 102, 103, 0, 0, 96, 0, 104, 105, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 106, 107, 0, 0, 0, 0, 0, 0, 0, 0, 108,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 109, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 110, 111, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    113, 0, 107, 0, 0, 114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 115, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    72, 72, 72, 72, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/*Normalization properties of every code point of each block, combining class | quick check bits*/
+const uint16_t __str_normstage2[15104] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    256, 256, 256, 256, 256, 256, 0, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    0, 256, 256, 256, 256, 256, 256, 0, 0, 256, 256, 256, 256, 256, 0, 0,
+    256, 256, 256, 256, 256, 256, 0, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    0, 256, 256, 256, 256, 256, 256, 0, 0, 256, 256, 256, 256, 256, 0, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    0, 0, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 0, 0, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 0, 0, 0, 256, 256, 256, 256, 0, 256, 256, 256, 256, 256, 256, 0,
+    0, 0, 0, 256, 256, 256, 256, 256, 256, 0, 0, 0, 256, 256, 256, 256,
+    256, 256, 0, 0, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 0, 0, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    256, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256,
+    256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 0, 256, 256,
+    256, 256, 256, 256, 0, 0, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 0, 0, 0, 256, 256, 0, 0, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 0, 0, 256, 256,
+    0, 0, 0, 0, 0, 0, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1254, 1254, 1254, 1254, 1254, 230, 1254, 1254, 1254, 1254, 1254, 1254, 1254, 230, 230, 1254,
+    230, 1254, 230, 1254, 1254, 232, 220, 220, 220, 220, 232, 1240, 220, 220, 220, 220,
+    220, 202, 202, 1244, 1244, 1244, 1244, 1226, 1226, 220, 220, 220, 220, 1244, 1244, 220,
+    1244, 1244, 220, 220, 1, 1, 1, 1, 1025, 220, 220, 220, 220, 230, 230, 230,
+    998, 998, 1254, 998, 998, 1264, 230, 220, 220, 220, 230, 230, 230, 220, 220, 0,
+    230, 230, 230, 220, 220, 220, 220, 230, 232, 220, 220, 230, 233, 234, 234, 233,
+    234, 234, 233, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    0, 0, 0, 0, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0,
+    0, 0, 0, 0, 0, 256, 256, 768, 256, 256, 256, 0, 256, 0, 256, 256,
+    256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256, 256, 256, 256,
+    256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256, 256, 256, 0,
+    0, 0, 0, 256, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    256, 256, 0, 256, 0, 0, 0, 256, 0, 0, 0, 0, 256, 256, 256, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    256, 256, 0, 256, 0, 0, 0, 256, 0, 0, 0, 0, 256, 256, 256, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 256, 256, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 256, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    256, 256, 256, 256, 0, 0, 256, 256, 0, 0, 256, 256, 256, 256, 256, 256,
+    0, 0, 256, 256, 256, 256, 256, 256, 0, 0, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 0, 0, 256, 256, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 230, 230, 230, 230, 220, 230, 230, 230, 222, 220, 230, 230, 230, 230,
+    230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 230, 230, 222, 228, 230,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 0, 23,
+    0, 24, 25, 0, 230, 220, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 230, 30, 31, 32, 0, 0, 0, 0, 0,
+    0, 0, 256, 256, 256, 256, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 29, 30, 31,
+    32, 33, 34, 1254, 1254, 1244, 220, 230, 230, 230, 230, 230, 220, 230, 230, 220,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    256, 0, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 256, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 230,
+    230, 230, 230, 220, 230, 0, 0, 230, 230, 0, 220, 230, 230, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 220, 230, 230, 220, 230, 230, 220, 220, 220, 230, 220, 220, 230, 220, 230,
+    230, 230, 220, 230, 220, 230, 220, 230, 220, 230, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230,
+    230, 230, 220, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 0, 230, 230, 230, 0, 230, 230, 230, 230, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 220, 220, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 220,
+    220, 220, 220, 220, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 0, 220, 230, 230, 220, 230, 230, 220, 230, 230, 230, 220, 220, 220,
+    27, 28, 29, 230, 230, 230, 220, 230, 230, 220, 220, 230, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0, 0, 0, 0, 0,
+    0, 256, 0, 0, 256, 0, 0, 0, 0, 0, 0, 0, 1031, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 230, 220, 230, 230, 0, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 1024, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 768, 768, 0, 768,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 768, 0, 0, 768, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 0, 0, 768, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 1024, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0, 256, 256, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 1024, 1024, 0, 0, 0, 0, 768, 768, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 84, 1115, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    256, 0, 1024, 0, 0, 0, 0, 256, 256, 0, 256, 256, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 1024, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 1024, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1033, 0, 0, 0, 0, 1024,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 256, 256, 256, 1024,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 103, 103, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 107, 107, 107, 107, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 118, 118, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 122, 122, 122, 122, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 220, 0, 220, 0, 216, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0,
+    0, 0, 768, 0, 0, 0, 0, 768, 0, 0, 0, 0, 768, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 0, 0,
+    0, 129, 130, 768, 132, 768, 768, 0, 768, 0, 130, 130, 130, 130, 0, 0,
+    130, 768, 230, 230, 9, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0,
+    0, 0, 768, 0, 0, 0, 0, 768, 0, 0, 0, 0, 768, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 256, 0, 0, 0, 0, 0, 0, 0, 1024, 0,
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+    1024, 1024, 1024, 1024, 1024, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+    1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+    1024, 1024, 1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 230, 220, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 220,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 0, 220,
+    220, 230, 230, 220, 220, 230, 230, 230, 230, 230, 220, 230, 230, 230, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 256, 0, 256, 0, 256, 0, 256, 0, 256, 0,
+    0, 0, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 7, 1024, 0, 0, 0, 0, 0, 256, 0, 256, 0, 0,
+    256, 256, 0, 256, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 230, 230, 230,
+    230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 0, 1, 220, 220, 220, 220, 220, 230, 230, 220, 220, 220, 220,
+    230, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 230, 0, 0, 0, 230, 230, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 220, 230, 230, 230, 230, 230, 230, 230, 220, 230, 230, 234, 214, 220,
+    202, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 232, 228, 228, 220, 218, 230, 233, 220, 230, 220,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 0, 256, 0, 0, 0, 0,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 0, 0, 0, 0, 0, 0,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 0, 0, 256, 256, 256, 256, 256, 256, 0, 0,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 0, 0, 256, 256, 256, 256, 256, 256, 0, 0,
+    256, 256, 256, 256, 256, 256, 256, 256, 0, 256, 0, 256, 0, 256, 0, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 768, 256, 768, 256, 768, 256, 768, 256, 768, 256, 768, 256, 768, 0, 0,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 0, 256, 256, 256, 256, 256, 768, 256, 0, 768, 0,
+    0, 256, 256, 256, 256, 0, 256, 256, 256, 768, 256, 768, 256, 256, 256, 256,
+    256, 256, 256, 768, 0, 0, 256, 256, 256, 256, 256, 768, 0, 256, 256, 256,
+    256, 256, 256, 768, 256, 256, 256, 256, 256, 256, 256, 768, 256, 256, 768, 768,
+    0, 0, 256, 256, 256, 0, 256, 256, 256, 768, 256, 768, 256, 768, 0, 0,
+    768, 768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 1, 1, 230, 230, 230, 230, 1, 1, 1, 230, 230, 0, 0, 0,
+    0, 230, 0, 0, 0, 1, 1, 230, 220, 230, 1, 1, 220, 220, 220, 220,
+    230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 768, 0, 0, 0, 768, 768, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 256, 0, 0, 0, 0, 256, 0, 0, 256, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 256, 0, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 256, 0, 0, 256, 0, 0, 256, 0, 256, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    256, 0, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256,
+    256, 256, 0, 0, 256, 256, 0, 0, 256, 256, 0, 0, 0, 0, 0, 0,
+    256, 256, 0, 0, 256, 256, 0, 0, 256, 256, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 256, 256,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    256, 256, 256, 256, 0, 0, 0, 0, 0, 0, 256, 256, 256, 256, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+    230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 228, 232, 222, 224, 224,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 256, 0,
+    256, 0, 256, 0, 256, 0, 256, 0, 256, 0, 256, 0, 256, 0, 256, 0,
+    256, 0, 256, 0, 0, 256, 0, 256, 0, 256, 0, 0, 0, 0, 0, 0,
+    256, 256, 0, 256, 256, 0, 256, 256, 0, 256, 256, 0, 256, 256, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 256, 0, 0, 0, 0, 1032, 1032, 0, 0, 0, 256, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 256, 0,
+    256, 0, 256, 0, 256, 0, 256, 0, 256, 0, 256, 0, 256, 0, 256, 0,
+    256, 0, 256, 0, 0, 256, 0, 256, 0, 256, 0, 0, 0, 0, 0, 0,
+    256, 256, 0, 256, 256, 0, 256, 256, 0, 256, 256, 0, 256, 256, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 256, 0, 0, 256, 256, 256, 256, 0, 0, 0, 256, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+    0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 0, 230, 230, 220, 0, 0, 230, 230, 0, 0, 0, 0, 0, 230, 230,
+    0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+    256, 256, 256, 256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0,
+    768, 0, 768, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0,
+    768, 0, 768, 0, 0, 768, 768, 0, 0, 0, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 26, 768,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 0, 768, 768, 768, 768, 768, 0, 768, 0,
+    768, 768, 0, 768, 768, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 220, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 230, 1, 220, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 220, 220, 230, 230, 230, 220, 230, 220, 220, 220,
+    220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 230, 220, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 256, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 1031, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 256, 256,
+    0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 1024, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1024, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0,
+    230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024, 256, 256, 1024, 256, 0,
+    0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1024,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 256, 0, 0, 0, 9,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1024, 0, 0, 0, 0, 0, 0, 0, 256, 0, 0, 0, 0, 9, 9, 0,
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768,
+    768, 768, 768, 768, 768, 216, 216, 1, 1, 1, 0, 0, 0, 226, 216, 216,
+    216, 216, 216, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 220, 220,
+    220, 220, 220, 0, 0, 230, 230, 230, 230, 230, 220, 220, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768,
+    768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 0, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 230, 230, 230, 230, 230,
+    230, 230, 0, 230, 230, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    220, 220, 220, 220, 220, 220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+    768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/*Full canonical decompositions, (code point, offset | length << 16) pairs sorted by code point*/
+const uint32_t __str_decomp[4122] = {
+    0x000000c0, 0x00020000, 0x000000c1, 0x00020002, 0x000000c2, 0x00020004, 0x000000c3, 0x00020006,
+    0x000000c4, 0x00020008, 0x000000c5, 0x0002000a, 0x000000c7, 0x0002000c, 0x000000c8, 0x0002000e,
+    0x000000c9, 0x00020010, 0x000000ca, 0x00020012, 0x000000cb, 0x00020014, 0x000000cc, 0x00020016,
+    0x000000cd, 0x00020018, 0x000000ce, 0x0002001a, 0x000000cf, 0x0002001c, 0x000000d1, 0x0002001e,
+    0x000000d2, 0x00020020, 0x000000d3, 0x00020022, 0x000000d4, 0x00020024, 0x000000d5, 0x00020026,
+    0x000000d6, 0x00020028, 0x000000d9, 0x0002002a, 0x000000da, 0x0002002c, 0x000000db, 0x0002002e,
+    0x000000dc, 0x00020030, 0x000000dd, 0x00020032, 0x000000e0, 0x00020034, 0x000000e1, 0x00020036,
+    0x000000e2, 0x00020038, 0x000000e3, 0x0002003a, 0x000000e4, 0x0002003c, 0x000000e5, 0x0002003e,
+    0x000000e7, 0x00020040, 0x000000e8, 0x00020042, 0x000000e9, 0x00020044, 0x000000ea, 0x00020046,
+    0x000000eb, 0x00020048, 0x000000ec, 0x0002004a, 0x000000ed, 0x0002004c, 0x000000ee, 0x0002004e,
+    0x000000ef, 0x00020050, 0x000000f1, 0x00020052, 0x000000f2, 0x00020054, 0x000000f3, 0x00020056,
+    0x000000f4, 0x00020058, 0x000000f5, 0x0002005a, 0x000000f6, 0x0002005c, 0x000000f9, 0x0002005e,
+    0x000000fa, 0x00020060, 0x000000fb, 0x00020062, 0x000000fc, 0x00020064, 0x000000fd, 0x00020066,
+    0x000000ff, 0x00020068, 0x00000100, 0x0002006a, 0x00000101, 0x0002006c, 0x00000102, 0x0002006e,
+    0x00000103, 0x00020070, 0x00000104, 0x00020072, 0x00000105, 0x00020074, 0x00000106, 0x00020076,
+    0x00000107, 0x00020078, 0x00000108, 0x0002007a, 0x00000109, 0x0002007c, 0x0000010a, 0x0002007e,
+    0x0000010b, 0x00020080, 0x0000010c, 0x00020082, 0x0000010d, 0x00020084, 0x0000010e, 0x00020086,
+    0x0000010f, 0x00020088, 0x00000112, 0x0002008a, 0x00000113, 0x0002008c, 0x00000114, 0x0002008e,
+    0x00000115, 0x00020090, 0x00000116, 0x00020092, 0x00000117, 0x00020094, 0x00000118, 0x00020096,
+    0x00000119, 0x00020098, 0x0000011a, 0x0002009a, 0x0000011b, 0x0002009c, 0x0000011c, 0x0002009e,
+    0x0000011d, 0x000200a0, 0x0000011e, 0x000200a2, 0x0000011f, 0x000200a4, 0x00000120, 0x000200a6,
+    0x00000121, 0x000200a8, 0x00000122, 0x000200aa, 0x00000123, 0x000200ac, 0x00000124, 0x000200ae,
+    0x00000125, 0x000200b0, 0x00000128, 0x000200b2, 0x00000129, 0x000200b4, 0x0000012a, 0x000200b6,
+    0x0000012b, 0x000200b8, 0x0000012c, 0x000200ba, 0x0000012d, 0x000200bc, 0x0000012e, 0x000200be,
+    0x0000012f, 0x000200c0, 0x00000130, 0x000200c2, 0x00000134, 0x000200c4, 0x00000135, 0x000200c6,
+    0x00000136, 0x000200c8, 0x00000137, 0x000200ca, 0x00000139, 0x000200cc, 0x0000013a, 0x000200ce,
+    0x0000013b, 0x000200d0, 0x0000013c, 0x000200d2, 0x0000013d, 0x000200d4, 0x0000013e, 0x000200d6,
+    0x00000143, 0x000200d8, 0x00000144, 0x000200da, 0x00000145, 0x000200dc, 0x00000146, 0x000200de,
+    0x00000147, 0x000200e0, 0x00000148, 0x000200e2, 0x0000014c, 0x000200e4, 0x0000014d, 0x000200e6,
+    0x0000014e, 0x000200e8, 0x0000014f, 0x000200ea, 0x00000150, 0x000200ec, 0x00000151, 0x000200ee,
+    0x00000154, 0x000200f0, 0x00000155, 0x000200f2, 0x00000156, 0x000200f4, 0x00000157, 0x000200f6,
+    0x00000158, 0x000200f8, 0x00000159, 0x000200fa, 0x0000015a, 0x000200fc, 0x0000015b, 0x000200fe,
+    0x0000015c, 0x00020100, 0x0000015d, 0x00020102, 0x0000015e, 0x00020104, 0x0000015f, 0x00020106,
+    0x00000160, 0x00020108, 0x00000161, 0x0002010a, 0x00000162, 0x0002010c, 0x00000163, 0x0002010e,
+    0x00000164, 0x00020110, 0x00000165, 0x00020112, 0x00000168, 0x00020114, 0x00000169, 0x00020116,
+    0x0000016a, 0x00020118, 0x0000016b, 0x0002011a, 0x0000016c, 0x0002011c, 0x0000016d, 0x0002011e,
+    0x0000016e, 0x00020120, 0x0000016f, 0x00020122, 0x00000170, 0x00020124, 0x00000171, 0x00020126,
+    0x00000172, 0x00020128, 0x00000173, 0x0002012a, 0x00000174, 0x0002012c, 0x00000175, 0x0002012e,
+    0x00000176, 0x00020130, 0x00000177, 0x00020132, 0x00000178, 0x00020134, 0x00000179, 0x00020136,
+    0x0000017a, 0x00020138, 0x0000017b, 0x0002013a, 0x0000017c, 0x0002013c, 0x0000017d, 0x0002013e,
+    0x0000017e, 0x00020140, 0x000001a0, 0x00020142, 0x000001a1, 0x00020144, 0x000001af, 0x00020146,
+    0x000001b0, 0x00020148, 0x000001cd, 0x0002014a, 0x000001ce, 0x0002014c, 0x000001cf, 0x0002014e,
+    0x000001d0, 0x00020150, 0x000001d1, 0x00020152, 0x000001d2, 0x00020154, 0x000001d3, 0x00020156,
+    0x000001d4, 0x00020158, 0x000001d5, 0x0003015a, 0x000001d6, 0x0003015d, 0x000001d7, 0x00030160,
+    0x000001d8, 0x00030163, 0x000001d9, 0x00030166, 0x000001da, 0x00030169, 0x000001db, 0x0003016c,
+    0x000001dc, 0x0003016f, 0x000001de, 0x00030172, 0x000001df, 0x00030175, 0x000001e0, 0x00030178,
+    0x000001e1, 0x0003017b, 0x000001e2, 0x0002017e, 0x000001e3, 0x00020180, 0x000001e6, 0x00020182,
+    0x000001e7, 0x00020184, 0x000001e8, 0x00020186, 0x000001e9, 0x00020188, 0x000001ea, 0x0002018a,
+    0x000001eb, 0x0002018c, 0x000001ec, 0x0003018e, 0x000001ed, 0x00030191, 0x000001ee, 0x00020194,
+    0x000001ef, 0x00020196, 0x000001f0, 0x00020198, 0x000001f4, 0x0002019a, 0x000001f5, 0x0002019c,
+    0x000001f8, 0x0002019e, 0x000001f9, 0x000201a0, 0x000001fa, 0x000301a2, 0x000001fb, 0x000301a5,
+    0x000001fc, 0x000201a8, 0x000001fd, 0x000201aa, 0x000001fe, 0x000201ac, 0x000001ff, 0x000201ae,
+    0x00000200, 0x000201b0, 0x00000201, 0x000201b2, 0x00000202, 0x000201b4, 0x00000203, 0x000201b6,
+    0x00000204, 0x000201b8, 0x00000205, 0x000201ba, 0x00000206, 0x000201bc, 0x00000207, 0x000201be,
+    0x00000208, 0x000201c0, 0x00000209, 0x000201c2, 0x0000020a, 0x000201c4, 0x0000020b, 0x000201c6,
+    0x0000020c, 0x000201c8, 0x0000020d, 0x000201ca, 0x0000020e, 0x000201cc, 0x0000020f, 0x000201ce,
+    0x00000210, 0x000201d0, 0x00000211, 0x000201d2, 0x00000212, 0x000201d4, 0x00000213, 0x000201d6,
+    0x00000214, 0x000201d8, 0x00000215, 0x000201da, 0x00000216, 0x000201dc, 0x00000217, 0x000201de,
+    0x00000218, 0x000201e0, 0x00000219, 0x000201e2, 0x0000021a, 0x000201e4, 0x0000021b, 0x000201e6,
+    0x0000021e, 0x000201e8, 0x0000021f, 0x000201ea, 0x00000226, 0x000201ec, 0x00000227, 0x000201ee,
+    0x00000228, 0x000201f0, 0x00000229, 0x000201f2, 0x0000022a, 0x000301f4, 0x0000022b, 0x000301f7,
+    0x0000022c, 0x000301fa, 0x0000022d, 0x000301fd, 0x0000022e, 0x00020200, 0x0000022f, 0x00020202,
+    0x00000230, 0x00030204, 0x00000231, 0x00030207, 0x00000232, 0x0002020a, 0x00000233, 0x0002020c,
+    0x00000340, 0x0001020e, 0x00000341, 0x0001020f, 0x00000343, 0x00010210, 0x00000344, 0x00020211,
+    0x00000374, 0x00010213, 0x0000037e, 0x00010214, 0x00000385, 0x00020215, 0x00000386, 0x00020217,
+    0x00000387, 0x00010219, 0x00000388, 0x0002021a, 0x00000389, 0x0002021c, 0x0000038a, 0x0002021e,
+    0x0000038c, 0x00020220, 0x0000038e, 0x00020222, 0x0000038f, 0x00020224, 0x00000390, 0x00030226,
+    0x000003aa, 0x00020229, 0x000003ab, 0x0002022b, 0x000003ac, 0x0002022d, 0x000003ad, 0x0002022f,
+    0x000003ae, 0x00020231, 0x000003af, 0x00020233, 0x000003b0, 0x00030235, 0x000003ca, 0x00020238,
+    0x000003cb, 0x0002023a, 0x000003cc, 0x0002023c, 0x000003cd, 0x0002023e, 0x000003ce, 0x00020240,
+    0x000003d3, 0x00020242, 0x000003d4, 0x00020244, 0x00000400, 0x00020246, 0x00000401, 0x00020248,
+    0x00000403, 0x0002024a, 0x00000407, 0x0002024c, 0x0000040c, 0x0002024e, 0x0000040d, 0x00020250,
+    0x0000040e, 0x00020252, 0x00000419, 0x00020254, 0x00000439, 0x00020256, 0x00000450, 0x00020258,
+    0x00000451, 0x0002025a, 0x00000453, 0x0002025c, 0x00000457, 0x0002025e, 0x0000045c, 0x00020260,
+    0x0000045d, 0x00020262, 0x0000045e, 0x00020264, 0x00000476, 0x00020266, 0x00000477, 0x00020268,
+    0x000004c1, 0x0002026a, 0x000004c2, 0x0002026c, 0x000004d0, 0x0002026e, 0x000004d1, 0x00020270,
+    0x000004d2, 0x00020272, 0x000004d3, 0x00020274, 0x000004d6, 0x00020276, 0x000004d7, 0x00020278,
+    0x000004da, 0x0002027a, 0x000004db, 0x0002027c, 0x000004dc, 0x0002027e, 0x000004dd, 0x00020280,
+    0x000004de, 0x00020282, 0x000004df, 0x00020284, 0x000004e2, 0x00020286, 0x000004e3, 0x00020288,
+    0x000004e4, 0x0002028a, 0x000004e5, 0x0002028c, 0x000004e6, 0x0002028e, 0x000004e7, 0x00020290,
+    0x000004ea, 0x00020292, 0x000004eb, 0x00020294, 0x000004ec, 0x00020296, 0x000004ed, 0x00020298,
+    0x000004ee, 0x0002029a, 0x000004ef, 0x0002029c, 0x000004f0, 0x0002029e, 0x000004f1, 0x000202a0,
+    0x000004f2, 0x000202a2, 0x000004f3, 0x000202a4, 0x000004f4, 0x000202a6, 0x000004f5, 0x000202a8,
+    0x000004f8, 0x000202aa, 0x000004f9, 0x000202ac, 0x00000622, 0x000202ae, 0x00000623, 0x000202b0,
+    0x00000624, 0x000202b2, 0x00000625, 0x000202b4, 0x00000626, 0x000202b6, 0x000006c0, 0x000202b8,
+    0x000006c2, 0x000202ba, 0x000006d3, 0x000202bc, 0x00000929, 0x000202be, 0x00000931, 0x000202c0,
+    0x00000934, 0x000202c2, 0x00000958, 0x000202c4, 0x00000959, 0x000202c6, 0x0000095a, 0x000202c8,
+    0x0000095b, 0x000202ca, 0x0000095c, 0x000202cc, 0x0000095d, 0x000202ce, 0x0000095e, 0x000202d0,
+    0x0000095f, 0x000202d2, 0x000009cb, 0x000202d4, 0x000009cc, 0x000202d6, 0x000009dc, 0x000202d8,
+    0x000009dd, 0x000202da, 0x000009df, 0x000202dc, 0x00000a33, 0x000202de, 0x00000a36, 0x000202e0,
+    0x00000a59, 0x000202e2, 0x00000a5a, 0x000202e4, 0x00000a5b, 0x000202e6, 0x00000a5e, 0x000202e8,
+    0x00000b48, 0x000202ea, 0x00000b4b, 0x000202ec, 0x00000b4c, 0x000202ee, 0x00000b5c, 0x000202f0,
+    0x00000b5d, 0x000202f2, 0x00000b94, 0x000202f4, 0x00000bca, 0x000202f6, 0x00000bcb, 0x000202f8,
+    0x00000bcc, 0x000202fa, 0x00000c48, 0x000202fc, 0x00000cc0, 0x000202fe, 0x00000cc7, 0x00020300,
+    0x00000cc8, 0x00020302, 0x00000cca, 0x00020304, 0x00000ccb, 0x00030306, 0x00000d4a, 0x00020309,
+    0x00000d4b, 0x0002030b, 0x00000d4c, 0x0002030d, 0x00000dda, 0x0002030f, 0x00000ddc, 0x00020311,
+    0x00000ddd, 0x00030313, 0x00000dde, 0x00020316, 0x00000f43, 0x00020318, 0x00000f4d, 0x0002031a,
+    0x00000f52, 0x0002031c, 0x00000f57, 0x0002031e, 0x00000f5c, 0x00020320, 0x00000f69, 0x00020322,
+    0x00000f73, 0x00020324, 0x00000f75, 0x00020326, 0x00000f76, 0x00020328, 0x00000f78, 0x0002032a,
+    0x00000f81, 0x0002032c, 0x00000f93, 0x0002032e, 0x00000f9d, 0x00020330, 0x00000fa2, 0x00020332,
+    0x00000fa7, 0x00020334, 0x00000fac, 0x00020336, 0x00000fb9, 0x00020338, 0x00001026, 0x0002033a,
+    0x00001b06, 0x0002033c, 0x00001b08, 0x0002033e, 0x00001b0a, 0x00020340, 0x00001b0c, 0x00020342,
+    0x00001b0e, 0x00020344, 0x00001b12, 0x00020346, 0x00001b3b, 0x00020348, 0x00001b3d, 0x0002034a,
+    0x00001b40, 0x0002034c, 0x00001b41, 0x0002034e, 0x00001b43, 0x00020350, 0x00001e00, 0x00020352,
+    0x00001e01, 0x00020354, 0x00001e02, 0x00020356, 0x00001e03, 0x00020358, 0x00001e04, 0x0002035a,
+    0x00001e05, 0x0002035c, 0x00001e06, 0x0002035e, 0x00001e07, 0x00020360, 0x00001e08, 0x00030362,
+    0x00001e09, 0x00030365, 0x00001e0a, 0x00020368, 0x00001e0b, 0x0002036a, 0x00001e0c, 0x0002036c,
+    0x00001e0d, 0x0002036e, 0x00001e0e, 0x00020370, 0x00001e0f, 0x00020372, 0x00001e10, 0x00020374,
+    0x00001e11, 0x00020376, 0x00001e12, 0x00020378, 0x00001e13, 0x0002037a, 0x00001e14, 0x0003037c,
+    0x00001e15, 0x0003037f, 0x00001e16, 0x00030382, 0x00001e17, 0x00030385, 0x00001e18, 0x00020388,
+    0x00001e19, 0x0002038a, 0x00001e1a, 0x0002038c, 0x00001e1b, 0x0002038e, 0x00001e1c, 0x00030390,
+    0x00001e1d, 0x00030393, 0x00001e1e, 0x00020396, 0x00001e1f, 0x00020398, 0x00001e20, 0x0002039a,
+    0x00001e21, 0x0002039c, 0x00001e22, 0x0002039e, 0x00001e23, 0x000203a0, 0x00001e24, 0x000203a2,
+    0x00001e25, 0x000203a4, 0x00001e26, 0x000203a6, 0x00001e27, 0x000203a8, 0x00001e28, 0x000203aa,
+    0x00001e29, 0x000203ac, 0x00001e2a, 0x000203ae, 0x00001e2b, 0x000203b0, 0x00001e2c, 0x000203b2,
+    0x00001e2d, 0x000203b4, 0x00001e2e, 0x000303b6, 0x00001e2f, 0x000303b9, 0x00001e30, 0x000203bc,
+    0x00001e31, 0x000203be, 0x00001e32, 0x000203c0, 0x00001e33, 0x000203c2, 0x00001e34, 0x000203c4,
+    0x00001e35, 0x000203c6, 0x00001e36, 0x000203c8, 0x00001e37, 0x000203ca, 0x00001e38, 0x000303cc,
+    0x00001e39, 0x000303cf, 0x00001e3a, 0x000203d2, 0x00001e3b, 0x000203d4, 0x00001e3c, 0x000203d6,
+    0x00001e3d, 0x000203d8, 0x00001e3e, 0x000203da, 0x00001e3f, 0x000203dc, 0x00001e40, 0x000203de,
+    0x00001e41, 0x000203e0, 0x00001e42, 0x000203e2, 0x00001e43, 0x000203e4, 0x00001e44, 0x000203e6,
+    0x00001e45, 0x000203e8, 0x00001e46, 0x000203ea, 0x00001e47, 0x000203ec, 0x00001e48, 0x000203ee,
+    0x00001e49, 0x000203f0, 0x00001e4a, 0x000203f2, 0x00001e4b, 0x000203f4, 0x00001e4c, 0x000303f6,
+    0x00001e4d, 0x000303f9, 0x00001e4e, 0x000303fc, 0x00001e4f, 0x000303ff, 0x00001e50, 0x00030402,
+    0x00001e51, 0x00030405, 0x00001e52, 0x00030408, 0x00001e53, 0x0003040b, 0x00001e54, 0x0002040e,
+    0x00001e55, 0x00020410, 0x00001e56, 0x00020412, 0x00001e57, 0x00020414, 0x00001e58, 0x00020416,
+    0x00001e59, 0x00020418, 0x00001e5a, 0x0002041a, 0x00001e5b, 0x0002041c, 0x00001e5c, 0x0003041e,
+    0x00001e5d, 0x00030421, 0x00001e5e, 0x00020424, 0x00001e5f, 0x00020426, 0x00001e60, 0x00020428,
+    0x00001e61, 0x0002042a, 0x00001e62, 0x0002042c, 0x00001e63, 0x0002042e, 0x00001e64, 0x00030430,
+    0x00001e65, 0x00030433, 0x00001e66, 0x00030436, 0x00001e67, 0x00030439, 0x00001e68, 0x0003043c,
+    0x00001e69, 0x0003043f, 0x00001e6a, 0x00020442, 0x00001e6b, 0x00020444, 0x00001e6c, 0x00020446,
+    0x00001e6d, 0x00020448, 0x00001e6e, 0x0002044a, 0x00001e6f, 0x0002044c, 0x00001e70, 0x0002044e,
+    0x00001e71, 0x00020450, 0x00001e72, 0x00020452, 0x00001e73, 0x00020454, 0x00001e74, 0x00020456,
+    0x00001e75, 0x00020458, 0x00001e76, 0x0002045a, 0x00001e77, 0x0002045c, 0x00001e78, 0x0003045e,
+    0x00001e79, 0x00030461, 0x00001e7a, 0x00030464, 0x00001e7b, 0x00030467, 0x00001e7c, 0x0002046a,
+    0x00001e7d, 0x0002046c, 0x00001e7e, 0x0002046e, 0x00001e7f, 0x00020470, 0x00001e80, 0x00020472,
+    0x00001e81, 0x00020474, 0x00001e82, 0x00020476, 0x00001e83, 0x00020478, 0x00001e84, 0x0002047a,
+    0x00001e85, 0x0002047c, 0x00001e86, 0x0002047e, 0x00001e87, 0x00020480, 0x00001e88, 0x00020482,
+    0x00001e89, 0x00020484, 0x00001e8a, 0x00020486, 0x00001e8b, 0x00020488, 0x00001e8c, 0x0002048a,
+    0x00001e8d, 0x0002048c, 0x00001e8e, 0x0002048e, 0x00001e8f, 0x00020490, 0x00001e90, 0x00020492,
+    0x00001e91, 0x00020494, 0x00001e92, 0x00020496, 0x00001e93, 0x00020498, 0x00001e94, 0x0002049a,
+    0x00001e95, 0x0002049c, 0x00001e96, 0x0002049e, 0x00001e97, 0x000204a0, 0x00001e98, 0x000204a2,
+    0x00001e99, 0x000204a4, 0x00001e9b, 0x000204a6, 0x00001ea0, 0x000204a8, 0x00001ea1, 0x000204aa,
+    0x00001ea2, 0x000204ac, 0x00001ea3, 0x000204ae, 0x00001ea4, 0x000304b0, 0x00001ea5, 0x000304b3,
+    0x00001ea6, 0x000304b6, 0x00001ea7, 0x000304b9, 0x00001ea8, 0x000304bc, 0x00001ea9, 0x000304bf,
+    0x00001eaa, 0x000304c2, 0x00001eab, 0x000304c5, 0x00001eac, 0x000304c8, 0x00001ead, 0x000304cb,
+    0x00001eae, 0x000304ce, 0x00001eaf, 0x000304d1, 0x00001eb0, 0x000304d4, 0x00001eb1, 0x000304d7,
+    0x00001eb2, 0x000304da, 0x00001eb3, 0x000304dd, 0x00001eb4, 0x000304e0, 0x00001eb5, 0x000304e3,
+    0x00001eb6, 0x000304e6, 0x00001eb7, 0x000304e9, 0x00001eb8, 0x000204ec, 0x00001eb9, 0x000204ee,
+    0x00001eba, 0x000204f0, 0x00001ebb, 0x000204f2, 0x00001ebc, 0x000204f4, 0x00001ebd, 0x000204f6,
+    0x00001ebe, 0x000304f8, 0x00001ebf, 0x000304fb, 0x00001ec0, 0x000304fe, 0x00001ec1, 0x00030501,
+    0x00001ec2, 0x00030504, 0x00001ec3, 0x00030507, 0x00001ec4, 0x0003050a, 0x00001ec5, 0x0003050d,
+    0x00001ec6, 0x00030510, 0x00001ec7, 0x00030513, 0x00001ec8, 0x00020516, 0x00001ec9, 0x00020518,
+    0x00001eca, 0x0002051a, 0x00001ecb, 0x0002051c, 0x00001ecc, 0x0002051e, 0x00001ecd, 0x00020520,
+    0x00001ece, 0x00020522, 0x00001ecf, 0x00020524, 0x00001ed0, 0x00030526, 0x00001ed1, 0x00030529,
+    0x00001ed2, 0x0003052c, 0x00001ed3, 0x0003052f, 0x00001ed4, 0x00030532, 0x00001ed5, 0x00030535,
+    0x00001ed6, 0x00030538, 0x00001ed7, 0x0003053b, 0x00001ed8, 0x0003053e, 0x00001ed9, 0x00030541,
+    0x00001eda, 0x00030544, 0x00001edb, 0x00030547, 0x00001edc, 0x0003054a, 0x00001edd, 0x0003054d,
+    0x00001ede, 0x00030550, 0x00001edf, 0x00030553, 0x00001ee0, 0x00030556, 0x00001ee1, 0x00030559,
+    0x00001ee2, 0x0003055c, 0x00001ee3, 0x0003055f, 0x00001ee4, 0x00020562, 0x00001ee5, 0x00020564,
+    0x00001ee6, 0x00020566, 0x00001ee7, 0x00020568, 0x00001ee8, 0x0003056a, 0x00001ee9, 0x0003056d,
+    0x00001eea, 0x00030570, 0x00001eeb, 0x00030573, 0x00001eec, 0x00030576, 0x00001eed, 0x00030579,
+    0x00001eee, 0x0003057c, 0x00001eef, 0x0003057f, 0x00001ef0, 0x00030582, 0x00001ef1, 0x00030585,
+    0x00001ef2, 0x00020588, 0x00001ef3, 0x0002058a, 0x00001ef4, 0x0002058c, 0x00001ef5, 0x0002058e,
+    0x00001ef6, 0x00020590, 0x00001ef7, 0x00020592, 0x00001ef8, 0x00020594, 0x00001ef9, 0x00020596,
+    0x00001f00, 0x00020598, 0x00001f01, 0x0002059a, 0x00001f02, 0x0003059c, 0x00001f03, 0x0003059f,
+    0x00001f04, 0x000305a2, 0x00001f05, 0x000305a5, 0x00001f06, 0x000305a8, 0x00001f07, 0x000305ab,
+    0x00001f08, 0x000205ae, 0x00001f09, 0x000205b0, 0x00001f0a, 0x000305b2, 0x00001f0b, 0x000305b5,
+    0x00001f0c, 0x000305b8, 0x00001f0d, 0x000305bb, 0x00001f0e, 0x000305be, 0x00001f0f, 0x000305c1,
+    0x00001f10, 0x000205c4, 0x00001f11, 0x000205c6, 0x00001f12, 0x000305c8, 0x00001f13, 0x000305cb,
+    0x00001f14, 0x000305ce, 0x00001f15, 0x000305d1, 0x00001f18, 0x000205d4, 0x00001f19, 0x000205d6,
+    0x00001f1a, 0x000305d8, 0x00001f1b, 0x000305db, 0x00001f1c, 0x000305de, 0x00001f1d, 0x000305e1,
+    0x00001f20, 0x000205e4, 0x00001f21, 0x000205e6, 0x00001f22, 0x000305e8, 0x00001f23, 0x000305eb,
+    0x00001f24, 0x000305ee, 0x00001f25, 0x000305f1, 0x00001f26, 0x000305f4, 0x00001f27, 0x000305f7,
+    0x00001f28, 0x000205fa, 0x00001f29, 0x000205fc, 0x00001f2a, 0x000305fe, 0x00001f2b, 0x00030601,
+    0x00001f2c, 0x00030604, 0x00001f2d, 0x00030607, 0x00001f2e, 0x0003060a, 0x00001f2f, 0x0003060d,
+    0x00001f30, 0x00020610, 0x00001f31, 0x00020612, 0x00001f32, 0x00030614, 0x00001f33, 0x00030617,
+    0x00001f34, 0x0003061a, 0x00001f35, 0x0003061d, 0x00001f36, 0x00030620, 0x00001f37, 0x00030623,
+    0x00001f38, 0x00020626, 0x00001f39, 0x00020628, 0x00001f3a, 0x0003062a, 0x00001f3b, 0x0003062d,
+    0x00001f3c, 0x00030630, 0x00001f3d, 0x00030633, 0x00001f3e, 0x00030636, 0x00001f3f, 0x00030639,
+    0x00001f40, 0x0002063c, 0x00001f41, 0x0002063e, 0x00001f42, 0x00030640, 0x00001f43, 0x00030643,
+    0x00001f44, 0x00030646, 0x00001f45, 0x00030649, 0x00001f48, 0x0002064c, 0x00001f49, 0x0002064e,
+    0x00001f4a, 0x00030650, 0x00001f4b, 0x00030653, 0x00001f4c, 0x00030656, 0x00001f4d, 0x00030659,
+    0x00001f50, 0x0002065c, 0x00001f51, 0x0002065e, 0x00001f52, 0x00030660, 0x00001f53, 0x00030663,
+    0x00001f54, 0x00030666, 0x00001f55, 0x00030669, 0x00001f56, 0x0003066c, 0x00001f57, 0x0003066f,
+    0x00001f59, 0x00020672, 0x00001f5b, 0x00030674, 0x00001f5d, 0x00030677, 0x00001f5f, 0x0003067a,
+    0x00001f60, 0x0002067d, 0x00001f61, 0x0002067f, 0x00001f62, 0x00030681, 0x00001f63, 0x00030684,
+    0x00001f64, 0x00030687, 0x00001f65, 0x0003068a, 0x00001f66, 0x0003068d, 0x00001f67, 0x00030690,
+    0x00001f68, 0x00020693, 0x00001f69, 0x00020695, 0x00001f6a, 0x00030697, 0x00001f6b, 0x0003069a,
+    0x00001f6c, 0x0003069d, 0x00001f6d, 0x000306a0, 0x00001f6e, 0x000306a3, 0x00001f6f, 0x000306a6,
+    0x00001f70, 0x000206a9, 0x00001f71, 0x000206ab, 0x00001f72, 0x000206ad, 0x00001f73, 0x000206af,
+    0x00001f74, 0x000206b1, 0x00001f75, 0x000206b3, 0x00001f76, 0x000206b5, 0x00001f77, 0x000206b7,
+    0x00001f78, 0x000206b9, 0x00001f79, 0x000206bb, 0x00001f7a, 0x000206bd, 0x00001f7b, 0x000206bf,
+    0x00001f7c, 0x000206c1, 0x00001f7d, 0x000206c3, 0x00001f80, 0x000306c5, 0x00001f81, 0x000306c8,
+    0x00001f82, 0x000406cb, 0x00001f83, 0x000406cf, 0x00001f84, 0x000406d3, 0x00001f85, 0x000406d7,
+    0x00001f86, 0x000406db, 0x00001f87, 0x000406df, 0x00001f88, 0x000306e3, 0x00001f89, 0x000306e6,
+    0x00001f8a, 0x000406e9, 0x00001f8b, 0x000406ed, 0x00001f8c, 0x000406f1, 0x00001f8d, 0x000406f5,
+    0x00001f8e, 0x000406f9, 0x00001f8f, 0x000406fd, 0x00001f90, 0x00030701, 0x00001f91, 0x00030704,
+    0x00001f92, 0x00040707, 0x00001f93, 0x0004070b, 0x00001f94, 0x0004070f, 0x00001f95, 0x00040713,
+    0x00001f96, 0x00040717, 0x00001f97, 0x0004071b, 0x00001f98, 0x0003071f, 0x00001f99, 0x00030722,
+    0x00001f9a, 0x00040725, 0x00001f9b, 0x00040729, 0x00001f9c, 0x0004072d, 0x00001f9d, 0x00040731,
+    0x00001f9e, 0x00040735, 0x00001f9f, 0x00040739, 0x00001fa0, 0x0003073d, 0x00001fa1, 0x00030740,
+    0x00001fa2, 0x00040743, 0x00001fa3, 0x00040747, 0x00001fa4, 0x0004074b, 0x00001fa5, 0x0004074f,
+    0x00001fa6, 0x00040753, 0x00001fa7, 0x00040757, 0x00001fa8, 0x0003075b, 0x00001fa9, 0x0003075e,
+    0x00001faa, 0x00040761, 0x00001fab, 0x00040765, 0x00001fac, 0x00040769, 0x00001fad, 0x0004076d,
+    0x00001fae, 0x00040771, 0x00001faf, 0x00040775, 0x00001fb0, 0x00020779, 0x00001fb1, 0x0002077b,
+    0x00001fb2, 0x0003077d, 0x00001fb3, 0x00020780, 0x00001fb4, 0x00030782, 0x00001fb6, 0x00020785,
+    0x00001fb7, 0x00030787, 0x00001fb8, 0x0002078a, 0x00001fb9, 0x0002078c, 0x00001fba, 0x0002078e,
+    0x00001fbb, 0x00020790, 0x00001fbc, 0x00020792, 0x00001fbe, 0x00010794, 0x00001fc1, 0x00020795,
+    0x00001fc2, 0x00030797, 0x00001fc3, 0x0002079a, 0x00001fc4, 0x0003079c, 0x00001fc6, 0x0002079f,
+    0x00001fc7, 0x000307a1, 0x00001fc8, 0x000207a4, 0x00001fc9, 0x000207a6, 0x00001fca, 0x000207a8,
+    0x00001fcb, 0x000207aa, 0x00001fcc, 0x000207ac, 0x00001fcd, 0x000207ae, 0x00001fce, 0x000207b0,
+    0x00001fcf, 0x000207b2, 0x00001fd0, 0x000207b4, 0x00001fd1, 0x000207b6, 0x00001fd2, 0x000307b8,
+    0x00001fd3, 0x000307bb, 0x00001fd6, 0x000207be, 0x00001fd7, 0x000307c0, 0x00001fd8, 0x000207c3,
+    0x00001fd9, 0x000207c5, 0x00001fda, 0x000207c7, 0x00001fdb, 0x000207c9, 0x00001fdd, 0x000207cb,
+    0x00001fde, 0x000207cd, 0x00001fdf, 0x000207cf, 0x00001fe0, 0x000207d1, 0x00001fe1, 0x000207d3,
+    0x00001fe2, 0x000307d5, 0x00001fe3, 0x000307d8, 0x00001fe4, 0x000207db, 0x00001fe5, 0x000207dd,
+    0x00001fe6, 0x000207df, 0x00001fe7, 0x000307e1, 0x00001fe8, 0x000207e4, 0x00001fe9, 0x000207e6,
+    0x00001fea, 0x000207e8, 0x00001feb, 0x000207ea, 0x00001fec, 0x000207ec, 0x00001fed, 0x000207ee,
+    0x00001fee, 0x000207f0, 0x00001fef, 0x000107f2, 0x00001ff2, 0x000307f3, 0x00001ff3, 0x000207f6,
+    0x00001ff4, 0x000307f8, 0x00001ff6, 0x000207fb, 0x00001ff7, 0x000307fd, 0x00001ff8, 0x00020800,
+    0x00001ff9, 0x00020802, 0x00001ffa, 0x00020804, 0x00001ffb, 0x00020806, 0x00001ffc, 0x00020808,
+    0x00001ffd, 0x0001080a, 0x00002000, 0x0001080b, 0x00002001, 0x0001080c, 0x00002126, 0x0001080d,
+    0x0000212a, 0x0001080e, 0x0000212b, 0x0002080f, 0x0000219a, 0x00020811, 0x0000219b, 0x00020813,
+    0x000021ae, 0x00020815, 0x000021cd, 0x00020817, 0x000021ce, 0x00020819, 0x000021cf, 0x0002081b,
+    0x00002204, 0x0002081d, 0x00002209, 0x0002081f, 0x0000220c, 0x00020821, 0x00002224, 0x00020823,
+    0x00002226, 0x00020825, 0x00002241, 0x00020827, 0x00002244, 0x00020829, 0x00002247, 0x0002082b,
+    0x00002249, 0x0002082d, 0x00002260, 0x0002082f, 0x00002262, 0x00020831, 0x0000226d, 0x00020833,
+    0x0000226e, 0x00020835, 0x0000226f, 0x00020837, 0x00002270, 0x00020839, 0x00002271, 0x0002083b,
+    0x00002274, 0x0002083d, 0x00002275, 0x0002083f, 0x00002278, 0x00020841, 0x00002279, 0x00020843,
+    0x00002280, 0x00020845, 0x00002281, 0x00020847, 0x00002284, 0x00020849, 0x00002285, 0x0002084b,
+    0x00002288, 0x0002084d, 0x00002289, 0x0002084f, 0x000022ac, 0x00020851, 0x000022ad, 0x00020853,
+    0x000022ae, 0x00020855, 0x000022af, 0x00020857, 0x000022e0, 0x00020859, 0x000022e1, 0x0002085b,
+    0x000022e2, 0x0002085d, 0x000022e3, 0x0002085f, 0x000022ea, 0x00020861, 0x000022eb, 0x00020863,
+    0x000022ec, 0x00020865, 0x000022ed, 0x00020867, 0x00002329, 0x00010869, 0x0000232a, 0x0001086a,
+    0x00002adc, 0x0002086b, 0x0000304c, 0x0002086d, 0x0000304e, 0x0002086f, 0x00003050, 0x00020871,
+    0x00003052, 0x00020873, 0x00003054, 0x00020875, 0x00003056, 0x00020877, 0x00003058, 0x00020879,
+    0x0000305a, 0x0002087b, 0x0000305c, 0x0002087d, 0x0000305e, 0x0002087f, 0x00003060, 0x00020881,
+    0x00003062, 0x00020883, 0x00003065, 0x00020885, 0x00003067, 0x00020887, 0x00003069, 0x00020889,
+    0x00003070, 0x0002088b, 0x00003071, 0x0002088d, 0x00003073, 0x0002088f, 0x00003074, 0x00020891,
+    0x00003076, 0x00020893, 0x00003077, 0x00020895, 0x00003079, 0x00020897, 0x0000307a, 0x00020899,
+    0x0000307c, 0x0002089b, 0x0000307d, 0x0002089d, 0x00003094, 0x0002089f, 0x0000309e, 0x000208a1,
+    0x000030ac, 0x000208a3, 0x000030ae, 0x000208a5, 0x000030b0, 0x000208a7, 0x000030b2, 0x000208a9,
+    0x000030b4, 0x000208ab, 0x000030b6, 0x000208ad, 0x000030b8, 0x000208af, 0x000030ba, 0x000208b1,
+    0x000030bc, 0x000208b3, 0x000030be, 0x000208b5, 0x000030c0, 0x000208b7, 0x000030c2, 0x000208b9,
+    0x000030c5, 0x000208bb, 0x000030c7, 0x000208bd, 0x000030c9, 0x000208bf, 0x000030d0, 0x000208c1,
+    0x000030d1, 0x000208c3, 0x000030d3, 0x000208c5, 0x000030d4, 0x000208c7, 0x000030d6, 0x000208c9,
+    0x000030d7, 0x000208cb, 0x000030d9, 0x000208cd, 0x000030da, 0x000208cf, 0x000030dc, 0x000208d1,
+    0x000030dd, 0x000208d3, 0x000030f4, 0x000208d5, 0x000030f7, 0x000208d7, 0x000030f8, 0x000208d9,
+    0x000030f9, 0x000208db, 0x000030fa, 0x000208dd, 0x000030fe, 0x000208df, 0x0000f900, 0x000108e1,
+    0x0000f901, 0x000108e2, 0x0000f902, 0x000108e3, 0x0000f903, 0x000108e4, 0x0000f904, 0x000108e5,
+    0x0000f905, 0x000108e6, 0x0000f906, 0x000108e7, 0x0000f907, 0x000108e8, 0x0000f908, 0x000108e9,
+    0x0000f909, 0x000108ea, 0x0000f90a, 0x000108eb, 0x0000f90b, 0x000108ec, 0x0000f90c, 0x000108ed,
+    0x0000f90d, 0x000108ee, 0x0000f90e, 0x000108ef, 0x0000f90f, 0x000108f0, 0x0000f910, 0x000108f1,
+    0x0000f911, 0x000108f2, 0x0000f912, 0x000108f3, 0x0000f913, 0x000108f4, 0x0000f914, 0x000108f5,
+    0x0000f915, 0x000108f6, 0x0000f916, 0x000108f7, 0x0000f917, 0x000108f8, 0x0000f918, 0x000108f9,
+    0x0000f919, 0x000108fa, 0x0000f91a, 0x000108fb, 0x0000f91b, 0x000108fc, 0x0000f91c, 0x000108fd,
+    0x0000f91d, 0x000108fe, 0x0000f91e, 0x000108ff, 0x0000f91f, 0x00010900, 0x0000f920, 0x00010901,
+    0x0000f921, 0x00010902, 0x0000f922, 0x00010903, 0x0000f923, 0x00010904, 0x0000f924, 0x00010905,
+    0x0000f925, 0x00010906, 0x0000f926, 0x00010907, 0x0000f927, 0x00010908, 0x0000f928, 0x00010909,
+    0x0000f929, 0x0001090a, 0x0000f92a, 0x0001090b, 0x0000f92b, 0x0001090c, 0x0000f92c, 0x0001090d,
+    0x0000f92d, 0x0001090e, 0x0000f92e, 0x0001090f, 0x0000f92f, 0x00010910, 0x0000f930, 0x00010911,
+    0x0000f931, 0x00010912, 0x0000f932, 0x00010913, 0x0000f933, 0x00010914, 0x0000f934, 0x00010915,
+    0x0000f935, 0x00010916, 0x0000f936, 0x00010917, 0x0000f937, 0x00010918, 0x0000f938, 0x00010919,
+    0x0000f939, 0x0001091a, 0x0000f93a, 0x0001091b, 0x0000f93b, 0x0001091c, 0x0000f93c, 0x0001091d,
+    0x0000f93d, 0x0001091e, 0x0000f93e, 0x0001091f, 0x0000f93f, 0x00010920, 0x0000f940, 0x00010921,
+    0x0000f941, 0x00010922, 0x0000f942, 0x00010923, 0x0000f943, 0x00010924, 0x0000f944, 0x00010925,
+    0x0000f945, 0x00010926, 0x0000f946, 0x00010927, 0x0000f947, 0x00010928, 0x0000f948, 0x00010929,
+    0x0000f949, 0x0001092a, 0x0000f94a, 0x0001092b, 0x0000f94b, 0x0001092c, 0x0000f94c, 0x0001092d,
+    0x0000f94d, 0x0001092e, 0x0000f94e, 0x0001092f, 0x0000f94f, 0x00010930, 0x0000f950, 0x00010931,
+    0x0000f951, 0x00010932, 0x0000f952, 0x00010933, 0x0000f953, 0x00010934, 0x0000f954, 0x00010935,
+    0x0000f955, 0x00010936, 0x0000f956, 0x00010937, 0x0000f957, 0x00010938, 0x0000f958, 0x00010939,
+    0x0000f959, 0x0001093a, 0x0000f95a, 0x0001093b, 0x0000f95b, 0x0001093c, 0x0000f95c, 0x0001093d,
+    0x0000f95d, 0x0001093e, 0x0000f95e, 0x0001093f, 0x0000f95f, 0x00010940, 0x0000f960, 0x00010941,
+    0x0000f961, 0x00010942, 0x0000f962, 0x00010943, 0x0000f963, 0x00010944, 0x0000f964, 0x00010945,
+    0x0000f965, 0x00010946, 0x0000f966, 0x00010947, 0x0000f967, 0x00010948, 0x0000f968, 0x00010949,
+    0x0000f969, 0x0001094a, 0x0000f96a, 0x0001094b, 0x0000f96b, 0x0001094c, 0x0000f96c, 0x0001094d,
+    0x0000f96d, 0x0001094e, 0x0000f96e, 0x0001094f, 0x0000f96f, 0x00010950, 0x0000f970, 0x00010951,
+    0x0000f971, 0x00010952, 0x0000f972, 0x00010953, 0x0000f973, 0x00010954, 0x0000f974, 0x00010955,
+    0x0000f975, 0x00010956, 0x0000f976, 0x00010957, 0x0000f977, 0x00010958, 0x0000f978, 0x00010959,
+    0x0000f979, 0x0001095a, 0x0000f97a, 0x0001095b, 0x0000f97b, 0x0001095c, 0x0000f97c, 0x0001095d,
+    0x0000f97d, 0x0001095e, 0x0000f97e, 0x0001095f, 0x0000f97f, 0x00010960, 0x0000f980, 0x00010961,
+    0x0000f981, 0x00010962, 0x0000f982, 0x00010963, 0x0000f983, 0x00010964, 0x0000f984, 0x00010965,
+    0x0000f985, 0x00010966, 0x0000f986, 0x00010967, 0x0000f987, 0x00010968, 0x0000f988, 0x00010969,
+    0x0000f989, 0x0001096a, 0x0000f98a, 0x0001096b, 0x0000f98b, 0x0001096c, 0x0000f98c, 0x0001096d,
+    0x0000f98d, 0x0001096e, 0x0000f98e, 0x0001096f, 0x0000f98f, 0x00010970, 0x0000f990, 0x00010971,
+    0x0000f991, 0x00010972, 0x0000f992, 0x00010973, 0x0000f993, 0x00010974, 0x0000f994, 0x00010975,
+    0x0000f995, 0x00010976, 0x0000f996, 0x00010977, 0x0000f997, 0x00010978, 0x0000f998, 0x00010979,
+    0x0000f999, 0x0001097a, 0x0000f99a, 0x0001097b, 0x0000f99b, 0x0001097c, 0x0000f99c, 0x0001097d,
+    0x0000f99d, 0x0001097e, 0x0000f99e, 0x0001097f, 0x0000f99f, 0x00010980, 0x0000f9a0, 0x00010981,
+    0x0000f9a1, 0x00010982, 0x0000f9a2, 0x00010983, 0x0000f9a3, 0x00010984, 0x0000f9a4, 0x00010985,
+    0x0000f9a5, 0x00010986, 0x0000f9a6, 0x00010987, 0x0000f9a7, 0x00010988, 0x0000f9a8, 0x00010989,
+    0x0000f9a9, 0x0001098a, 0x0000f9aa, 0x0001098b, 0x0000f9ab, 0x0001098c, 0x0000f9ac, 0x0001098d,
+    0x0000f9ad, 0x0001098e, 0x0000f9ae, 0x0001098f, 0x0000f9af, 0x00010990, 0x0000f9b0, 0x00010991,
+    0x0000f9b1, 0x00010992, 0x0000f9b2, 0x00010993, 0x0000f9b3, 0x00010994, 0x0000f9b4, 0x00010995,
+    0x0000f9b5, 0x00010996, 0x0000f9b6, 0x00010997, 0x0000f9b7, 0x00010998, 0x0000f9b8, 0x00010999,
+    0x0000f9b9, 0x0001099a, 0x0000f9ba, 0x0001099b, 0x0000f9bb, 0x0001099c, 0x0000f9bc, 0x0001099d,
+    0x0000f9bd, 0x0001099e, 0x0000f9be, 0x0001099f, 0x0000f9bf, 0x000109a0, 0x0000f9c0, 0x000109a1,
+    0x0000f9c1, 0x000109a2, 0x0000f9c2, 0x000109a3, 0x0000f9c3, 0x000109a4, 0x0000f9c4, 0x000109a5,
+    0x0000f9c5, 0x000109a6, 0x0000f9c6, 0x000109a7, 0x0000f9c7, 0x000109a8, 0x0000f9c8, 0x000109a9,
+    0x0000f9c9, 0x000109aa, 0x0000f9ca, 0x000109ab, 0x0000f9cb, 0x000109ac, 0x0000f9cc, 0x000109ad,
+    0x0000f9cd, 0x000109ae, 0x0000f9ce, 0x000109af, 0x0000f9cf, 0x000109b0, 0x0000f9d0, 0x000109b1,
+    0x0000f9d1, 0x000109b2, 0x0000f9d2, 0x000109b3, 0x0000f9d3, 0x000109b4, 0x0000f9d4, 0x000109b5,
+    0x0000f9d5, 0x000109b6, 0x0000f9d6, 0x000109b7, 0x0000f9d7, 0x000109b8, 0x0000f9d8, 0x000109b9,
+    0x0000f9d9, 0x000109ba, 0x0000f9da, 0x000109bb, 0x0000f9db, 0x000109bc, 0x0000f9dc, 0x000109bd,
+    0x0000f9dd, 0x000109be, 0x0000f9de, 0x000109bf, 0x0000f9df, 0x000109c0, 0x0000f9e0, 0x000109c1,
+    0x0000f9e1, 0x000109c2, 0x0000f9e2, 0x000109c3, 0x0000f9e3, 0x000109c4, 0x0000f9e4, 0x000109c5,
+    0x0000f9e5, 0x000109c6, 0x0000f9e6, 0x000109c7, 0x0000f9e7, 0x000109c8, 0x0000f9e8, 0x000109c9,
+    0x0000f9e9, 0x000109ca, 0x0000f9ea, 0x000109cb, 0x0000f9eb, 0x000109cc, 0x0000f9ec, 0x000109cd,
+    0x0000f9ed, 0x000109ce, 0x0000f9ee, 0x000109cf, 0x0000f9ef, 0x000109d0, 0x0000f9f0, 0x000109d1,
+    0x0000f9f1, 0x000109d2, 0x0000f9f2, 0x000109d3, 0x0000f9f3, 0x000109d4, 0x0000f9f4, 0x000109d5,
+    0x0000f9f5, 0x000109d6, 0x0000f9f6, 0x000109d7, 0x0000f9f7, 0x000109d8, 0x0000f9f8, 0x000109d9,
+    0x0000f9f9, 0x000109da, 0x0000f9fa, 0x000109db, 0x0000f9fb, 0x000109dc, 0x0000f9fc, 0x000109dd,
+    0x0000f9fd, 0x000109de, 0x0000f9fe, 0x000109df, 0x0000f9ff, 0x000109e0, 0x0000fa00, 0x000109e1,
+    0x0000fa01, 0x000109e2, 0x0000fa02, 0x000109e3, 0x0000fa03, 0x000109e4, 0x0000fa04, 0x000109e5,
+    0x0000fa05, 0x000109e6, 0x0000fa06, 0x000109e7, 0x0000fa07, 0x000109e8, 0x0000fa08, 0x000109e9,
+    0x0000fa09, 0x000109ea, 0x0000fa0a, 0x000109eb, 0x0000fa0b, 0x000109ec, 0x0000fa0c, 0x000109ed,
+    0x0000fa0d, 0x000109ee, 0x0000fa10, 0x000109ef, 0x0000fa12, 0x000109f0, 0x0000fa15, 0x000109f1,
+    0x0000fa16, 0x000109f2, 0x0000fa17, 0x000109f3, 0x0000fa18, 0x000109f4, 0x0000fa19, 0x000109f5,
+    0x0000fa1a, 0x000109f6, 0x0000fa1b, 0x000109f7, 0x0000fa1c, 0x000109f8, 0x0000fa1d, 0x000109f9,
+    0x0000fa1e, 0x000109fa, 0x0000fa20, 0x000109fb, 0x0000fa22, 0x000109fc, 0x0000fa25, 0x000109fd,
+    0x0000fa26, 0x000109fe, 0x0000fa2a, 0x000109ff, 0x0000fa2b, 0x00010a00, 0x0000fa2c, 0x00010a01,
+    0x0000fa2d, 0x00010a02, 0x0000fa2e, 0x00010a03, 0x0000fa2f, 0x00010a04, 0x0000fa30, 0x00010a05,
+    0x0000fa31, 0x00010a06, 0x0000fa32, 0x00010a07, 0x0000fa33, 0x00010a08, 0x0000fa34, 0x00010a09,
+    0x0000fa35, 0x00010a0a, 0x0000fa36, 0x00010a0b, 0x0000fa37, 0x00010a0c, 0x0000fa38, 0x00010a0d,
+    0x0000fa39, 0x00010a0e, 0x0000fa3a, 0x00010a0f, 0x0000fa3b, 0x00010a10, 0x0000fa3c, 0x00010a11,
+    0x0000fa3d, 0x00010a12, 0x0000fa3e, 0x00010a13, 0x0000fa3f, 0x00010a14, 0x0000fa40, 0x00010a15,
+    0x0000fa41, 0x00010a16, 0x0000fa42, 0x00010a17, 0x0000fa43, 0x00010a18, 0x0000fa44, 0x00010a19,
+    0x0000fa45, 0x00010a1a, 0x0000fa46, 0x00010a1b, 0x0000fa47, 0x00010a1c, 0x0000fa48, 0x00010a1d,
+    0x0000fa49, 0x00010a1e, 0x0000fa4a, 0x00010a1f, 0x0000fa4b, 0x00010a20, 0x0000fa4c, 0x00010a21,
+    0x0000fa4d, 0x00010a22, 0x0000fa4e, 0x00010a23, 0x0000fa4f, 0x00010a24, 0x0000fa50, 0x00010a25,
+    0x0000fa51, 0x00010a26, 0x0000fa52, 0x00010a27, 0x0000fa53, 0x00010a28, 0x0000fa54, 0x00010a29,
+    0x0000fa55, 0x00010a2a, 0x0000fa56, 0x00010a2b, 0x0000fa57, 0x00010a2c, 0x0000fa58, 0x00010a2d,
+    0x0000fa59, 0x00010a2e, 0x0000fa5a, 0x00010a2f, 0x0000fa5b, 0x00010a30, 0x0000fa5c, 0x00010a31,
+    0x0000fa5d, 0x00010a32, 0x0000fa5e, 0x00010a33, 0x0000fa5f, 0x00010a34, 0x0000fa60, 0x00010a35,
+    0x0000fa61, 0x00010a36, 0x0000fa62, 0x00010a37, 0x0000fa63, 0x00010a38, 0x0000fa64, 0x00010a39,
+    0x0000fa65, 0x00010a3a, 0x0000fa66, 0x00010a3b, 0x0000fa67, 0x00010a3c, 0x0000fa68, 0x00010a3d,
+    0x0000fa69, 0x00010a3e, 0x0000fa6a, 0x00010a3f, 0x0000fa6b, 0x00010a40, 0x0000fa6c, 0x00010a41,
+    0x0000fa6d, 0x00010a42, 0x0000fa70, 0x00010a43, 0x0000fa71, 0x00010a44, 0x0000fa72, 0x00010a45,
+    0x0000fa73, 0x00010a46, 0x0000fa74, 0x00010a47, 0x0000fa75, 0x00010a48, 0x0000fa76, 0x00010a49,
+    0x0000fa77, 0x00010a4a, 0x0000fa78, 0x00010a4b, 0x0000fa79, 0x00010a4c, 0x0000fa7a, 0x00010a4d,
+    0x0000fa7b, 0x00010a4e, 0x0000fa7c, 0x00010a4f, 0x0000fa7d, 0x00010a50, 0x0000fa7e, 0x00010a51,
+    0x0000fa7f, 0x00010a52, 0x0000fa80, 0x00010a53, 0x0000fa81, 0x00010a54, 0x0000fa82, 0x00010a55,
+    0x0000fa83, 0x00010a56, 0x0000fa84, 0x00010a57, 0x0000fa85, 0x00010a58, 0x0000fa86, 0x00010a59,
+    0x0000fa87, 0x00010a5a, 0x0000fa88, 0x00010a5b, 0x0000fa89, 0x00010a5c, 0x0000fa8a, 0x00010a5d,
+    0x0000fa8b, 0x00010a5e, 0x0000fa8c, 0x00010a5f, 0x0000fa8d, 0x00010a60, 0x0000fa8e, 0x00010a61,
+    0x0000fa8f, 0x00010a62, 0x0000fa90, 0x00010a63, 0x0000fa91, 0x00010a64, 0x0000fa92, 0x00010a65,
+    0x0000fa93, 0x00010a66, 0x0000fa94, 0x00010a67, 0x0000fa95, 0x00010a68, 0x0000fa96, 0x00010a69,
+    0x0000fa97, 0x00010a6a, 0x0000fa98, 0x00010a6b, 0x0000fa99, 0x00010a6c, 0x0000fa9a, 0x00010a6d,
+    0x0000fa9b, 0x00010a6e, 0x0000fa9c, 0x00010a6f, 0x0000fa9d, 0x00010a70, 0x0000fa9e, 0x00010a71,
+    0x0000fa9f, 0x00010a72, 0x0000faa0, 0x00010a73, 0x0000faa1, 0x00010a74, 0x0000faa2, 0x00010a75,
+    0x0000faa3, 0x00010a76, 0x0000faa4, 0x00010a77, 0x0000faa5, 0x00010a78, 0x0000faa6, 0x00010a79,
+    0x0000faa7, 0x00010a7a, 0x0000faa8, 0x00010a7b, 0x0000faa9, 0x00010a7c, 0x0000faaa, 0x00010a7d,
+    0x0000faab, 0x00010a7e, 0x0000faac, 0x00010a7f, 0x0000faad, 0x00010a80, 0x0000faae, 0x00010a81,
+    0x0000faaf, 0x00010a82, 0x0000fab0, 0x00010a83, 0x0000fab1, 0x00010a84, 0x0000fab2, 0x00010a85,
+    0x0000fab3, 0x00010a86, 0x0000fab4, 0x00010a87, 0x0000fab5, 0x00010a88, 0x0000fab6, 0x00010a89,
+    0x0000fab7, 0x00010a8a, 0x0000fab8, 0x00010a8b, 0x0000fab9, 0x00010a8c, 0x0000faba, 0x00010a8d,
+    0x0000fabb, 0x00010a8e, 0x0000fabc, 0x00010a8f, 0x0000fabd, 0x00010a90, 0x0000fabe, 0x00010a91,
+    0x0000fabf, 0x00010a92, 0x0000fac0, 0x00010a93, 0x0000fac1, 0x00010a94, 0x0000fac2, 0x00010a95,
+    0x0000fac3, 0x00010a96, 0x0000fac4, 0x00010a97, 0x0000fac5, 0x00010a98, 0x0000fac6, 0x00010a99,
+    0x0000fac7, 0x00010a9a, 0x0000fac8, 0x00010a9b, 0x0000fac9, 0x00010a9c, 0x0000faca, 0x00010a9d,
+    0x0000facb, 0x00010a9e, 0x0000facc, 0x00010a9f, 0x0000facd, 0x00010aa0, 0x0000face, 0x00010aa1,
+    0x0000facf, 0x00010aa2, 0x0000fad0, 0x00010aa3, 0x0000fad1, 0x00010aa4, 0x0000fad2, 0x00010aa5,
+    0x0000fad3, 0x00010aa6, 0x0000fad4, 0x00010aa7, 0x0000fad5, 0x00010aa8, 0x0000fad6, 0x00010aa9,
+    0x0000fad7, 0x00010aaa, 0x0000fad8, 0x00010aab, 0x0000fad9, 0x00010aac, 0x0000fb1d, 0x00020aad,
+    0x0000fb1f, 0x00020aaf, 0x0000fb2a, 0x00020ab1, 0x0000fb2b, 0x00020ab3, 0x0000fb2c, 0x00030ab5,
+    0x0000fb2d, 0x00030ab8, 0x0000fb2e, 0x00020abb, 0x0000fb2f, 0x00020abd, 0x0000fb30, 0x00020abf,
+    0x0000fb31, 0x00020ac1, 0x0000fb32, 0x00020ac3, 0x0000fb33, 0x00020ac5, 0x0000fb34, 0x00020ac7,
+    0x0000fb35, 0x00020ac9, 0x0000fb36, 0x00020acb, 0x0000fb38, 0x00020acd, 0x0000fb39, 0x00020acf,
+    0x0000fb3a, 0x00020ad1, 0x0000fb3b, 0x00020ad3, 0x0000fb3c, 0x00020ad5, 0x0000fb3e, 0x00020ad7,
+    0x0000fb40, 0x00020ad9, 0x0000fb41, 0x00020adb, 0x0000fb43, 0x00020add, 0x0000fb44, 0x00020adf,
+    0x0000fb46, 0x00020ae1, 0x0000fb47, 0x00020ae3, 0x0000fb48, 0x00020ae5, 0x0000fb49, 0x00020ae7,
+    0x0000fb4a, 0x00020ae9, 0x0000fb4b, 0x00020aeb, 0x0000fb4c, 0x00020aed, 0x0000fb4d, 0x00020aef,
+    0x0000fb4e, 0x00020af1, 0x0001109a, 0x00020af3, 0x0001109c, 0x00020af5, 0x000110ab, 0x00020af7,
+    0x0001112e, 0x00020af9, 0x0001112f, 0x00020afb, 0x0001134b, 0x00020afd, 0x0001134c, 0x00020aff,
+    0x000114bb, 0x00020b01, 0x000114bc, 0x00020b03, 0x000114be, 0x00020b05, 0x000115ba, 0x00020b07,
+    0x000115bb, 0x00020b09, 0x00011938, 0x00020b0b, 0x0001d15e, 0x00020b0d, 0x0001d15f, 0x00020b0f,
+    0x0001d160, 0x00030b11, 0x0001d161, 0x00030b14, 0x0001d162, 0x00030b17, 0x0001d163, 0x00030b1a,
+    0x0001d164, 0x00030b1d, 0x0001d1bb, 0x00020b20, 0x0001d1bc, 0x00020b22, 0x0001d1bd, 0x00030b24,
+    0x0001d1be, 0x00030b27, 0x0001d1bf, 0x00030b2a, 0x0001d1c0, 0x00030b2d, 0x0002f800, 0x00010b30,
+    0x0002f801, 0x00010b31, 0x0002f802, 0x00010b32, 0x0002f803, 0x00010b33, 0x0002f804, 0x00010b34,
+    0x0002f805, 0x00010b35, 0x0002f806, 0x00010b36, 0x0002f807, 0x00010b37, 0x0002f808, 0x00010b38,
+    0x0002f809, 0x00010b39, 0x0002f80a, 0x00010b3a, 0x0002f80b, 0x00010b3b, 0x0002f80c, 0x00010b3c,
+    0x0002f80d, 0x00010b3d, 0x0002f80e, 0x00010b3e, 0x0002f80f, 0x00010b3f, 0x0002f810, 0x00010b40,
+    0x0002f811, 0x00010b41, 0x0002f812, 0x00010b42, 0x0002f813, 0x00010b43, 0x0002f814, 0x00010b44,
+    0x0002f815, 0x00010b45, 0x0002f816, 0x00010b46, 0x0002f817, 0x00010b47, 0x0002f818, 0x00010b48,
+    0x0002f819, 0x00010b49, 0x0002f81a, 0x00010b4a, 0x0002f81b, 0x00010b4b, 0x0002f81c, 0x00010b4c,
+    0x0002f81d, 0x00010b4d, 0x0002f81e, 0x00010b4e, 0x0002f81f, 0x00010b4f, 0x0002f820, 0x00010b50,
+    0x0002f821, 0x00010b51, 0x0002f822, 0x00010b52, 0x0002f823, 0x00010b53, 0x0002f824, 0x00010b54,
+    0x0002f825, 0x00010b55, 0x0002f826, 0x00010b56, 0x0002f827, 0x00010b57, 0x0002f828, 0x00010b58,
+    0x0002f829, 0x00010b59, 0x0002f82a, 0x00010b5a, 0x0002f82b, 0x00010b5b, 0x0002f82c, 0x00010b5c,
+    0x0002f82d, 0x00010b5d, 0x0002f82e, 0x00010b5e, 0x0002f82f, 0x00010b5f, 0x0002f830, 0x00010b60,
+    0x0002f831, 0x00010b61, 0x0002f832, 0x00010b62, 0x0002f833, 0x00010b63, 0x0002f834, 0x00010b64,
+    0x0002f835, 0x00010b65, 0x0002f836, 0x00010b66, 0x0002f837, 0x00010b67, 0x0002f838, 0x00010b68,
+    0x0002f839, 0x00010b69, 0x0002f83a, 0x00010b6a, 0x0002f83b, 0x00010b6b, 0x0002f83c, 0x00010b6c,
+    0x0002f83d, 0x00010b6d, 0x0002f83e, 0x00010b6e, 0x0002f83f, 0x00010b6f, 0x0002f840, 0x00010b70,
+    0x0002f841, 0x00010b71, 0x0002f842, 0x00010b72, 0x0002f843, 0x00010b73, 0x0002f844, 0x00010b74,
+    0x0002f845, 0x00010b75, 0x0002f846, 0x00010b76, 0x0002f847, 0x00010b77, 0x0002f848, 0x00010b78,
+    0x0002f849, 0x00010b79, 0x0002f84a, 0x00010b7a, 0x0002f84b, 0x00010b7b, 0x0002f84c, 0x00010b7c,
+    0x0002f84d, 0x00010b7d, 0x0002f84e, 0x00010b7e, 0x0002f84f, 0x00010b7f, 0x0002f850, 0x00010b80,
+    0x0002f851, 0x00010b81, 0x0002f852, 0x00010b82, 0x0002f853, 0x00010b83, 0x0002f854, 0x00010b84,
+    0x0002f855, 0x00010b85, 0x0002f856, 0x00010b86, 0x0002f857, 0x00010b87, 0x0002f858, 0x00010b88,
+    0x0002f859, 0x00010b89, 0x0002f85a, 0x00010b8a, 0x0002f85b, 0x00010b8b, 0x0002f85c, 0x00010b8c,
+    0x0002f85d, 0x00010b8d, 0x0002f85e, 0x00010b8e, 0x0002f85f, 0x00010b8f, 0x0002f860, 0x00010b90,
+    0x0002f861, 0x00010b91, 0x0002f862, 0x00010b92, 0x0002f863, 0x00010b93, 0x0002f864, 0x00010b94,
+    0x0002f865, 0x00010b95, 0x0002f866, 0x00010b96, 0x0002f867, 0x00010b97, 0x0002f868, 0x00010b98,
+    0x0002f869, 0x00010b99, 0x0002f86a, 0x00010b9a, 0x0002f86b, 0x00010b9b, 0x0002f86c, 0x00010b9c,
+    0x0002f86d, 0x00010b9d, 0x0002f86e, 0x00010b9e, 0x0002f86f, 0x00010b9f, 0x0002f870, 0x00010ba0,
+    0x0002f871, 0x00010ba1, 0x0002f872, 0x00010ba2, 0x0002f873, 0x00010ba3, 0x0002f874, 0x00010ba4,
+    0x0002f875, 0x00010ba5, 0x0002f876, 0x00010ba6, 0x0002f877, 0x00010ba7, 0x0002f878, 0x00010ba8,
+    0x0002f879, 0x00010ba9, 0x0002f87a, 0x00010baa, 0x0002f87b, 0x00010bab, 0x0002f87c, 0x00010bac,
+    0x0002f87d, 0x00010bad, 0x0002f87e, 0x00010bae, 0x0002f87f, 0x00010baf, 0x0002f880, 0x00010bb0,
+    0x0002f881, 0x00010bb1, 0x0002f882, 0x00010bb2, 0x0002f883, 0x00010bb3, 0x0002f884, 0x00010bb4,
+    0x0002f885, 0x00010bb5, 0x0002f886, 0x00010bb6, 0x0002f887, 0x00010bb7, 0x0002f888, 0x00010bb8,
+    0x0002f889, 0x00010bb9, 0x0002f88a, 0x00010bba, 0x0002f88b, 0x00010bbb, 0x0002f88c, 0x00010bbc,
+    0x0002f88d, 0x00010bbd, 0x0002f88e, 0x00010bbe, 0x0002f88f, 0x00010bbf, 0x0002f890, 0x00010bc0,
+    0x0002f891, 0x00010bc1, 0x0002f892, 0x00010bc2, 0x0002f893, 0x00010bc3, 0x0002f894, 0x00010bc4,
+    0x0002f895, 0x00010bc5, 0x0002f896, 0x00010bc6, 0x0002f897, 0x00010bc7, 0x0002f898, 0x00010bc8,
+    0x0002f899, 0x00010bc9, 0x0002f89a, 0x00010bca, 0x0002f89b, 0x00010bcb, 0x0002f89c, 0x00010bcc,
+    0x0002f89d, 0x00010bcd, 0x0002f89e, 0x00010bce, 0x0002f89f, 0x00010bcf, 0x0002f8a0, 0x00010bd0,
+    0x0002f8a1, 0x00010bd1, 0x0002f8a2, 0x00010bd2, 0x0002f8a3, 0x00010bd3, 0x0002f8a4, 0x00010bd4,
+    0x0002f8a5, 0x00010bd5, 0x0002f8a6, 0x00010bd6, 0x0002f8a7, 0x00010bd7, 0x0002f8a8, 0x00010bd8,
+    0x0002f8a9, 0x00010bd9, 0x0002f8aa, 0x00010bda, 0x0002f8ab, 0x00010bdb, 0x0002f8ac, 0x00010bdc,
+    0x0002f8ad, 0x00010bdd, 0x0002f8ae, 0x00010bde, 0x0002f8af, 0x00010bdf, 0x0002f8b0, 0x00010be0,
+    0x0002f8b1, 0x00010be1, 0x0002f8b2, 0x00010be2, 0x0002f8b3, 0x00010be3, 0x0002f8b4, 0x00010be4,
+    0x0002f8b5, 0x00010be5, 0x0002f8b6, 0x00010be6, 0x0002f8b7, 0x00010be7, 0x0002f8b8, 0x00010be8,
+    0x0002f8b9, 0x00010be9, 0x0002f8ba, 0x00010bea, 0x0002f8bb, 0x00010beb, 0x0002f8bc, 0x00010bec,
+    0x0002f8bd, 0x00010bed, 0x0002f8be, 0x00010bee, 0x0002f8bf, 0x00010bef, 0x0002f8c0, 0x00010bf0,
+    0x0002f8c1, 0x00010bf1, 0x0002f8c2, 0x00010bf2, 0x0002f8c3, 0x00010bf3, 0x0002f8c4, 0x00010bf4,
+    0x0002f8c5, 0x00010bf5, 0x0002f8c6, 0x00010bf6, 0x0002f8c7, 0x00010bf7, 0x0002f8c8, 0x00010bf8,
+    0x0002f8c9, 0x00010bf9, 0x0002f8ca, 0x00010bfa, 0x0002f8cb, 0x00010bfb, 0x0002f8cc, 0x00010bfc,
+    0x0002f8cd, 0x00010bfd, 0x0002f8ce, 0x00010bfe, 0x0002f8cf, 0x00010bff, 0x0002f8d0, 0x00010c00,
+    0x0002f8d1, 0x00010c01, 0x0002f8d2, 0x00010c02, 0x0002f8d3, 0x00010c03, 0x0002f8d4, 0x00010c04,
+    0x0002f8d5, 0x00010c05, 0x0002f8d6, 0x00010c06, 0x0002f8d7, 0x00010c07, 0x0002f8d8, 0x00010c08,
+    0x0002f8d9, 0x00010c09, 0x0002f8da, 0x00010c0a, 0x0002f8db, 0x00010c0b, 0x0002f8dc, 0x00010c0c,
+    0x0002f8dd, 0x00010c0d, 0x0002f8de, 0x00010c0e, 0x0002f8df, 0x00010c0f, 0x0002f8e0, 0x00010c10,
+    0x0002f8e1, 0x00010c11, 0x0002f8e2, 0x00010c12, 0x0002f8e3, 0x00010c13, 0x0002f8e4, 0x00010c14,
+    0x0002f8e5, 0x00010c15, 0x0002f8e6, 0x00010c16, 0x0002f8e7, 0x00010c17, 0x0002f8e8, 0x00010c18,
+    0x0002f8e9, 0x00010c19, 0x0002f8ea, 0x00010c1a, 0x0002f8eb, 0x00010c1b, 0x0002f8ec, 0x00010c1c,
+    0x0002f8ed, 0x00010c1d, 0x0002f8ee, 0x00010c1e, 0x0002f8ef, 0x00010c1f, 0x0002f8f0, 0x00010c20,
+    0x0002f8f1, 0x00010c21, 0x0002f8f2, 0x00010c22, 0x0002f8f3, 0x00010c23, 0x0002f8f4, 0x00010c24,
+    0x0002f8f5, 0x00010c25, 0x0002f8f6, 0x00010c26, 0x0002f8f7, 0x00010c27, 0x0002f8f8, 0x00010c28,
+    0x0002f8f9, 0x00010c29, 0x0002f8fa, 0x00010c2a, 0x0002f8fb, 0x00010c2b, 0x0002f8fc, 0x00010c2c,
+    0x0002f8fd, 0x00010c2d, 0x0002f8fe, 0x00010c2e, 0x0002f8ff, 0x00010c2f, 0x0002f900, 0x00010c30,
+    0x0002f901, 0x00010c31, 0x0002f902, 0x00010c32, 0x0002f903, 0x00010c33, 0x0002f904, 0x00010c34,
+    0x0002f905, 0x00010c35, 0x0002f906, 0x00010c36, 0x0002f907, 0x00010c37, 0x0002f908, 0x00010c38,
+    0x0002f909, 0x00010c39, 0x0002f90a, 0x00010c3a, 0x0002f90b, 0x00010c3b, 0x0002f90c, 0x00010c3c,
+    0x0002f90d, 0x00010c3d, 0x0002f90e, 0x00010c3e, 0x0002f90f, 0x00010c3f, 0x0002f910, 0x00010c40,
+    0x0002f911, 0x00010c41, 0x0002f912, 0x00010c42, 0x0002f913, 0x00010c43, 0x0002f914, 0x00010c44,
+    0x0002f915, 0x00010c45, 0x0002f916, 0x00010c46, 0x0002f917, 0x00010c47, 0x0002f918, 0x00010c48,
+    0x0002f919, 0x00010c49, 0x0002f91a, 0x00010c4a, 0x0002f91b, 0x00010c4b, 0x0002f91c, 0x00010c4c,
+    0x0002f91d, 0x00010c4d, 0x0002f91e, 0x00010c4e, 0x0002f91f, 0x00010c4f, 0x0002f920, 0x00010c50,
+    0x0002f921, 0x00010c51, 0x0002f922, 0x00010c52, 0x0002f923, 0x00010c53, 0x0002f924, 0x00010c54,
+    0x0002f925, 0x00010c55, 0x0002f926, 0x00010c56, 0x0002f927, 0x00010c57, 0x0002f928, 0x00010c58,
+    0x0002f929, 0x00010c59, 0x0002f92a, 0x00010c5a, 0x0002f92b, 0x00010c5b, 0x0002f92c, 0x00010c5c,
+    0x0002f92d, 0x00010c5d, 0x0002f92e, 0x00010c5e, 0x0002f92f, 0x00010c5f, 0x0002f930, 0x00010c60,
+    0x0002f931, 0x00010c61, 0x0002f932, 0x00010c62, 0x0002f933, 0x00010c63, 0x0002f934, 0x00010c64,
+    0x0002f935, 0x00010c65, 0x0002f936, 0x00010c66, 0x0002f937, 0x00010c67, 0x0002f938, 0x00010c68,
+    0x0002f939, 0x00010c69, 0x0002f93a, 0x00010c6a, 0x0002f93b, 0x00010c6b, 0x0002f93c, 0x00010c6c,
+    0x0002f93d, 0x00010c6d, 0x0002f93e, 0x00010c6e, 0x0002f93f, 0x00010c6f, 0x0002f940, 0x00010c70,
+    0x0002f941, 0x00010c71, 0x0002f942, 0x00010c72, 0x0002f943, 0x00010c73, 0x0002f944, 0x00010c74,
+    0x0002f945, 0x00010c75, 0x0002f946, 0x00010c76, 0x0002f947, 0x00010c77, 0x0002f948, 0x00010c78,
+    0x0002f949, 0x00010c79, 0x0002f94a, 0x00010c7a, 0x0002f94b, 0x00010c7b, 0x0002f94c, 0x00010c7c,
+    0x0002f94d, 0x00010c7d, 0x0002f94e, 0x00010c7e, 0x0002f94f, 0x00010c7f, 0x0002f950, 0x00010c80,
+    0x0002f951, 0x00010c81, 0x0002f952, 0x00010c82, 0x0002f953, 0x00010c83, 0x0002f954, 0x00010c84,
+    0x0002f955, 0x00010c85, 0x0002f956, 0x00010c86, 0x0002f957, 0x00010c87, 0x0002f958, 0x00010c88,
+    0x0002f959, 0x00010c89, 0x0002f95a, 0x00010c8a, 0x0002f95b, 0x00010c8b, 0x0002f95c, 0x00010c8c,
+    0x0002f95d, 0x00010c8d, 0x0002f95e, 0x00010c8e, 0x0002f95f, 0x00010c8f, 0x0002f960, 0x00010c90,
+    0x0002f961, 0x00010c91, 0x0002f962, 0x00010c92, 0x0002f963, 0x00010c93, 0x0002f964, 0x00010c94,
+    0x0002f965, 0x00010c95, 0x0002f966, 0x00010c96, 0x0002f967, 0x00010c97, 0x0002f968, 0x00010c98,
+    0x0002f969, 0x00010c99, 0x0002f96a, 0x00010c9a, 0x0002f96b, 0x00010c9b, 0x0002f96c, 0x00010c9c,
+    0x0002f96d, 0x00010c9d, 0x0002f96e, 0x00010c9e, 0x0002f96f, 0x00010c9f, 0x0002f970, 0x00010ca0,
+    0x0002f971, 0x00010ca1, 0x0002f972, 0x00010ca2, 0x0002f973, 0x00010ca3, 0x0002f974, 0x00010ca4,
+    0x0002f975, 0x00010ca5, 0x0002f976, 0x00010ca6, 0x0002f977, 0x00010ca7, 0x0002f978, 0x00010ca8,
+    0x0002f979, 0x00010ca9, 0x0002f97a, 0x00010caa, 0x0002f97b, 0x00010cab, 0x0002f97c, 0x00010cac,
+    0x0002f97d, 0x00010cad, 0x0002f97e, 0x00010cae, 0x0002f97f, 0x00010caf, 0x0002f980, 0x00010cb0,
+    0x0002f981, 0x00010cb1, 0x0002f982, 0x00010cb2, 0x0002f983, 0x00010cb3, 0x0002f984, 0x00010cb4,
+    0x0002f985, 0x00010cb5, 0x0002f986, 0x00010cb6, 0x0002f987, 0x00010cb7, 0x0002f988, 0x00010cb8,
+    0x0002f989, 0x00010cb9, 0x0002f98a, 0x00010cba, 0x0002f98b, 0x00010cbb, 0x0002f98c, 0x00010cbc,
+    0x0002f98d, 0x00010cbd, 0x0002f98e, 0x00010cbe, 0x0002f98f, 0x00010cbf, 0x0002f990, 0x00010cc0,
+    0x0002f991, 0x00010cc1, 0x0002f992, 0x00010cc2, 0x0002f993, 0x00010cc3, 0x0002f994, 0x00010cc4,
+    0x0002f995, 0x00010cc5, 0x0002f996, 0x00010cc6, 0x0002f997, 0x00010cc7, 0x0002f998, 0x00010cc8,
+    0x0002f999, 0x00010cc9, 0x0002f99a, 0x00010cca, 0x0002f99b, 0x00010ccb, 0x0002f99c, 0x00010ccc,
+    0x0002f99d, 0x00010ccd, 0x0002f99e, 0x00010cce, 0x0002f99f, 0x00010ccf, 0x0002f9a0, 0x00010cd0,
+    0x0002f9a1, 0x00010cd1, 0x0002f9a2, 0x00010cd2, 0x0002f9a3, 0x00010cd3, 0x0002f9a4, 0x00010cd4,
+    0x0002f9a5, 0x00010cd5, 0x0002f9a6, 0x00010cd6, 0x0002f9a7, 0x00010cd7, 0x0002f9a8, 0x00010cd8,
+    0x0002f9a9, 0x00010cd9, 0x0002f9aa, 0x00010cda, 0x0002f9ab, 0x00010cdb, 0x0002f9ac, 0x00010cdc,
+    0x0002f9ad, 0x00010cdd, 0x0002f9ae, 0x00010cde, 0x0002f9af, 0x00010cdf, 0x0002f9b0, 0x00010ce0,
+    0x0002f9b1, 0x00010ce1, 0x0002f9b2, 0x00010ce2, 0x0002f9b3, 0x00010ce3, 0x0002f9b4, 0x00010ce4,
+    0x0002f9b5, 0x00010ce5, 0x0002f9b6, 0x00010ce6, 0x0002f9b7, 0x00010ce7, 0x0002f9b8, 0x00010ce8,
+    0x0002f9b9, 0x00010ce9, 0x0002f9ba, 0x00010cea, 0x0002f9bb, 0x00010ceb, 0x0002f9bc, 0x00010cec,
+    0x0002f9bd, 0x00010ced, 0x0002f9be, 0x00010cee, 0x0002f9bf, 0x00010cef, 0x0002f9c0, 0x00010cf0,
+    0x0002f9c1, 0x00010cf1, 0x0002f9c2, 0x00010cf2, 0x0002f9c3, 0x00010cf3, 0x0002f9c4, 0x00010cf4,
+    0x0002f9c5, 0x00010cf5, 0x0002f9c6, 0x00010cf6, 0x0002f9c7, 0x00010cf7, 0x0002f9c8, 0x00010cf8,
+    0x0002f9c9, 0x00010cf9, 0x0002f9ca, 0x00010cfa, 0x0002f9cb, 0x00010cfb, 0x0002f9cc, 0x00010cfc,
+    0x0002f9cd, 0x00010cfd, 0x0002f9ce, 0x00010cfe, 0x0002f9cf, 0x00010cff, 0x0002f9d0, 0x00010d00,
+    0x0002f9d1, 0x00010d01, 0x0002f9d2, 0x00010d02, 0x0002f9d3, 0x00010d03, 0x0002f9d4, 0x00010d04,
+    0x0002f9d5, 0x00010d05, 0x0002f9d6, 0x00010d06, 0x0002f9d7, 0x00010d07, 0x0002f9d8, 0x00010d08,
+    0x0002f9d9, 0x00010d09, 0x0002f9da, 0x00010d0a, 0x0002f9db, 0x00010d0b, 0x0002f9dc, 0x00010d0c,
+    0x0002f9dd, 0x00010d0d, 0x0002f9de, 0x00010d0e, 0x0002f9df, 0x00010d0f, 0x0002f9e0, 0x00010d10,
+    0x0002f9e1, 0x00010d11, 0x0002f9e2, 0x00010d12, 0x0002f9e3, 0x00010d13, 0x0002f9e4, 0x00010d14,
+    0x0002f9e5, 0x00010d15, 0x0002f9e6, 0x00010d16, 0x0002f9e7, 0x00010d17, 0x0002f9e8, 0x00010d18,
+    0x0002f9e9, 0x00010d19, 0x0002f9ea, 0x00010d1a, 0x0002f9eb, 0x00010d1b, 0x0002f9ec, 0x00010d1c,
+    0x0002f9ed, 0x00010d1d, 0x0002f9ee, 0x00010d1e, 0x0002f9ef, 0x00010d1f, 0x0002f9f0, 0x00010d20,
+    0x0002f9f1, 0x00010d21, 0x0002f9f2, 0x00010d22, 0x0002f9f3, 0x00010d23, 0x0002f9f4, 0x00010d24,
+    0x0002f9f5, 0x00010d25, 0x0002f9f6, 0x00010d26, 0x0002f9f7, 0x00010d27, 0x0002f9f8, 0x00010d28,
+    0x0002f9f9, 0x00010d29, 0x0002f9fa, 0x00010d2a, 0x0002f9fb, 0x00010d2b, 0x0002f9fc, 0x00010d2c,
+    0x0002f9fd, 0x00010d2d, 0x0002f9fe, 0x00010d2e, 0x0002f9ff, 0x00010d2f, 0x0002fa00, 0x00010d30,
+    0x0002fa01, 0x00010d31, 0x0002fa02, 0x00010d32, 0x0002fa03, 0x00010d33, 0x0002fa04, 0x00010d34,
+    0x0002fa05, 0x00010d35, 0x0002fa06, 0x00010d36, 0x0002fa07, 0x00010d37, 0x0002fa08, 0x00010d38,
+    0x0002fa09, 0x00010d39, 0x0002fa0a, 0x00010d3a, 0x0002fa0b, 0x00010d3b, 0x0002fa0c, 0x00010d3c,
+    0x0002fa0d, 0x00010d3d, 0x0002fa0e, 0x00010d3e, 0x0002fa0f, 0x00010d3f, 0x0002fa10, 0x00010d40,
+    0x0002fa11, 0x00010d41, 0x0002fa12, 0x00010d42, 0x0002fa13, 0x00010d43, 0x0002fa14, 0x00010d44,
+    0x0002fa15, 0x00010d45, 0x0002fa16, 0x00010d46, 0x0002fa17, 0x00010d47, 0x0002fa18, 0x00010d48,
+    0x0002fa19, 0x00010d49, 0x0002fa1a, 0x00010d4a, 0x0002fa1b, 0x00010d4b, 0x0002fa1c, 0x00010d4c,
+    0x0002fa1d, 0x00010d4d,
+};
+
+/*Code points of the canonical decompositions*/
+const uint32_t __str_decompcps[3406] = {
+    0x00000041, 0x00000300, 0x00000041, 0x00000301, 0x00000041, 0x00000302, 0x00000041, 0x00000303,
+    0x00000041, 0x00000308, 0x00000041, 0x0000030a, 0x00000043, 0x00000327, 0x00000045, 0x00000300,
+    0x00000045, 0x00000301, 0x00000045, 0x00000302, 0x00000045, 0x00000308, 0x00000049, 0x00000300,
+    0x00000049, 0x00000301, 0x00000049, 0x00000302, 0x00000049, 0x00000308, 0x0000004e, 0x00000303,
+    0x0000004f, 0x00000300, 0x0000004f, 0x00000301, 0x0000004f, 0x00000302, 0x0000004f, 0x00000303,
+    0x0000004f, 0x00000308, 0x00000055, 0x00000300, 0x00000055, 0x00000301, 0x00000055, 0x00000302,
+    0x00000055, 0x00000308, 0x00000059, 0x00000301, 0x00000061, 0x00000300, 0x00000061, 0x00000301,
+    0x00000061, 0x00000302, 0x00000061, 0x00000303, 0x00000061, 0x00000308, 0x00000061, 0x0000030a,
+    0x00000063, 0x00000327, 0x00000065, 0x00000300, 0x00000065, 0x00000301, 0x00000065, 0x00000302,
+    0x00000065, 0x00000308, 0x00000069, 0x00000300, 0x00000069, 0x00000301, 0x00000069, 0x00000302,
+    0x00000069, 0x00000308, 0x0000006e, 0x00000303, 0x0000006f, 0x00000300, 0x0000006f, 0x00000301,
+    0x0000006f, 0x00000302, 0x0000006f, 0x00000303, 0x0000006f, 0x00000308, 0x00000075, 0x00000300,
+    0x00000075, 0x00000301, 0x00000075, 0x00000302, 0x00000075, 0x00000308, 0x00000079, 0x00000301,
+    0x00000079, 0x00000308, 0x00000041, 0x00000304, 0x00000061, 0x00000304, 0x00000041, 0x00000306,
+    0x00000061, 0x00000306, 0x00000041, 0x00000328, 0x00000061, 0x00000328, 0x00000043, 0x00000301,
+    0x00000063, 0x00000301, 0x00000043, 0x00000302, 0x00000063, 0x00000302, 0x00000043, 0x00000307,
+    0x00000063, 0x00000307, 0x00000043, 0x0000030c, 0x00000063, 0x0000030c, 0x00000044, 0x0000030c,
+    0x00000064, 0x0000030c, 0x00000045, 0x00000304, 0x00000065, 0x00000304, 0x00000045, 0x00000306,
+    0x00000065, 0x00000306, 0x00000045, 0x00000307, 0x00000065, 0x00000307, 0x00000045, 0x00000328,
+    0x00000065, 0x00000328, 0x00000045, 0x0000030c, 0x00000065, 0x0000030c, 0x00000047, 0x00000302,
+    0x00000067, 0x00000302, 0x00000047, 0x00000306, 0x00000067, 0x00000306, 0x00000047, 0x00000307,
+    0x00000067, 0x00000307, 0x00000047, 0x00000327, 0x00000067, 0x00000327, 0x00000048, 0x00000302,
+    0x00000068, 0x00000302, 0x00000049, 0x00000303, 0x00000069, 0x00000303, 0x00000049, 0x00000304,
+    0x00000069, 0x00000304, 0x00000049, 0x00000306, 0x00000069, 0x00000306, 0x00000049, 0x00000328,
+    0x00000069, 0x00000328, 0x00000049, 0x00000307, 0x0000004a, 0x00000302, 0x0000006a, 0x00000302,
+    0x0000004b, 0x00000327, 0x0000006b, 0x00000327, 0x0000004c, 0x00000301, 0x0000006c, 0x00000301,
+    0x0000004c, 0x00000327, 0x0000006c, 0x00000327, 0x0000004c, 0x0000030c, 0x0000006c, 0x0000030c,
+    0x0000004e, 0x00000301, 0x0000006e, 0x00000301, 0x0000004e, 0x00000327, 0x0000006e, 0x00000327,
+    0x0000004e, 0x0000030c, 0x0000006e, 0x0000030c, 0x0000004f, 0x00000304, 0x0000006f, 0x00000304,
+    0x0000004f, 0x00000306, 0x0000006f, 0x00000306, 0x0000004f, 0x0000030b, 0x0000006f, 0x0000030b,
+    0x00000052, 0x00000301, 0x00000072, 0x00000301, 0x00000052, 0x00000327, 0x00000072, 0x00000327,
+    0x00000052, 0x0000030c, 0x00000072, 0x0000030c, 0x00000053, 0x00000301, 0x00000073, 0x00000301,
+    0x00000053, 0x00000302, 0x00000073, 0x00000302, 0x00000053, 0x00000327, 0x00000073, 0x00000327,
+    0x00000053, 0x0000030c, 0x00000073, 0x0000030c, 0x00000054, 0x00000327, 0x00000074, 0x00000327,
+    0x00000054, 0x0000030c, 0x00000074, 0x0000030c, 0x00000055, 0x00000303, 0x00000075, 0x00000303,
+    0x00000055, 0x00000304, 0x00000075, 0x00000304, 0x00000055, 0x00000306, 0x00000075, 0x00000306,
+    0x00000055, 0x0000030a, 0x00000075, 0x0000030a, 0x00000055, 0x0000030b, 0x00000075, 0x0000030b,
+    0x00000055, 0x00000328, 0x00000075, 0x00000328, 0x00000057, 0x00000302, 0x00000077, 0x00000302,
+    0x00000059, 0x00000302, 0x00000079, 0x00000302, 0x00000059, 0x00000308, 0x0000005a, 0x00000301,
+    0x0000007a, 0x00000301, 0x0000005a, 0x00000307, 0x0000007a, 0x00000307, 0x0000005a, 0x0000030c,
+    0x0000007a, 0x0000030c, 0x0000004f, 0x0000031b, 0x0000006f, 0x0000031b, 0x00000055, 0x0000031b,
+    0x00000075, 0x0000031b, 0x00000041, 0x0000030c, 0x00000061, 0x0000030c, 0x00000049, 0x0000030c,
+    0x00000069, 0x0000030c, 0x0000004f, 0x0000030c, 0x0000006f, 0x0000030c, 0x00000055, 0x0000030c,
+    0x00000075, 0x0000030c, 0x00000055, 0x00000308, 0x00000304, 0x00000075, 0x00000308, 0x00000304,
+    0x00000055, 0x00000308, 0x00000301, 0x00000075, 0x00000308, 0x00000301, 0x00000055, 0x00000308,
+    0x0000030c, 0x00000075, 0x00000308, 0x0000030c, 0x00000055, 0x00000308, 0x00000300, 0x00000075,
+    0x00000308, 0x00000300, 0x00000041, 0x00000308, 0x00000304, 0x00000061, 0x00000308, 0x00000304,
+    0x00000041, 0x00000307, 0x00000304, 0x00000061, 0x00000307, 0x00000304, 0x000000c6, 0x00000304,
+    0x000000e6, 0x00000304, 0x00000047, 0x0000030c, 0x00000067, 0x0000030c, 0x0000004b, 0x0000030c,
+    0x0000006b, 0x0000030c, 0x0000004f, 0x00000328, 0x0000006f, 0x00000328, 0x0000004f, 0x00000328,
+    0x00000304, 0x0000006f, 0x00000328, 0x00000304, 0x000001b7, 0x0000030c, 0x00000292, 0x0000030c,
+    0x0000006a, 0x0000030c, 0x00000047, 0x00000301, 0x00000067, 0x00000301, 0x0000004e, 0x00000300,
+    0x0000006e, 0x00000300, 0x00000041, 0x0000030a, 0x00000301, 0x00000061, 0x0000030a, 0x00000301,
+    0x000000c6, 0x00000301, 0x000000e6, 0x00000301, 0x000000d8, 0x00000301, 0x000000f8, 0x00000301,
+    0x00000041, 0x0000030f, 0x00000061, 0x0000030f, 0x00000041, 0x00000311, 0x00000061, 0x00000311,
+    0x00000045, 0x0000030f, 0x00000065, 0x0000030f, 0x00000045, 0x00000311, 0x00000065, 0x00000311,
+    0x00000049, 0x0000030f, 0x00000069, 0x0000030f, 0x00000049, 0x00000311, 0x00000069, 0x00000311,
+    0x0000004f, 0x0000030f, 0x0000006f, 0x0000030f, 0x0000004f, 0x00000311, 0x0000006f, 0x00000311,
+    0x00000052, 0x0000030f, 0x00000072, 0x0000030f, 0x00000052, 0x00000311, 0x00000072, 0x00000311,
+    0x00000055, 0x0000030f, 0x00000075, 0x0000030f, 0x00000055, 0x00000311, 0x00000075, 0x00000311,
+    0x00000053, 0x00000326, 0x00000073, 0x00000326, 0x00000054, 0x00000326, 0x00000074, 0x00000326,
+    0x00000048, 0x0000030c, 0x00000068, 0x0000030c, 0x00000041, 0x00000307, 0x00000061, 0x00000307,
+    0x00000045, 0x00000327, 0x00000065, 0x00000327, 0x0000004f, 0x00000308, 0x00000304, 0x0000006f,
+    0x00000308, 0x00000304, 0x0000004f, 0x00000303, 0x00000304, 0x0000006f, 0x00000303, 0x00000304,
+    0x0000004f, 0x00000307, 0x0000006f, 0x00000307, 0x0000004f, 0x00000307, 0x00000304, 0x0000006f,
+    0x00000307, 0x00000304, 0x00000059, 0x00000304, 0x00000079, 0x00000304, 0x00000300, 0x00000301,
+    0x00000313, 0x00000308, 0x00000301, 0x000002b9, 0x0000003b, 0x000000a8, 0x00000301, 0x00000391,
+    0x00000301, 0x000000b7, 0x00000395, 0x00000301, 0x00000397, 0x00000301, 0x00000399, 0x00000301,
+    0x0000039f, 0x00000301, 0x000003a5, 0x00000301, 0x000003a9, 0x00000301, 0x000003b9, 0x00000308,
+    0x00000301, 0x00000399, 0x00000308, 0x000003a5, 0x00000308, 0x000003b1, 0x00000301, 0x000003b5,
+    0x00000301, 0x000003b7, 0x00000301, 0x000003b9, 0x00000301, 0x000003c5, 0x00000308, 0x00000301,
+    0x000003b9, 0x00000308, 0x000003c5, 0x00000308, 0x000003bf, 0x00000301, 0x000003c5, 0x00000301,
+    0x000003c9, 0x00000301, 0x000003d2, 0x00000301, 0x000003d2, 0x00000308, 0x00000415, 0x00000300,
+    0x00000415, 0x00000308, 0x00000413, 0x00000301, 0x00000406, 0x00000308, 0x0000041a, 0x00000301,
+    0x00000418, 0x00000300, 0x00000423, 0x00000306, 0x00000418, 0x00000306, 0x00000438, 0x00000306,
+    0x00000435, 0x00000300, 0x00000435, 0x00000308, 0x00000433, 0x00000301, 0x00000456, 0x00000308,
+    0x0000043a, 0x00000301, 0x00000438, 0x00000300, 0x00000443, 0x00000306, 0x00000474, 0x0000030f,
+    0x00000475, 0x0000030f, 0x00000416, 0x00000306, 0x00000436, 0x00000306, 0x00000410, 0x00000306,
+    0x00000430, 0x00000306, 0x00000410, 0x00000308, 0x00000430, 0x00000308, 0x00000415, 0x00000306,
+    0x00000435, 0x00000306, 0x000004d8, 0x00000308, 0x000004d9, 0x00000308, 0x00000416, 0x00000308,
+    0x00000436, 0x00000308, 0x00000417, 0x00000308, 0x00000437, 0x00000308, 0x00000418, 0x00000304,
+    0x00000438, 0x00000304, 0x00000418, 0x00000308, 0x00000438, 0x00000308, 0x0000041e, 0x00000308,
+    0x0000043e, 0x00000308, 0x000004e8, 0x00000308, 0x000004e9, 0x00000308, 0x0000042d, 0x00000308,
+    0x0000044d, 0x00000308, 0x00000423, 0x00000304, 0x00000443, 0x00000304, 0x00000423, 0x00000308,
+    0x00000443, 0x00000308, 0x00000423, 0x0000030b, 0x00000443, 0x0000030b, 0x00000427, 0x00000308,
+    0x00000447, 0x00000308, 0x0000042b, 0x00000308, 0x0000044b, 0x00000308, 0x00000627, 0x00000653,
+    0x00000627, 0x00000654, 0x00000648, 0x00000654, 0x00000627, 0x00000655, 0x0000064a, 0x00000654,
+    0x000006d5, 0x00000654, 0x000006c1, 0x00000654, 0x000006d2, 0x00000654, 0x00000928, 0x0000093c,
+    0x00000930, 0x0000093c, 0x00000933, 0x0000093c, 0x00000915, 0x0000093c, 0x00000916, 0x0000093c,
+    0x00000917, 0x0000093c, 0x0000091c, 0x0000093c, 0x00000921, 0x0000093c, 0x00000922, 0x0000093c,
+    0x0000092b, 0x0000093c, 0x0000092f, 0x0000093c, 0x000009c7, 0x000009be, 0x000009c7, 0x000009d7,
+    0x000009a1, 0x000009bc, 0x000009a2, 0x000009bc, 0x000009af, 0x000009bc, 0x00000a32, 0x00000a3c,
+    0x00000a38, 0x00000a3c, 0x00000a16, 0x00000a3c, 0x00000a17, 0x00000a3c, 0x00000a1c, 0x00000a3c,
+    0x00000a2b, 0x00000a3c, 0x00000b47, 0x00000b56, 0x00000b47, 0x00000b3e, 0x00000b47, 0x00000b57,
+    0x00000b21, 0x00000b3c, 0x00000b22, 0x00000b3c, 0x00000b92, 0x00000bd7, 0x00000bc6, 0x00000bbe,
+    0x00000bc7, 0x00000bbe, 0x00000bc6, 0x00000bd7, 0x00000c46, 0x00000c56, 0x00000cbf, 0x00000cd5,
+    0x00000cc6, 0x00000cd5, 0x00000cc6, 0x00000cd6, 0x00000cc6, 0x00000cc2, 0x00000cc6, 0x00000cc2,
+    0x00000cd5, 0x00000d46, 0x00000d3e, 0x00000d47, 0x00000d3e, 0x00000d46, 0x00000d57, 0x00000dd9,
+    0x00000dca, 0x00000dd9, 0x00000dcf, 0x00000dd9, 0x00000dcf, 0x00000dca, 0x00000dd9, 0x00000ddf,
+    0x00000f42, 0x00000fb7, 0x00000f4c, 0x00000fb7, 0x00000f51, 0x00000fb7, 0x00000f56, 0x00000fb7,
+    0x00000f5b, 0x00000fb7, 0x00000f40, 0x00000fb5, 0x00000f71, 0x00000f72, 0x00000f71, 0x00000f74,
+    0x00000fb2, 0x00000f80, 0x00000fb3, 0x00000f80, 0x00000f71, 0x00000f80, 0x00000f92, 0x00000fb7,
+    0x00000f9c, 0x00000fb7, 0x00000fa1, 0x00000fb7, 0x00000fa6, 0x00000fb7, 0x00000fab, 0x00000fb7,
+    0x00000f90, 0x00000fb5, 0x00001025, 0x0000102e, 0x00001b05, 0x00001b35, 0x00001b07, 0x00001b35,
+    0x00001b09, 0x00001b35, 0x00001b0b, 0x00001b35, 0x00001b0d, 0x00001b35, 0x00001b11, 0x00001b35,
+    0x00001b3a, 0x00001b35, 0x00001b3c, 0x00001b35, 0x00001b3e, 0x00001b35, 0x00001b3f, 0x00001b35,
+    0x00001b42, 0x00001b35, 0x00000041, 0x00000325, 0x00000061, 0x00000325, 0x00000042, 0x00000307,
+    0x00000062, 0x00000307, 0x00000042, 0x00000323, 0x00000062, 0x00000323, 0x00000042, 0x00000331,
+    0x00000062, 0x00000331, 0x00000043, 0x00000327, 0x00000301, 0x00000063, 0x00000327, 0x00000301,
+    0x00000044, 0x00000307, 0x00000064, 0x00000307, 0x00000044, 0x00000323, 0x00000064, 0x00000323,
+    0x00000044, 0x00000331, 0x00000064, 0x00000331, 0x00000044, 0x00000327, 0x00000064, 0x00000327,
+    0x00000044, 0x0000032d, 0x00000064, 0x0000032d, 0x00000045, 0x00000304, 0x00000300, 0x00000065,
+    0x00000304, 0x00000300, 0x00000045, 0x00000304, 0x00000301, 0x00000065, 0x00000304, 0x00000301,
+    0x00000045, 0x0000032d, 0x00000065, 0x0000032d, 0x00000045, 0x00000330, 0x00000065, 0x00000330,
+    0x00000045, 0x00000327, 0x00000306, 0x00000065, 0x00000327, 0x00000306, 0x00000046, 0x00000307,
+    0x00000066, 0x00000307, 0x00000047, 0x00000304, 0x00000067, 0x00000304, 0x00000048, 0x00000307,
+    0x00000068, 0x00000307, 0x00000048, 0x00000323, 0x00000068, 0x00000323, 0x00000048, 0x00000308,
+    0x00000068, 0x00000308, 0x00000048, 0x00000327, 0x00000068, 0x00000327, 0x00000048, 0x0000032e,
+    0x00000068, 0x0000032e, 0x00000049, 0x00000330, 0x00000069, 0x00000330, 0x00000049, 0x00000308,
+    0x00000301, 0x00000069, 0x00000308, 0x00000301, 0x0000004b, 0x00000301, 0x0000006b, 0x00000301,
+    0x0000004b, 0x00000323, 0x0000006b, 0x00000323, 0x0000004b, 0x00000331, 0x0000006b, 0x00000331,
+    0x0000004c, 0x00000323, 0x0000006c, 0x00000323, 0x0000004c, 0x00000323, 0x00000304, 0x0000006c,
+    0x00000323, 0x00000304, 0x0000004c, 0x00000331, 0x0000006c, 0x00000331, 0x0000004c, 0x0000032d,
+    0x0000006c, 0x0000032d, 0x0000004d, 0x00000301, 0x0000006d, 0x00000301, 0x0000004d, 0x00000307,
+    0x0000006d, 0x00000307, 0x0000004d, 0x00000323, 0x0000006d, 0x00000323, 0x0000004e, 0x00000307,
+    0x0000006e, 0x00000307, 0x0000004e, 0x00000323, 0x0000006e, 0x00000323, 0x0000004e, 0x00000331,
+    0x0000006e, 0x00000331, 0x0000004e, 0x0000032d, 0x0000006e, 0x0000032d, 0x0000004f, 0x00000303,
+    0x00000301, 0x0000006f, 0x00000303, 0x00000301, 0x0000004f, 0x00000303, 0x00000308, 0x0000006f,
+    0x00000303, 0x00000308, 0x0000004f, 0x00000304, 0x00000300, 0x0000006f, 0x00000304, 0x00000300,
+    0x0000004f, 0x00000304, 0x00000301, 0x0000006f, 0x00000304, 0x00000301, 0x00000050, 0x00000301,
+    0x00000070, 0x00000301, 0x00000050, 0x00000307, 0x00000070, 0x00000307, 0x00000052, 0x00000307,
+    0x00000072, 0x00000307, 0x00000052, 0x00000323, 0x00000072, 0x00000323, 0x00000052, 0x00000323,
+    0x00000304, 0x00000072, 0x00000323, 0x00000304, 0x00000052, 0x00000331, 0x00000072, 0x00000331,
+    0x00000053, 0x00000307, 0x00000073, 0x00000307, 0x00000053, 0x00000323, 0x00000073, 0x00000323,
+    0x00000053, 0x00000301, 0x00000307, 0x00000073, 0x00000301, 0x00000307, 0x00000053, 0x0000030c,
+    0x00000307, 0x00000073, 0x0000030c, 0x00000307, 0x00000053, 0x00000323, 0x00000307, 0x00000073,
+    0x00000323, 0x00000307, 0x00000054, 0x00000307, 0x00000074, 0x00000307, 0x00000054, 0x00000323,
+    0x00000074, 0x00000323, 0x00000054, 0x00000331, 0x00000074, 0x00000331, 0x00000054, 0x0000032d,
+    0x00000074, 0x0000032d, 0x00000055, 0x00000324, 0x00000075, 0x00000324, 0x00000055, 0x00000330,
+    0x00000075, 0x00000330, 0x00000055, 0x0000032d, 0x00000075, 0x0000032d, 0x00000055, 0x00000303,
+    0x00000301, 0x00000075, 0x00000303, 0x00000301, 0x00000055, 0x00000304, 0x00000308, 0x00000075,
+    0x00000304, 0x00000308, 0x00000056, 0x00000303, 0x00000076, 0x00000303, 0x00000056, 0x00000323,
+    0x00000076, 0x00000323, 0x00000057, 0x00000300, 0x00000077, 0x00000300, 0x00000057, 0x00000301,
+    0x00000077, 0x00000301, 0x00000057, 0x00000308, 0x00000077, 0x00000308, 0x00000057, 0x00000307,
+    0x00000077, 0x00000307, 0x00000057, 0x00000323, 0x00000077, 0x00000323, 0x00000058, 0x00000307,
+    0x00000078, 0x00000307, 0x00000058, 0x00000308, 0x00000078, 0x00000308, 0x00000059, 0x00000307,
+    0x00000079, 0x00000307, 0x0000005a, 0x00000302, 0x0000007a, 0x00000302, 0x0000005a, 0x00000323,
+    0x0000007a, 0x00000323, 0x0000005a, 0x00000331, 0x0000007a, 0x00000331, 0x00000068, 0x00000331,
+    0x00000074, 0x00000308, 0x00000077, 0x0000030a, 0x00000079, 0x0000030a, 0x0000017f, 0x00000307,
+    0x00000041, 0x00000323, 0x00000061, 0x00000323, 0x00000041, 0x00000309, 0x00000061, 0x00000309,
+    0x00000041, 0x00000302, 0x00000301, 0x00000061, 0x00000302, 0x00000301, 0x00000041, 0x00000302,
+    0x00000300, 0x00000061, 0x00000302, 0x00000300, 0x00000041, 0x00000302, 0x00000309, 0x00000061,
+    0x00000302, 0x00000309, 0x00000041, 0x00000302, 0x00000303, 0x00000061, 0x00000302, 0x00000303,
+    0x00000041, 0x00000323, 0x00000302, 0x00000061, 0x00000323, 0x00000302, 0x00000041, 0x00000306,
+    0x00000301, 0x00000061, 0x00000306, 0x00000301, 0x00000041, 0x00000306, 0x00000300, 0x00000061,
+    0x00000306, 0x00000300, 0x00000041, 0x00000306, 0x00000309, 0x00000061, 0x00000306, 0x00000309,
+    0x00000041, 0x00000306, 0x00000303, 0x00000061, 0x00000306, 0x00000303, 0x00000041, 0x00000323,
+    0x00000306, 0x00000061, 0x00000323, 0x00000306, 0x00000045, 0x00000323, 0x00000065, 0x00000323,
+    0x00000045, 0x00000309, 0x00000065, 0x00000309, 0x00000045, 0x00000303, 0x00000065, 0x00000303,
+    0x00000045, 0x00000302, 0x00000301, 0x00000065, 0x00000302, 0x00000301, 0x00000045, 0x00000302,
+    0x00000300, 0x00000065, 0x00000302, 0x00000300, 0x00000045, 0x00000302, 0x00000309, 0x00000065,
+    0x00000302, 0x00000309, 0x00000045, 0x00000302, 0x00000303, 0x00000065, 0x00000302, 0x00000303,
+    0x00000045, 0x00000323, 0x00000302, 0x00000065, 0x00000323, 0x00000302, 0x00000049, 0x00000309,
+    0x00000069, 0x00000309, 0x00000049, 0x00000323, 0x00000069, 0x00000323, 0x0000004f, 0x00000323,
+    0x0000006f, 0x00000323, 0x0000004f, 0x00000309, 0x0000006f, 0x00000309, 0x0000004f, 0x00000302,
+    0x00000301, 0x0000006f, 0x00000302, 0x00000301, 0x0000004f, 0x00000302, 0x00000300, 0x0000006f,
+    0x00000302, 0x00000300, 0x0000004f, 0x00000302, 0x00000309, 0x0000006f, 0x00000302, 0x00000309,
+    0x0000004f, 0x00000302, 0x00000303, 0x0000006f, 0x00000302, 0x00000303, 0x0000004f, 0x00000323,
+    0x00000302, 0x0000006f, 0x00000323, 0x00000302, 0x0000004f, 0x0000031b, 0x00000301, 0x0000006f,
+    0x0000031b, 0x00000301, 0x0000004f, 0x0000031b, 0x00000300, 0x0000006f, 0x0000031b, 0x00000300,
+    0x0000004f, 0x0000031b, 0x00000309, 0x0000006f, 0x0000031b, 0x00000309, 0x0000004f, 0x0000031b,
+    0x00000303, 0x0000006f, 0x0000031b, 0x00000303, 0x0000004f, 0x0000031b, 0x00000323, 0x0000006f,
+    0x0000031b, 0x00000323, 0x00000055, 0x00000323, 0x00000075, 0x00000323, 0x00000055, 0x00000309,
+    0x00000075, 0x00000309, 0x00000055, 0x0000031b, 0x00000301, 0x00000075, 0x0000031b, 0x00000301,
+    0x00000055, 0x0000031b, 0x00000300, 0x00000075, 0x0000031b, 0x00000300, 0x00000055, 0x0000031b,
+    0x00000309, 0x00000075, 0x0000031b, 0x00000309, 0x00000055, 0x0000031b, 0x00000303, 0x00000075,
+    0x0000031b, 0x00000303, 0x00000055, 0x0000031b, 0x00000323, 0x00000075, 0x0000031b, 0x00000323,
+    0x00000059, 0x00000300, 0x00000079, 0x00000300, 0x00000059, 0x00000323, 0x00000079, 0x00000323,
+    0x00000059, 0x00000309, 0x00000079, 0x00000309, 0x00000059, 0x00000303, 0x00000079, 0x00000303,
+    0x000003b1, 0x00000313, 0x000003b1, 0x00000314, 0x000003b1, 0x00000313, 0x00000300, 0x000003b1,
+    0x00000314, 0x00000300, 0x000003b1, 0x00000313, 0x00000301, 0x000003b1, 0x00000314, 0x00000301,
+    0x000003b1, 0x00000313, 0x00000342, 0x000003b1, 0x00000314, 0x00000342, 0x00000391, 0x00000313,
+    0x00000391, 0x00000314, 0x00000391, 0x00000313, 0x00000300, 0x00000391, 0x00000314, 0x00000300,
+    0x00000391, 0x00000313, 0x00000301, 0x00000391, 0x00000314, 0x00000301, 0x00000391, 0x00000313,
+    0x00000342, 0x00000391, 0x00000314, 0x00000342, 0x000003b5, 0x00000313, 0x000003b5, 0x00000314,
+    0x000003b5, 0x00000313, 0x00000300, 0x000003b5, 0x00000314, 0x00000300, 0x000003b5, 0x00000313,
+    0x00000301, 0x000003b5, 0x00000314, 0x00000301, 0x00000395, 0x00000313, 0x00000395, 0x00000314,
+    0x00000395, 0x00000313, 0x00000300, 0x00000395, 0x00000314, 0x00000300, 0x00000395, 0x00000313,
+    0x00000301, 0x00000395, 0x00000314, 0x00000301, 0x000003b7, 0x00000313, 0x000003b7, 0x00000314,
+    0x000003b7, 0x00000313, 0x00000300, 0x000003b7, 0x00000314, 0x00000300, 0x000003b7, 0x00000313,
+    0x00000301, 0x000003b7, 0x00000314, 0x00000301, 0x000003b7, 0x00000313, 0x00000342, 0x000003b7,
+    0x00000314, 0x00000342, 0x00000397, 0x00000313, 0x00000397, 0x00000314, 0x00000397, 0x00000313,
+    0x00000300, 0x00000397, 0x00000314, 0x00000300, 0x00000397, 0x00000313, 0x00000301, 0x00000397,
+    0x00000314, 0x00000301, 0x00000397, 0x00000313, 0x00000342, 0x00000397, 0x00000314, 0x00000342,
+    0x000003b9, 0x00000313, 0x000003b9, 0x00000314, 0x000003b9, 0x00000313, 0x00000300, 0x000003b9,
+    0x00000314, 0x00000300, 0x000003b9, 0x00000313, 0x00000301, 0x000003b9, 0x00000314, 0x00000301,
+    0x000003b9, 0x00000313, 0x00000342, 0x000003b9, 0x00000314, 0x00000342, 0x00000399, 0x00000313,
+    0x00000399, 0x00000314, 0x00000399, 0x00000313, 0x00000300, 0x00000399, 0x00000314, 0x00000300,
+    0x00000399, 0x00000313, 0x00000301, 0x00000399, 0x00000314, 0x00000301, 0x00000399, 0x00000313,
+    0x00000342, 0x00000399, 0x00000314, 0x00000342, 0x000003bf, 0x00000313, 0x000003bf, 0x00000314,
+    0x000003bf, 0x00000313, 0x00000300, 0x000003bf, 0x00000314, 0x00000300, 0x000003bf, 0x00000313,
+    0x00000301, 0x000003bf, 0x00000314, 0x00000301, 0x0000039f, 0x00000313, 0x0000039f, 0x00000314,
+    0x0000039f, 0x00000313, 0x00000300, 0x0000039f, 0x00000314, 0x00000300, 0x0000039f, 0x00000313,
+    0x00000301, 0x0000039f, 0x00000314, 0x00000301, 0x000003c5, 0x00000313, 0x000003c5, 0x00000314,
+    0x000003c5, 0x00000313, 0x00000300, 0x000003c5, 0x00000314, 0x00000300, 0x000003c5, 0x00000313,
+    0x00000301, 0x000003c5, 0x00000314, 0x00000301, 0x000003c5, 0x00000313, 0x00000342, 0x000003c5,
+    0x00000314, 0x00000342, 0x000003a5, 0x00000314, 0x000003a5, 0x00000314, 0x00000300, 0x000003a5,
+    0x00000314, 0x00000301, 0x000003a5, 0x00000314, 0x00000342, 0x000003c9, 0x00000313, 0x000003c9,
+    0x00000314, 0x000003c9, 0x00000313, 0x00000300, 0x000003c9, 0x00000314, 0x00000300, 0x000003c9,
+    0x00000313, 0x00000301, 0x000003c9, 0x00000314, 0x00000301, 0x000003c9, 0x00000313, 0x00000342,
+    0x000003c9, 0x00000314, 0x00000342, 0x000003a9, 0x00000313, 0x000003a9, 0x00000314, 0x000003a9,
+    0x00000313, 0x00000300, 0x000003a9, 0x00000314, 0x00000300, 0x000003a9, 0x00000313, 0x00000301,
+    0x000003a9, 0x00000314, 0x00000301, 0x000003a9, 0x00000313, 0x00000342, 0x000003a9, 0x00000314,
+    0x00000342, 0x000003b1, 0x00000300, 0x000003b1, 0x00000301, 0x000003b5, 0x00000300, 0x000003b5,
+    0x00000301, 0x000003b7, 0x00000300, 0x000003b7, 0x00000301, 0x000003b9, 0x00000300, 0x000003b9,
+    0x00000301, 0x000003bf, 0x00000300, 0x000003bf, 0x00000301, 0x000003c5, 0x00000300, 0x000003c5,
+    0x00000301, 0x000003c9, 0x00000300, 0x000003c9, 0x00000301, 0x000003b1, 0x00000313, 0x00000345,
+    0x000003b1, 0x00000314, 0x00000345, 0x000003b1, 0x00000313, 0x00000300, 0x00000345, 0x000003b1,
+    0x00000314, 0x00000300, 0x00000345, 0x000003b1, 0x00000313, 0x00000301, 0x00000345, 0x000003b1,
+    0x00000314, 0x00000301, 0x00000345, 0x000003b1, 0x00000313, 0x00000342, 0x00000345, 0x000003b1,
+    0x00000314, 0x00000342, 0x00000345, 0x00000391, 0x00000313, 0x00000345, 0x00000391, 0x00000314,
+    0x00000345, 0x00000391, 0x00000313, 0x00000300, 0x00000345, 0x00000391, 0x00000314, 0x00000300,
+    0x00000345, 0x00000391, 0x00000313, 0x00000301, 0x00000345, 0x00000391, 0x00000314, 0x00000301,
+    0x00000345, 0x00000391, 0x00000313, 0x00000342, 0x00000345, 0x00000391, 0x00000314, 0x00000342,
+    0x00000345, 0x000003b7, 0x00000313, 0x00000345, 0x000003b7, 0x00000314, 0x00000345, 0x000003b7,
+    0x00000313, 0x00000300, 0x00000345, 0x000003b7, 0x00000314, 0x00000300, 0x00000345, 0x000003b7,
+    0x00000313, 0x00000301, 0x00000345, 0x000003b7, 0x00000314, 0x00000301, 0x00000345, 0x000003b7,
+    0x00000313, 0x00000342, 0x00000345, 0x000003b7, 0x00000314, 0x00000342, 0x00000345, 0x00000397,
+    0x00000313, 0x00000345, 0x00000397, 0x00000314, 0x00000345, 0x00000397, 0x00000313, 0x00000300,
+    0x00000345, 0x00000397, 0x00000314, 0x00000300, 0x00000345, 0x00000397, 0x00000313, 0x00000301,
+    0x00000345, 0x00000397, 0x00000314, 0x00000301, 0x00000345, 0x00000397, 0x00000313, 0x00000342,
+    0x00000345, 0x00000397, 0x00000314, 0x00000342, 0x00000345, 0x000003c9, 0x00000313, 0x00000345,
+    0x000003c9, 0x00000314, 0x00000345, 0x000003c9, 0x00000313, 0x00000300, 0x00000345, 0x000003c9,
+    0x00000314, 0x00000300, 0x00000345, 0x000003c9, 0x00000313, 0x00000301, 0x00000345, 0x000003c9,
+    0x00000314, 0x00000301, 0x00000345, 0x000003c9, 0x00000313, 0x00000342, 0x00000345, 0x000003c9,
+    0x00000314, 0x00000342, 0x00000345, 0x000003a9, 0x00000313, 0x00000345, 0x000003a9, 0x00000314,
+    0x00000345, 0x000003a9, 0x00000313, 0x00000300, 0x00000345, 0x000003a9, 0x00000314, 0x00000300,
+    0x00000345, 0x000003a9, 0x00000313, 0x00000301, 0x00000345, 0x000003a9, 0x00000314, 0x00000301,
+    0x00000345, 0x000003a9, 0x00000313, 0x00000342, 0x00000345, 0x000003a9, 0x00000314, 0x00000342,
+    0x00000345, 0x000003b1, 0x00000306, 0x000003b1, 0x00000304, 0x000003b1, 0x00000300, 0x00000345,
+    0x000003b1, 0x00000345, 0x000003b1, 0x00000301, 0x00000345, 0x000003b1, 0x00000342, 0x000003b1,
+    0x00000342, 0x00000345, 0x00000391, 0x00000306, 0x00000391, 0x00000304, 0x00000391, 0x00000300,
+    0x00000391, 0x00000301, 0x00000391, 0x00000345, 0x000003b9, 0x000000a8, 0x00000342, 0x000003b7,
+    0x00000300, 0x00000345, 0x000003b7, 0x00000345, 0x000003b7, 0x00000301, 0x00000345, 0x000003b7,
+    0x00000342, 0x000003b7, 0x00000342, 0x00000345, 0x00000395, 0x00000300, 0x00000395, 0x00000301,
+    0x00000397, 0x00000300, 0x00000397, 0x00000301, 0x00000397, 0x00000345, 0x00001fbf, 0x00000300,
+    0x00001fbf, 0x00000301, 0x00001fbf, 0x00000342, 0x000003b9, 0x00000306, 0x000003b9, 0x00000304,
+    0x000003b9, 0x00000308, 0x00000300, 0x000003b9, 0x00000308, 0x00000301, 0x000003b9, 0x00000342,
+    0x000003b9, 0x00000308, 0x00000342, 0x00000399, 0x00000306, 0x00000399, 0x00000304, 0x00000399,
+    0x00000300, 0x00000399, 0x00000301, 0x00001ffe, 0x00000300, 0x00001ffe, 0x00000301, 0x00001ffe,
+    0x00000342, 0x000003c5, 0x00000306, 0x000003c5, 0x00000304, 0x000003c5, 0x00000308, 0x00000300,
+    0x000003c5, 0x00000308, 0x00000301, 0x000003c1, 0x00000313, 0x000003c1, 0x00000314, 0x000003c5,
+    0x00000342, 0x000003c5, 0x00000308, 0x00000342, 0x000003a5, 0x00000306, 0x000003a5, 0x00000304,
+    0x000003a5, 0x00000300, 0x000003a5, 0x00000301, 0x000003a1, 0x00000314, 0x000000a8, 0x00000300,
+    0x000000a8, 0x00000301, 0x00000060, 0x000003c9, 0x00000300, 0x00000345, 0x000003c9, 0x00000345,
+    0x000003c9, 0x00000301, 0x00000345, 0x000003c9, 0x00000342, 0x000003c9, 0x00000342, 0x00000345,
+    0x0000039f, 0x00000300, 0x0000039f, 0x00000301, 0x000003a9, 0x00000300, 0x000003a9, 0x00000301,
+    0x000003a9, 0x00000345, 0x000000b4, 0x00002002, 0x00002003, 0x000003a9, 0x0000004b, 0x00000041,
+    0x0000030a, 0x00002190, 0x00000338, 0x00002192, 0x00000338, 0x00002194, 0x00000338, 0x000021d0,
+    0x00000338, 0x000021d4, 0x00000338, 0x000021d2, 0x00000338, 0x00002203, 0x00000338, 0x00002208,
+    0x00000338, 0x0000220b, 0x00000338, 0x00002223, 0x00000338, 0x00002225, 0x00000338, 0x0000223c,
+    0x00000338, 0x00002243, 0x00000338, 0x00002245, 0x00000338, 0x00002248, 0x00000338, 0x0000003d,
+    0x00000338, 0x00002261, 0x00000338, 0x0000224d, 0x00000338, 0x0000003c, 0x00000338, 0x0000003e,
+    0x00000338, 0x00002264, 0x00000338, 0x00002265, 0x00000338, 0x00002272, 0x00000338, 0x00002273,
+    0x00000338, 0x00002276, 0x00000338, 0x00002277, 0x00000338, 0x0000227a, 0x00000338, 0x0000227b,
+    0x00000338, 0x00002282, 0x00000338, 0x00002283, 0x00000338, 0x00002286, 0x00000338, 0x00002287,
+    0x00000338, 0x000022a2, 0x00000338, 0x000022a8, 0x00000338, 0x000022a9, 0x00000338, 0x000022ab,
+    0x00000338, 0x0000227c, 0x00000338, 0x0000227d, 0x00000338, 0x00002291, 0x00000338, 0x00002292,
+    0x00000338, 0x000022b2, 0x00000338, 0x000022b3, 0x00000338, 0x000022b4, 0x00000338, 0x000022b5,
+    0x00000338, 0x00003008, 0x00003009, 0x00002add, 0x00000338, 0x0000304b, 0x00003099, 0x0000304d,
+    0x00003099, 0x0000304f, 0x00003099, 0x00003051, 0x00003099, 0x00003053, 0x00003099, 0x00003055,
+    0x00003099, 0x00003057, 0x00003099, 0x00003059, 0x00003099, 0x0000305b, 0x00003099, 0x0000305d,
+    0x00003099, 0x0000305f, 0x00003099, 0x00003061, 0x00003099, 0x00003064, 0x00003099, 0x00003066,
+    0x00003099, 0x00003068, 0x00003099, 0x0000306f, 0x00003099, 0x0000306f, 0x0000309a, 0x00003072,
+    0x00003099, 0x00003072, 0x0000309a, 0x00003075, 0x00003099, 0x00003075, 0x0000309a, 0x00003078,
+    0x00003099, 0x00003078, 0x0000309a, 0x0000307b, 0x00003099, 0x0000307b, 0x0000309a, 0x00003046,
+    0x00003099, 0x0000309d, 0x00003099, 0x000030ab, 0x00003099, 0x000030ad, 0x00003099, 0x000030af,
+    0x00003099, 0x000030b1, 0x00003099, 0x000030b3, 0x00003099, 0x000030b5, 0x00003099, 0x000030b7,
+    0x00003099, 0x000030b9, 0x00003099, 0x000030bb, 0x00003099, 0x000030bd, 0x00003099, 0x000030bf,
+    0x00003099, 0x000030c1, 0x00003099, 0x000030c4, 0x00003099, 0x000030c6, 0x00003099, 0x000030c8,
+    0x00003099, 0x000030cf, 0x00003099, 0x000030cf, 0x0000309a, 0x000030d2, 0x00003099, 0x000030d2,
+    0x0000309a, 0x000030d5, 0x00003099, 0x000030d5, 0x0000309a, 0x000030d8, 0x00003099, 0x000030d8,
+    0x0000309a, 0x000030db, 0x00003099, 0x000030db, 0x0000309a, 0x000030a6, 0x00003099, 0x000030ef,
+    0x00003099, 0x000030f0, 0x00003099, 0x000030f1, 0x00003099, 0x000030f2, 0x00003099, 0x000030fd,
+    0x00003099, 0x00008c48, 0x000066f4, 0x00008eca, 0x00008cc8, 0x00006ed1, 0x00004e32, 0x000053e5,
+    0x00009f9c, 0x00009f9c, 0x00005951, 0x000091d1, 0x00005587, 0x00005948, 0x000061f6, 0x00007669,
+    0x00007f85, 0x0000863f, 0x000087ba, 0x000088f8, 0x0000908f, 0x00006a02, 0x00006d1b, 0x000070d9,
+    0x000073de, 0x0000843d, 0x0000916a, 0x000099f1, 0x00004e82, 0x00005375, 0x00006b04, 0x0000721b,
+    0x0000862d, 0x00009e1e, 0x00005d50, 0x00006feb, 0x000085cd, 0x00008964, 0x000062c9, 0x000081d8,
+    0x0000881f, 0x00005eca, 0x00006717, 0x00006d6a, 0x000072fc, 0x000090ce, 0x00004f86, 0x000051b7,
+    0x000052de, 0x000064c4, 0x00006ad3, 0x00007210, 0x000076e7, 0x00008001, 0x00008606, 0x0000865c,
+    0x00008def, 0x00009732, 0x00009b6f, 0x00009dfa, 0x0000788c, 0x0000797f, 0x00007da0, 0x000083c9,
+    0x00009304, 0x00009e7f, 0x00008ad6, 0x000058df, 0x00005f04, 0x00007c60, 0x0000807e, 0x00007262,
+    0x000078ca, 0x00008cc2, 0x000096f7, 0x000058d8, 0x00005c62, 0x00006a13, 0x00006dda, 0x00006f0f,
+    0x00007d2f, 0x00007e37, 0x0000964b, 0x000052d2, 0x0000808b, 0x000051dc, 0x000051cc, 0x00007a1c,
+    0x00007dbe, 0x000083f1, 0x00009675, 0x00008b80, 0x000062cf, 0x00006a02, 0x00008afe, 0x00004e39,
+    0x00005be7, 0x00006012, 0x00007387, 0x00007570, 0x00005317, 0x000078fb, 0x00004fbf, 0x00005fa9,
+    0x00004e0d, 0x00006ccc, 0x00006578, 0x00007d22, 0x000053c3, 0x0000585e, 0x00007701, 0x00008449,
+    0x00008aaa, 0x00006bba, 0x00008fb0, 0x00006c88, 0x000062fe, 0x000082e5, 0x000063a0, 0x00007565,
+    0x00004eae, 0x00005169, 0x000051c9, 0x00006881, 0x00007ce7, 0x0000826f, 0x00008ad2, 0x000091cf,
+    0x000052f5, 0x00005442, 0x00005973, 0x00005eec, 0x000065c5, 0x00006ffe, 0x0000792a, 0x000095ad,
+    0x00009a6a, 0x00009e97, 0x00009ece, 0x0000529b, 0x000066c6, 0x00006b77, 0x00008f62, 0x00005e74,
+    0x00006190, 0x00006200, 0x0000649a, 0x00006f23, 0x00007149, 0x00007489, 0x000079ca, 0x00007df4,
+    0x0000806f, 0x00008f26, 0x000084ee, 0x00009023, 0x0000934a, 0x00005217, 0x000052a3, 0x000054bd,
+    0x000070c8, 0x000088c2, 0x00008aaa, 0x00005ec9, 0x00005ff5, 0x0000637b, 0x00006bae, 0x00007c3e,
+    0x00007375, 0x00004ee4, 0x000056f9, 0x00005be7, 0x00005dba, 0x0000601c, 0x000073b2, 0x00007469,
+    0x00007f9a, 0x00008046, 0x00009234, 0x000096f6, 0x00009748, 0x00009818, 0x00004f8b, 0x000079ae,
+    0x000091b4, 0x000096b8, 0x000060e1, 0x00004e86, 0x000050da, 0x00005bee, 0x00005c3f, 0x00006599,
+    0x00006a02, 0x000071ce, 0x00007642, 0x000084fc, 0x0000907c, 0x00009f8d, 0x00006688, 0x0000962e,
+    0x00005289, 0x0000677b, 0x000067f3, 0x00006d41, 0x00006e9c, 0x00007409, 0x00007559, 0x0000786b,
+    0x00007d10, 0x0000985e, 0x0000516d, 0x0000622e, 0x00009678, 0x0000502b, 0x00005d19, 0x00006dea,
+    0x00008f2a, 0x00005f8b, 0x00006144, 0x00006817, 0x00007387, 0x00009686, 0x00005229, 0x0000540f,
+    0x00005c65, 0x00006613, 0x0000674e, 0x000068a8, 0x00006ce5, 0x00007406, 0x000075e2, 0x00007f79,
+    0x000088cf, 0x000088e1, 0x000091cc, 0x000096e2, 0x0000533f, 0x00006eba, 0x0000541d, 0x000071d0,
+    0x00007498, 0x000085fa, 0x000096a3, 0x00009c57, 0x00009e9f, 0x00006797, 0x00006dcb, 0x000081e8,
+    0x00007acb, 0x00007b20, 0x00007c92, 0x000072c0, 0x00007099, 0x00008b58, 0x00004ec0, 0x00008336,
+    0x0000523a, 0x00005207, 0x00005ea6, 0x000062d3, 0x00007cd6, 0x00005b85, 0x00006d1e, 0x000066b4,
+    0x00008f3b, 0x0000884c, 0x0000964d, 0x0000898b, 0x00005ed3, 0x00005140, 0x000055c0, 0x0000585a,
+    0x00006674, 0x000051de, 0x0000732a, 0x000076ca, 0x0000793c, 0x0000795e, 0x00007965, 0x0000798f,
+    0x00009756, 0x00007cbe, 0x00007fbd, 0x00008612, 0x00008af8, 0x00009038, 0x000090fd, 0x000098ef,
+    0x000098fc, 0x00009928, 0x00009db4, 0x000090de, 0x000096b7, 0x00004fae, 0x000050e7, 0x0000514d,
+    0x000052c9, 0x000052e4, 0x00005351, 0x0000559d, 0x00005606, 0x00005668, 0x00005840, 0x000058a8,
+    0x00005c64, 0x00005c6e, 0x00006094, 0x00006168, 0x0000618e, 0x000061f2, 0x0000654f, 0x000065e2,
+    0x00006691, 0x00006885, 0x00006d77, 0x00006e1a, 0x00006f22, 0x0000716e, 0x0000722b, 0x00007422,
+    0x00007891, 0x0000793e, 0x00007949, 0x00007948, 0x00007950, 0x00007956, 0x0000795d, 0x0000798d,
+    0x0000798e, 0x00007a40, 0x00007a81, 0x00007bc0, 0x00007df4, 0x00007e09, 0x00007e41, 0x00007f72,
+    0x00008005, 0x000081ed, 0x00008279, 0x00008279, 0x00008457, 0x00008910, 0x00008996, 0x00008b01,
+    0x00008b39, 0x00008cd3, 0x00008d08, 0x00008fb6, 0x00009038, 0x000096e3, 0x000097ff, 0x0000983b,
+    0x00006075, 0x000242ee, 0x00008218, 0x00004e26, 0x000051b5, 0x00005168, 0x00004f80, 0x00005145,
+    0x00005180, 0x000052c7, 0x000052fa, 0x0000559d, 0x00005555, 0x00005599, 0x000055e2, 0x0000585a,
+    0x000058b3, 0x00005944, 0x00005954, 0x00005a62, 0x00005b28, 0x00005ed2, 0x00005ed9, 0x00005f69,
+    0x00005fad, 0x000060d8, 0x0000614e, 0x00006108, 0x0000618e, 0x00006160, 0x000061f2, 0x00006234,
+    0x000063c4, 0x0000641c, 0x00006452, 0x00006556, 0x00006674, 0x00006717, 0x0000671b, 0x00006756,
+    0x00006b79, 0x00006bba, 0x00006d41, 0x00006edb, 0x00006ecb, 0x00006f22, 0x0000701e, 0x0000716e,
+    0x000077a7, 0x00007235, 0x000072af, 0x0000732a, 0x00007471, 0x00007506, 0x0000753b, 0x0000761d,
+    0x0000761f, 0x000076ca, 0x000076db, 0x000076f4, 0x0000774a, 0x00007740, 0x000078cc, 0x00007ab1,
+    0x00007bc0, 0x00007c7b, 0x00007d5b, 0x00007df4, 0x00007f3e, 0x00008005, 0x00008352, 0x000083ef,
+    0x00008779, 0x00008941, 0x00008986, 0x00008996, 0x00008abf, 0x00008af8, 0x00008acb, 0x00008b01,
+    0x00008afe, 0x00008aed, 0x00008b39, 0x00008b8a, 0x00008d08, 0x00008f38, 0x00009072, 0x00009199,
+    0x00009276, 0x0000967c, 0x000096e3, 0x00009756, 0x000097db, 0x000097ff, 0x0000980b, 0x0000983b,
+    0x00009b12, 0x00009f9c, 0x0002284a, 0x00022844, 0x000233d5, 0x00003b9d, 0x00004018, 0x00004039,
+    0x00025249, 0x00025cd0, 0x00027ed3, 0x00009f43, 0x00009f8e, 0x000005d9, 0x000005b4, 0x000005f2,
+    0x000005b7, 0x000005e9, 0x000005c1, 0x000005e9, 0x000005c2, 0x000005e9, 0x000005bc, 0x000005c1,
+    0x000005e9, 0x000005bc, 0x000005c2, 0x000005d0, 0x000005b7, 0x000005d0, 0x000005b8, 0x000005d0,
+    0x000005bc, 0x000005d1, 0x000005bc, 0x000005d2, 0x000005bc, 0x000005d3, 0x000005bc, 0x000005d4,
+    0x000005bc, 0x000005d5, 0x000005bc, 0x000005d6, 0x000005bc, 0x000005d8, 0x000005bc, 0x000005d9,
+    0x000005bc, 0x000005da, 0x000005bc, 0x000005db, 0x000005bc, 0x000005dc, 0x000005bc, 0x000005de,
+    0x000005bc, 0x000005e0, 0x000005bc, 0x000005e1, 0x000005bc, 0x000005e3, 0x000005bc, 0x000005e4,
+    0x000005bc, 0x000005e6, 0x000005bc, 0x000005e7, 0x000005bc, 0x000005e8, 0x000005bc, 0x000005e9,
+    0x000005bc, 0x000005ea, 0x000005bc, 0x000005d5, 0x000005b9, 0x000005d1, 0x000005bf, 0x000005db,
+    0x000005bf, 0x000005e4, 0x000005bf, 0x00011099, 0x000110ba, 0x0001109b, 0x000110ba, 0x000110a5,
+    0x000110ba, 0x00011131, 0x00011127, 0x00011132, 0x00011127, 0x00011347, 0x0001133e, 0x00011347,
+    0x00011357, 0x000114b9, 0x000114ba, 0x000114b9, 0x000114b0, 0x000114b9, 0x000114bd, 0x000115b8,
+    0x000115af, 0x000115b9, 0x000115af, 0x00011935, 0x00011930, 0x0001d157, 0x0001d165, 0x0001d158,
+    0x0001d165, 0x0001d158, 0x0001d165, 0x0001d16e, 0x0001d158, 0x0001d165, 0x0001d16f, 0x0001d158,
+    0x0001d165, 0x0001d170, 0x0001d158, 0x0001d165, 0x0001d171, 0x0001d158, 0x0001d165, 0x0001d172,
+    0x0001d1b9, 0x0001d165, 0x0001d1ba, 0x0001d165, 0x0001d1b9, 0x0001d165, 0x0001d16e, 0x0001d1ba,
+    0x0001d165, 0x0001d16e, 0x0001d1b9, 0x0001d165, 0x0001d16f, 0x0001d1ba, 0x0001d165, 0x0001d16f,
+    0x00004e3d, 0x00004e38, 0x00004e41, 0x00020122, 0x00004f60, 0x00004fae, 0x00004fbb, 0x00005002,
+    0x0000507a, 0x00005099, 0x000050e7, 0x000050cf, 0x0000349e, 0x0002063a, 0x0000514d, 0x00005154,
+    0x00005164, 0x00005177, 0x0002051c, 0x000034b9, 0x00005167, 0x0000518d, 0x0002054b, 0x00005197,
+    0x000051a4, 0x00004ecc, 0x000051ac, 0x000051b5, 0x000291df, 0x000051f5, 0x00005203, 0x000034df,
+    0x0000523b, 0x00005246, 0x00005272, 0x00005277, 0x00003515, 0x000052c7, 0x000052c9, 0x000052e4,
+    0x000052fa, 0x00005305, 0x00005306, 0x00005317, 0x00005349, 0x00005351, 0x0000535a, 0x00005373,
+    0x0000537d, 0x0000537f, 0x0000537f, 0x0000537f, 0x00020a2c, 0x00007070, 0x000053ca, 0x000053df,
+    0x00020b63, 0x000053eb, 0x000053f1, 0x00005406, 0x0000549e, 0x00005438, 0x00005448, 0x00005468,
+    0x000054a2, 0x000054f6, 0x00005510, 0x00005553, 0x00005563, 0x00005584, 0x00005584, 0x00005599,
+    0x000055ab, 0x000055b3, 0x000055c2, 0x00005716, 0x00005606, 0x00005717, 0x00005651, 0x00005674,
+    0x00005207, 0x000058ee, 0x000057ce, 0x000057f4, 0x0000580d, 0x0000578b, 0x00005832, 0x00005831,
+    0x000058ac, 0x000214e4, 0x000058f2, 0x000058f7, 0x00005906, 0x0000591a, 0x00005922, 0x00005962,
+    0x000216a8, 0x000216ea, 0x000059ec, 0x00005a1b, 0x00005a27, 0x000059d8, 0x00005a66, 0x000036ee,
+    0x000036fc, 0x00005b08, 0x00005b3e, 0x00005b3e, 0x000219c8, 0x00005bc3, 0x00005bd8, 0x00005be7,
+    0x00005bf3, 0x00021b18, 0x00005bff, 0x00005c06, 0x00005f53, 0x00005c22, 0x00003781, 0x00005c60,
+    0x00005c6e, 0x00005cc0, 0x00005c8d, 0x00021de4, 0x00005d43, 0x00021de6, 0x00005d6e, 0x00005d6b,
+    0x00005d7c, 0x00005de1, 0x00005de2, 0x0000382f, 0x00005dfd, 0x00005e28, 0x00005e3d, 0x00005e69,
+    0x00003862, 0x00022183, 0x0000387c, 0x00005eb0, 0x00005eb3, 0x00005eb6, 0x00005eca, 0x0002a392,
+    0x00005efe, 0x00022331, 0x00022331, 0x00008201, 0x00005f22, 0x00005f22, 0x000038c7, 0x000232b8,
+    0x000261da, 0x00005f62, 0x00005f6b, 0x000038e3, 0x00005f9a, 0x00005fcd, 0x00005fd7, 0x00005ff9,
+    0x00006081, 0x0000393a, 0x0000391c, 0x00006094, 0x000226d4, 0x000060c7, 0x00006148, 0x0000614c,
+    0x0000614e, 0x0000614c, 0x0000617a, 0x0000618e, 0x000061b2, 0x000061a4, 0x000061af, 0x000061de,
+    0x000061f2, 0x000061f6, 0x00006210, 0x0000621b, 0x0000625d, 0x000062b1, 0x000062d4, 0x00006350,
+    0x00022b0c, 0x0000633d, 0x000062fc, 0x00006368, 0x00006383, 0x000063e4, 0x00022bf1, 0x00006422,
+    0x000063c5, 0x000063a9, 0x00003a2e, 0x00006469, 0x0000647e, 0x0000649d, 0x00006477, 0x00003a6c,
+    0x0000654f, 0x0000656c, 0x0002300a, 0x000065e3, 0x000066f8, 0x00006649, 0x00003b19, 0x00006691,
+    0x00003b08, 0x00003ae4, 0x00005192, 0x00005195, 0x00006700, 0x0000669c, 0x000080ad, 0x000043d9,
+    0x00006717, 0x0000671b, 0x00006721, 0x0000675e, 0x00006753, 0x000233c3, 0x00003b49, 0x000067fa,
+    0x00006785, 0x00006852, 0x00006885, 0x0002346d, 0x0000688e, 0x0000681f, 0x00006914, 0x00003b9d,
+    0x00006942, 0x000069a3, 0x000069ea, 0x00006aa8, 0x000236a3, 0x00006adb, 0x00003c18, 0x00006b21,
+    0x000238a7, 0x00006b54, 0x00003c4e, 0x00006b72, 0x00006b9f, 0x00006bba, 0x00006bbb, 0x00023a8d,
+    0x00021d0b, 0x00023afa, 0x00006c4e, 0x00023cbc, 0x00006cbf, 0x00006ccd, 0x00006c67, 0x00006d16,
+    0x00006d3e, 0x00006d77, 0x00006d41, 0x00006d69, 0x00006d78, 0x00006d85, 0x00023d1e, 0x00006d34,
+    0x00006e2f, 0x00006e6e, 0x00003d33, 0x00006ecb, 0x00006ec7, 0x00023ed1, 0x00006df9, 0x00006f6e,
+    0x00023f5e, 0x00023f8e, 0x00006fc6, 0x00007039, 0x0000701e, 0x0000701b, 0x00003d96, 0x0000704a,
+    0x0000707d, 0x00007077, 0x000070ad, 0x00020525, 0x00007145, 0x00024263, 0x0000719c, 0x000243ab,
+    0x00007228, 0x00007235, 0x00007250, 0x00024608, 0x00007280, 0x00007295, 0x00024735, 0x00024814,
+    0x0000737a, 0x0000738b, 0x00003eac, 0x000073a5, 0x00003eb8, 0x00003eb8, 0x00007447, 0x0000745c,
+    0x00007471, 0x00007485, 0x000074ca, 0x00003f1b, 0x00007524, 0x00024c36, 0x0000753e, 0x00024c92,
+    0x00007570, 0x0002219f, 0x00007610, 0x00024fa1, 0x00024fb8, 0x00025044, 0x00003ffc, 0x00004008,
+    0x000076f4, 0x000250f3, 0x000250f2, 0x00025119, 0x00025133, 0x0000771e, 0x0000771f, 0x0000771f,
+    0x0000774a, 0x00004039, 0x0000778b, 0x00004046, 0x00004096, 0x0002541d, 0x0000784e, 0x0000788c,
+    0x000078cc, 0x000040e3, 0x00025626, 0x00007956, 0x0002569a, 0x000256c5, 0x0000798f, 0x000079eb,
+    0x0000412f, 0x00007a40, 0x00007a4a, 0x00007a4f, 0x0002597c, 0x00025aa7, 0x00025aa7, 0x00007aee,
+    0x00004202, 0x00025bab, 0x00007bc6, 0x00007bc9, 0x00004227, 0x00025c80, 0x00007cd2, 0x000042a0,
+    0x00007ce8, 0x00007ce3, 0x00007d00, 0x00025f86, 0x00007d63, 0x00004301, 0x00007dc7, 0x00007e02,
+    0x00007e45, 0x00004334, 0x00026228, 0x00026247, 0x00004359, 0x000262d9, 0x00007f7a, 0x0002633e,
+    0x00007f95, 0x00007ffa, 0x00008005, 0x000264da, 0x00026523, 0x00008060, 0x000265a8, 0x00008070,
+    0x0002335f, 0x000043d5, 0x000080b2, 0x00008103, 0x0000440b, 0x0000813e, 0x00005ab5, 0x000267a7,
+    0x000267b5, 0x00023393, 0x0002339c, 0x00008201, 0x00008204, 0x00008f9e, 0x0000446b, 0x00008291,
+    0x0000828b, 0x0000829d, 0x000052b3, 0x000082b1, 0x000082b3, 0x000082bd, 0x000082e6, 0x00026b3c,
+    0x000082e5, 0x0000831d, 0x00008363, 0x000083ad, 0x00008323, 0x000083bd, 0x000083e7, 0x00008457,
+    0x00008353, 0x000083ca, 0x000083cc, 0x000083dc, 0x00026c36, 0x00026d6b, 0x00026cd5, 0x0000452b,
+    0x000084f1, 0x000084f3, 0x00008516, 0x000273ca, 0x00008564, 0x00026f2c, 0x0000455d, 0x00004561,
+    0x00026fb1, 0x000270d2, 0x0000456b, 0x00008650, 0x0000865c, 0x00008667, 0x00008669, 0x000086a9,
+    0x00008688, 0x0000870e, 0x000086e2, 0x00008779, 0x00008728, 0x0000876b, 0x00008786, 0x000045d7,
+    0x000087e1, 0x00008801, 0x000045f9, 0x00008860, 0x00008863, 0x00027667, 0x000088d7, 0x000088de,
+    0x00004635, 0x000088fa, 0x000034bb, 0x000278ae, 0x00027966, 0x000046be, 0x000046c7, 0x00008aa0,
+    0x00008aed, 0x00008b8a, 0x00008c55, 0x00027ca8, 0x00008cab, 0x00008cc1, 0x00008d1b, 0x00008d77,
+    0x00027f2f, 0x00020804, 0x00008dcb, 0x00008dbc, 0x00008df0, 0x000208de, 0x00008ed4, 0x00008f38,
+    0x000285d2, 0x000285ed, 0x00009094, 0x000090f1, 0x00009111, 0x0002872e, 0x0000911b, 0x00009238,
+    0x000092d7, 0x000092d8, 0x0000927c, 0x000093f9, 0x00009415, 0x00028bfa, 0x0000958b, 0x00004995,
+    0x000095b7, 0x00028d77, 0x000049e6, 0x000096c3, 0x00005db2, 0x00009723, 0x00029145, 0x0002921a,
+    0x00004a6e, 0x00004a76, 0x000097e0, 0x0002940a, 0x00004ab2, 0x00029496, 0x0000980b, 0x0000980b,
+    0x00009829, 0x000295b6, 0x000098e2, 0x00004b33, 0x00009929, 0x000099a7, 0x000099c2, 0x000099fe,
+    0x00004bce, 0x00029b30, 0x00009b12, 0x00009c40, 0x00009cfd, 0x00004cce, 0x00004ced, 0x00009d67,
+    0x0002a0ce, 0x00004cf8, 0x0002a105, 0x0002a20e, 0x0002a291, 0x00009ebb, 0x00004d56, 0x00009ef9,
+    0x00009efe, 0x00009f05, 0x00009f0f, 0x00009f16, 0x00009f3b, 0x0002a600,
+};
+
+/*Primary composites, first << 21 | second, sorted*/
+const uint64_t __str_compkeys[941] = {
+    0x0000000007800338ULL, 0x0000000007a00338ULL, 0x0000000007c00338ULL, 0x0000000008200300ULL,
+    0x0000000008200301ULL, 0x0000000008200302ULL, 0x0000000008200303ULL, 0x0000000008200304ULL,
+    0x0000000008200306ULL, 0x0000000008200307ULL, 0x0000000008200308ULL, 0x0000000008200309ULL,
+    0x000000000820030aULL, 0x000000000820030cULL, 0x000000000820030fULL, 0x0000000008200311ULL,
+    0x0000000008200323ULL, 0x0000000008200325ULL, 0x0000000008200328ULL, 0x0000000008400307ULL,
+    0x0000000008400323ULL, 0x0000000008400331ULL, 0x0000000008600301ULL, 0x0000000008600302ULL,
+    0x0000000008600307ULL, 0x000000000860030cULL, 0x0000000008600327ULL, 0x0000000008800307ULL,
+    0x000000000880030cULL, 0x0000000008800323ULL, 0x0000000008800327ULL, 0x000000000880032dULL,
+    0x0000000008800331ULL, 0x0000000008a00300ULL, 0x0000000008a00301ULL, 0x0000000008a00302ULL,
+    0x0000000008a00303ULL, 0x0000000008a00304ULL, 0x0000000008a00306ULL, 0x0000000008a00307ULL,
+    0x0000000008a00308ULL, 0x0000000008a00309ULL, 0x0000000008a0030cULL, 0x0000000008a0030fULL,
+    0x0000000008a00311ULL, 0x0000000008a00323ULL, 0x0000000008a00327ULL, 0x0000000008a00328ULL,
+    0x0000000008a0032dULL, 0x0000000008a00330ULL, 0x0000000008c00307ULL, 0x0000000008e00301ULL,
+    0x0000000008e00302ULL, 0x0000000008e00304ULL, 0x0000000008e00306ULL, 0x0000000008e00307ULL,
+    0x0000000008e0030cULL, 0x0000000008e00327ULL, 0x0000000009000302ULL, 0x0000000009000307ULL,
+    0x0000000009000308ULL, 0x000000000900030cULL, 0x0000000009000323ULL, 0x0000000009000327ULL,
+    0x000000000900032eULL, 0x0000000009200300ULL, 0x0000000009200301ULL, 0x0000000009200302ULL,
+    0x0000000009200303ULL, 0x0000000009200304ULL, 0x0000000009200306ULL, 0x0000000009200307ULL,
+    0x0000000009200308ULL, 0x0000000009200309ULL, 0x000000000920030cULL, 0x000000000920030fULL,
+    0x0000000009200311ULL, 0x0000000009200323ULL, 0x0000000009200328ULL, 0x0000000009200330ULL,
+    0x0000000009400302ULL, 0x0000000009600301ULL, 0x000000000960030cULL, 0x0000000009600323ULL,
+    0x0000000009600327ULL, 0x0000000009600331ULL, 0x0000000009800301ULL, 0x000000000980030cULL,
+    0x0000000009800323ULL, 0x0000000009800327ULL, 0x000000000980032dULL, 0x0000000009800331ULL,
+    0x0000000009a00301ULL, 0x0000000009a00307ULL, 0x0000000009a00323ULL, 0x0000000009c00300ULL,
+    0x0000000009c00301ULL, 0x0000000009c00303ULL, 0x0000000009c00307ULL, 0x0000000009c0030cULL,
+    0x0000000009c00323ULL, 0x0000000009c00327ULL, 0x0000000009c0032dULL, 0x0000000009c00331ULL,
+    0x0000000009e00300ULL, 0x0000000009e00301ULL, 0x0000000009e00302ULL, 0x0000000009e00303ULL,
+    0x0000000009e00304ULL, 0x0000000009e00306ULL, 0x0000000009e00307ULL, 0x0000000009e00308ULL,
+    0x0000000009e00309ULL, 0x0000000009e0030bULL, 0x0000000009e0030cULL, 0x0000000009e0030fULL,
+    0x0000000009e00311ULL, 0x0000000009e0031bULL, 0x0000000009e00323ULL, 0x0000000009e00328ULL,
+    0x000000000a000301ULL, 0x000000000a000307ULL, 0x000000000a400301ULL, 0x000000000a400307ULL,
+    0x000000000a40030cULL, 0x000000000a40030fULL, 0x000000000a400311ULL, 0x000000000a400323ULL,
+    0x000000000a400327ULL, 0x000000000a400331ULL, 0x000000000a600301ULL, 0x000000000a600302ULL,
+    0x000000000a600307ULL, 0x000000000a60030cULL, 0x000000000a600323ULL, 0x000000000a600326ULL,
+    0x000000000a600327ULL, 0x000000000a800307ULL, 0x000000000a80030cULL, 0x000000000a800323ULL,
+    0x000000000a800326ULL, 0x000000000a800327ULL, 0x000000000a80032dULL, 0x000000000a800331ULL,
+    0x000000000aa00300ULL, 0x000000000aa00301ULL, 0x000000000aa00302ULL, 0x000000000aa00303ULL,
+    0x000000000aa00304ULL, 0x000000000aa00306ULL, 0x000000000aa00308ULL, 0x000000000aa00309ULL,
+    0x000000000aa0030aULL, 0x000000000aa0030bULL, 0x000000000aa0030cULL, 0x000000000aa0030fULL,
+    0x000000000aa00311ULL, 0x000000000aa0031bULL, 0x000000000aa00323ULL, 0x000000000aa00324ULL,
+    0x000000000aa00328ULL, 0x000000000aa0032dULL, 0x000000000aa00330ULL, 0x000000000ac00303ULL,
+    0x000000000ac00323ULL, 0x000000000ae00300ULL, 0x000000000ae00301ULL, 0x000000000ae00302ULL,
+    0x000000000ae00307ULL, 0x000000000ae00308ULL, 0x000000000ae00323ULL, 0x000000000b000307ULL,
+    0x000000000b000308ULL, 0x000000000b200300ULL, 0x000000000b200301ULL, 0x000000000b200302ULL,
+    0x000000000b200303ULL, 0x000000000b200304ULL, 0x000000000b200307ULL, 0x000000000b200308ULL,
+    0x000000000b200309ULL, 0x000000000b200323ULL, 0x000000000b400301ULL, 0x000000000b400302ULL,
+    0x000000000b400307ULL, 0x000000000b40030cULL, 0x000000000b400323ULL, 0x000000000b400331ULL,
+    0x000000000c200300ULL, 0x000000000c200301ULL, 0x000000000c200302ULL, 0x000000000c200303ULL,
+    0x000000000c200304ULL, 0x000000000c200306ULL, 0x000000000c200307ULL, 0x000000000c200308ULL,
+    0x000000000c200309ULL, 0x000000000c20030aULL, 0x000000000c20030cULL, 0x000000000c20030fULL,
+    0x000000000c200311ULL, 0x000000000c200323ULL, 0x000000000c200325ULL, 0x000000000c200328ULL,
+    0x000000000c400307ULL, 0x000000000c400323ULL, 0x000000000c400331ULL, 0x000000000c600301ULL,
+    0x000000000c600302ULL, 0x000000000c600307ULL, 0x000000000c60030cULL, 0x000000000c600327ULL,
+    0x000000000c800307ULL, 0x000000000c80030cULL, 0x000000000c800323ULL, 0x000000000c800327ULL,
+    0x000000000c80032dULL, 0x000000000c800331ULL, 0x000000000ca00300ULL, 0x000000000ca00301ULL,
+    0x000000000ca00302ULL, 0x000000000ca00303ULL, 0x000000000ca00304ULL, 0x000000000ca00306ULL,
+    0x000000000ca00307ULL, 0x000000000ca00308ULL, 0x000000000ca00309ULL, 0x000000000ca0030cULL,
+    0x000000000ca0030fULL, 0x000000000ca00311ULL, 0x000000000ca00323ULL, 0x000000000ca00327ULL,
+    0x000000000ca00328ULL, 0x000000000ca0032dULL, 0x000000000ca00330ULL, 0x000000000cc00307ULL,
+    0x000000000ce00301ULL, 0x000000000ce00302ULL, 0x000000000ce00304ULL, 0x000000000ce00306ULL,
+    0x000000000ce00307ULL, 0x000000000ce0030cULL, 0x000000000ce00327ULL, 0x000000000d000302ULL,
+    0x000000000d000307ULL, 0x000000000d000308ULL, 0x000000000d00030cULL, 0x000000000d000323ULL,
+    0x000000000d000327ULL, 0x000000000d00032eULL, 0x000000000d000331ULL, 0x000000000d200300ULL,
+    0x000000000d200301ULL, 0x000000000d200302ULL, 0x000000000d200303ULL, 0x000000000d200304ULL,
+    0x000000000d200306ULL, 0x000000000d200308ULL, 0x000000000d200309ULL, 0x000000000d20030cULL,
+    0x000000000d20030fULL, 0x000000000d200311ULL, 0x000000000d200323ULL, 0x000000000d200328ULL,
+    0x000000000d200330ULL, 0x000000000d400302ULL, 0x000000000d40030cULL, 0x000000000d600301ULL,
+    0x000000000d60030cULL, 0x000000000d600323ULL, 0x000000000d600327ULL, 0x000000000d600331ULL,
+    0x000000000d800301ULL, 0x000000000d80030cULL, 0x000000000d800323ULL, 0x000000000d800327ULL,
+    0x000000000d80032dULL, 0x000000000d800331ULL, 0x000000000da00301ULL, 0x000000000da00307ULL,
+    0x000000000da00323ULL, 0x000000000dc00300ULL, 0x000000000dc00301ULL, 0x000000000dc00303ULL,
+    0x000000000dc00307ULL, 0x000000000dc0030cULL, 0x000000000dc00323ULL, 0x000000000dc00327ULL,
+    0x000000000dc0032dULL, 0x000000000dc00331ULL, 0x000000000de00300ULL, 0x000000000de00301ULL,
+    0x000000000de00302ULL, 0x000000000de00303ULL, 0x000000000de00304ULL, 0x000000000de00306ULL,
+    0x000000000de00307ULL, 0x000000000de00308ULL, 0x000000000de00309ULL, 0x000000000de0030bULL,
+    0x000000000de0030cULL, 0x000000000de0030fULL, 0x000000000de00311ULL, 0x000000000de0031bULL,
+    0x000000000de00323ULL, 0x000000000de00328ULL, 0x000000000e000301ULL, 0x000000000e000307ULL,
+    0x000000000e400301ULL, 0x000000000e400307ULL, 0x000000000e40030cULL, 0x000000000e40030fULL,
+    0x000000000e400311ULL, 0x000000000e400323ULL, 0x000000000e400327ULL, 0x000000000e400331ULL,
+    0x000000000e600301ULL, 0x000000000e600302ULL, 0x000000000e600307ULL, 0x000000000e60030cULL,
+    0x000000000e600323ULL, 0x000000000e600326ULL, 0x000000000e600327ULL, 0x000000000e800307ULL,
+    0x000000000e800308ULL, 0x000000000e80030cULL, 0x000000000e800323ULL, 0x000000000e800326ULL,
+    0x000000000e800327ULL, 0x000000000e80032dULL, 0x000000000e800331ULL, 0x000000000ea00300ULL,
+    0x000000000ea00301ULL, 0x000000000ea00302ULL, 0x000000000ea00303ULL, 0x000000000ea00304ULL,
+    0x000000000ea00306ULL, 0x000000000ea00308ULL, 0x000000000ea00309ULL, 0x000000000ea0030aULL,
+    0x000000000ea0030bULL, 0x000000000ea0030cULL, 0x000000000ea0030fULL, 0x000000000ea00311ULL,
+    0x000000000ea0031bULL, 0x000000000ea00323ULL, 0x000000000ea00324ULL, 0x000000000ea00328ULL,
+    0x000000000ea0032dULL, 0x000000000ea00330ULL, 0x000000000ec00303ULL, 0x000000000ec00323ULL,
+    0x000000000ee00300ULL, 0x000000000ee00301ULL, 0x000000000ee00302ULL, 0x000000000ee00307ULL,
+    0x000000000ee00308ULL, 0x000000000ee0030aULL, 0x000000000ee00323ULL, 0x000000000f000307ULL,
+    0x000000000f000308ULL, 0x000000000f200300ULL, 0x000000000f200301ULL, 0x000000000f200302ULL,
+    0x000000000f200303ULL, 0x000000000f200304ULL, 0x000000000f200307ULL, 0x000000000f200308ULL,
+    0x000000000f200309ULL, 0x000000000f20030aULL, 0x000000000f200323ULL, 0x000000000f400301ULL,
+    0x000000000f400302ULL, 0x000000000f400307ULL, 0x000000000f40030cULL, 0x000000000f400323ULL,
+    0x000000000f400331ULL, 0x0000000015000300ULL, 0x0000000015000301ULL, 0x0000000015000342ULL,
+    0x0000000018400300ULL, 0x0000000018400301ULL, 0x0000000018400303ULL, 0x0000000018400309ULL,
+    0x0000000018800304ULL, 0x0000000018a00301ULL, 0x0000000018c00301ULL, 0x0000000018c00304ULL,
+    0x0000000018e00301ULL, 0x0000000019400300ULL, 0x0000000019400301ULL, 0x0000000019400303ULL,
+    0x0000000019400309ULL, 0x0000000019e00301ULL, 0x000000001a800300ULL, 0x000000001a800301ULL,
+    0x000000001a800303ULL, 0x000000001a800309ULL, 0x000000001aa00301ULL, 0x000000001aa00304ULL,
+    0x000000001aa00308ULL, 0x000000001ac00304ULL, 0x000000001b000301ULL, 0x000000001b800300ULL,
+    0x000000001b800301ULL, 0x000000001b800304ULL, 0x000000001b80030cULL, 0x000000001c400300ULL,
+    0x000000001c400301ULL, 0x000000001c400303ULL, 0x000000001c400309ULL, 0x000000001c800304ULL,
+    0x000000001ca00301ULL, 0x000000001cc00301ULL, 0x000000001cc00304ULL, 0x000000001ce00301ULL,
+    0x000000001d400300ULL, 0x000000001d400301ULL, 0x000000001d400303ULL, 0x000000001d400309ULL,
+    0x000000001de00301ULL, 0x000000001e800300ULL, 0x000000001e800301ULL, 0x000000001e800303ULL,
+    0x000000001e800309ULL, 0x000000001ea00301ULL, 0x000000001ea00304ULL, 0x000000001ea00308ULL,
+    0x000000001ec00304ULL, 0x000000001f000301ULL, 0x000000001f800300ULL, 0x000000001f800301ULL,
+    0x000000001f800304ULL, 0x000000001f80030cULL, 0x0000000020400300ULL, 0x0000000020400301ULL,
+    0x0000000020400303ULL, 0x0000000020400309ULL, 0x0000000020600300ULL, 0x0000000020600301ULL,
+    0x0000000020600303ULL, 0x0000000020600309ULL, 0x0000000022400300ULL, 0x0000000022400301ULL,
+    0x0000000022600300ULL, 0x0000000022600301ULL, 0x0000000029800300ULL, 0x0000000029800301ULL,
+    0x0000000029a00300ULL, 0x0000000029a00301ULL, 0x000000002b400307ULL, 0x000000002b600307ULL,
+    0x000000002c000307ULL, 0x000000002c200307ULL, 0x000000002d000301ULL, 0x000000002d200301ULL,
+    0x000000002d400308ULL, 0x000000002d600308ULL, 0x000000002fe00307ULL, 0x0000000034000300ULL,
+    0x0000000034000301ULL, 0x0000000034000303ULL, 0x0000000034000309ULL, 0x0000000034000323ULL,
+    0x0000000034200300ULL, 0x0000000034200301ULL, 0x0000000034200303ULL, 0x0000000034200309ULL,
+    0x0000000034200323ULL, 0x0000000035e00300ULL, 0x0000000035e00301ULL, 0x0000000035e00303ULL,
+    0x0000000035e00309ULL, 0x0000000035e00323ULL, 0x0000000036000300ULL, 0x0000000036000301ULL,
+    0x0000000036000303ULL, 0x0000000036000309ULL, 0x0000000036000323ULL, 0x0000000036e0030cULL,
+    0x000000003d400304ULL, 0x000000003d600304ULL, 0x0000000044c00304ULL, 0x0000000044e00304ULL,
+    0x0000000045000306ULL, 0x0000000045200306ULL, 0x0000000045c00304ULL, 0x0000000045e00304ULL,
+    0x000000005240030cULL, 0x0000000072200300ULL, 0x0000000072200301ULL, 0x0000000072200304ULL,
+    0x0000000072200306ULL, 0x0000000072200313ULL, 0x0000000072200314ULL, 0x0000000072200345ULL,
+    0x0000000072a00300ULL, 0x0000000072a00301ULL, 0x0000000072a00313ULL, 0x0000000072a00314ULL,
+    0x0000000072e00300ULL, 0x0000000072e00301ULL, 0x0000000072e00313ULL, 0x0000000072e00314ULL,
+    0x0000000072e00345ULL, 0x0000000073200300ULL, 0x0000000073200301ULL, 0x0000000073200304ULL,
+    0x0000000073200306ULL, 0x0000000073200308ULL, 0x0000000073200313ULL, 0x0000000073200314ULL,
+    0x0000000073e00300ULL, 0x0000000073e00301ULL, 0x0000000073e00313ULL, 0x0000000073e00314ULL,
+    0x0000000074200314ULL, 0x0000000074a00300ULL, 0x0000000074a00301ULL, 0x0000000074a00304ULL,
+    0x0000000074a00306ULL, 0x0000000074a00308ULL, 0x0000000074a00314ULL, 0x0000000075200300ULL,
+    0x0000000075200301ULL, 0x0000000075200313ULL, 0x0000000075200314ULL, 0x0000000075200345ULL,
+    0x0000000075800345ULL, 0x0000000075c00345ULL, 0x0000000076200300ULL, 0x0000000076200301ULL,
+    0x0000000076200304ULL, 0x0000000076200306ULL, 0x0000000076200313ULL, 0x0000000076200314ULL,
+    0x0000000076200342ULL, 0x0000000076200345ULL, 0x0000000076a00300ULL, 0x0000000076a00301ULL,
+    0x0000000076a00313ULL, 0x0000000076a00314ULL, 0x0000000076e00300ULL, 0x0000000076e00301ULL,
+    0x0000000076e00313ULL, 0x0000000076e00314ULL, 0x0000000076e00342ULL, 0x0000000076e00345ULL,
+    0x0000000077200300ULL, 0x0000000077200301ULL, 0x0000000077200304ULL, 0x0000000077200306ULL,
+    0x0000000077200308ULL, 0x0000000077200313ULL, 0x0000000077200314ULL, 0x0000000077200342ULL,
+    0x0000000077e00300ULL, 0x0000000077e00301ULL, 0x0000000077e00313ULL, 0x0000000077e00314ULL,
+    0x0000000078200313ULL, 0x0000000078200314ULL, 0x0000000078a00300ULL, 0x0000000078a00301ULL,
+    0x0000000078a00304ULL, 0x0000000078a00306ULL, 0x0000000078a00308ULL, 0x0000000078a00313ULL,
+    0x0000000078a00314ULL, 0x0000000078a00342ULL, 0x0000000079200300ULL, 0x0000000079200301ULL,
+    0x0000000079200313ULL, 0x0000000079200314ULL, 0x0000000079200342ULL, 0x0000000079200345ULL,
+    0x0000000079400300ULL, 0x0000000079400301ULL, 0x0000000079400342ULL, 0x0000000079600300ULL,
+    0x0000000079600301ULL, 0x0000000079600342ULL, 0x0000000079c00345ULL, 0x000000007a400301ULL,
+    0x000000007a400308ULL, 0x0000000080c00308ULL, 0x0000000082000306ULL, 0x0000000082000308ULL,
+    0x0000000082600301ULL, 0x0000000082a00300ULL, 0x0000000082a00306ULL, 0x0000000082a00308ULL,
+    0x0000000082c00306ULL, 0x0000000082c00308ULL, 0x0000000082e00308ULL, 0x0000000083000300ULL,
+    0x0000000083000304ULL, 0x0000000083000306ULL, 0x0000000083000308ULL, 0x0000000083400301ULL,
+    0x0000000083c00308ULL, 0x0000000084600304ULL, 0x0000000084600306ULL, 0x0000000084600308ULL,
+    0x000000008460030bULL, 0x0000000084e00308ULL, 0x0000000085600308ULL, 0x0000000085a00308ULL,
+    0x0000000086000306ULL, 0x0000000086000308ULL, 0x0000000086600301ULL, 0x0000000086a00300ULL,
+    0x0000000086a00306ULL, 0x0000000086a00308ULL, 0x0000000086c00306ULL, 0x0000000086c00308ULL,
+    0x0000000086e00308ULL, 0x0000000087000300ULL, 0x0000000087000304ULL, 0x0000000087000306ULL,
+    0x0000000087000308ULL, 0x0000000087400301ULL, 0x0000000087c00308ULL, 0x0000000088600304ULL,
+    0x0000000088600306ULL, 0x0000000088600308ULL, 0x000000008860030bULL, 0x0000000088e00308ULL,
+    0x0000000089600308ULL, 0x0000000089a00308ULL, 0x000000008ac00308ULL, 0x000000008e80030fULL,
+    0x000000008ea0030fULL, 0x000000009b000308ULL, 0x000000009b200308ULL, 0x000000009d000308ULL,
+    0x000000009d200308ULL, 0x00000000c4e00653ULL, 0x00000000c4e00654ULL, 0x00000000c4e00655ULL,
+    0x00000000c9000654ULL, 0x00000000c9400654ULL, 0x00000000d8200654ULL, 0x00000000da400654ULL,
+    0x00000000daa00654ULL, 0x000000012500093cULL, 0x000000012600093cULL, 0x000000012660093cULL,
+    0x0000000138e009beULL, 0x0000000138e009d7ULL, 0x0000000168e00b3eULL, 0x0000000168e00b56ULL,
+    0x0000000168e00b57ULL, 0x0000000172400bd7ULL, 0x0000000178c00bbeULL, 0x0000000178c00bd7ULL,
+    0x0000000178e00bbeULL, 0x0000000188c00c56ULL, 0x0000000197e00cd5ULL, 0x0000000198c00cc2ULL,
+    0x0000000198c00cd5ULL, 0x0000000198c00cd6ULL, 0x0000000199400cd5ULL, 0x00000001a8c00d3eULL,
+    0x00000001a8c00d57ULL, 0x00000001a8e00d3eULL, 0x00000001bb200dcaULL, 0x00000001bb200dcfULL,
+    0x00000001bb200ddfULL, 0x00000001bb800dcaULL, 0x0000000204a0102eULL, 0x0000000360a01b35ULL,
+    0x0000000360e01b35ULL, 0x0000000361201b35ULL, 0x0000000361601b35ULL, 0x0000000361a01b35ULL,
+    0x0000000362201b35ULL, 0x0000000367401b35ULL, 0x0000000367801b35ULL, 0x0000000367c01b35ULL,
+    0x0000000367e01b35ULL, 0x0000000368401b35ULL, 0x00000003c6c00304ULL, 0x00000003c6e00304ULL,
+    0x00000003cb400304ULL, 0x00000003cb600304ULL, 0x00000003cc400307ULL, 0x00000003cc600307ULL,
+    0x00000003d4000302ULL, 0x00000003d4000306ULL, 0x00000003d4200302ULL, 0x00000003d4200306ULL,
+    0x00000003d7000302ULL, 0x00000003d7200302ULL, 0x00000003d9800302ULL, 0x00000003d9a00302ULL,
+    0x00000003e0000300ULL, 0x00000003e0000301ULL, 0x00000003e0000342ULL, 0x00000003e0000345ULL,
+    0x00000003e0200300ULL, 0x00000003e0200301ULL, 0x00000003e0200342ULL, 0x00000003e0200345ULL,
+    0x00000003e0400345ULL, 0x00000003e0600345ULL, 0x00000003e0800345ULL, 0x00000003e0a00345ULL,
+    0x00000003e0c00345ULL, 0x00000003e0e00345ULL, 0x00000003e1000300ULL, 0x00000003e1000301ULL,
+    0x00000003e1000342ULL, 0x00000003e1000345ULL, 0x00000003e1200300ULL, 0x00000003e1200301ULL,
+    0x00000003e1200342ULL, 0x00000003e1200345ULL, 0x00000003e1400345ULL, 0x00000003e1600345ULL,
+    0x00000003e1800345ULL, 0x00000003e1a00345ULL, 0x00000003e1c00345ULL, 0x00000003e1e00345ULL,
+    0x00000003e2000300ULL, 0x00000003e2000301ULL, 0x00000003e2200300ULL, 0x00000003e2200301ULL,
+    0x00000003e3000300ULL, 0x00000003e3000301ULL, 0x00000003e3200300ULL, 0x00000003e3200301ULL,
+    0x00000003e4000300ULL, 0x00000003e4000301ULL, 0x00000003e4000342ULL, 0x00000003e4000345ULL,
+    0x00000003e4200300ULL, 0x00000003e4200301ULL, 0x00000003e4200342ULL, 0x00000003e4200345ULL,
+    0x00000003e4400345ULL, 0x00000003e4600345ULL, 0x00000003e4800345ULL, 0x00000003e4a00345ULL,
+    0x00000003e4c00345ULL, 0x00000003e4e00345ULL, 0x00000003e5000300ULL, 0x00000003e5000301ULL,
+    0x00000003e5000342ULL, 0x00000003e5000345ULL, 0x00000003e5200300ULL, 0x00000003e5200301ULL,
+    0x00000003e5200342ULL, 0x00000003e5200345ULL, 0x00000003e5400345ULL, 0x00000003e5600345ULL,
+    0x00000003e5800345ULL, 0x00000003e5a00345ULL, 0x00000003e5c00345ULL, 0x00000003e5e00345ULL,
+    0x00000003e6000300ULL, 0x00000003e6000301ULL, 0x00000003e6000342ULL, 0x00000003e6200300ULL,
+    0x00000003e6200301ULL, 0x00000003e6200342ULL, 0x00000003e7000300ULL, 0x00000003e7000301ULL,
+    0x00000003e7000342ULL, 0x00000003e7200300ULL, 0x00000003e7200301ULL, 0x00000003e7200342ULL,
+    0x00000003e8000300ULL, 0x00000003e8000301ULL, 0x00000003e8200300ULL, 0x00000003e8200301ULL,
+    0x00000003e9000300ULL, 0x00000003e9000301ULL, 0x00000003e9200300ULL, 0x00000003e9200301ULL,
+    0x00000003ea000300ULL, 0x00000003ea000301ULL, 0x00000003ea000342ULL, 0x00000003ea200300ULL,
+    0x00000003ea200301ULL, 0x00000003ea200342ULL, 0x00000003eb200300ULL, 0x00000003eb200301ULL,
+    0x00000003eb200342ULL, 0x00000003ec000300ULL, 0x00000003ec000301ULL, 0x00000003ec000342ULL,
+    0x00000003ec000345ULL, 0x00000003ec200300ULL, 0x00000003ec200301ULL, 0x00000003ec200342ULL,
+    0x00000003ec200345ULL, 0x00000003ec400345ULL, 0x00000003ec600345ULL, 0x00000003ec800345ULL,
+    0x00000003eca00345ULL, 0x00000003ecc00345ULL, 0x00000003ece00345ULL, 0x00000003ed000300ULL,
+    0x00000003ed000301ULL, 0x00000003ed000342ULL, 0x00000003ed000345ULL, 0x00000003ed200300ULL,
+    0x00000003ed200301ULL, 0x00000003ed200342ULL, 0x00000003ed200345ULL, 0x00000003ed400345ULL,
+    0x00000003ed600345ULL, 0x00000003ed800345ULL, 0x00000003eda00345ULL, 0x00000003edc00345ULL,
+    0x00000003ede00345ULL, 0x00000003ee000345ULL, 0x00000003ee800345ULL, 0x00000003ef800345ULL,
+    0x00000003f6c00345ULL, 0x00000003f7e00300ULL, 0x00000003f7e00301ULL, 0x00000003f7e00342ULL,
+    0x00000003f8c00345ULL, 0x00000003fec00345ULL, 0x00000003ffc00300ULL, 0x00000003ffc00301ULL,
+    0x00000003ffc00342ULL, 0x0000000432000338ULL, 0x0000000432400338ULL, 0x0000000432800338ULL,
+    0x000000043a000338ULL, 0x000000043a400338ULL, 0x000000043a800338ULL, 0x0000000440600338ULL,
+    0x0000000441000338ULL, 0x0000000441600338ULL, 0x0000000444600338ULL, 0x0000000444a00338ULL,
+    0x0000000447800338ULL, 0x0000000448600338ULL, 0x0000000448a00338ULL, 0x0000000449000338ULL,
+    0x0000000449a00338ULL, 0x000000044c200338ULL, 0x000000044c800338ULL, 0x000000044ca00338ULL,
+    0x000000044e400338ULL, 0x000000044e600338ULL, 0x000000044ec00338ULL, 0x000000044ee00338ULL,
+    0x000000044f400338ULL, 0x000000044f600338ULL, 0x000000044f800338ULL, 0x000000044fa00338ULL,
+    0x0000000450400338ULL, 0x0000000450600338ULL, 0x0000000450c00338ULL, 0x0000000450e00338ULL,
+    0x0000000452200338ULL, 0x0000000452400338ULL, 0x0000000454400338ULL, 0x0000000455000338ULL,
+    0x0000000455200338ULL, 0x0000000455600338ULL, 0x0000000456400338ULL, 0x0000000456600338ULL,
+    0x0000000456800338ULL, 0x0000000456a00338ULL, 0x0000000608c03099ULL, 0x0000000609603099ULL,
+    0x0000000609a03099ULL, 0x0000000609e03099ULL, 0x000000060a203099ULL, 0x000000060a603099ULL,
+    0x000000060aa03099ULL, 0x000000060ae03099ULL, 0x000000060b203099ULL, 0x000000060b603099ULL,
+    0x000000060ba03099ULL, 0x000000060be03099ULL, 0x000000060c203099ULL, 0x000000060c803099ULL,
+    0x000000060cc03099ULL, 0x000000060d003099ULL, 0x000000060de03099ULL, 0x000000060de0309aULL,
+    0x000000060e403099ULL, 0x000000060e40309aULL, 0x000000060ea03099ULL, 0x000000060ea0309aULL,
+    0x000000060f003099ULL, 0x000000060f00309aULL, 0x000000060f603099ULL, 0x000000060f60309aULL,
+    0x0000000613a03099ULL, 0x0000000614c03099ULL, 0x0000000615603099ULL, 0x0000000615a03099ULL,
+    0x0000000615e03099ULL, 0x0000000616203099ULL, 0x0000000616603099ULL, 0x0000000616a03099ULL,
+    0x0000000616e03099ULL, 0x0000000617203099ULL, 0x0000000617603099ULL, 0x0000000617a03099ULL,
+    0x0000000617e03099ULL, 0x0000000618203099ULL, 0x0000000618803099ULL, 0x0000000618c03099ULL,
+    0x0000000619003099ULL, 0x0000000619e03099ULL, 0x0000000619e0309aULL, 0x000000061a403099ULL,
+    0x000000061a40309aULL, 0x000000061aa03099ULL, 0x000000061aa0309aULL, 0x000000061b003099ULL,
+    0x000000061b00309aULL, 0x000000061b603099ULL, 0x000000061b60309aULL, 0x000000061de03099ULL,
+    0x000000061e003099ULL, 0x000000061e203099ULL, 0x000000061e403099ULL, 0x000000061fa03099ULL,
+    0x00000022132110baULL, 0x00000022136110baULL, 0x0000002214a110baULL, 0x0000002226211127ULL,
+    0x0000002226411127ULL, 0x0000002268e1133eULL, 0x0000002268e11357ULL, 0x00000022972114b0ULL,
+    0x00000022972114baULL, 0x00000022972114bdULL, 0x00000022b70115afULL, 0x00000022b72115afULL,
+    0x0000002326a11930ULL,
+};
+
+/*Primary composites of __str_compkeys*/
+const uint32_t __str_composites[941] = {
+    0x0000226e, 0x00002260, 0x0000226f, 0x000000c0, 0x000000c1, 0x000000c2, 0x000000c3, 0x00000100,
+    0x00000102, 0x00000226, 0x000000c4, 0x00001ea2, 0x000000c5, 0x000001cd, 0x00000200, 0x00000202,
+    0x00001ea0, 0x00001e00, 0x00000104, 0x00001e02, 0x00001e04, 0x00001e06, 0x00000106, 0x00000108,
+    0x0000010a, 0x0000010c, 0x000000c7, 0x00001e0a, 0x0000010e, 0x00001e0c, 0x00001e10, 0x00001e12,
+    0x00001e0e, 0x000000c8, 0x000000c9, 0x000000ca, 0x00001ebc, 0x00000112, 0x00000114, 0x00000116,
+    0x000000cb, 0x00001eba, 0x0000011a, 0x00000204, 0x00000206, 0x00001eb8, 0x00000228, 0x00000118,
+    0x00001e18, 0x00001e1a, 0x00001e1e, 0x000001f4, 0x0000011c, 0x00001e20, 0x0000011e, 0x00000120,
+    0x000001e6, 0x00000122, 0x00000124, 0x00001e22, 0x00001e26, 0x0000021e, 0x00001e24, 0x00001e28,
+    0x00001e2a, 0x000000cc, 0x000000cd, 0x000000ce, 0x00000128, 0x0000012a, 0x0000012c, 0x00000130,
+    0x000000cf, 0x00001ec8, 0x000001cf, 0x00000208, 0x0000020a, 0x00001eca, 0x0000012e, 0x00001e2c,
+    0x00000134, 0x00001e30, 0x000001e8, 0x00001e32, 0x00000136, 0x00001e34, 0x00000139, 0x0000013d,
+    0x00001e36, 0x0000013b, 0x00001e3c, 0x00001e3a, 0x00001e3e, 0x00001e40, 0x00001e42, 0x000001f8,
+    0x00000143, 0x000000d1, 0x00001e44, 0x00000147, 0x00001e46, 0x00000145, 0x00001e4a, 0x00001e48,
+    0x000000d2, 0x000000d3, 0x000000d4, 0x000000d5, 0x0000014c, 0x0000014e, 0x0000022e, 0x000000d6,
+    0x00001ece, 0x00000150, 0x000001d1, 0x0000020c, 0x0000020e, 0x000001a0, 0x00001ecc, 0x000001ea,
+    0x00001e54, 0x00001e56, 0x00000154, 0x00001e58, 0x00000158, 0x00000210, 0x00000212, 0x00001e5a,
+    0x00000156, 0x00001e5e, 0x0000015a, 0x0000015c, 0x00001e60, 0x00000160, 0x00001e62, 0x00000218,
+    0x0000015e, 0x00001e6a, 0x00000164, 0x00001e6c, 0x0000021a, 0x00000162, 0x00001e70, 0x00001e6e,
+    0x000000d9, 0x000000da, 0x000000db, 0x00000168, 0x0000016a, 0x0000016c, 0x000000dc, 0x00001ee6,
+    0x0000016e, 0x00000170, 0x000001d3, 0x00000214, 0x00000216, 0x000001af, 0x00001ee4, 0x00001e72,
+    0x00000172, 0x00001e76, 0x00001e74, 0x00001e7c, 0x00001e7e, 0x00001e80, 0x00001e82, 0x00000174,
+    0x00001e86, 0x00001e84, 0x00001e88, 0x00001e8a, 0x00001e8c, 0x00001ef2, 0x000000dd, 0x00000176,
+    0x00001ef8, 0x00000232, 0x00001e8e, 0x00000178, 0x00001ef6, 0x00001ef4, 0x00000179, 0x00001e90,
+    0x0000017b, 0x0000017d, 0x00001e92, 0x00001e94, 0x000000e0, 0x000000e1, 0x000000e2, 0x000000e3,
+    0x00000101, 0x00000103, 0x00000227, 0x000000e4, 0x00001ea3, 0x000000e5, 0x000001ce, 0x00000201,
+    0x00000203, 0x00001ea1, 0x00001e01, 0x00000105, 0x00001e03, 0x00001e05, 0x00001e07, 0x00000107,
+    0x00000109, 0x0000010b, 0x0000010d, 0x000000e7, 0x00001e0b, 0x0000010f, 0x00001e0d, 0x00001e11,
+    0x00001e13, 0x00001e0f, 0x000000e8, 0x000000e9, 0x000000ea, 0x00001ebd, 0x00000113, 0x00000115,
+    0x00000117, 0x000000eb, 0x00001ebb, 0x0000011b, 0x00000205, 0x00000207, 0x00001eb9, 0x00000229,
+    0x00000119, 0x00001e19, 0x00001e1b, 0x00001e1f, 0x000001f5, 0x0000011d, 0x00001e21, 0x0000011f,
+    0x00000121, 0x000001e7, 0x00000123, 0x00000125, 0x00001e23, 0x00001e27, 0x0000021f, 0x00001e25,
+    0x00001e29, 0x00001e2b, 0x00001e96, 0x000000ec, 0x000000ed, 0x000000ee, 0x00000129, 0x0000012b,
+    0x0000012d, 0x000000ef, 0x00001ec9, 0x000001d0, 0x00000209, 0x0000020b, 0x00001ecb, 0x0000012f,
+    0x00001e2d, 0x00000135, 0x000001f0, 0x00001e31, 0x000001e9, 0x00001e33, 0x00000137, 0x00001e35,
+    0x0000013a, 0x0000013e, 0x00001e37, 0x0000013c, 0x00001e3d, 0x00001e3b, 0x00001e3f, 0x00001e41,
+    0x00001e43, 0x000001f9, 0x00000144, 0x000000f1, 0x00001e45, 0x00000148, 0x00001e47, 0x00000146,
+    0x00001e4b, 0x00001e49, 0x000000f2, 0x000000f3, 0x000000f4, 0x000000f5, 0x0000014d, 0x0000014f,
+    0x0000022f, 0x000000f6, 0x00001ecf, 0x00000151, 0x000001d2, 0x0000020d, 0x0000020f, 0x000001a1,
+    0x00001ecd, 0x000001eb, 0x00001e55, 0x00001e57, 0x00000155, 0x00001e59, 0x00000159, 0x00000211,
+    0x00000213, 0x00001e5b, 0x00000157, 0x00001e5f, 0x0000015b, 0x0000015d, 0x00001e61, 0x00000161,
+    0x00001e63, 0x00000219, 0x0000015f, 0x00001e6b, 0x00001e97, 0x00000165, 0x00001e6d, 0x0000021b,
+    0x00000163, 0x00001e71, 0x00001e6f, 0x000000f9, 0x000000fa, 0x000000fb, 0x00000169, 0x0000016b,
+    0x0000016d, 0x000000fc, 0x00001ee7, 0x0000016f, 0x00000171, 0x000001d4, 0x00000215, 0x00000217,
+    0x000001b0, 0x00001ee5, 0x00001e73, 0x00000173, 0x00001e77, 0x00001e75, 0x00001e7d, 0x00001e7f,
+    0x00001e81, 0x00001e83, 0x00000175, 0x00001e87, 0x00001e85, 0x00001e98, 0x00001e89, 0x00001e8b,
+    0x00001e8d, 0x00001ef3, 0x000000fd, 0x00000177, 0x00001ef9, 0x00000233, 0x00001e8f, 0x000000ff,
+    0x00001ef7, 0x00001e99, 0x00001ef5, 0x0000017a, 0x00001e91, 0x0000017c, 0x0000017e, 0x00001e93,
+    0x00001e95, 0x00001fed, 0x00000385, 0x00001fc1, 0x00001ea6, 0x00001ea4, 0x00001eaa, 0x00001ea8,
+    0x000001de, 0x000001fa, 0x000001fc, 0x000001e2, 0x00001e08, 0x00001ec0, 0x00001ebe, 0x00001ec4,
+    0x00001ec2, 0x00001e2e, 0x00001ed2, 0x00001ed0, 0x00001ed6, 0x00001ed4, 0x00001e4c, 0x0000022c,
+    0x00001e4e, 0x0000022a, 0x000001fe, 0x000001db, 0x000001d7, 0x000001d5, 0x000001d9, 0x00001ea7,
+    0x00001ea5, 0x00001eab, 0x00001ea9, 0x000001df, 0x000001fb, 0x000001fd, 0x000001e3, 0x00001e09,
+    0x00001ec1, 0x00001ebf, 0x00001ec5, 0x00001ec3, 0x00001e2f, 0x00001ed3, 0x00001ed1, 0x00001ed7,
+    0x00001ed5, 0x00001e4d, 0x0000022d, 0x00001e4f, 0x0000022b, 0x000001ff, 0x000001dc, 0x000001d8,
+    0x000001d6, 0x000001da, 0x00001eb0, 0x00001eae, 0x00001eb4, 0x00001eb2, 0x00001eb1, 0x00001eaf,
+    0x00001eb5, 0x00001eb3, 0x00001e14, 0x00001e16, 0x00001e15, 0x00001e17, 0x00001e50, 0x00001e52,
+    0x00001e51, 0x00001e53, 0x00001e64, 0x00001e65, 0x00001e66, 0x00001e67, 0x00001e78, 0x00001e79,
+    0x00001e7a, 0x00001e7b, 0x00001e9b, 0x00001edc, 0x00001eda, 0x00001ee0, 0x00001ede, 0x00001ee2,
+    0x00001edd, 0x00001edb, 0x00001ee1, 0x00001edf, 0x00001ee3, 0x00001eea, 0x00001ee8, 0x00001eee,
+    0x00001eec, 0x00001ef0, 0x00001eeb, 0x00001ee9, 0x00001eef, 0x00001eed, 0x00001ef1, 0x000001ee,
+    0x000001ec, 0x000001ed, 0x000001e0, 0x000001e1, 0x00001e1c, 0x00001e1d, 0x00000230, 0x00000231,
+    0x000001ef, 0x00001fba, 0x00000386, 0x00001fb9, 0x00001fb8, 0x00001f08, 0x00001f09, 0x00001fbc,
+    0x00001fc8, 0x00000388, 0x00001f18, 0x00001f19, 0x00001fca, 0x00000389, 0x00001f28, 0x00001f29,
+    0x00001fcc, 0x00001fda, 0x0000038a, 0x00001fd9, 0x00001fd8, 0x000003aa, 0x00001f38, 0x00001f39,
+    0x00001ff8, 0x0000038c, 0x00001f48, 0x00001f49, 0x00001fec, 0x00001fea, 0x0000038e, 0x00001fe9,
+    0x00001fe8, 0x000003ab, 0x00001f59, 0x00001ffa, 0x0000038f, 0x00001f68, 0x00001f69, 0x00001ffc,
+    0x00001fb4, 0x00001fc4, 0x00001f70, 0x000003ac, 0x00001fb1, 0x00001fb0, 0x00001f00, 0x00001f01,
+    0x00001fb6, 0x00001fb3, 0x00001f72, 0x000003ad, 0x00001f10, 0x00001f11, 0x00001f74, 0x000003ae,
+    0x00001f20, 0x00001f21, 0x00001fc6, 0x00001fc3, 0x00001f76, 0x000003af, 0x00001fd1, 0x00001fd0,
+    0x000003ca, 0x00001f30, 0x00001f31, 0x00001fd6, 0x00001f78, 0x000003cc, 0x00001f40, 0x00001f41,
+    0x00001fe4, 0x00001fe5, 0x00001f7a, 0x000003cd, 0x00001fe1, 0x00001fe0, 0x000003cb, 0x00001f50,
+    0x00001f51, 0x00001fe6, 0x00001f7c, 0x000003ce, 0x00001f60, 0x00001f61, 0x00001ff6, 0x00001ff3,
+    0x00001fd2, 0x00000390, 0x00001fd7, 0x00001fe2, 0x000003b0, 0x00001fe7, 0x00001ff4, 0x000003d3,
+    0x000003d4, 0x00000407, 0x000004d0, 0x000004d2, 0x00000403, 0x00000400, 0x000004d6, 0x00000401,
+    0x000004c1, 0x000004dc, 0x000004de, 0x0000040d, 0x000004e2, 0x00000419, 0x000004e4, 0x0000040c,
+    0x000004e6, 0x000004ee, 0x0000040e, 0x000004f0, 0x000004f2, 0x000004f4, 0x000004f8, 0x000004ec,
+    0x000004d1, 0x000004d3, 0x00000453, 0x00000450, 0x000004d7, 0x00000451, 0x000004c2, 0x000004dd,
+    0x000004df, 0x0000045d, 0x000004e3, 0x00000439, 0x000004e5, 0x0000045c, 0x000004e7, 0x000004ef,
+    0x0000045e, 0x000004f1, 0x000004f3, 0x000004f5, 0x000004f9, 0x000004ed, 0x00000457, 0x00000476,
+    0x00000477, 0x000004da, 0x000004db, 0x000004ea, 0x000004eb, 0x00000622, 0x00000623, 0x00000625,
+    0x00000624, 0x00000626, 0x000006c2, 0x000006d3, 0x000006c0, 0x00000929, 0x00000931, 0x00000934,
+    0x000009cb, 0x000009cc, 0x00000b4b, 0x00000b48, 0x00000b4c, 0x00000b94, 0x00000bca, 0x00000bcc,
+    0x00000bcb, 0x00000c48, 0x00000cc0, 0x00000cca, 0x00000cc7, 0x00000cc8, 0x00000ccb, 0x00000d4a,
+    0x00000d4c, 0x00000d4b, 0x00000dda, 0x00000ddc, 0x00000dde, 0x00000ddd, 0x00001026, 0x00001b06,
+    0x00001b08, 0x00001b0a, 0x00001b0c, 0x00001b0e, 0x00001b12, 0x00001b3b, 0x00001b3d, 0x00001b40,
+    0x00001b41, 0x00001b43, 0x00001e38, 0x00001e39, 0x00001e5c, 0x00001e5d, 0x00001e68, 0x00001e69,
+    0x00001eac, 0x00001eb6, 0x00001ead, 0x00001eb7, 0x00001ec6, 0x00001ec7, 0x00001ed8, 0x00001ed9,
+    0x00001f02, 0x00001f04, 0x00001f06, 0x00001f80, 0x00001f03, 0x00001f05, 0x00001f07, 0x00001f81,
+    0x00001f82, 0x00001f83, 0x00001f84, 0x00001f85, 0x00001f86, 0x00001f87, 0x00001f0a, 0x00001f0c,
+    0x00001f0e, 0x00001f88, 0x00001f0b, 0x00001f0d, 0x00001f0f, 0x00001f89, 0x00001f8a, 0x00001f8b,
+    0x00001f8c, 0x00001f8d, 0x00001f8e, 0x00001f8f, 0x00001f12, 0x00001f14, 0x00001f13, 0x00001f15,
+    0x00001f1a, 0x00001f1c, 0x00001f1b, 0x00001f1d, 0x00001f22, 0x00001f24, 0x00001f26, 0x00001f90,
+    0x00001f23, 0x00001f25, 0x00001f27, 0x00001f91, 0x00001f92, 0x00001f93, 0x00001f94, 0x00001f95,
+    0x00001f96, 0x00001f97, 0x00001f2a, 0x00001f2c, 0x00001f2e, 0x00001f98, 0x00001f2b, 0x00001f2d,
+    0x00001f2f, 0x00001f99, 0x00001f9a, 0x00001f9b, 0x00001f9c, 0x00001f9d, 0x00001f9e, 0x00001f9f,
+    0x00001f32, 0x00001f34, 0x00001f36, 0x00001f33, 0x00001f35, 0x00001f37, 0x00001f3a, 0x00001f3c,
+    0x00001f3e, 0x00001f3b, 0x00001f3d, 0x00001f3f, 0x00001f42, 0x00001f44, 0x00001f43, 0x00001f45,
+    0x00001f4a, 0x00001f4c, 0x00001f4b, 0x00001f4d, 0x00001f52, 0x00001f54, 0x00001f56, 0x00001f53,
+    0x00001f55, 0x00001f57, 0x00001f5b, 0x00001f5d, 0x00001f5f, 0x00001f62, 0x00001f64, 0x00001f66,
+    0x00001fa0, 0x00001f63, 0x00001f65, 0x00001f67, 0x00001fa1, 0x00001fa2, 0x00001fa3, 0x00001fa4,
+    0x00001fa5, 0x00001fa6, 0x00001fa7, 0x00001f6a, 0x00001f6c, 0x00001f6e, 0x00001fa8, 0x00001f6b,
+    0x00001f6d, 0x00001f6f, 0x00001fa9, 0x00001faa, 0x00001fab, 0x00001fac, 0x00001fad, 0x00001fae,
+    0x00001faf, 0x00001fb2, 0x00001fc2, 0x00001ff2, 0x00001fb7, 0x00001fcd, 0x00001fce, 0x00001fcf,
+    0x00001fc7, 0x00001ff7, 0x00001fdd, 0x00001fde, 0x00001fdf, 0x0000219a, 0x0000219b, 0x000021ae,
+    0x000021cd, 0x000021cf, 0x000021ce, 0x00002204, 0x00002209, 0x0000220c, 0x00002224, 0x00002226,
+    0x00002241, 0x00002244, 0x00002247, 0x00002249, 0x0000226d, 0x00002262, 0x00002270, 0x00002271,
+    0x00002274, 0x00002275, 0x00002278, 0x00002279, 0x00002280, 0x00002281, 0x000022e0, 0x000022e1,
+    0x00002284, 0x00002285, 0x00002288, 0x00002289, 0x000022e2, 0x000022e3, 0x000022ac, 0x000022ad,
+    0x000022ae, 0x000022af, 0x000022ea, 0x000022eb, 0x000022ec, 0x000022ed, 0x00003094, 0x0000304c,
+    0x0000304e, 0x00003050, 0x00003052, 0x00003054, 0x00003056, 0x00003058, 0x0000305a, 0x0000305c,
+    0x0000305e, 0x00003060, 0x00003062, 0x00003065, 0x00003067, 0x00003069, 0x00003070, 0x00003071,
+    0x00003073, 0x00003074, 0x00003076, 0x00003077, 0x00003079, 0x0000307a, 0x0000307c, 0x0000307d,
+    0x0000309e, 0x000030f4, 0x000030ac, 0x000030ae, 0x000030b0, 0x000030b2, 0x000030b4, 0x000030b6,
+    0x000030b8, 0x000030ba, 0x000030bc, 0x000030be, 0x000030c0, 0x000030c2, 0x000030c5, 0x000030c7,
+    0x000030c9, 0x000030d0, 0x000030d1, 0x000030d3, 0x000030d4, 0x000030d6, 0x000030d7, 0x000030d9,
+    0x000030da, 0x000030dc, 0x000030dd, 0x000030f7, 0x000030f8, 0x000030f9, 0x000030fa, 0x000030fe,
+    0x0001109a, 0x0001109c, 0x000110ab, 0x0001112e, 0x0001112f, 0x0001134b, 0x0001134c, 0x000114bc,
+    0x000114bb, 0x000114be, 0x000115ba, 0x000115bb, 0x00011938,
+};
+
+#endif
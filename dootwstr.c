@@ -0,0 +1,868 @@
+/*
+Generated by tools/genwide.py, do not edit by hand.
+Include it after dootstr.c to get a wchar_t instance of the library next to the char one. Every name gets a w in front: wstr_t,
+wsarr_t, wstr_newfrom(), wstr_append_c(), ... The error codes (str_err_t) are shared.
+*/
+
+#ifndef __DOOTWSTR_INC
+#define __DOOTWSTR_INC
+
+#include "dootstr.c"
+
+#pragma push_macro("__DOOTSTR_INC")
+#undef __DOOTSTR_INC
+#pragma push_macro("DOOTSTR_USE_WCHAR")
+#undef DOOTSTR_USE_WCHAR
+#pragma push_macro("DOOTSTR_USE_UTF8")
+#undef DOOTSTR_USE_UTF8
+#pragma push_macro("STR_CALLER")
+#undef STR_CALLER
+#pragma push_macro("STR_EMPTY")
+#undef STR_EMPTY
+#pragma push_macro("STR_SLICE_ERROR")
+#undef STR_SLICE_ERROR
+#pragma push_macro("STR_STAT_ALLOC")
+#undef STR_STAT_ALLOC
+#pragma push_macro("STR_STAT_COPY")
+#undef STR_STAT_COPY
+#pragma push_macro("STR_STAT_FREE")
+#undef STR_STAT_FREE
+#pragma push_macro("STR_STAT_REALLOC")
+#undef STR_STAT_REALLOC
+#pragma push_macro("STR_UTF8_ASSERT")
+#undef STR_UTF8_ASSERT
+#pragma push_macro("STR_UTF8_CHECK")
+#undef STR_UTF8_CHECK
+#pragma push_macro("__str_u16towide")
+#undef __str_u16towide
+#pragma push_macro("__str_u8towide")
+#undef __str_u8towide
+#pragma push_macro("__str_widecopy")
+#undef __str_widecopy
+#pragma push_macro("__str_widetou16")
+#undef __str_widetou16
+#pragma push_macro("__str_widetou8")
+#undef __str_widetou8
+#pragma push_macro("_strdup")
+#undef _strdup
+#pragma push_macro("_strlen")
+#undef _strlen
+#pragma push_macro("_strpbrk")
+#undef _strpbrk
+#pragma push_macro("_strstr")
+#undef _strstr
+#pragma push_macro("str_realloc")
+#undef str_realloc
+#define DOOTSTR_USE_WCHAR
+
+#define __str_advance __wstr_advance
+#define __str_appendnfrom __wstr_appendnfrom
+#define __str_asciicase __wstr_asciicase
+#define __str_asciicasevec __wstr_asciicasevec
+#define __str_bcopy __wstr_bcopy
+#define __str_bjoin __wstr_bjoin
+#define __str_blockalloc __wstr_blockalloc
+#define __str_blockfree __wstr_blockfree
+#define __str_blockrealloc __wstr_blockrealloc
+#define __str_boundIndex __wstr_boundIndex
+#define __str_bpush __wstr_bpush
+#define __str_cache __wstr_cache
+#define __str_cacheexit __wstr_cacheexit
+#define __str_cachekey __wstr_cachekey
+#define __str_cachekeyinit __wstr_cachekeyinit
+#define __str_cacheonce __wstr_cacheonce
+#define __str_casecmpn __wstr_casecmpn
+#define __str_casedecode __wstr_casedecode
+#define __str_casemap __wstr_casemap
+#define __str_casemapat __wstr_casemapat
+#define __str_casetransform __wstr_casetransform
+#define __str_checkhdr __wstr_checkhdr
+#define __str_checktable __wstr_checktable
+#define __str_compact __wstr_compact
+#define __str_compose __wstr_compose
+#define __str_copytask __wstr_copytask
+#define __str_countSplits __wstr_countSplits
+#define __str_counttask __wstr_counttask
+#define __str_cpdecode __wstr_cpdecode
+#define __str_cpencode __wstr_cpencode
+#define __str_cpindexextend __wstr_cpindexextend
+#define __str_cpunits __wstr_cpunits
+#define __str_csvpush __wstr_csvpush
+#define __str_decompose __wstr_decompose
+#define __str_dfind __wstr_dfind
+#define __str_digitpairs __wstr_digitpairs
+#define __str_dropblock __wstr_dropblock
+#define __str_editcmp __wstr_editcmp
+#define __str_eisellemire __wstr_eisellemire
+#define __str_fdscan __wstr_fdscan
+#define __str_fdsetindex __wstr_fdsetindex
+#define __str_findany3 __wstr_findany3
+#define __str_findtask __wstr_findtask
+#define __str_fmtbrace __wstr_fmtbrace
+#define __str_fmtdigits __wstr_fmtdigits
+#define __str_fmtdouble __wstr_fmtdouble
+#define __str_fmtdoublespec __wstr_fmtdoublespec
+#define __str_fmtfetch __wstr_fmtfetch
+#define __str_fmtfill __wstr_fmtfill
+#define __str_fmtintlayout __wstr_fmtintlayout
+#define __str_fmtisalign __wstr_fmtisalign
+#define __str_fmtlit __wstr_fmtlit
+#define __str_fmtmeasure __wstr_fmtmeasure
+#define __str_fmtndigits __wstr_fmtndigits
+#define __str_fmtnum __wstr_fmtnum
+#define __str_fmtparse __wstr_fmtparse
+#define __str_fmtprintf __wstr_fmtprintf
+#define __str_fmtpush __wstr_fmtpush
+#define __str_fmttype __wstr_fmttype
+#define __str_fmtwrite __wstr_fmtwrite
+#define __str_gathervec __wstr_gathervec
+#define __str_indextask __wstr_indextask
+#define __str_insertview __wstr_insertview
+#define __str_iscased __wstr_iscased
+#define __str_iseightdigits __wstr_iseightdigits
+#define __str_loadfail __wstr_loadfail
+#define __str_lspace __wstr_lspace
+#define __str_memanchor __wstr_memanchor
+#define __str_memfind __wstr_memfind
+#define __str_mergematches __wstr_mergematches
+#define __str_mulshift64 __wstr_mulshift64
+#define __str_mutate __wstr_mutate
+#define __str_newview __wstr_newview
+#define __str_normalize __wstr_normalize
+#define __str_normprops __wstr_normprops
+#define __str_normquick __wstr_normquick
+#define __str_normsafe __wstr_normsafe
+#define __str_parallel __wstr_parallel
+#define __str_parsedouble __wstr_parsedouble
+#define __str_parseeightdigits __wstr_parseeightdigits
+#define __str_parsei64 __wstr_parsei64
+#define __str_parseu64 __wstr_parseu64
+#define __str_pool __wstr_pool
+#define __str_poolclass __wstr_poolclass
+#define __str_poolmove __wstr_poolmove
+#define __str_poolonce __wstr_poolonce
+#define __str_poolsize __wstr_poolsize
+#define __str_poolstart __wstr_poolstart
+#define __str_poolworker __wstr_poolworker
+#define __str_pow5factor __wstr_pow5factor
+#define __str_prefixmask __wstr_prefixmask
+#define __str_readall __wstr_readall
+#define __str_readerassign __wstr_readerassign
+#define __str_readerfill __wstr_readerfill
+#define __str_readernext __wstr_readernext
+#define __str_reallocfrom __wstr_reallocfrom
+#define __str_reservefrom __wstr_reservefrom
+#define __str_reverse __wstr_reverse
+#define __str_revvec __wstr_revvec
+#define __str_rspace __wstr_rspace
+#define __str_ryu __wstr_ryu
+#define __str_savestrs __wstr_savestrs
+#define __str_scandigits __wstr_scandigits
+#define __str_scaninit __wstr_scaninit
+#define __str_scanrange __wstr_scanrange
+#define __str_shared __wstr_shared
+#define __str_sharedlock __wstr_sharedlock
+#define __str_slicecopy __wstr_slicecopy
+#define __str_startsword __wstr_startsword
+#define __str_statfn __wstr_statfn
+#define __str_statrecord __wstr_statrecord
+#define __str_stats __wstr_stats
+#define __str_strtodfallback __wstr_strtodfallback
+#define __str_sumbytes __wstr_sumbytes
+#define __str_sumfeed __wstr_sumfeed
+#define __str_u16to16 __wstr_u16to16
+#define __str_u16to32 __wstr_u16to32
+#define __str_u16to8 __wstr_u16to8
+#define __str_u32to16 __wstr_u32to16
+#define __str_u32to32 __wstr_u32to32
+#define __str_u32to8 __wstr_u32to8
+#define __str_u64len __wstr_u64len
+#define __str_u8all __wstr_u8all
+#define __str_u8blockerrors __wstr_u8blockerrors
+#define __str_u8class __wstr_u8class
+#define __str_u8count __wstr_u8count
+#define __str_u8encode __wstr_u8encode
+#define __str_u8length __wstr_u8length
+#define __str_u8next __wstr_u8next
+#define __str_u8offset __wstr_u8offset
+#define __str_u8scalarcheck __wstr_u8scalarcheck
+#define __str_u8skip __wstr_u8skip
+#define __str_u8to16 __wstr_u8to16
+#define __str_u8to32 __wstr_u8to32
+#define __str_u8to8 __wstr_u8to8
+#define __str_u8valid __wstr_u8valid
+#define __str_u8validssse3 __wstr_u8validssse3
+#define __str_unmap __wstr_unmap
+#define __str_viewall __wstr_viewall
+#define __str_viewanchor __wstr_viewanchor
+#define __str_viewhas __wstr_viewhas
+#define __str_viewoffset __wstr_viewoffset
+#define __str_writedouble __wstr_writedouble
+#define __str_writestrs __wstr_writestrs
+#define __str_writeu64 __wstr_writeu64
+#define __str_writevall __wstr_writevall
+#define dchar_t wdchar_t
+#define dootview wdootview
+#define dootview_t wdootview_t
+#define sarr wsarr
+#define sarr_t wsarr_t
+#define str wstr
+#define str_afree wstr_afree
+#define str_afrom wstr_afrom
+#define str_aload wstr_aload
+#define str_append wstr_append
+#define str_append_c wstr_append_c
+#define str_append_c_unchecked wstr_append_c_unchecked
+#define str_append_double wstr_append_double
+#define str_append_hex wstr_append_hex
+#define str_append_i64 wstr_append_i64
+#define str_append_u64 wstr_append_u64
+#define str_append_unchecked wstr_append_unchecked
+#define str_append_v wstr_append_v
+#define str_appendn_unchecked wstr_appendn_unchecked
+#define str_asave wstr_asave
+#define str_assign wstr_assign
+#define str_assignSlice wstr_assignSlice
+#define str_assign_c wstr_assign_c
+#define str_assign_v wstr_assign_v
+#define str_assignu16 wstr_assignu16
+#define str_assignu8 wstr_assignu8
+#define str_assignwcs wstr_assignwcs
+#define str_asteal wstr_asteal
+#define str_at wstr_at
+#define str_at_unchecked wstr_at_unchecked
+#define str_awrite wstr_awrite
+#define str_bappend wstr_bappend
+#define str_bappend_c wstr_bappend_c
+#define str_bappendn wstr_bappendn
+#define str_bappendto wstr_bappendto
+#define str_bborrow wstr_bborrow
+#define str_bborrow_c wstr_bborrow_c
+#define str_bborrown wstr_bborrown
+#define str_bbuild wstr_bbuild
+#define str_bclear wstr_bclear
+#define str_bfree wstr_bfree
+#define str_bnew wstr_bnew
+#define str_builder_t wstr_builder_t
+#define str_bwrite wstr_bwrite
+#define str_casecmp wstr_casecmp
+#define str_casecmp_v wstr_casecmp_v
+#define str_casefold wstr_casefold
+#define str_casehash wstr_casehash
+#define str_clear wstr_clear
+#define str_cmp_v wstr_cmp_v
+#define str_concat wstr_concat
+#define str_consume wstr_consume
+#define str_containsAny wstr_containsAny
+#define str_containsAny_v wstr_containsAny_v
+#define str_containsOnly wstr_containsOnly
+#define str_containsOnly_v wstr_containsOnly_v
+#define str_containsSeq wstr_containsSeq
+#define str_containsSeq_v wstr_containsSeq_v
+#define str_count wstr_count
+#define str_countAny wstr_countAny
+#define str_countAny_v wstr_countAny_v
+#define str_count_mt wstr_count_mt
+#define str_count_unchecked wstr_count_unchecked
+#define str_count_v wstr_count_v
+#define str_csv_t wstr_csv_t
+#define str_csvfree wstr_csvfree
+#define str_csvnew wstr_csvnew
+#define str_csvnewn wstr_csvnewn
+#define str_csvnext wstr_csvnext
+#define str_cut wstr_cut
+#define str_cut_unchecked wstr_cut_unchecked
+#define str_destroy wstr_destroy
+#define str_editdelete wstr_editdelete
+#define str_editinsert wstr_editinsert
+#define str_editinsert_v wstr_editinsert_v
+#define str_editreplace wstr_editreplace
+#define str_editreplace_v wstr_editreplace_v
+#define str_edits_t wstr_edits_t
+#define str_editsapply wstr_editsapply
+#define str_editsclear wstr_editsclear
+#define str_editsfree wstr_editsfree
+#define str_editsnew wstr_editsnew
+#define str_fdcount wstr_fdcount
+#define str_fdfindall wstr_fdfindall
+#define str_fdindex wstr_fdindex
+#define str_fmt_t wstr_fmt_t
+#define str_fmtfree wstr_fmtfree
+#define str_fmtnew wstr_fmtnew
+#define str_fnstats_t wstr_fnstats_t
+#define str_format wstr_format
+#define str_formatSpec wstr_formatSpec
+#define str_free wstr_free
+#define str_index wstr_index
+#define str_index_mt wstr_index_mt
+#define str_index_unchecked wstr_index_unchecked
+#define str_index_v wstr_index_v
+#define str_insert wstr_insert
+#define str_insert_c wstr_insert_c
+#define str_insert_c_unchecked wstr_insert_c_unchecked
+#define str_insert_v wstr_insert_v
+#define str_insertn_unchecked wstr_insertn_unchecked
+#define str_isalnum wstr_isalnum
+#define str_isalnum_v wstr_isalnum_v
+#define str_isalpha wstr_isalpha
+#define str_isalpha_v wstr_isalpha_v
+#define str_isdigit wstr_isdigit
+#define str_isdigit_v wstr_isdigit_v
+#define str_isempty wstr_isempty
+#define str_islower wstr_islower
+#define str_islower_v wstr_islower_v
+#define str_isspace wstr_isspace
+#define str_isspace_v wstr_isspace_v
+#define str_isupper wstr_isupper
+#define str_isupper_v wstr_isupper_v
+#define str_isutf8 wstr_isutf8
+#define str_load wstr_load
+#define str_lower wstr_lower
+#define str_lstrip wstr_lstrip
+#define str_mapfile wstr_mapfile
+#define str_new wstr_new
+#define str_newfrom wstr_newfrom
+#define str_newslice wstr_newslice
+#define str_normalize_nfc wstr_normalize_nfc
+#define str_normalize_nfd wstr_normalize_nfd
+#define str_partition wstr_partition
+#define str_partition_v wstr_partition_v
+#define str_poolflush wstr_poolflush
+#define str_reader_t wstr_reader_t
+#define str_readerfree wstr_readerfree
+#define str_readernew wstr_readernew
+#define str_readline wstr_readline
+#define str_readline_v wstr_readline_v
+#define str_readuntil wstr_readuntil
+#define str_readuntil_v wstr_readuntil_v
+#define str_realloc wstr_realloc
+#define str_remove wstr_remove
+#define str_removeAny wstr_removeAny
+#define str_replace wstr_replace
+#define str_replaceAny wstr_replaceAny
+#define str_replaceAnyCh wstr_replaceAnyCh
+#define str_replace_mt wstr_replace_mt
+#define str_reverse wstr_reverse
+#define str_rindex wstr_rindex
+#define str_rindex_v wstr_rindex_v
+#define str_rpartition wstr_rpartition
+#define str_rpartition_v wstr_rpartition_v
+#define str_rstrip wstr_rstrip
+#define str_save wstr_save
+#define str_split wstr_split
+#define str_stats wstr_stats
+#define str_stats_t wstr_stats_t
+#define str_statsprint wstr_statsprint
+#define str_statsreset wstr_statsreset
+#define str_steal wstr_steal
+#define str_strip wstr_strip
+#define str_subview wstr_subview
+#define str_swapcase wstr_swapcase
+#define str_t wstr_t
+#define str_table_t wstr_table_t
+#define str_tablefree wstr_tablefree
+#define str_tableget wstr_tableget
+#define str_tablemap wstr_tablemap
+#define str_tableread wstr_tableread
+#define str_tod wstr_tod
+#define str_tod_at wstr_tod_at
+#define str_tod_v wstr_tod_v
+#define str_toi64 wstr_toi64
+#define str_toi64_at wstr_toi64_at
+#define str_toi64_v wstr_toi64_v
+#define str_tou16 wstr_tou16
+#define str_tou64 wstr_tou64
+#define str_tou64_at wstr_tou64_at
+#define str_tou64_v wstr_tou64_v
+#define str_tou8 wstr_tou8
+#define str_towcs wstr_towcs
+#define str_u16tou8 wstr_u16tou8
+#define str_u8assignSlice wstr_u8assignSlice
+#define str_u8at wstr_u8at
+#define str_u8check wstr_u8check
+#define str_u8dropindex wstr_u8dropindex
+#define str_u8index wstr_u8index
+#define str_u8len wstr_u8len
+#define str_u8newslice wstr_u8newslice
+#define str_u8offset wstr_u8offset
+#define str_u8substr wstr_u8substr
+#define str_u8tou16 wstr_u8tou16
+#define str_upper wstr_upper
+#define str_vformat wstr_vformat
+#define str_vformatSpec wstr_vformatSpec
+#define str_view wstr_view
+#define str_view_c wstr_view_c
+#define str_view_t wstr_view_t
+#define str_viewn wstr_viewn
+#define str_write wstr_write
+#define str_writemany wstr_writemany
+#define strbuilder wstrbuilder
+#define strcache wstrcache
+#define strcache_t wstrcache_t
+#define strchunk wstrchunk
+#define strchunk_t wstrchunk_t
+#define strcpindex wstrcpindex
+#define strcpindex_t wstrcpindex_t
+#define strcsv wstrcsv
+#define strdecimal wstrdecimal
+#define strdecimal_t wstrdecimal_t
+#define stredit wstredit
+#define stredit_t wstredit_t
+#define stredits wstredits
+#define strfilehdr wstrfilehdr
+#define strfilehdr_t wstrfilehdr_t
+#define strfmt wstrfmt
+#define strfmtarg wstrfmtarg
+#define strfmtarg_t wstrfmtarg_t
+#define strfmtint wstrfmtint
+#define strfmtint_t wstrfmtint_t
+#define strfmtop wstrfmtop
+#define strfmtop_t wstrfmtop_t
+#define strfmtval wstrfmtval
+#define strfmtval_t wstrfmtval_t
+#define strfnstats wstrfnstats
+#define strfreelist wstrfreelist
+#define strfreelist_t wstrfreelist_t
+#define strpiece wstrpiece
+#define strpiece_t wstrpiece_t
+#define strpool wstrpool
+#define strpool_t wstrpool_t
+#define strreader wstrreader
+#define strscan wstrscan
+#define strscan_t wstrscan_t
+#define strstats wstrstats
+#define strsum wstrsum
+#define strsum_t wstrsum_t
+#define strtable wstrtable
+#define strview wstrview
+#define strwunit_t wstrwunit_t
+
+#include "dootstr.c"
+
+#undef __str_advance
+#undef __str_appendnfrom
+#undef __str_asciicase
+#undef __str_asciicasevec
+#undef __str_bcopy
+#undef __str_bjoin
+#undef __str_blockalloc
+#undef __str_blockfree
+#undef __str_blockrealloc
+#undef __str_boundIndex
+#undef __str_bpush
+#undef __str_cache
+#undef __str_cacheexit
+#undef __str_cachekey
+#undef __str_cachekeyinit
+#undef __str_cacheonce
+#undef __str_casecmpn
+#undef __str_casedecode
+#undef __str_casemap
+#undef __str_casemapat
+#undef __str_casetransform
+#undef __str_checkhdr
+#undef __str_checktable
+#undef __str_compact
+#undef __str_compose
+#undef __str_copytask
+#undef __str_countSplits
+#undef __str_counttask
+#undef __str_cpdecode
+#undef __str_cpencode
+#undef __str_cpindexextend
+#undef __str_cpunits
+#undef __str_csvpush
+#undef __str_decompose
+#undef __str_dfind
+#undef __str_digitpairs
+#undef __str_dropblock
+#undef __str_editcmp
+#undef __str_eisellemire
+#undef __str_fdscan
+#undef __str_fdsetindex
+#undef __str_findany3
+#undef __str_findtask
+#undef __str_fmtbrace
+#undef __str_fmtdigits
+#undef __str_fmtdouble
+#undef __str_fmtdoublespec
+#undef __str_fmtfetch
+#undef __str_fmtfill
+#undef __str_fmtintlayout
+#undef __str_fmtisalign
+#undef __str_fmtlit
+#undef __str_fmtmeasure
+#undef __str_fmtndigits
+#undef __str_fmtnum
+#undef __str_fmtparse
+#undef __str_fmtprintf
+#undef __str_fmtpush
+#undef __str_fmttype
+#undef __str_fmtwrite
+#undef __str_gathervec
+#undef __str_indextask
+#undef __str_insertview
+#undef __str_iscased
+#undef __str_iseightdigits
+#undef __str_loadfail
+#undef __str_lspace
+#undef __str_memanchor
+#undef __str_memfind
+#undef __str_mergematches
+#undef __str_mulshift64
+#undef __str_mutate
+#undef __str_newview
+#undef __str_normalize
+#undef __str_normprops
+#undef __str_normquick
+#undef __str_normsafe
+#undef __str_parallel
+#undef __str_parsedouble
+#undef __str_parseeightdigits
+#undef __str_parsei64
+#undef __str_parseu64
+#undef __str_pool
+#undef __str_poolclass
+#undef __str_poolmove
+#undef __str_poolonce
+#undef __str_poolsize
+#undef __str_poolstart
+#undef __str_poolworker
+#undef __str_pow5factor
+#undef __str_prefixmask
+#undef __str_readall
+#undef __str_readerassign
+#undef __str_readerfill
+#undef __str_readernext
+#undef __str_reallocfrom
+#undef __str_reservefrom
+#undef __str_reverse
+#undef __str_revvec
+#undef __str_rspace
+#undef __str_ryu
+#undef __str_savestrs
+#undef __str_scandigits
+#undef __str_scaninit
+#undef __str_scanrange
+#undef __str_shared
+#undef __str_sharedlock
+#undef __str_slicecopy
+#undef __str_startsword
+#undef __str_statfn
+#undef __str_statrecord
+#undef __str_stats
+#undef __str_strtodfallback
+#undef __str_sumbytes
+#undef __str_sumfeed
+#undef __str_u16to16
+#undef __str_u16to32
+#undef __str_u16to8
+#undef __str_u32to16
+#undef __str_u32to32
+#undef __str_u32to8
+#undef __str_u64len
+#undef __str_u8all
+#undef __str_u8blockerrors
+#undef __str_u8class
+#undef __str_u8count
+#undef __str_u8encode
+#undef __str_u8length
+#undef __str_u8next
+#undef __str_u8offset
+#undef __str_u8scalarcheck
+#undef __str_u8skip
+#undef __str_u8to16
+#undef __str_u8to32
+#undef __str_u8to8
+#undef __str_u8valid
+#undef __str_u8validssse3
+#undef __str_unmap
+#undef __str_viewall
+#undef __str_viewanchor
+#undef __str_viewhas
+#undef __str_viewoffset
+#undef __str_writedouble
+#undef __str_writestrs
+#undef __str_writeu64
+#undef __str_writevall
+#undef dchar_t
+#undef dootview
+#undef dootview_t
+#undef sarr
+#undef sarr_t
+#undef str
+#undef str_afree
+#undef str_afrom
+#undef str_aload
+#undef str_append
+#undef str_append_c
+#undef str_append_c_unchecked
+#undef str_append_double
+#undef str_append_hex
+#undef str_append_i64
+#undef str_append_u64
+#undef str_append_unchecked
+#undef str_append_v
+#undef str_appendn_unchecked
+#undef str_asave
+#undef str_assign
+#undef str_assignSlice
+#undef str_assign_c
+#undef str_assign_v
+#undef str_assignu16
+#undef str_assignu8
+#undef str_assignwcs
+#undef str_asteal
+#undef str_at
+#undef str_at_unchecked
+#undef str_awrite
+#undef str_bappend
+#undef str_bappend_c
+#undef str_bappendn
+#undef str_bappendto
+#undef str_bborrow
+#undef str_bborrow_c
+#undef str_bborrown
+#undef str_bbuild
+#undef str_bclear
+#undef str_bfree
+#undef str_bnew
+#undef str_builder_t
+#undef str_bwrite
+#undef str_casecmp
+#undef str_casecmp_v
+#undef str_casefold
+#undef str_casehash
+#undef str_clear
+#undef str_cmp_v
+#undef str_concat
+#undef str_consume
+#undef str_containsAny
+#undef str_containsAny_v
+#undef str_containsOnly
+#undef str_containsOnly_v
+#undef str_containsSeq
+#undef str_containsSeq_v
+#undef str_count
+#undef str_countAny
+#undef str_countAny_v
+#undef str_count_mt
+#undef str_count_unchecked
+#undef str_count_v
+#undef str_csv_t
+#undef str_csvfree
+#undef str_csvnew
+#undef str_csvnewn
+#undef str_csvnext
+#undef str_cut
+#undef str_cut_unchecked
+#undef str_destroy
+#undef str_editdelete
+#undef str_editinsert
+#undef str_editinsert_v
+#undef str_editreplace
+#undef str_editreplace_v
+#undef str_edits_t
+#undef str_editsapply
+#undef str_editsclear
+#undef str_editsfree
+#undef str_editsnew
+#undef str_fdcount
+#undef str_fdfindall
+#undef str_fdindex
+#undef str_fmt_t
+#undef str_fmtfree
+#undef str_fmtnew
+#undef str_fnstats_t
+#undef str_format
+#undef str_formatSpec
+#undef str_free
+#undef str_index
+#undef str_index_mt
+#undef str_index_unchecked
+#undef str_index_v
+#undef str_insert
+#undef str_insert_c
+#undef str_insert_c_unchecked
+#undef str_insert_v
+#undef str_insertn_unchecked
+#undef str_isalnum
+#undef str_isalnum_v
+#undef str_isalpha
+#undef str_isalpha_v
+#undef str_isdigit
+#undef str_isdigit_v
+#undef str_isempty
+#undef str_islower
+#undef str_islower_v
+#undef str_isspace
+#undef str_isspace_v
+#undef str_isupper
+#undef str_isupper_v
+#undef str_isutf8
+#undef str_load
+#undef str_lower
+#undef str_lstrip
+#undef str_mapfile
+#undef str_new
+#undef str_newfrom
+#undef str_newslice
+#undef str_normalize_nfc
+#undef str_normalize_nfd
+#undef str_partition
+#undef str_partition_v
+#undef str_poolflush
+#undef str_reader_t
+#undef str_readerfree
+#undef str_readernew
+#undef str_readline
+#undef str_readline_v
+#undef str_readuntil
+#undef str_readuntil_v
+#undef str_realloc
+#undef str_remove
+#undef str_removeAny
+#undef str_replace
+#undef str_replaceAny
+#undef str_replaceAnyCh
+#undef str_replace_mt
+#undef str_reverse
+#undef str_rindex
+#undef str_rindex_v
+#undef str_rpartition
+#undef str_rpartition_v
+#undef str_rstrip
+#undef str_save
+#undef str_split
+#undef str_stats
+#undef str_stats_t
+#undef str_statsprint
+#undef str_statsreset
+#undef str_steal
+#undef str_strip
+#undef str_subview
+#undef str_swapcase
+#undef str_t
+#undef str_table_t
+#undef str_tablefree
+#undef str_tableget
+#undef str_tablemap
+#undef str_tableread
+#undef str_tod
+#undef str_tod_at
+#undef str_tod_v
+#undef str_toi64
+#undef str_toi64_at
+#undef str_toi64_v
+#undef str_tou16
+#undef str_tou64
+#undef str_tou64_at
+#undef str_tou64_v
+#undef str_tou8
+#undef str_towcs
+#undef str_u16tou8
+#undef str_u8assignSlice
+#undef str_u8at
+#undef str_u8check
+#undef str_u8dropindex
+#undef str_u8index
+#undef str_u8len
+#undef str_u8newslice
+#undef str_u8offset
+#undef str_u8substr
+#undef str_u8tou16
+#undef str_upper
+#undef str_vformat
+#undef str_vformatSpec
+#undef str_view
+#undef str_view_c
+#undef str_view_t
+#undef str_viewn
+#undef str_write
+#undef str_writemany
+#undef strbuilder
+#undef strcache
+#undef strcache_t
+#undef strchunk
+#undef strchunk_t
+#undef strcpindex
+#undef strcpindex_t
+#undef strcsv
+#undef strdecimal
+#undef strdecimal_t
+#undef stredit
+#undef stredit_t
+#undef stredits
+#undef strfilehdr
+#undef strfilehdr_t
+#undef strfmt
+#undef strfmtarg
+#undef strfmtarg_t
+#undef strfmtint
+#undef strfmtint_t
+#undef strfmtop
+#undef strfmtop_t
+#undef strfmtval
+#undef strfmtval_t
+#undef strfnstats
+#undef strfreelist
+#undef strfreelist_t
+#undef strpiece
+#undef strpiece_t
+#undef strpool
+#undef strpool_t
+#undef strreader
+#undef strscan
+#undef strscan_t
+#undef strstats
+#undef strsum
+#undef strsum_t
+#undef strtable
+#undef strview
+#undef strwunit_t
+#undef str_realloc
+#pragma pop_macro("str_realloc")
+#undef _strstr
+#pragma pop_macro("_strstr")
+#undef _strpbrk
+#pragma pop_macro("_strpbrk")
+#undef _strlen
+#pragma pop_macro("_strlen")
+#undef _strdup
+#pragma pop_macro("_strdup")
+#undef __str_widetou8
+#pragma pop_macro("__str_widetou8")
+#undef __str_widetou16
+#pragma pop_macro("__str_widetou16")
+#undef __str_widecopy
+#pragma pop_macro("__str_widecopy")
+#undef __str_u8towide
+#pragma pop_macro("__str_u8towide")
+#undef __str_u16towide
+#pragma pop_macro("__str_u16towide")
+#undef STR_UTF8_CHECK
+#pragma pop_macro("STR_UTF8_CHECK")
+#undef STR_UTF8_ASSERT
+#pragma pop_macro("STR_UTF8_ASSERT")
+#undef STR_STAT_REALLOC
+#pragma pop_macro("STR_STAT_REALLOC")
+#undef STR_STAT_FREE
+#pragma pop_macro("STR_STAT_FREE")
+#undef STR_STAT_COPY
+#pragma pop_macro("STR_STAT_COPY")
+#undef STR_STAT_ALLOC
+#pragma pop_macro("STR_STAT_ALLOC")
+#undef STR_SLICE_ERROR
+#pragma pop_macro("STR_SLICE_ERROR")
+#undef STR_EMPTY
+#pragma pop_macro("STR_EMPTY")
+#undef STR_CALLER
+#pragma pop_macro("STR_CALLER")
+#undef DOOTSTR_USE_UTF8
+#pragma pop_macro("DOOTSTR_USE_UTF8")
+#undef DOOTSTR_USE_WCHAR
+#pragma pop_macro("DOOTSTR_USE_WCHAR")
+#undef __DOOTSTR_INC
+#pragma pop_macro("__DOOTSTR_INC")
+
+#endif
@@ -0,0 +1,1241 @@
+/*
+Checks of the dootstr functions, one function per feature. Build and run every configuration with "make test", a failed check prints its
+line and the exit code is 1. Unlike main.c this isn't a demo, keep it quiet when everything passes.
+*/
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include <float.h>
+
+#include "dootstr.c"
+#ifndef DOOTSTR_USE_WCHAR
+#include "dootwstr.c" // The wide instance is built next to the narrow one
+#endif
+
+#ifdef DOOTSTR_USE_WCHAR
+#define L_(s) L##s
+#define B_STRCMP wcscmp
+#define WIDTH "wchar"
+#elif defined(DOOTSTR_USE_UTF8)
+#define L_(s) s
+#define B_STRCMP strcmp
+#define WIDTH "utf8"
+#else
+#define L_(s) s
+#define B_STRCMP strcmp
+#define WIDTH "char"
+#endif
+
+int failed = 0;
+
+#define CHECK(cond) \
+    do \
+    { \
+        if (!(cond)) \
+        { \
+            fprintf(stderr, "%s: %s:%d: CHECK failed: %s\n", WIDTH, __FILE__, __LINE__, #cond); \
+            failed++; \
+        } \
+    } while (0)
+
+#define CHECK_STR(ps, lit) CHECK(B_STRCMP((ps)->pstr, L_(lit)) == 0 && (ps)->strlen == sizeof(L_(lit)) / sizeof(dchar_t) - 1)
+#define CHECK_VIEW(view, lit) CHECK((view).strlen == sizeof(L_(lit)) / sizeof(dchar_t) - 1 && memcmp((view).pstr, L_(lit), (view).strlen * sizeof(dchar_t)) == 0)
+
+#pragma region BUILDER
+void test_builder(void)
+{
+    str_builder_t *pb = str_bnew();
+    dchar_t scratch[8] = L_("tmp");
+    str_t *world = str_newfrom(L_("world"));
+    str_bborrow_c(pb, L_("hello "));
+    str_bborrow(pb, world);
+    str_bappend_c(pb, scratch); // Copied, changing scratch afterwards doesn't matter
+    str_bappendn(pb, L_("abcdef"), 3);
+    scratch[0] = 'X';
+    for (int i = 0; i < 5000; i++) // More than one chunk of owned copies
+    {
+        str_bappend_c(pb, L_("z"));
+    }
+    str_t *s = str_bbuild(pb);
+    CHECK(s->strlen == 6 + 5 + 3 + 3 + 5000 && s->capacity >= s->strlen + 1 && s->pstr[s->strlen] == '\0');
+    CHECK(memcmp(s->pstr, L_("hello worldtmpabczz"), 19 * sizeof(dchar_t)) == 0 && s->pstr[s->strlen - 1] == 'z');
+    str_t *t = str_newfrom(L_("pre:"));
+    str_bappendto(pb, t);
+    CHECK(t->strlen == 4 + s->strlen && memcmp(t->pstr + 4, s->pstr, (s->strlen + 1) * sizeof(dchar_t)) == 0);
+
+    FILE *f = tmpfile();
+    CHECK(str_bwrite(pb, fileno(f)) == s->strlen * sizeof(dchar_t));
+    str_bclear(pb);
+    CHECK(pb->strlen == 0 && pb->count == 0);
+    dchar_t ab[2] = { 'a', 'b' };
+    for (int i = 0; i < 3000; i++) // More pieces than writev() takes at once, none of them adjacent
+    {
+        str_bborrown(pb, ab + (i & 1), 1);
+        str_bborrown(pb, L_("-"), 1);
+    }
+    CHECK(pb->strlen == 6000);
+    rewind(f);
+    CHECK(ftruncate(fileno(f), 0) == 0);
+    CHECK(str_bwrite(pb, fileno(f)) == 6000 * sizeof(dchar_t));
+    fclose(f);
+    str_bfree(&pb);
+    CHECK(pb == NULL);
+    str_free(&s);
+    str_free(&t);
+    str_free(&world);
+}
+#pragma endregion
+
+#pragma region CSV
+void test_csv(void)
+{
+    str_t *in = str_newfrom(L_("a,b,c\n\"q,1\",\"he said \"\"hi\"\"\",x\r\n\"multi\nline\",,\"\"\r\nlast,\"tail\"junk\n\nz,"));
+    str_csv_t *pcsv = str_csvnew(in, ',');
+    CHECK(str_csvnext(pcsv) && pcsv->nfields == 3);
+    CHECK_VIEW(pcsv->fields[0], "a");
+    CHECK_VIEW(pcsv->fields[2], "c");
+    CHECK(pcsv->fields[0].pstr == in->pstr); // Not copied
+    CHECK(str_csvnext(pcsv) && pcsv->nfields == 3);
+    CHECK_VIEW(pcsv->fields[0], "q,1");
+    CHECK_VIEW(pcsv->fields[1], "he said \"hi\"");
+    CHECK_VIEW(pcsv->fields[2], "x");
+    CHECK(str_csvnext(pcsv) && pcsv->nfields == 3);
+    CHECK_VIEW(pcsv->fields[0], "multi\nline");
+    CHECK(pcsv->fields[1].strlen == 0 && pcsv->fields[2].strlen == 0);
+    CHECK(str_csvnext(pcsv) && pcsv->nfields == 2);
+    CHECK_VIEW(pcsv->fields[1], "tailjunk");
+    CHECK(str_csvnext(pcsv) && pcsv->nfields == 1 && pcsv->fields[0].strlen == 0);
+    CHECK(str_csvnext(pcsv) && pcsv->nfields == 2);
+    CHECK_VIEW(pcsv->fields[0], "z");
+    CHECK(!str_csvnext(pcsv));
+    str_csvfree(&pcsv);
+    CHECK(pcsv == NULL);
+
+    str_t *tsv = str_new(0);
+    for (int i = 0; i < 100; i++) // Long enough for the vectorized scan
+    {
+        str_append_c(tsv, L_("abcdefghijklmnopqrstuvwxyz\t\"x\"\"y\"\t"));
+    }
+    str_append_c(tsv, L_("end\n"));
+    pcsv = str_csvnew(tsv, '\t');
+    CHECK(str_csvnext(pcsv) && pcsv->nfields == 201);
+    CHECK_VIEW(pcsv->fields[198], "abcdefghijklmnopqrstuvwxyz");
+    CHECK_VIEW(pcsv->fields[199], "x\"y");
+    CHECK_VIEW(pcsv->fields[200], "end");
+    CHECK(!str_csvnext(pcsv));
+    str_csvfree(&pcsv);
+    str_free(&tsv);
+    str_free(&in);
+}
+#pragma endregion
+
+#pragma region FORMATTING
+/*@brief Formats into a fresh string and compares the result with want, an ASCII string, in every character width.*/
+int format_is(const char *want, const dchar_t *format, ...)
+{
+    str_t *s = str_new(0);
+    va_list ap;
+    va_start(ap, format);
+    size_t n = str_vformat(s, format, ap);
+    va_end(ap);
+    int same = n == s->strlen && s->strlen == strlen(want);
+    for (size_t i = 0; same && i < s->strlen; i++)
+    {
+        same = s->pstr[i] == (dchar_t)want[i];
+    }
+    if (!same)
+    {
+        fprintf(stderr, "%s: wanted \"%s\"\n", WIDTH, want);
+    }
+    str_free(&s);
+    return same;
+}
+
+void test_format(void)
+{
+    char want[256];
+    snprintf(want, sizeof(want), "%d|%5d|%-5d|%05d|%+d|% d|%.3d|%8.3d", 42, 42, 42, -42, 42, 42, 7, -7);
+    CHECK(format_is(want, L_("%d|%5d|%-5d|%05d|%+d|% d|%.3d|%8.3d"), 42, 42, 42, -42, 42, 42, 7, -7));
+    snprintf(want, sizeof(want), "%x|%X|%#x|%#o|%.0d|%u|%hhd|%lld|%zu", 255u, 255u, 255u, 8u, 0, 4000000000u, 300, -9223372036854775807LL - 1, (size_t)123);
+    CHECK(format_is(want, L_("%x|%X|%#x|%#o|%.0d|%u|%hhd|%lld|%zu"), 255u, 255u, 255u, 8u, 0, 4000000000u, 300, -9223372036854775807LL - 1, (size_t)123));
+    snprintf(want, sizeof(want), "%f|%.2f|%10.3e|%-10g|%+G|%#.0f|%010.2f|%a", 3.14159, 2.5, 12345.678, 0.0001, 1e100, 3.0, -3.14159, 1.0);
+    CHECK(format_is(want, L_("%f|%.2f|%10.3e|%-10g|%+G|%#.0f|%010.2f|%a"), 3.14159, 2.5, 12345.678, 0.0001, 1e100, 3.0, -3.14159, 1.0));
+    snprintf(want, sizeof(want), "%*d|%-*d|%.*f|%c%c|%5c|%%", 6, 1, 6, 1, 3, 2.0, 'a', 'b', 'x');
+    CHECK(format_is(want, L_("%*d|%-*d|%.*f|%c%c|%5c|%%"), 6, 1, 6, 1, 3, 2.0, 'a', 'b', 'x'));
+    char longwant[512]; // Longer than what a floating point conversion can be rendered into without allocating
+    snprintf(longwant, sizeof(longwant), "%f|%.60Le|%070.3f|%g", 1e300, 1.0L / 3, -2.5, 1e300);
+    CHECK(format_is(longwant, L_("%f|%.60Le|%070.3f|%g"), 1e300, 1.0L / 3, -2.5, 1e300));
+    CHECK(format_is("abc|        hi|hi   |", L_("%.3s|%10s|%-5s|"), L_("abcdef"), L_("hi"), L_("hi")));
+
+    str_t *x = str_newfrom(L_("strt"));
+    CHECK(format_is("[strt] strt      |      strt|   strt   |***strt***", L_("[{}] {:10}|{:>10}|{:^10}|{:*^10}"), x, x, x, x, x));
+    CHECK(format_is("42|   42|-0042|+42|0x2a|0b101|    1.50", L_("{:d}|{:5d}|{:05d}|{:+d}|{:#x}|{:#b}|{:8.2f}"), 42, 42, -42, 42, 42, 5, 1.5));
+    CHECK(format_is("{x} }{ {\"a\": 1}", L_("{{x}} }}{{ {\"a\": %d}"), 1));
+
+    str_fmt_t *pfmt = str_fmtnew(L_("[%s:%d] {}\n"));
+    str_t *s = str_newfrom(L_(">"));
+    for (int i = 0; i < 3; i++)
+    {
+        str_formatSpec(s, pfmt, L_("file.c"), i, x);
+    }
+    CHECK_STR(s, ">[file.c:0] strt\n[file.c:1] strt\n[file.c:2] strt\n");
+    str_fmtfree(&pfmt);
+    CHECK(pfmt == NULL);
+    str_assign_c(s, L_("ab"));
+    CHECK(str_format(s, L_("%0300d"), 1) == 300 && s->strlen == 302 && s->pstr[301] == '1');
+    str_free(&s);
+    str_free(&x);
+}
+#pragma endregion
+
+#pragma region PARSING
+/*@brief Parses an ASCII string with str_tod() and compares the result bit by bit with strtod().*/
+int tod_matches(const char *text)
+{
+    str_t *s = str_new(strlen(text) + 1);
+    for (size_t i = 0; text[i]; i++)
+    {
+        s->pstr[i] = (dchar_t)text[i];
+    }
+    s->strlen = strlen(text);
+    s->pstr[s->strlen] = '\0';
+    double d = 0.5, want = strtod(text, NULL);
+    str_err_t err = str_tod(s, &d);
+    str_free(&s);
+    return (err == STR_OK || err == STR_ERR_RANGE) && memcmp(&d, &want, sizeof(double)) == 0;
+}
+
+void test_parse(void)
+{
+    int64_t i64;
+    uint64_t u64;
+    double d;
+    size_t end;
+    str_t *s = str_newfrom(L_("-9223372036854775808"));
+    CHECK(str_toi64(s, &i64) == STR_OK && i64 == INT64_MIN);
+    str_assign_c(s, L_("9223372036854775808"));
+    CHECK(str_toi64(s, &i64) == STR_ERR_RANGE && i64 == INT64_MAX);
+    str_assign_c(s, L_("18446744073709551615"));
+    CHECK(str_tou64(s, &u64) == STR_OK && u64 == UINT64_MAX);
+    str_assign_c(s, L_("18446744073709551616"));
+    CHECK(str_tou64(s, &u64) == STR_ERR_RANGE);
+    str_assign_c(s, L_("12a"));
+    CHECK(str_toi64(s, &i64) == STR_ERR_SYNTAX);
+    CHECK(str_toi64_at(s, 0, &i64, &end) == STR_OK && i64 == 12 && end == 2);
+    str_assign_c(s, L_(""));
+    CHECK(str_toi64(s, &i64) == STR_ERR_EMPTY);
+    str_assign_c(s, L_("a=12345678901,b=-7"));
+    CHECK(str_toi64_at(s, 2, &i64, &end) == STR_OK && i64 == 12345678901LL && end == 13);
+    CHECK(str_toi64_at(s, 16, &i64, &end) == STR_OK && i64 == -7 && end == 18);
+    CHECK(str_toi64_at(s, 0, &i64, &end) == STR_ERR_SYNTAX && end == 0);
+    str_view_t view = { L_("1234567890123456xyz"), 16 };
+    CHECK(str_tou64_v(view, &u64) == STR_OK && u64 == 1234567890123456ULL);
+    str_assign_c(s, L_("1e"));
+    CHECK(str_tod(s, &d) == STR_ERR_SYNTAX);
+    CHECK(str_tod_at(s, 0, &d, &end) == STR_OK && d == 1.0 && end == 1);
+    str_assign_c(s, L_("-InFinity"));
+    CHECK(str_tod(s, &d) == STR_OK && isinf(d) && d < 0);
+    str_assign_c(s, L_("nan"));
+    CHECK(str_tod(s, &d) == STR_OK && isnan(d));
+    str_assign_c(s, L_("1e400"));
+    CHECK(str_tod(s, &d) == STR_ERR_RANGE && isinf(d));
+    str_free(&s);
+
+    const char *hard[] = { "0", "-0", "1.", ".5", "2.2250738585072011e-308", "4.9406564584124654e-324", "2.4703282292062327e-324",
+        "2.4703282292062328e-324", "1.7976931348623157e308", "1.7976931348623159e308", "9007199254740993", "123456789012345678901234567890",
+        "1.00000000000000011102230246251565404236316680908203125", "1.00000000000000011102230246251565404236316680908203124", "0.1", "1e23",
+        "6.9294956446009195e15", "4.35679845e-230" };
+    for (size_t i = 0; i < sizeof(hard) / sizeof(hard[0]); i++)
+    {
+        CHECK(tod_matches(hard[i]));
+    }
+    uint64_t state = 88172645463325252ull;
+    char text[64];
+    for (int i = 0; i < 20000; i++) // Random mantissas and exponents, all of them have to be correctly rounded
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        snprintf(text, sizeof(text), "%llue%d", (unsigned long long)(state >> (state % 64)), (int)(state % 700) - 350);
+        if (!tod_matches(text))
+        {
+            CHECK(!"str_tod() rounding");
+            break;
+        }
+    }
+}
+#pragma endregion
+
+#pragma region NUMBERS
+void test_appendnum(void)
+{
+    const double values[] = { 0.0, -0.0, 1.0, -1.5, 0.1, 1.0 / 3.0, 123456789.125, 1e-7, 5e-324, DBL_MIN, DBL_MAX, 9007199254740993.0,
+        2.2250738585072009e-308, 1e21, 1e22, 4.35e-5 };
+    str_t *s = str_new(0);
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+    {
+        str_assign_c(s, L_(""));
+        str_append_double(s, values[i]);
+        double back = 1.0;
+        CHECK(str_tod(s, &back) == STR_OK);
+        CHECK(back == values[i] && signbit(back) == signbit(values[i]));
+    }
+    str_assign_c(s, L_(""));
+    str_append_double(s, 0.1);
+    CHECK_STR(s, "0.1");
+    str_assign_c(s, L_(""));
+    str_append_double(s, 1e22);
+    CHECK_STR(s, "1e+22");
+    uint64_t state = 88172645463325252ull;
+    for (int i = 0; i < 20000; i++) // Random bit patterns, skipping NaN and infinities
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        double d;
+        memcpy(&d, &state, sizeof(d));
+        if (!isfinite(d))
+        {
+            continue;
+        }
+        str_assign_c(s, L_(""));
+        str_append_double(s, d);
+        double back;
+        if (str_tod(s, &back) != STR_OK || back != d)
+        {
+            CHECK(!"double round-trip");
+            break;
+        }
+    }
+    str_assign_c(s, L_("x="));
+    str_append_i64(s, INT64_MIN);
+    str_append_c(s, L_(","));
+    str_append_u64(s, UINT64_MAX);
+    str_append_c(s, L_(","));
+    str_append_hex(s, 0xBEEF);
+    CHECK_STR(s, "x=-9223372036854775808,18446744073709551615,beef");
+    int64_t i64;
+    uint64_t u64;
+    size_t end;
+    CHECK(str_toi64_at(s, 2, &i64, &end) == STR_OK && i64 == INT64_MIN && end == 22);
+    CHECK(str_tou64_at(s, 23, &u64, &end) == STR_OK && u64 == UINT64_MAX);
+    str_free(&s);
+}
+#pragma endregion
+
+#pragma region UTF8
+#ifdef DOOTSTR_USE_UTF8
+void test_utf8(void)
+{
+    const char *bad[] = { "\xC0\x80", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xE0\x9F\xBF", "\x80", "\xC2", "\xE2\x82", "\xFF" };
+    char buf[128];
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++)
+    {
+        for (size_t pad = 0; pad < 40; pad += 13) // The bad sequence in the vectorized part and in the tail
+        {
+            memset(buf, 'a', pad);
+            strcpy(buf + pad, bad[i]);
+            strcat(buf, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+            size_t badpos = 99;
+            CHECK(str_u8check(buf, strlen(buf), &badpos) == STR_ERR_SYNTAX && badpos == pad);
+        }
+    }
+    CHECK(str_u8check("h\xC3\xA9llo \xF0\x9F\x98\x80 and enough ASCII for a whole vector", 47, NULL) == STR_OK);
+
+    str_t *s = str_newfrom("  \xE2\x80\x83h\xC3\xA9llo w\xC3\xB6rld\xC2\xA0 \n");
+    CHECK(str_isutf8(s) && str_u8len(s) == 17);
+    str_strip(s); // U+2003 and U+00A0 are spaces too
+    CHECK_STR(s, "h\xC3\xA9llo w\xC3\xB6rld");
+    CHECK(str_u8len(s) == 11);
+    CHECK(str_u8at(s, 1) == 0xE9 && str_u8at(s, STR_FROMEND(4)) == 0xF6 && str_u8at(s, 11) == 0);
+    str_t *t = str_u8newslice(s->pstr, 1, STR_FROMEND(1), 1);
+    CHECK_STR(t, "\xC3\xA9llo w\xC3\xB6rl");
+    str_u8assignSlice(t, s->pstr, 0, STR_END, -1);
+    CHECK_STR(t, "dlr\xC3\xB6w oll\xC3\xA9h");
+    str_u8assignSlice(t, s->pstr, 1, STR_END, 2);
+    CHECK_STR(t, "\xC3\xA9l \xC3\xB6l");
+    str_assign_c(t, "\xCE\xB1\xCE\xB2 x");
+    CHECK(str_islower(t) && !str_isupper(t));
+    str_assign_c(t, "\xD9\xA3\xD9\xA4");
+    CHECK(str_isdigit(t));
+
+    str_u8assignSlice(s, s->pstr, 0, 11, -1); // Slices of the string itself
+    CHECK_STR(s, "dlr\xC3\xB6w oll\xC3\xA9h");
+    str_u8assignSlice(s, s->pstr, 2, 11, 1);
+    CHECK_STR(s, "r\xC3\xB6w oll\xC3\xA9h");
+    str_u8assignSlice(s, s->pstr + 1, 0, STR_END, 2);
+    CHECK_STR(s, "\xC3\xB6 l\xC3\xA9");
+    CHECK(str_isutf8(s));
+    str_free(&s);
+    str_free(&t);
+}
+#endif
+#pragma endregion
+
+#pragma region TRANSCODING
+void test_transcode(void)
+{
+    const char u8[] = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80z"; // a, U+00E9, U+20AC, U+1F600, z
+    const uint16_t u16[] = { 'a', 0xE9, 0x20AC, 0xD83D, 0xDE00, 'z' };
+    const wchar_t wcs[] = { 'a', 0xE9, 0x20AC, (wchar_t)0x1F600, 'z' };
+    uint16_t out16[8];
+    char out8[16];
+    size_t len;
+    CHECK(str_u8tou16(u8, sizeof(u8) - 1, NULL, &len) == STR_OK && len == 6);
+    CHECK(str_u8tou16(u8, sizeof(u8) - 1, out16, &len) == STR_OK && memcmp(out16, u16, sizeof(u16)) == 0);
+    CHECK(str_u16tou8(u16, 6, out8, &len) == STR_OK && len == sizeof(u8) - 1 && memcmp(out8, u8, len) == 0);
+    const uint16_t lone[] = { 'a', 0xD800, 'b' };
+    CHECK(str_u16tou8(lone, 3, NULL, &len) == STR_ERR_SYNTAX);
+    CHECK(str_u16tou8(lone + 1, 1, NULL, &len) == STR_ERR_SYNTAX);
+    CHECK(str_u8tou16("\xED\xA0\x80", 3, NULL, &len) == STR_ERR_SYNTAX);
+
+    str_t *s = str_new(0);
+    str_t *t = str_new(0);
+    CHECK(str_assignu8(s, u8, sizeof(u8) - 1) == STR_OK);
+    CHECK(str_assignu16(t, u16, 6) == STR_OK && t->strlen == s->strlen && memcmp(t->pstr, s->pstr, s->strlen * sizeof(dchar_t)) == 0);
+    if (WCHAR_MAX > 0xFFFF)
+    {
+        CHECK(str_assignwcs(t, wcs, 5) == STR_OK && t->strlen == s->strlen && memcmp(t->pstr, s->pstr, s->strlen * sizeof(dchar_t)) == 0);
+    }
+    char *p8;
+    uint16_t *p16;
+    CHECK(str_tou8(s, &p8, &len) == STR_OK && len == sizeof(u8) - 1 && strcmp(p8, u8) == 0);
+    CHECK(str_tou16(t, &p16, &len) == STR_OK && len == 6 && memcmp(p16, u16, sizeof(u16)) == 0 && p16[6] == 0);
+    free(p8);
+    free(p16);
+    CHECK(str_assignu8(t, "ok\xFF", 3) == STR_ERR_SYNTAX);
+    str_free(&s);
+    str_free(&t);
+}
+#pragma endregion
+
+#pragma region CPINDEX
+#ifndef DOOTSTR_USE_WCHAR
+/*@brief Checks that the indexed string a gives the same code point offsets as the unindexed string b.*/
+int offsets_agree(const str_t *a, const str_t *b)
+{
+    size_t n = str_u8len(b);
+    if (str_u8len(a) != n)
+    {
+        return 0;
+    }
+    for (size_t i = 0; i <= n; i += 7)
+    {
+        if (str_u8offset(a, i) != str_u8offset(b, i) || str_u8at(a, i) != str_u8at(b, i))
+        {
+            return 0;
+        }
+    }
+    return str_u8offset(a, n) == a->strlen;
+}
+
+void test_cpindex(void)
+{
+    str_t *a = str_new(0);
+    str_t *b = str_new(0);
+    str_u8index(a);
+    for (int i = 0; i < 300; i++)
+    {
+        const char *piece = (i % 3 == 0) ? "\xC3\xA9" : (i % 3 == 1) ? "x" : "\xF0\x9F\x98\x80";
+        str_append_c(a, piece);
+        str_append_c(b, piece);
+    }
+    CHECK(a->cpindex && !b->cpindex && offsets_agree(a, b));
+    size_t pos = str_u8offset(a, 150);
+    str_insert_c(a, "\xE2\x82\xAC\xE2\x82\xAC", pos); // Changes in the middle drop the rest of the index
+    str_insert_c(b, "\xE2\x82\xAC\xE2\x82\xAC", pos);
+    CHECK(offsets_agree(a, b));
+    str_cut(a, 0, str_u8offset(a, 10));
+    str_cut(b, 0, str_u8offset(b, 10));
+    CHECK(offsets_agree(a, b));
+    str_t *sub = str_u8substr(a, 5, STR_FROMEND(5));
+    CHECK(str_u8len(sub) == str_u8len(a) - 10 && memcmp(sub->pstr, a->pstr + str_u8offset(a, 5), sub->strlen) == 0);
+    str_u8dropindex(a);
+    CHECK(a->cpindex == NULL && offsets_agree(a, b));
+    str_free(&sub);
+    str_free(&a);
+    str_free(&b);
+}
+#endif
+#pragma endregion
+
+#pragma region CASE
+void test_case(void)
+{
+    str_t *s = str_newfrom(L_("Hello, World! abcdefghijklmnopqrstuvwxyz 0123456789 @[`{"));
+    str_upper(s);
+    CHECK_STR(s, "HELLO, WORLD! ABCDEFGHIJKLMNOPQRSTUVWXYZ 0123456789 @[`{");
+    str_lower(s);
+    CHECK_STR(s, "hello, world! abcdefghijklmnopqrstuvwxyz 0123456789 @[`{");
+    str_t *a = str_newfrom(L_("The Quick Brown Fox Jumps Over The Lazy Dog"));
+    str_t *b = str_newfrom(L_("the quick brown fox jumps over the lazy dog"));
+    str_t *c = str_newfrom(L_("the quick brown fox jumps over the lazy cog"));
+    CHECK(str_casecmp(a, b) == 0 && str_casehash(a) == str_casehash(b));
+    CHECK(str_casecmp(a, c) > 0 && str_casecmp(c, a) < 0);
+    str_t *e = str_new(0);
+    CHECK(str_casecmp(e, e) == 0);
+    str_upper(e);
+    #if defined(DOOTSTR_USE_WCHAR) || defined(DOOTSTR_USE_UTF8)
+        #ifdef DOOTSTR_USE_WCHAR
+        #define U_(w, n) w
+        #else
+        #define U_(w, n) n
+        #endif
+    str_assign_c(s, U_(L"Straße ǅ ﬁ", "Stra\xC3\x9F" "e \xC7\x85 \xEF\xAC\x81"));
+    str_upper(s); // Special casing makes the string longer
+    CHECK(B_STRCMP(s->pstr, U_(L"STRASSE Ǆ FI", "STRASSE \xC7\x84 FI")) == 0);
+    str_assign_c(s, U_(L"ΟΔΟΣ ΣΑ", "\xCE\x9F\xCE\x94\xCE\x9F\xCE\xA3 \xCE\xA3\xCE\x91"));
+    str_lower(s); // Final sigma
+    CHECK(B_STRCMP(s->pstr, U_(L"οδος σα", "\xCE\xBF\xCE\xB4\xCE\xBF\xCF\x82 \xCF\x83\xCE\xB1")) == 0);
+    str_assign_c(s, U_(L"ᾭΣ", "\xE1\xBE\xAD\xCE\xA3"));
+    str_lower(s); // U+1FAD is title case, but still cased
+    CHECK(B_STRCMP(s->pstr, U_(L"ᾥς", "\xE1\xBE\xA5\xCF\x82")) == 0);
+    str_assign_c(s, U_(L"Maße ΣΊΣΥΦΟΣ", "Ma\xC3\x9F" "e \xCE\xA3\xCE\x8A\xCE\xA3\xCE\xA5\xCE\xA6\xCE\x9F\xCE\xA3"));
+    str_casefold(s);
+    CHECK(B_STRCMP(s->pstr, U_(L"masse σίσυφοσ", "masse \xCF\x83\xCE\xAF\xCF\x83\xCF\x85\xCF\x86\xCE\xBF\xCF\x83")) == 0);
+    str_assign_c(a, U_(L"Straße und long enough for vectors", "Stra\xC3\x9F" "e und long enough for vectors"));
+    str_assign_c(b, L_("STRASSE UND LONG ENOUGH FOR VECTORS"));
+    CHECK(str_casecmp(a, b) == 0 && str_casehash(a) == str_casehash(b));
+        #undef U_
+    #else
+    str_assign_c(s, "caf\xC3\xA9 ABC"); // Bytes above 0x7F are left alone
+    str_lower(s);
+    CHECK_STR(s, "caf\xC3\xA9 abc");
+    #endif
+    str_free(&s);
+    str_free(&a);
+    str_free(&b);
+    str_free(&c);
+    str_free(&e);
+}
+#pragma endregion
+
+#pragma region NORMALIZATION
+#ifndef DOOTSTR_USE_WCHAR
+void test_normalize(void)
+{
+    str_t *s = str_newfrom("Cafe\xCC\x81 ol\xC3\xA9 \xE1\x84\x92\xE1\x85\xA1\xE1\x86\xAB and a long ASCII tail to use the vectors");
+    str_normalize_nfc(s); // Combining acute and a Hangul syllable made of jamo
+    CHECK_STR(s, "Caf\xC3\xA9 ol\xC3\xA9 \xED\x95\x9C and a long ASCII tail to use the vectors");
+    dchar_t *before = s->pstr;
+    str_normalize_nfc(s); // Already normalized, nothing is allocated
+    CHECK(s->pstr == before);
+    str_normalize_nfd(s);
+    CHECK_STR(s, "Cafe\xCC\x81 ole\xCC\x81 \xE1\x84\x92\xE1\x85\xA1\xE1\x86\xAB and a long ASCII tail to use the vectors");
+    str_assign_c(s, "a\xCC\x81\xCC\xA3 x"); // The dot below goes before the acute
+    str_normalize_nfc(s);
+    CHECK_STR(s, "\xE1\xBA\xA1\xCC\x81 x");
+    str_t *e = str_new(0);
+    str_normalize_nfc(e);
+    str_normalize_nfd(e);
+    CHECK(e->strlen == 0);
+    str_free(&s);
+    str_free(&e);
+}
+#endif
+#pragma endregion
+
+#pragma region MAPPING
+#ifndef DOOTSTR_USE_WCHAR
+void test_mapfile(void)
+{
+    CHECK(str_mapfile("/nonexistent/dootstr", STR_MAP_NORMAL) == NULL && errno == ENOENT);
+    char path[] = "/tmp/dootstr_testXXXXXX";
+    int fd = mkstemp(path);
+    CHECK(fd >= 0);
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    const size_t sizes[] = { 0, 10, page, 3 * page + 7 }; // A file that ends on a page boundary needs a copy for the terminator
+    for (size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++)
+    {
+        CHECK(ftruncate(fd, 0) == 0);
+        for (size_t i = 0; i < sizes[k]; i++)
+        {
+            CHECK(pwrite(fd, (i % 10 == 9) ? "," : "a", 1, (off_t)i) == 1);
+        }
+        str_t *s = str_mapfile(path, (int)k % 4);
+        CHECK(s && s->strlen == sizes[k] && strlen(s->pstr) == sizes[k]);
+        CHECK(str_count(s, ",") == sizes[k] / 10);
+        CHECK(sizes[k] < 10 || str_index(s, ",") == 9);
+        sarr_t *parts = str_split(s, ","); // Parts of nine 'a's, and what's left after the last comma
+        CHECK(parts->size == sizes[k] / 10 + (sizes[k] % 10 != 0) && (sizes[k] < 10 || B_STRCMP(parts->strArr[0]->pstr, "aaaaaaaaa") == 0));
+        str_afree(&parts);
+        str_t *t = str_mapfile(path, STR_MAP_SEQUENTIAL);
+        str_append_c(t, "!"); // Copied to the heap on the first change
+        CHECK(t->mapped == 0 && t->strlen == sizes[k] + 1 && t->pstr[sizes[k]] == '!');
+        str_upper(s);
+        CHECK(s->mapped == 0 && s->strlen == sizes[k] && (sizes[k] == 0 || s->pstr[0] == 'A'));
+        str_free(&s);
+        str_free(&t);
+        s = str_mapfile(path, STR_MAP_RANDOM);
+        str_destroy(s); // Unmaps
+        free(s);
+    }
+    close(fd);
+    unlink(path);
+}
+#endif
+#pragma endregion
+
+#pragma region READING
+/*@brief Returns a descriptor of an unlinked temporary file holding n bytes of data, positioned at its start.*/
+int tmpfd_with(const void *data, size_t n)
+{
+    char path[] = "/tmp/dootstr_testXXXXXX";
+    int fd = mkstemp(path);
+    unlink(path);
+    if (fd < 0 || write(fd, data, n) != (ssize_t)n)
+    {
+        fprintf(stderr, "%s: can't write a temporary file\n", WIDTH);
+        exit(1);
+    }
+    lseek(fd, 0, SEEK_SET);
+    return fd;
+}
+
+void test_reader(void)
+{
+    const char *data = "one\r\ntwo\n\nlast";
+    int fd = tmpfd_with(data, strlen(data));
+    str_reader_t *prd = str_readernew(fd, 4); // Smaller than the lines
+    str_t *s = str_new(0);
+    CHECK(str_readline(prd, s) == 1);
+    CHECK_STR(s, "one");
+    CHECK(str_readline(prd, s) == 1);
+    CHECK_STR(s, "two");
+    CHECK(str_readline(prd, s) == 1 && s->strlen == 0);
+    CHECK(str_readline(prd, s) == 1);
+    CHECK_STR(s, "last");
+    CHECK(str_readline(prd, s) == 0 && s->strlen == 0);
+    str_readerfree(&prd);
+    CHECK(prd == NULL);
+    close(fd);
+
+    size_t n = 300000;
+    char *big = (char *)malloc(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        big[i] = (i % 1000 == 999) ? ';' : 'a' + i % 26;
+    }
+    fd = tmpfd_with(big, n);
+    prd = str_readernew(fd, 0);
+    size_t records = 0, total = 0;
+    while (str_readuntil(prd, ';', s))
+    {
+        records++;
+        total += s->strlen;
+    }
+    CHECK(records == 300 && total == 299700);
+    str_readerfree(&prd);
+    close(fd);
+    #ifndef DOOTSTR_USE_WCHAR
+    fd = tmpfd_with(data, strlen(data));
+    prd = str_readernew(fd, 3);
+    str_view_t view;
+    CHECK(str_readline_v(prd, &view) == 1 && view.strlen == 3 && memcmp(view.pstr, "one", 3) == 0);
+    CHECK(str_readline_v(prd, &view) == 1 && view.strlen == 3 && memcmp(view.pstr, "two", 3) == 0);
+    str_readerfree(&prd);
+    close(fd);
+    #endif
+    free(big);
+    str_free(&s);
+}
+#pragma endregion
+
+#pragma region WRITING
+void test_write(void)
+{
+    int fd = tmpfd_with("", 0);
+    str_t *a = str_newfrom(L_("alpha"));
+    CHECK(str_write(a, fd) == 5 * sizeof(dchar_t));
+    size_t n = 3000; // More than writev() takes at once
+    str_t **strs = (str_t **)malloc(n * sizeof(str_t *));
+    str_t *all = str_newfrom(L_("alpha"));
+    for (size_t i = 0; i < n; i++)
+    {
+        strs[i] = str_newfrom((i % 3) ? L_("ab") : L_(""));
+        if (i)
+        {
+            str_append_c(all, L_(","));
+        }
+        str_append(all, strs[i]);
+    }
+    CHECK(str_writemany(strs, n, L_(","), fd) == (all->strlen - 5) * sizeof(dchar_t));
+    sarr_t arr = { strs, 3 };
+    CHECK(str_awrite(&arr, L_("--"), fd) == 8 * sizeof(dchar_t));
+    CHECK(str_awrite(&arr, NULL, fd) == 4 * sizeof(dchar_t));
+    CHECK(str_writemany(NULL, 0, NULL, fd) == 0);
+    str_append_c(all, L_("--ab--ababab"));
+    off_t size = lseek(fd, 0, SEEK_CUR);
+    dchar_t *back = (dchar_t *)malloc(size);
+    CHECK(size == (off_t)(all->strlen * sizeof(dchar_t)) && pread(fd, back, size, 0) == size);
+    CHECK(memcmp(back, all->pstr, size) == 0);
+    for (size_t i = 0; i < n; i++)
+    {
+        str_free(&strs[i]);
+    }
+    free(strs);
+    free(back);
+    str_free(&a);
+    str_free(&all);
+    close(fd);
+}
+#pragma endregion
+
+#pragma region STREAMING
+#ifndef DOOTSTR_USE_WCHAR
+off_t found_offsets[20000];
+size_t found_count;
+
+void record_offset(off_t offset, void *arg)
+{
+    (void)arg;
+    found_offsets[found_count++] = offset;
+}
+
+void test_fdsearch(void)
+{
+    size_t n = 20000;
+    char *data = (char *)malloc(n);
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < n; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        data[i] = "aab"[state % 3];
+    }
+    int fd = tmpfd_with(data, n);
+    const char *seqs[] = { "a", "aab", "baa", "abab", "bbbbbbbbbbbbbbbbbbbbbbbb" };
+    const size_t windows[] = { 1, 3, 64, 4096, 0 }; // Matches straddle the windows
+    for (size_t k = 0; k < sizeof(seqs) / sizeof(seqs[0]); k++)
+    {
+        size_t len = strlen(seqs[k]), want = 0;
+        off_t first = -1;
+        for (size_t i = 0; i + len <= n; i++)
+        {
+            if (memcmp(data + i, seqs[k], len) == 0)
+            {
+                first = (first < 0) ? (off_t)i : first;
+                want++;
+            }
+        }
+        for (size_t w = 0; w < sizeof(windows) / sizeof(windows[0]); w++)
+        {
+            lseek(fd, 0, SEEK_SET);
+            CHECK(str_fdcount(fd, seqs[k], windows[w]) == want);
+            lseek(fd, 0, SEEK_SET);
+            CHECK(str_fdindex(fd, seqs[k], windows[w]) == first);
+            lseek(fd, 0, SEEK_SET);
+            found_count = 0;
+            CHECK(str_fdfindall(fd, seqs[k], windows[w], record_offset, NULL) == want && found_count == want);
+            CHECK(found_count == 0 || found_offsets[0] == first);
+        }
+    }
+    close(fd);
+    int pp[2];
+    CHECK(pipe(pp) == 0 && write(pp[1], "xxabcxxabc", 10) == 10);
+    close(pp[1]);
+    CHECK(str_fdindex(pp[0], "abc", 2) == 2); // Pipes can't seek
+    close(pp[0]);
+    free(data);
+}
+#endif
+#pragma endregion
+
+#pragma region SERIALIZATION
+void test_serialize(void)
+{
+    char path[] = "/tmp/dootstr_testXXXXXX";
+    int fd = mkstemp(path);
+    CHECK(fd >= 0);
+    size_t n = 1000;
+    sarr_t *pa = (sarr_t *)malloc(sizeof(sarr_t));
+    pa->size = n;
+    pa->strArr = (str_t **)malloc(n * sizeof(str_t *));
+    for (size_t i = 0; i < n; i++)
+    {
+        pa->strArr[i] = str_new(0);
+        for (size_t k = 0; k < i % 13; k++)
+        {
+            str_append_c(pa->strArr[i], L_("xy"));
+        }
+    }
+    size_t written = str_asave(pa, fd);
+    CHECK(written == (size_t)lseek(fd, 0, SEEK_CUR) && written % 8 == 0);
+    str_t *one = str_newfrom(L_("hello"));
+    str_save(one, fd);
+    lseek(fd, 0, SEEK_SET);
+    str_err_t err;
+    sarr_t *pb = str_aload(fd, &err);
+    CHECK(pb && err == STR_OK && pb->size == n);
+    for (size_t i = 0; pb && i < n; i++)
+    {
+        CHECK(pb->strArr[i]->strlen == pa->strArr[i]->strlen && (pa->strArr[i]->strlen == 0
+            || memcmp(pb->strArr[i]->pstr, pa->strArr[i]->pstr, pa->strArr[i]->strlen * sizeof(dchar_t)) == 0));
+    }
+    str_t *back = str_load(fd, &err);
+    CHECK(back && err == STR_OK);
+    CHECK_STR(back, "hello");
+    CHECK(str_load(fd, &err) == NULL && err == STR_ERR_FORMAT); // End of file
+
+    CHECK(ftruncate(fd, written) == 0);
+    str_table_t *pt = str_tablemap(path, 1, &err);
+    CHECK(pt && err == STR_OK && pt->count == n);
+    for (size_t i = 0; pt && i < n; i++)
+    {
+        str_view_t view = str_tableget(pt, i);
+        CHECK(view.strlen == pa->strArr[i]->strlen && view.pstr[view.strlen] == '\0');
+    }
+    str_tablefree(&pt);
+    CHECK(pt == NULL);
+    dchar_t bad = 'Q';
+    CHECK(pwrite(fd, &bad, sizeof(bad), written - 16) == sizeof(bad)); // Corrupt the last string
+    CHECK(str_tablemap(path, 1, &err) == NULL && err == STR_ERR_CHECKSUM);
+    lseek(fd, 0, SEEK_SET);
+    CHECK(str_tableread(fd, &err) == NULL && err == STR_ERR_CHECKSUM);
+    CHECK(ftruncate(fd, written - 8) == 0);
+    CHECK(str_tablemap(path, 0, &err) == NULL && err == STR_ERR_FORMAT);
+    CHECK(str_tablemap("/nonexistent/dootstr", 0, &err) == NULL && err == STR_ERR_IO);
+    close(fd);
+    unlink(path);
+    str_afree(&pa);
+    str_afree(&pb);
+    str_free(&one);
+    str_free(&back);
+}
+#pragma endregion
+
+#pragma region PARALLEL
+void test_parallel(void)
+{
+    size_t n = (1 << 20) + 17; // Big enough to be split between threads
+    str_t *s = str_new(n + 1);
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < n; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        s->pstr[i] = (state % 5 == 0) ? 'b' : 'a';
+    }
+    s->pstr[n] = '\0';
+    s->strlen = n;
+    const dchar_t *seqs[] = { L_("a"), L_("aba"), L_("abaab"), L_("bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb") };
+    for (size_t k = 0; k < sizeof(seqs) / sizeof(seqs[0]); k++)
+    {
+        size_t len = _strlen(seqs[k]), count = 0, taken = 0;
+        ssize_t first = -1;
+        dchar_t *want = (dchar_t *)malloc((3 * n + 1) * sizeof(dchar_t)); // Replaced by hand, str_replace() is too slow with the sanitizers
+        size_t wlen = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            if (i + len <= n && memcmp(s->pstr + i, seqs[k], len * sizeof(dchar_t)) == 0)
+            {
+                first = (first < 0) ? (ssize_t)i : first;
+                count++;
+                if (i >= taken)
+                {
+                    memcpy(want + wlen, L_("XYZ"), 3 * sizeof(dchar_t));
+                    wlen += 3;
+                    taken = i + len;
+                }
+            }
+            else if (i >= taken)
+            {
+                want[wlen++] = s->pstr[i];
+            }
+        }
+        CHECK(str_count_mt(s, seqs[k]) == count);
+        CHECK(str_index_mt(s, seqs[k]) == first);
+        str_t *parallel = str_newfrom(s->pstr);
+        str_replace_mt(parallel, seqs[k], L_("XYZ"));
+        CHECK(parallel->strlen == wlen && memcmp(parallel->pstr, want, wlen * sizeof(dchar_t)) == 0);
+        free(want);
+        str_free(&parallel);
+    }
+    str_free(&s);
+
+    s = str_newfrom(L_("aaaaaaa")); // Self-overlapping matches are taken from left to right
+    CHECK(str_replace(s, L_("aa"), L_("b")) == 3);
+    CHECK_STR(s, "bbba");
+    str_t *t = str_newfrom(L_("aaaaaaa"));
+    CHECK(str_replace_mt(t, L_("aa"), L_("b")) == 3);
+    CHECK_STR(t, "bbba");
+    CHECK(str_remove(t, L_("bb")) == 1);
+    CHECK_STR(t, "ba");
+    str_free(&s);
+    str_free(&t);
+}
+#pragma endregion
+
+#pragma region POOL
+#ifndef DOOTSTR_NO_THREADS
+void *pool_churn(void *arg)
+{
+    (void)arg;
+    for (int i = 0; i < 5000; i++) // Every thread has its own pool
+    {
+        str_t *s = str_newfrom(L_("worker"));
+        str_append_c(s, L_(" string that grows"));
+        str_realloc(s, 200 + i % 300);
+        str_free(&s);
+    }
+    return NULL;
+}
+#endif
+
+void test_pool(void)
+{
+    str_t *s = str_newfrom(L_("hello"));
+    CHECK(s->capacity >= 6);
+    dchar_t *first = s->pstr;
+    (void)first;
+    str_free(&s);
+    s = str_new(6);
+    #ifdef DOOTSTR_USE_POOL
+    CHECK(s->pstr == first); // Recycled from the same size class
+    #endif
+    str_append_c(s, L_("0123456789abcdefghij"));
+    str_realloc(s, 4); // Truncated at the requested size even if the block is bigger
+    CHECK_STR(s, "012");
+    str_realloc(s, 100000);
+    CHECK(s->capacity >= 100000);
+    CHECK_STR(s, "012");
+    str_free(&s);
+    s = str_newfrom(L_("ab"));
+    str_insert_c(s, L_("0123456789abcdefghij"), 1); // Doesn't fit, the new block comes from the pool as well
+    #ifdef DOOTSTR_USE_POOL
+    CHECK(((s->capacity * sizeof(dchar_t)) & (s->capacity * sizeof(dchar_t) - 1)) == 0); // A whole size class
+    #endif
+    str_upper(s);
+    CHECK_STR(s, "A0123456789ABCDEFGHIJB");
+    str_free(&s);
+    #ifndef DOOTSTR_NO_THREADS
+    pthread_t threads[4];
+    for (int i = 0; i < 4; i++)
+    {
+        pthread_create(threads + i, NULL, pool_churn, NULL);
+    }
+    for (int i = 0; i < 4; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    #endif
+    #ifdef DOOTSTR_USE_POOL
+    str_poolflush();
+    #endif
+}
+#pragma endregion
+
+#pragma region STATS
+#ifdef DOOTSTR_STATS
+void test_stats(void)
+{
+    str_stats_t *pst = (str_stats_t *)malloc(sizeof(str_stats_t));
+    str_statsreset();
+    str_t *s = str_newfrom(L_("hello"));
+    for (int i = 0; i < 100; i++)
+    {
+        str_append_c(s, L_("abcdef"));
+    }
+    str_insert_c(s, L_("xyz"), 3);
+    str_t *t = str_new(0); // The first block comes later, but it's still a new one
+    str_append_c(t, L_("abc"));
+    str_insert_c(t, L_("xyz"), 1);
+    str_free(&s);
+    str_free(&t);
+    str_stats(pst);
+    CHECK(pst->allocs == 2 && pst->frees == 2 && pst->reallocs >= 3);
+    CHECK(pst->peak_capacity >= 604 * sizeof(dchar_t));
+    uint64_t sized = 0;
+    for (int i = 0; i < STR_STATS_BUCKETS; i++)
+    {
+        sized += pst->sizes[i];
+    }
+    CHECK(sized == pst->allocs + pst->reallocs);
+    int found = 0;
+    for (size_t i = 0; i < pst->nfuncs; i++)
+    {
+        found |= strcmp(pst->funcs[i].name, "str_append_c") == 0 && pst->funcs[i].reallocs >= 2;
+    }
+    CHECK(found);
+    str_statsreset();
+    str_stats(pst);
+    CHECK(pst->allocs == 0 && pst->peak_capacity == 0);
+    free(pst);
+}
+#endif
+#pragma endregion
+
+#pragma region UNCHECKED
+void test_unchecked(void)
+{
+    str_t s = { 0 };
+    CHECK(str_append_c_unchecked(&s, L_("hello")) == STR_OK);
+    CHECK(str_appendn_unchecked(&s, L_(" worldXX"), 6) == STR_OK);
+    CHECK_STR(&s, "hello world");
+    CHECK(str_insert_c_unchecked(&s, L_(", big"), 5) == STR_OK);
+    CHECK(str_insert_c_unchecked(&s, L_("x"), 17) == STR_ERR_INDEX);
+    CHECK(str_insertn_unchecked(&s, L_("!"), 1, s.strlen) == STR_OK);
+    CHECK(str_insertn_unchecked(&s, L_(">"), 1, 0) == STR_OK);
+    CHECK_STR(&s, ">hello, big world!");
+    CHECK(str_cut_unchecked(&s, 0, 1) == STR_OK);
+    CHECK(str_cut_unchecked(&s, 5, 5) == STR_OK);
+    CHECK_STR(&s, "hello world!");
+    CHECK(str_cut_unchecked(&s, 10, 3) == STR_ERR_INDEX);
+    CHECK(str_cut_unchecked(&s, SIZE_MAX, 2) == STR_ERR_INDEX);
+    CHECK(str_at_unchecked(&s, 4) == 'o' && str_at_unchecked(&s, 12) == '\0');
+    CHECK(str_index_unchecked(&s, L_("world")) == 6 && str_index_unchecked(&s, L_("zz")) == -1 && str_index_unchecked(&s, L_("")) == 0);
+    str_t *a = str_newfrom(L_("aaaa"));
+    CHECK(str_count_unchecked(a, L_("aa")) == str_count(a, L_("aa")) && str_count_unchecked(a, L_("")) == 0);
+    CHECK(str_append_unchecked(&s, a) == STR_OK && s.strlen == 16);
+    str_t e = { 0 };
+    CHECK(str_index_unchecked(&e, L_("a")) == -1 && str_count_unchecked(&e, L_("a")) == 0);
+    CHECK(str_insertn_unchecked(&e, NULL, 0, 0) == STR_OK && e.pstr && e.pstr[0] == '\0');
+    str_destroy(&e);
+    str_free(&a);
+    str_destroy(&s);
+}
+#pragma endregion
+
+#pragma region WIDE
+#ifndef DOOTSTR_USE_WCHAR
+void test_wide(void)
+{
+    str_t *n = str_newfrom("narrow");
+    wstr_t *w = wstr_newfrom(L"wide");
+    str_append_c(n, " text");
+    wstr_append_c(w, L" text é");
+    CHECK(strcmp(n->pstr, "narrow text") == 0 && sizeof(*n->pstr) == 1);
+    CHECK(wcscmp(w->pstr, L"wide text é") == 0 && sizeof(*w->pstr) == sizeof(wchar_t));
+    CHECK(str_count(n, "t") == 2 && wstr_count(w, L"t") == 2);
+    wstr_upper(w);
+    CHECK(wcscmp(w->pstr, L"WIDE TEXT É") == 0);
+    int64_t value;
+    wstr_t *wnum = wstr_newfrom(L"77");
+    CHECK(wstr_toi64(wnum, &value) == STR_OK && value == 77); // The error codes are shared
+    CHECK(wstr_cut_unchecked(w, 0, 5) == STR_OK && wstr_cut_unchecked(w, 100, 1) == STR_ERR_INDEX);
+    CHECK(wstr_index(w, L"TEXT") == 0 && wstr_count_mt(w, L"T") == 2);
+    wstr_free(&w);
+    CHECK(w == NULL);
+    wstr_free(&wnum);
+    str_free(&n);
+}
+#endif
+#pragma endregion
+
+#pragma region VIEWS
+void test_views(void)
+{
+    str_t *s = str_newfrom(L_("key=value; other=thing"));
+    str_view_t all = str_view(s);
+    str_view_t sub = str_subview(all, 4, 9);
+    CHECK(all.strlen == 22);
+    CHECK_VIEW(sub, "value");
+    CHECK(str_cmp_v(sub, str_view_c(L_("valuf"))) < 0 && str_cmp_v(sub, str_view_c(L_("valu"))) > 0);
+    CHECK(str_cmp_v(str_subview(all, 0, 0), str_viewn(NULL, 0)) == 0);
+    CHECK(str_index_v(all, str_view_c(L_("other"))) == 11 && str_index_v(sub, str_view_c(L_("other"))) == -1);
+    CHECK(str_index_v(str_subview(all, 0, 15), str_view_c(L_("other"))) == -1); // Doesn't look past the end of the view
+    CHECK(str_rindex_v(all, str_view_c(L_("e"))) == 14 && str_rindex_v(sub, str_view_c(L_(""))) == 5);
+    CHECK(str_count_v(str_view_c(L_("aaaa")), str_view_c(L_("aa"))) == 3 && str_count_v(str_subview(all, 0, 5), str_view_c(L_("="))) == 1);
+    CHECK(str_casecmp_v(str_view_c(L_("HeLLo")), str_view_c(L_("hello"))) == 0);
+    str_view_t left, mid, right;
+    CHECK(str_partition_v(all, str_view_c(L_("; ")), &left, &mid, &right) == 1);
+    CHECK_VIEW(left, "key=value");
+    CHECK_VIEW(right, "other=thing");
+    CHECK(str_rpartition_v(all, str_view_c(L_("=")), &left, &mid, &right) == 1 && left.strlen == 16);
+    CHECK(str_partition_v(all, str_view_c(L_("#")), &left, &mid, &right) == 0 && left.strlen == 22 && right.strlen == 0);
+    CHECK(str_isalpha_v(sub) && !str_isalpha_v(all));
+    CHECK(str_isdigit_v(str_view_c(L_("0123"))) && !str_isdigit_v(str_view_c(L_("01a"))) && str_isalnum_v(str_view_c(L_("a1"))));
+    CHECK(str_islower_v(str_view_c(L_("abc1"))) && !str_islower_v(str_view_c(L_("aBc"))) && str_isupper_v(str_view_c(L_("AB C"))));
+    CHECK(str_isspace_v(str_view_c(L_(" \t\n"))));
+    str_t *empty = str_newfrom(L_(""));
+    CHECK(str_islower_v(str_view(empty)) == str_islower(empty) && str_isupper_v(str_view(empty)) == str_isupper(empty));
+    CHECK(str_islower_v(str_view_c(L_(""))) && !str_isalpha_v(str_view_c(L_("")))); // Only the case checks hold for empty views
+    str_free(&empty);
+
+    str_t *t = str_new(0);
+    str_append_v(t, sub);
+    str_append_v(t, str_viewn(L_("!!!!"), 1));
+    str_insert_v(t, str_view_c(L_("a ")), 0);
+    CHECK_STR(t, "a value!");
+    for (int i = 0; i < 4; i++) // Views of the string itself, across reallocations
+    {
+        str_append_v(t, str_view(t));
+    }
+    CHECK(t->strlen == 8 * 16 && B_STRCMP(t->pstr + 120, L_("a value!")) == 0);
+    str_assign_v(t, str_subview(str_view(t), 2, 7));
+    CHECK_STR(t, "value");
+    str_insert_v(t, str_subview(str_view(t), 1, 4), 2); // The view straddles the position
+    CHECK_STR(t, "vaalulue");
+    str_insert_v(t, str_subview(str_view(t), 5, 8), 1);
+    CHECK_STR(t, "vlueaalulue");
+    str_free(&t);
+    str_free(&s);
+}
+#pragma endregion
+
+#pragma region EDITS
+void test_edits(void)
+{
+    str_t *s = str_newfrom(L_("Hello {name}, you owe {amount}."));
+    str_edits_t *pe = str_editsnew();
+    str_editreplace(pe, 22, 8, L_("$5"));
+    str_editreplace(pe, 6, 6, L_("Ann"));
+    str_editinsert(pe, 0, L_(">> "));
+    str_editdelete(pe, 12, 1);
+    CHECK(str_editsapply(pe, s) == STR_OK);
+    CHECK_STR(s, ">> Hello Ann you owe $5.");
+
+    str_assign_c(s, L_("abcdef"));
+    str_edits_t *pdel = str_editsnew();
+    str_editdelete(pdel, 4, 1);
+    str_editdelete(pdel, 0, 2); // Only deletions, the batch never gets a text buffer
+    CHECK(str_editsapply(pdel, s) == STR_OK);
+    CHECK_STR(s, "cdf");
+    str_editsfree(&pdel);
+
+    str_editsclear(pe);
+    str_editdelete(pe, 0, 2);
+    str_editreplace(pe, 1, 1, L_("x"));
+    CHECK(str_editsapply(pe, s) == STR_ERR_OVERLAP);
+    CHECK_STR(s, "cdf");
+    str_editsclear(pe);
+    str_editdelete(pe, 0, 2);
+    str_editinsert(pe, 1, L_("x"));
+    CHECK(str_editsapply(pe, s) == STR_ERR_OVERLAP);
+    str_editsclear(pe);
+    str_editdelete(pe, 2, 2);
+    CHECK(str_editsapply(pe, s) == STR_ERR_INDEX);
+    str_editsclear(pe);
+    str_editinsert(pe, 4, L_("!"));
+    CHECK(str_editsapply(pe, s) == STR_ERR_INDEX);
+    CHECK_STR(s, "cdf");
+    str_editsclear(pe);
+    str_editdelete(pe, 0, 1);
+    str_editinsert(pe, 1, L_("-"));
+    str_editinsert_v(pe, 3, str_view_c(L_("!")));
+    CHECK(str_editsapply(pe, s) == STR_OK);
+    CHECK_STR(s, "-df!");
+    str_editsfree(&pe);
+    CHECK(pe == NULL);
+    str_free(&s);
+}
+#pragma endregion
+
+#pragma region CONSUMING
+void test_consume(void)
+{
+    str_t *s = str_newfrom(L_("  Host: a\r\nAccept: b\r\n\r\nbody"));
+    str_lstrip(s);
+    ssize_t end;
+    int headers = 0;
+    while ((end = str_index(s, L_("\r\n"))) > 0)
+    {
+        str_consume(s, end + 2);
+        headers++;
+    }
+    CHECK(headers == 2);
+    str_cut(s, 0, 2);
+    CHECK_STR(s, "body");
+    str_append_c(s, L_(" and a tail long enough to grow the block"));
+    CHECK_STR(s, "body and a tail long enough to grow the block");
+    str_consume(s, s->strlen);
+    CHECK(s->strlen == 0 && s->pstr[0] == '\0');
+    str_free(&s);
+}
+#pragma endregion
+
+#pragma region SLICING
+void test_slices(void)
+{
+    str_t *s = str_newslice(L_("abcdefg"), 1, STR_END, 2);
+    CHECK_STR(s, "bdf");
+    str_free(&s);
+    s = str_newslice(L_("abcdefg"), 0, STR_END, -3);
+    CHECK_STR(s, "gda");
+    str_free(&s);
+
+    s = str_newfrom(L_("abcdef"));
+    str_assignSlice(s, s->pstr, 0, STR_END, -1);
+    CHECK_STR(s, "fedcba");
+    str_assignSlice(s, s->pstr, 1, 5, 1);
+    CHECK_STR(s, "edcb");
+    str_assignSlice(s, s->pstr + 1, 0, STR_END, 2);
+    CHECK_STR(s, "db");
+    str_reverse(s);
+    CHECK_STR(s, "bd");
+    str_free(&s);
+
+    s = str_newfrom(L_("0123456789abcdefghijklmnopqrstuvwxyz0123456789ABCDEF"));
+    str_t *t = str_newslice(s->pstr, 0, STR_END, 4);
+    CHECK_STR(t, "048cgkosw048C");
+    str_assignSlice(t, s->pstr, 0, STR_END, -1);
+    str_reverse(t);
+    CHECK(B_STRCMP(t->pstr, s->pstr) == 0);
+    str_free(&s);
+    str_free(&t);
+}
+
+#ifdef DOOTSTR_USE_UTF8
+void test_u8slices(void)
+{
+    str_t *s = str_u8newslice("\xC4\x85" "b\xC4\x87\xE2\x82\xAC", 0, STR_END, -2);
+    CHECK_STR(s, "\xE2\x82\xAC" "b");
+    str_reverse(s); // Reverses code points, not bytes
+    CHECK_STR(s, "b\xE2\x82\xAC");
+    str_free(&s);
+}
+#endif
+#pragma endregion
+
+int main(void)
+{
+    test_builder();
+    test_csv();
+    test_format();
+    test_parse();
+    test_appendnum();
+    #ifdef DOOTSTR_USE_UTF8
+    test_utf8();
+    #endif
+    test_transcode();
+    #ifndef DOOTSTR_USE_WCHAR
+    test_cpindex();
+    #endif
+    test_case();
+    #ifndef DOOTSTR_USE_WCHAR
+    test_normalize();
+    #endif
+    #ifndef DOOTSTR_USE_WCHAR
+    test_mapfile();
+    #endif
+    test_reader();
+    test_write();
+    #ifndef DOOTSTR_USE_WCHAR
+    test_fdsearch();
+    #endif
+    test_serialize();
+    test_parallel();
+    test_pool();
+    #ifdef DOOTSTR_STATS
+    test_stats();
+    #endif
+    test_unchecked();
+    #ifndef DOOTSTR_USE_WCHAR
+    test_wide();
+    #endif
+    test_views();
+    test_edits();
+    test_consume();
+    test_slices();
+    #ifdef DOOTSTR_USE_UTF8
+    test_u8slices();
+    #endif
+    if (failed)
+    {
+        fprintf(stderr, "%s: %d checks failed\n", WIDTH, failed);
+        return 1;
+    }
+    return 0;
+}
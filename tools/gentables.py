@@ -0,0 +1,232 @@
+#!/usr/bin/env python3
+"""
+Generates dootstr_tables.h, the lookup tables used by dootstr.c.
+Run it from the repository root: python3 tools/gentables.py > dootstr_tables.h
+The Unicode tables follow the unicodedata module of the python running the script.
+"""
+
+import unicodedata
+
+
+def emit_u64(name, values, comment, per_line=4):
+    print("/*%s*/" % comment)
+    print("const uint64_t %s[%d] = {" % (name, len(values)))
+    for i in range(0, len(values), per_line):
+        print("    " + ", ".join("0x%016xULL" % v for v in values[i:i + per_line]) + ",")
+    print("};")
+    print()
+
+
+def pow5_128():
+    """128-bit approximations of 5^q for q in [-342, 308], as two 64-bit words (high first). Used by the Eisel-Lemire parser."""
+    out = []
+    for q in range(-342, 0):
+        power5 = 5 ** -q
+        z = power5.bit_length() if power5 & (power5 - 1) else power5.bit_length() - 1
+        if q >= -27:
+            c = 2 ** (z + 127) // power5 + 1
+        else:
+            c = 2 ** (2 * z + 128) // power5 + 1
+            while c >= (1 << 128):
+                c //= 2
+        out += [c >> 64, c & (2 ** 64 - 1)]
+    for q in range(0, 309):
+        power5 = 5 ** q
+        while power5 < (1 << 127):
+            power5 *= 2
+        while power5 >= (1 << 128):
+            power5 //= 2
+        out += [power5 >> 64, power5 & (2 ** 64 - 1)]
+    return out
+
+
+def ryu_pow5_split():
+    """5^i for i in [0, 325], normalized to 125 bits, as (low, high) word pairs. Used by the Ryu double to string conversion."""
+    out = []
+    for i in range(0, 326):
+        power5 = 5 ** i
+        shift = power5.bit_length() - 125
+        v = power5 >> shift if shift >= 0 else power5 << -shift
+        out += [v & (2 ** 64 - 1), v >> 64]
+    return out
+
+
+def ryu_pow5_inv_split():
+    """2^k / 5^i for i in [0, 341], rounded up to 125 significant bits, as (low, high) word pairs."""
+    out = []
+    for i in range(0, 342):
+        power5 = 5 ** i
+        v = (1 << (power5.bit_length() - 1 + 125)) // power5 + 1
+        out += [v & (2 ** 64 - 1), v >> 64]
+    return out
+
+
+def emit_u32(name, values, comment, per_line=8):
+    print("/*%s*/" % comment)
+    print("const uint32_t %s[%d] = {" % (name, len(values)))
+    for i in range(0, len(values), per_line):
+        print("    " + ", ".join("0x%08x" % v for v in values[i:i + per_line]) + ",")
+    print("};")
+    print()
+
+
+# Must match the STR_U8_* class flags in dootstr.c
+U8_ALPHA, U8_DIGIT, U8_UPPER, U8_LOWER, U8_SPACE, U8_CASED = 1, 2, 4, 8, 16, 32
+
+
+def uniclass(cp):
+    """isupper() and islower() follow the Uppercase and Lowercase properties, which include Other_Uppercase and Other_Lowercase. Cased
+    adds the title case letters (Lt) to them."""
+    c = chr(cp)
+    cased = c.isupper() or c.islower() or unicodedata.category(c) == "Lt"
+    return ((U8_ALPHA if c.isalpha() else 0) | (U8_DIGIT if c.isdecimal() else 0) | (U8_UPPER if c.isupper() else 0) |
+            (U8_LOWER if c.islower() else 0) | (U8_SPACE if c.isspace() else 0) | (U8_CASED if cased else 0))
+
+
+def uniclass_ranges():
+    """Ranges of code points (from 0x80) sharing the same non-zero class, as (first | flags << 24, last) pairs sorted by first."""
+    out = []
+    start, prev = None, 0
+    for cp in range(0x80, 0x110001):
+        flags = uniclass(cp) if cp <= 0x10FFFF else 0
+        if flags != prev:
+            if prev:
+                out += [start | prev << 24, cp - 1]
+            start, prev = cp, flags
+    return out
+
+
+def emit_ints(ctype, name, values, comment, per_line=16):
+    print("/*%s*/" % comment)
+    print("const %s %s[%d] = {" % (ctype, name, len(values)))
+    for i in range(0, len(values), per_line):
+        print("    " + ", ".join("%d" % v for v in values[i:i + per_line]) + ",")
+    print("};")
+    print()
+
+
+# Must match STR_CASE_BLOCK and the STR_CASE_SPECIAL encoding in dootstr.c
+CASE_BLOCK = 128
+CASE_SPECIAL = 0x40000000
+
+
+def casing():
+    """Two-stage case tables. Every code point maps to a record of three mappings (upper, lower, fold). A mapping is either the delta to
+    add to the code point or, for mappings to several code points, CASE_SPECIAL | length << 16 | offset into the specials array.
+    Records and blocks of CASE_BLOCK records are shared."""
+    records, specials, blocks = {(0, 0, 0): 0}, [], {}
+    special_index = {}
+    stage1, stage2 = [], []
+
+    def mapping(cp, s):
+        if s == chr(cp):
+            return 0
+        if len(s) == 1:
+            return ord(s) - cp
+        t = tuple(ord(c) for c in s)
+        if t not in special_index:
+            special_index[t] = len(specials)
+            specials.extend(t)
+        return CASE_SPECIAL | len(t) << 16 | special_index[t]
+
+    for first in range(0, 0x110000, CASE_BLOCK):
+        block = []
+        for cp in range(first, first + CASE_BLOCK):
+            record = (0, 0, 0)
+            if not 0xD800 <= cp <= 0xDFFF:
+                c = chr(cp)
+                record = (mapping(cp, c.upper()), mapping(cp, c.lower()), mapping(cp, c.casefold()))
+            block.append(records.setdefault(record, len(records)))
+        block = tuple(block)
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    assert len(blocks) <= 256 and len(records) <= 65536
+    flat = []
+    for record in sorted(records, key=records.get):
+        flat.extend(record)
+    return stage1, stage2, flat, specials
+
+
+# Must match the STR_NORM_* property bits in dootstr.c
+NORM_NFD_NO, NORM_NFC_NO, NORM_NFC_MAYBE = 0x100, 0x200, 0x400
+HANGUL_FIRST, HANGUL_LAST = 0xAC00, 0xD7A3
+
+
+def normalization():
+    """Two-stage normalization properties, the combining class in the low byte and the quick check bits above it, blocks of CASE_BLOCK
+    code points. Also the full canonical decompositions as (code point, offset | length << 16) pairs sorted by code point, and the
+    primary composites as (first << 21 | second) keys with their results. Hangul syllables are left to the algorithm."""
+    decomp, decompcps, pairs = [], [], {}
+    maybe = set(range(0x1161, 0x1176)) | set(range(0x11A8, 0x11C3))  # Hangul vowels and trailing consonants
+    for cp in range(0x110000):
+        if 0xD800 <= cp <= 0xDFFF or HANGUL_FIRST <= cp <= HANGUL_LAST:
+            continue
+        c = chr(cp)
+        full = unicodedata.normalize("NFD", c)
+        if full != c:
+            decomp += [cp, len(decompcps) | len(full) << 16]
+            decompcps += [ord(x) for x in full]
+        raw = unicodedata.decomposition(c).split()
+        if len(raw) == 2 and not raw[0].startswith("<") and unicodedata.normalize("NFC", c) == c:
+            first, second = int(raw[0], 16), int(raw[1], 16)
+            pairs[first << 21 | second] = cp
+            maybe.add(second)
+
+    def props(cp):
+        if 0xD800 <= cp <= 0xDFFF:
+            return 0
+        c = chr(cp)
+        flags = unicodedata.combining(c)
+        flags |= NORM_NFD_NO if unicodedata.normalize("NFD", c) != c else 0
+        flags |= NORM_NFC_NO if unicodedata.normalize("NFC", c) != c else 0
+        flags |= NORM_NFC_MAYBE if cp in maybe else 0
+        return flags
+
+    blocks, stage1, stage2 = {}, [], []
+    for first in range(0, 0x110000, CASE_BLOCK):
+        block = tuple(props(cp) for cp in range(first, first + CASE_BLOCK))
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    assert len(blocks) <= 256
+    keys = sorted(pairs)
+    return stage1, stage2, decomp, decompcps, keys, [pairs[k] for k in keys]
+
+
+def main():
+    print("/*")
+    print("Generated by tools/gentables.py, do not edit by hand.")
+    print("*/")
+    print()
+    print("#ifndef __DOOTSTR_TABLES_INC")
+    print("#define __DOOTSTR_TABLES_INC")
+    print()
+    print("#include <stdint.h>")
+    print()
+    emit_u64("__str_pow5_128", pow5_128(), "128-bit truncated powers of five from 5^-342 to 5^308, high word first")
+    emit_u64("__str_ryu_pow5", ryu_pow5_split(), "Powers of five for Ryu, 125 bits each, low word first")
+    emit_u64("__str_ryu_pow5inv", ryu_pow5_inv_split(), "Inverse powers of five for Ryu, 125 bits each, low word first")
+    print("#define STR_UNICODE_VERSION \"%s\"" % unicodedata.unidata_version)
+    print()
+    emit_u32("__str_asciiclass", [uniclass(cp) for cp in range(0x80)], "Character classes of ASCII code points")
+    emit_u32("__str_uniclass", uniclass_ranges(), "Character class ranges of the other code points, (first | class << 24, last) pairs")
+    stage1, stage2, records, specials = casing()
+    emit_ints("uint8_t", "__str_casestage1", stage1, "Case mapping block of every %d code points" % CASE_BLOCK)
+    emit_ints("uint16_t", "__str_casestage2", stage2, "Case mapping record of every code point of each block")
+    emit_ints("int32_t", "__str_caserecords", records, "Case mapping records, (upper, lower, fold) triples", per_line=12)
+    emit_u32("__str_casespecials", specials, "Code points of the mappings to several code points")
+    stage1, stage2, decomp, decompcps, compkeys, composites = normalization()
+    emit_ints("uint8_t", "__str_normstage1", stage1, "Normalization properties block of every %d code points" % CASE_BLOCK)
+    emit_ints("uint16_t", "__str_normstage2", stage2, "Normalization properties of every code point of each block, combining class | quick check bits")
+    emit_u32("__str_decomp", decomp, "Full canonical decompositions, (code point, offset | length << 16) pairs sorted by code point")
+    emit_u32("__str_decompcps", decompcps, "Code points of the canonical decompositions")
+    emit_u64("__str_compkeys", compkeys, "Primary composites, first << 21 | second, sorted")
+    emit_u32("__str_composites", composites, "Primary composites of __str_compkeys")
+    print("#endif")
+
+
+if __name__ == "__main__":
+    main()
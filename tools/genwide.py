@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""
+Generates dootwstr.c, which compiles dootstr.c a second time for wchar_t with every name prefixed by w (wstr_t, wstr_append, ...), so
+narrow and wide strings can be used side by side in one program.
+Run it from the repository root whenever a function or type is added to dootstr.c: python3 tools/genwide.py > dootwstr.c
+"""
+
+import re
+
+# Names that both instances share instead of getting a wide copy, dootstr.c defines them only once
+SHARED = {"str_err_t", "strerr"}
+# Switches of dootstr.c that have to be set differently while the wide instance is compiled
+SWITCHES = ["__DOOTSTR_INC", "DOOTSTR_USE_WCHAR", "DOOTSTR_USE_UTF8"]
+
+
+def strip(text):
+    """Removes comments, string and character literals and preprocessor lines, keeping the line breaks."""
+    text = re.sub(r"/\*.*?\*/", lambda m: "\n" * m.group(0).count("\n"), text, flags=re.S)
+    text = re.sub(r"//[^\n]*", "", text)
+    text = re.sub(r'"(\\.|[^"\\\n])*"', '""', text)
+    text = re.sub(r"'(\\.|[^'\\\n])*'", "''", text)
+    text = re.sub(r"\\\n", " ", text)
+    text = re.sub(r"__attribute__\s*\(\((?:[^()]|\([^()]*\))*\)\)", "", text)
+    return "\n".join("" if line.lstrip().startswith("#") else line for line in text.split("\n"))
+
+
+def toplevel(text):
+    """Yields the declarations at file scope as (text, is a function definition). Bodies are dropped, enumerations are kept."""
+    i, cur = 0, ""
+    while i < len(text):
+        c = text[i]
+        if c == "{":
+            depth, j = 1, i + 1
+            while depth:
+                depth += {"{": 1, "}": -1}.get(text[j], 0)
+                j += 1
+            if cur.rstrip().endswith(")"):
+                yield cur, True
+                cur = ""
+            else:
+                cur += "{" + (text[i + 1:j - 1] if re.search(r"\benum\s*\w*\s*$", cur) else "") + "}"
+            i = j
+            continue
+        if c == ";":
+            yield cur, False
+            cur = ""
+        else:
+            cur += c
+        i += 1
+
+
+def split_commas(decl):
+    """Splits a declaration into its declarators, ignoring commas inside brackets."""
+    out, cur, depth = [], "", 0
+    for c in decl:
+        depth += {"(": 1, "[": 1, "{": 1, ")": -1, "]": -1, "}": -1}.get(c, 0)
+        if c == "," and depth == 0:
+            out.append(cur)
+            cur = ""
+        else:
+            cur += c
+    return out + [cur]
+
+
+def declared_name(decl):
+    """Returns the identifier declared by a declarator (a function, a function pointer, an array or a plain variable)."""
+    decl = decl.split("=")[0]
+    m = re.match(r"[^(]*\(\s*\*\s*(\w+)\s*\)", decl)
+    if m:
+        return m.group(1)
+    m = re.match(r"([^()]*?)(\w+)\s*\(", decl)
+    if m and "[" not in m.group(1):
+        return m.group(2)
+    ids = re.findall(r"[A-Za-z_]\w*", re.sub(r"\[.*?\]", "", decl))
+    return ids[-1] if ids else None
+
+
+def file_names(path):
+    """Returns the names of the functions, variables, types and tags defined at file scope."""
+    names = set()
+    for decl, isfunc in toplevel(strip(open(path).read())):
+        decl = " ".join(decl.split())
+        if not decl:
+            continue
+        names.update(re.findall(r"\b(?:struct|enum|union)\s+(\w+)\s*\{", decl))
+        if decl.startswith("typedef"):
+            names.update(re.findall(r"\b(?:struct|enum|union)\s+(\w+)", decl))
+        decl = re.sub(r"\{[^{}]*\}", "", decl)
+        parts = [decl] if isfunc or decl.startswith("typedef") else split_commas(decl)
+        names.update(filter(None, map(declared_name, parts)))
+    return names
+
+
+def macros(path):
+    """Returns the macros defined by dootstr.c, and the ones among them with different definitions depending on the configuration."""
+    bodies = {}
+    for m in re.finditer(r"^\s*#\s*define\s+(\w+)(.*?)(?<!\\)$", open(path).read(), flags=re.M | re.S):
+        bodies.setdefault(m.group(1), set()).add(" ".join(m.group(2).split()))
+    return set(bodies), sorted(name for name, defs in bodies.items() if len(defs) > 1)
+
+
+def wide_name(name):
+    return "__w" + name[2:] if name.startswith("__") else "w" + name
+
+
+def main():
+    defined, varying = macros("dootstr.c")
+    names = sorted(file_names("dootstr.c") - file_names("dootstr_tables.h") - SHARED)
+    # Macros are saved and restored around the wide instance, so the narrow one keeps working after it
+    saved = SWITCHES + [name for name in varying if name not in SWITCHES] + sorted(defined & set(names))
+    print("/*")
+    print("Generated by tools/genwide.py, do not edit by hand.")
+    print("Include it after dootstr.c to get a wchar_t instance of the library next to the char one. Every name gets a w in front: wstr_t,")
+    print("wsarr_t, wstr_newfrom(), wstr_append_c(), ... The error codes (str_err_t) are shared.")
+    print("*/")
+    print()
+    print("#ifndef __DOOTWSTR_INC")
+    print("#define __DOOTWSTR_INC")
+    print()
+    print('#include "dootstr.c"')
+    print()
+    for name in saved:
+        print('#pragma push_macro("%s")' % name)
+        print("#undef %s" % name)
+    print("#define DOOTSTR_USE_WCHAR")
+    print()
+    for name in names:
+        print("#define %s %s" % (name, wide_name(name)))
+    print()
+    print('#include "dootstr.c"')
+    print()
+    for name in names:
+        print("#undef %s" % name)
+    for name in reversed(saved):
+        print("#undef %s" % name)
+        print('#pragma pop_macro("%s")' % name)
+    print()
+    print("#endif")
+
+
+if __name__ == "__main__":
+    main()